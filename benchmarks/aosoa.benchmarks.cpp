@@ -0,0 +1,273 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/aosoa.hpp>
+#include "tue.benchmarks.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include <tue/mat.hpp>
+#include <tue/quat.hpp>
+#include <tue/simd.hpp>
+#include <tue/soa_vector.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    constexpr int count = 4096;
+
+    // Gathers read from a larger array so that most of them miss the
+    // cache, which is where the layouts differ.
+    constexpr int gather_size = 1 << 18;
+    constexpr int gather_count = 1024;
+
+    // Each element type's streaming operation, which touches every
+    // element once in order.
+    struct stream_op
+    {
+        template<typename T>
+        vec3<T> operator()(const vec3<T>& v) const noexcept
+        {
+            return math::normalize(v);
+        }
+
+        template<typename T>
+        quat<T> operator()(const quat<T>& q) const noexcept
+        {
+            return math::normalize(q);
+        }
+
+        template<typename T>
+        mat3x3<T> operator()(const mat3x3<T>& m) const noexcept
+        {
+            return m * m;
+        }
+    };
+
+    template<typename V>
+    V initial_value(int i) noexcept
+    {
+        V value;
+        for (int k = 0; k < int(sizeof(V) / sizeof(float)); ++k)
+        {
+            value.data()[k] = float((i * 7 + k * 3) % 13 + 1);
+        }
+        return value;
+    }
+
+    template<typename A>
+    const A& gather_values()
+    {
+        static const A values = []
+        {
+            A result;
+            for (int i = 0; i < gather_size; ++i)
+            {
+                result.push_back(
+                    initial_value<typename A::value_type>(i));
+            }
+            return result;
+        }();
+        return values;
+    }
+
+    // Sums every component of pseudo-randomly chosen elements. The
+    // indices keep changing between iterations so they don't stay cached.
+    template<typename A>
+    void run_gather(const A& values, int iterations)
+    {
+        unsigned int x = 12345;
+        for (int i = 0; i < iterations; ++i)
+        {
+            float sum = 0.0f;
+            for (int j = 0; j < gather_count; ++j)
+            {
+                x = x * 1103515245u + 12345u;
+                const auto value = values[(x >> 8) % gather_size];
+                for (int k = 0; k < int(sizeof(value) / sizeof(float)); ++k)
+                {
+                    sum += value.data()[k];
+                }
+            }
+            tue::benchmarks::do_not_optimize(sum);
+        }
+    }
+
+    template<typename V>
+    void run_aos_gather(int iterations)
+    {
+        run_gather(gather_values<std::vector<V>>(), iterations);
+    }
+
+    template<typename V>
+    void run_soa_gather(int iterations)
+    {
+        struct indexed
+        {
+            const soa_vector<V>& values;
+
+            V operator[](std::size_t i) const noexcept
+            {
+                return values.get(i);
+            }
+        };
+
+        run_gather(indexed{ gather_values<soa_vector<V>>() }, iterations);
+    }
+
+    template<typename V>
+    void run_aosoa_gather(int iterations)
+    {
+        run_gather(gather_values<aosoa<V>>(), iterations);
+    }
+
+    template<typename V>
+    void run_aos_stream(int iterations)
+    {
+        std::vector<V> values;
+        for (int i = 0; i < count; ++i)
+        {
+            values.push_back(initial_value<V>(i));
+        }
+
+        for (int i = 0; i < iterations; ++i)
+        {
+            for (auto& v : values)
+            {
+                v = stream_op()(v);
+            }
+            tue::benchmarks::do_not_optimize(values[0]);
+        }
+    }
+
+    template<typename A>
+    void run_packet_stream(A& values, int iterations)
+    {
+        constexpr int W = aosoa<typename A::value_type>::block_width;
+        for (int i = 0; i < count; ++i)
+        {
+            values.push_back(initial_value<typename A::value_type>(i));
+        }
+
+        for (int i = 0; i < iterations; ++i)
+        {
+            values.template for_each_packet<W>([](const auto& p)
+            {
+                p.store(stream_op()(p.load()));
+            });
+            tue::benchmarks::do_not_optimize(values.get(0));
+        }
+    }
+
+    template<typename V>
+    void run_soa_stream(int iterations)
+    {
+        soa_vector<V> values;
+        run_packet_stream(values, iterations);
+    }
+
+    template<typename V>
+    void run_aosoa_stream(int iterations)
+    {
+        aosoa<V> values;
+        run_packet_stream(values, iterations);
+    }
+
+    BENCHMARK(fvec3_gather_aos)
+    {
+        run_aos_gather<fvec3>(iterations);
+    }
+
+    BENCHMARK(fvec3_gather_soa)
+    {
+        run_soa_gather<fvec3>(iterations);
+    }
+
+    BENCHMARK(fvec3_gather_aosoa)
+    {
+        run_aosoa_gather<fvec3>(iterations);
+    }
+
+    BENCHMARK(fvec3_stream_aos)
+    {
+        run_aos_stream<fvec3>(iterations);
+    }
+
+    BENCHMARK(fvec3_stream_soa)
+    {
+        run_soa_stream<fvec3>(iterations);
+    }
+
+    BENCHMARK(fvec3_stream_aosoa)
+    {
+        run_aosoa_stream<fvec3>(iterations);
+    }
+
+    BENCHMARK(fquat_gather_aos)
+    {
+        run_aos_gather<fquat>(iterations);
+    }
+
+    BENCHMARK(fquat_gather_soa)
+    {
+        run_soa_gather<fquat>(iterations);
+    }
+
+    BENCHMARK(fquat_gather_aosoa)
+    {
+        run_aosoa_gather<fquat>(iterations);
+    }
+
+    BENCHMARK(fquat_stream_aos)
+    {
+        run_aos_stream<fquat>(iterations);
+    }
+
+    BENCHMARK(fquat_stream_soa)
+    {
+        run_soa_stream<fquat>(iterations);
+    }
+
+    BENCHMARK(fquat_stream_aosoa)
+    {
+        run_aosoa_stream<fquat>(iterations);
+    }
+
+    BENCHMARK(fmat3x3_gather_aos)
+    {
+        run_aos_gather<fmat3x3>(iterations);
+    }
+
+    BENCHMARK(fmat3x3_gather_soa)
+    {
+        run_soa_gather<fmat3x3>(iterations);
+    }
+
+    BENCHMARK(fmat3x3_gather_aosoa)
+    {
+        run_aosoa_gather<fmat3x3>(iterations);
+    }
+
+    BENCHMARK(fmat3x3_stream_aos)
+    {
+        run_aos_stream<fmat3x3>(iterations);
+    }
+
+    BENCHMARK(fmat3x3_stream_soa)
+    {
+        run_soa_stream<fmat3x3>(iterations);
+    }
+
+    BENCHMARK(fmat3x3_stream_aosoa)
+    {
+        run_aosoa_stream<fmat3x3>(iterations);
+    }
+}
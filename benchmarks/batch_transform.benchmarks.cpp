@@ -0,0 +1,217 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/batch_transform.hpp>
+#include "tue.benchmarks.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <tue/cpu_features.hpp>
+#include <tue/mat.hpp>
+#include <tue/soa_vector.hpp>
+#include <tue/vec.hpp>
+
+// Every benchmark here transforms `iterations` points in total, cycling
+// through the same array, so the reported time is per point.
+namespace
+{
+    using namespace tue;
+
+    constexpr std::size_t small_count = 4096;
+    constexpr std::size_t large_count = std::size_t(1) << 22;
+
+    const fmat4x4 matrix(
+        fvec4(0.5f, 1.0f, 0.0f, 0.25f),
+        fvec4(-1.0f, 0.5f, 0.0f, 0.0f),
+        fvec4(0.0f, 0.25f, 2.0f, 0.125f),
+        fvec4(3.0f, -5.0f, 7.0f, 16.0f));
+
+    fvec3 initial_value(std::size_t i)
+    {
+        return fvec3(float(i % 7 + 1), float(i % 11 + 2), float(i % 13 + 3));
+    }
+
+    // The inputs and outputs are only allocated once per size so that
+    // the big ones don't spend most of their time in setup.
+    template<std::size_t Count>
+    const std::vector<fvec3>& aos_input()
+    {
+        static const auto values = []
+        {
+            std::vector<fvec3> v(Count);
+            for (std::size_t i = 0; i < Count; ++i)
+            {
+                v[i] = initial_value(i);
+            }
+            return v;
+        }();
+        return values;
+    }
+
+    template<std::size_t Count>
+    std::vector<fvec3>& aos_output()
+    {
+        static std::vector<fvec3> values(Count);
+        return values;
+    }
+
+    template<std::size_t Count>
+    const soa_vector<fvec3>& soa_input()
+    {
+        static const auto values = []
+        {
+            soa_vector<fvec3> v(Count);
+            for (std::size_t i = 0; i < Count; ++i)
+            {
+                v.set(i, initial_value(i));
+            }
+            return v;
+        }();
+        return values;
+    }
+
+    template<std::size_t Count>
+    soa_vector<fvec3>& soa_output()
+    {
+        static soa_vector<fvec3> values(Count);
+        return values;
+    }
+
+    // Calls `f(count)` with batch sizes adding up to `iterations`.
+    template<typename F>
+    void for_each_batch(int iterations, std::size_t count, F f)
+    {
+        auto remaining = std::size_t(iterations);
+        while (remaining > 0)
+        {
+            const auto n = std::min(remaining, count);
+            f(n);
+            remaining -= n;
+        }
+    }
+
+    template<std::size_t Count>
+    void run_scalar(int iterations)
+    {
+        const auto& in = aos_input<Count>();
+        auto& out = aos_output<Count>();
+        for_each_batch(iterations, Count, [&](std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                out[i] = fvec3(matrix * fvec4(in[i], 1.0f));
+            }
+            tue::benchmarks::do_not_optimize(out[0]);
+        });
+    }
+
+    template<std::size_t Count>
+    void run_aos(int iterations)
+    {
+        const auto& in = aos_input<Count>();
+        auto& out = aos_output<Count>();
+        for_each_batch(iterations, Count, [&](std::size_t n)
+        {
+            transform_points(matrix, in.data(), out.data(), n);
+            tue::benchmarks::do_not_optimize(out[0]);
+        });
+    }
+
+    template<std::size_t Count>
+    void run_soa(int iterations)
+    {
+        const auto& in = soa_input<Count>();
+        auto& out = soa_output<Count>();
+        for_each_batch(iterations, Count, [&](std::size_t n)
+        {
+            // Only whole arrays are transformed so that big ones stream.
+            // The iteration counts are powers of two, so that's all of
+            // them once there are enough iterations to measure.
+            if (n == Count)
+            {
+                transform_points(matrix, in, out);
+                tue::benchmarks::do_not_optimize(*out.stream(0));
+            }
+        });
+    }
+
+    // Runs the AoS kernel for `target` (or the best one the CPU supports
+    // if it's less capable) directly.
+    void run_kernel(int iterations, simd_target target)
+    {
+        const auto kernel = tue::select_kernel(
+            tue::detail_::transform3_kernels<float, false, false>::get(),
+            std::min(target, best_simd_target()));
+        const auto& in = aos_input<small_count>();
+        auto& out = aos_output<small_count>();
+        for_each_batch(iterations, small_count, [&](std::size_t n)
+        {
+            kernel(matrix.data(), in.data()->data(), 0,
+                out.data()->data(), 0, n, false);
+            tue::benchmarks::do_not_optimize(out[0]);
+        });
+    }
+
+    BENCHMARK(transform_points_scalar_4k)
+    {
+        run_scalar<small_count>(iterations);
+    }
+
+    BENCHMARK(transform_points_aos_4k)
+    {
+        run_aos<small_count>(iterations);
+    }
+
+    BENCHMARK(transform_points_soa_4k)
+    {
+        run_soa<small_count>(iterations);
+    }
+
+    BENCHMARK(transform_points_generic_4k)
+    {
+        run_kernel(iterations, simd_target::generic);
+    }
+
+    BENCHMARK(transform_points_avx_4k)
+    {
+        run_kernel(iterations, simd_target::avx);
+    }
+
+    BENCHMARK(transform_points_avx2_4k)
+    {
+        run_kernel(iterations, simd_target::avx2);
+    }
+
+    BENCHMARK(project_points_aos_4k)
+    {
+        const auto& in = aos_input<small_count>();
+        auto& out = aos_output<small_count>();
+        for_each_batch(iterations, small_count, [&](std::size_t n)
+        {
+            project_points(matrix, in.data(), out.data(), n);
+            tue::benchmarks::do_not_optimize(out[0]);
+        });
+    }
+
+    BENCHMARK(transform_points_scalar_4m)
+    {
+        run_scalar<large_count>(iterations);
+    }
+
+    BENCHMARK(transform_points_aos_4m)
+    {
+        run_aos<large_count>(iterations);
+    }
+
+    BENCHMARK(transform_points_soa_4m)
+    {
+        run_soa<large_count>(iterations);
+    }
+}
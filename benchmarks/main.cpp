@@ -0,0 +1,62 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include "tue.benchmarks.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    using clock_type = std::chrono::steady_clock;
+
+    double run(const tue::benchmarks::benchmark& b, int iterations)
+    {
+        const auto start = clock_type::now();
+        b.function(iterations);
+        const auto stop = clock_type::now();
+        return std::chrono::duration<double, std::nano>(stop - start).count();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // Each benchmark runs with a doubling iteration count until it takes at
+    // least 100 ms, and the time per iteration is reported. It's called
+    // once with no iterations beforehand so that one-time setup in function
+    // statics isn't timed. Arguments, if any, select benchmarks whose names
+    // contain one of them.
+    for (const auto& b : tue::benchmarks::registry())
+    {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc; ++i)
+        {
+            selected = selected || std::strstr(b.name, argv[i]) != nullptr;
+        }
+
+        if (!selected)
+        {
+            continue;
+        }
+
+        b.function(0);
+
+        int iterations = 1;
+        double ns = run(b, iterations);
+        while (ns < 1e8 && iterations < (1 << 30))
+        {
+            iterations *= 2;
+            ns = run(b, iterations);
+        }
+
+        std::printf("%-48s %10.3f ns\n", b.name, ns / iterations);
+    }
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/parallel_for.hpp>
+#include "tue.benchmarks.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include <tue/batch_transform.hpp>
+#include <tue/mat.hpp>
+#include <tue/soa_vector.hpp>
+#include <tue/vec.hpp>
+
+// The transform benchmarks time `iterations` points in total, as in
+// batch_transform.benchmarks.cpp, so the reported time is per point. The
+// `_tN` suffix is the `thread_pool`'s concurrency.
+namespace
+{
+    using namespace tue;
+
+    constexpr std::size_t count = std::size_t(1) << 22;
+
+    const fmat4x4 matrix(
+        fvec4(0.5f, 1.0f, 0.0f, 0.25f),
+        fvec4(-1.0f, 0.5f, 0.0f, 0.0f),
+        fvec4(0.0f, 0.25f, 2.0f, 0.125f),
+        fvec4(3.0f, -5.0f, 7.0f, 16.0f));
+
+    template<int Concurrency>
+    thread_pool& pool()
+    {
+        static thread_pool p(Concurrency);
+        return p;
+    }
+
+    fvec3 initial_value(std::size_t i)
+    {
+        return fvec3(float(i % 7 + 1), float(i % 11 + 2), float(i % 13 + 3));
+    }
+
+    const std::vector<fvec3>& aos_input()
+    {
+        static const auto values = []
+        {
+            std::vector<fvec3> v(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                v[i] = initial_value(i);
+            }
+            return v;
+        }();
+        return values;
+    }
+
+    const soa_vector<fvec3>& soa_input()
+    {
+        static const auto values = []
+        {
+            soa_vector<fvec3> v(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                v.set(i, initial_value(i));
+            }
+            return v;
+        }();
+        return values;
+    }
+
+    // Only whole arrays are transformed. The iteration counts are powers
+    // of two, so that's all of them once there are enough to measure.
+    template<int Concurrency>
+    void run_aos(int iterations)
+    {
+        const auto& in = aos_input();
+        static std::vector<fvec3> out(count);
+        for (auto i = std::size_t(iterations); i >= count; i -= count)
+        {
+            transform_points(
+                pool<Concurrency>(), matrix, in.data(), out.data(), count);
+            tue::benchmarks::do_not_optimize(out[0]);
+        }
+    }
+
+    template<int Concurrency>
+    void run_soa(int iterations)
+    {
+        const auto& in = soa_input();
+        static soa_vector<fvec3> out(count);
+        for (auto i = std::size_t(iterations); i >= count; i -= count)
+        {
+            transform_points(pool<Concurrency>(), matrix, in, out);
+            tue::benchmarks::do_not_optimize(*out.stream(0));
+        }
+    }
+
+    // One chunk per iteration with nothing in it, so the time is the
+    // scheduling overhead per chunk. A concurrency of 1 would run the whole
+    // range as a single chunk, so there's no `_t1`.
+    template<int Concurrency>
+    void run_empty(int iterations)
+    {
+        std::atomic<std::size_t> chunks{ 0 };
+        pool<Concurrency>().parallel_for(0, std::size_t(iterations), 1,
+            [&chunks](std::size_t, std::size_t)
+        {
+            chunks.fetch_add(1, std::memory_order_relaxed);
+        });
+        tue::benchmarks::do_not_optimize(chunks);
+    }
+
+    BENCHMARK(parallel_for_empty_t2)
+    {
+        run_empty<2>(iterations);
+    }
+
+    BENCHMARK(parallel_for_empty_t4)
+    {
+        run_empty<4>(iterations);
+    }
+
+    BENCHMARK(transform_points_aos_4m_t1)
+    {
+        run_aos<1>(iterations);
+    }
+
+    BENCHMARK(transform_points_aos_4m_t2)
+    {
+        run_aos<2>(iterations);
+    }
+
+    BENCHMARK(transform_points_aos_4m_t4)
+    {
+        run_aos<4>(iterations);
+    }
+
+    BENCHMARK(transform_points_aos_4m_t8)
+    {
+        run_aos<8>(iterations);
+    }
+
+    BENCHMARK(transform_points_soa_4m_t1)
+    {
+        run_soa<1>(iterations);
+    }
+
+    BENCHMARK(transform_points_soa_4m_t2)
+    {
+        run_soa<2>(iterations);
+    }
+
+    BENCHMARK(transform_points_soa_4m_t4)
+    {
+        run_soa<4>(iterations);
+    }
+
+    BENCHMARK(transform_points_soa_4m_t8)
+    {
+        run_soa<8>(iterations);
+    }
+}
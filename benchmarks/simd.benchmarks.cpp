@@ -0,0 +1,554 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/simd.hpp>
+#include "tue.benchmarks.hpp"
+
+#include <cstdint>
+#include <utility>
+
+namespace
+{
+    using namespace tue;
+
+    template<typename T, int N, typename F>
+    void run_binary(int iterations, F f)
+    {
+        constexpr int count = 64;
+        using result_type = decltype(f(simd<T, N>(), simd<T, N>()));
+        static simd<T, N> lhs[count];
+        static simd<T, N> rhs[count];
+        static result_type results[count];
+        for (int i = 0; i < count; ++i)
+        {
+            for (int j = 0; j < N; ++j)
+            {
+                lhs[i].data()[j] = static_cast<T>((i * N + j) * 7 + 1);
+                rhs[i].data()[j] = static_cast<T>((i * N + j) * 3 + 1);
+            }
+        }
+
+        for (int i = 0; i < iterations; ++i)
+        {
+            for (int j = 0; j < count; ++j)
+            {
+                results[j] = f(lhs[j], rhs[j]);
+            }
+            tue::benchmarks::do_not_optimize(results);
+        }
+    }
+
+    // Passing explicit template arguments to the detail_ functions selects
+    // the generic per-component implementations instead of the specialized
+    // overloads, which gives a baseline to compare against.
+
+    BENCHMARK(int8x16_multiplication)
+    {
+        run_binary<std::int8_t, 16>(iterations,
+            [](const int8x16& lhs, const int8x16& rhs)
+            {
+                return lhs * rhs;
+            });
+    }
+
+    BENCHMARK(int8x16_multiplication_generic)
+    {
+        run_binary<std::int8_t, 16>(iterations,
+            [](const int8x16& lhs, const int8x16& rhs)
+            {
+                return tue::detail_::multiplication_operator_ss<
+                    std::int8_t, 16>(lhs, rhs);
+            });
+    }
+
+    BENCHMARK(uint8x16_multiplication)
+    {
+        run_binary<std::uint8_t, 16>(iterations,
+            [](const uint8x16& lhs, const uint8x16& rhs)
+            {
+                return lhs * rhs;
+            });
+    }
+
+    BENCHMARK(uint8x16_multiplication_generic)
+    {
+        run_binary<std::uint8_t, 16>(iterations,
+            [](const uint8x16& lhs, const uint8x16& rhs)
+            {
+                return tue::detail_::multiplication_operator_ss<
+                    std::uint8_t, 16>(lhs, rhs);
+            });
+    }
+
+    BENCHMARK(uint8x16_adds)
+    {
+        run_binary<std::uint8_t, 16>(iterations,
+            [](const uint8x16& lhs, const uint8x16& rhs)
+            {
+                return math::avg(math::adds(lhs, rhs), math::subs(lhs, rhs));
+            });
+    }
+
+    BENCHMARK(uint8x16_adds_generic)
+    {
+        run_binary<std::uint8_t, 16>(iterations,
+            [](const uint8x16& lhs, const uint8x16& rhs)
+            {
+                using tue::detail_::adds_ss;
+                using tue::detail_::avg_ss;
+                using tue::detail_::subs_ss;
+                return avg_ss<std::uint8_t, 16>(
+                    adds_ss<std::uint8_t, 16>(lhs, rhs),
+                    subs_ss<std::uint8_t, 16>(lhs, rhs));
+            });
+    }
+
+    BENCHMARK(int32x4_multiplication)
+    {
+        run_binary<std::int32_t, 4>(iterations,
+            [](const int32x4& lhs, const int32x4& rhs)
+            {
+                return lhs * rhs;
+            });
+    }
+
+    BENCHMARK(int32x4_multiplication_generic)
+    {
+        run_binary<std::int32_t, 4>(iterations,
+            [](const int32x4& lhs, const int32x4& rhs)
+            {
+                return tue::detail_::multiplication_operator_ss<
+                    std::int32_t, 4>(lhs, rhs);
+            });
+    }
+
+    BENCHMARK(int32x4_division)
+    {
+        run_binary<std::int32_t, 4>(iterations,
+            [](const int32x4& lhs, const int32x4& rhs)
+            {
+                return lhs / rhs;
+            });
+    }
+
+    BENCHMARK(int32x4_division_generic)
+    {
+        run_binary<std::int32_t, 4>(iterations,
+            [](const int32x4& lhs, const int32x4& rhs)
+            {
+                return tue::detail_::division_operator_ss<
+                    std::int32_t, 4>(lhs, rhs);
+            });
+    }
+
+    BENCHMARK(int64x2_multiplication)
+    {
+        run_binary<std::int64_t, 2>(iterations,
+            [](const int64x2& lhs, const int64x2& rhs)
+            {
+                return lhs * rhs;
+            });
+    }
+
+    BENCHMARK(int64x2_multiplication_generic)
+    {
+        run_binary<std::int64_t, 2>(iterations,
+            [](const int64x2& lhs, const int64x2& rhs)
+            {
+                return tue::detail_::multiplication_operator_ss<
+                    std::int64_t>(lhs, rhs);
+            });
+    }
+
+    BENCHMARK(uint64x2_multiplication)
+    {
+        run_binary<std::uint64_t, 2>(iterations,
+            [](const uint64x2& lhs, const uint64x2& rhs)
+            {
+                return lhs * rhs;
+            });
+    }
+
+    BENCHMARK(uint64x2_multiplication_generic)
+    {
+        run_binary<std::uint64_t, 2>(iterations,
+            [](const uint64x2& lhs, const uint64x2& rhs)
+            {
+                return tue::detail_::multiplication_operator_ss<
+                    std::uint64_t>(lhs, rhs);
+            });
+    }
+
+    BENCHMARK(int64x2_less)
+    {
+        run_binary<std::int64_t, 2>(iterations,
+            [](const int64x2& lhs, const int64x2& rhs)
+            {
+                return math::less(lhs, rhs);
+            });
+    }
+
+    BENCHMARK(int64x2_less_generic)
+    {
+        run_binary<std::int64_t, 2>(iterations,
+            [](const int64x2& lhs, const int64x2& rhs)
+            {
+                return tue::detail_::less_ss<std::int64_t>(lhs, rhs);
+            });
+    }
+
+    BENCHMARK(uint64x2_less)
+    {
+        run_binary<std::uint64_t, 2>(iterations,
+            [](const uint64x2& lhs, const uint64x2& rhs)
+            {
+                return math::less(lhs, rhs);
+            });
+    }
+
+    BENCHMARK(uint64x2_less_generic)
+    {
+        run_binary<std::uint64_t, 2>(iterations,
+            [](const uint64x2& lhs, const uint64x2& rhs)
+            {
+                return tue::detail_::less_ss<std::uint64_t>(lhs, rhs);
+            });
+    }
+
+    BENCHMARK(float64x2_sin)
+    {
+        run_binary<double, 2>(iterations,
+            [](const float64x2& lhs, const float64x2& rhs)
+            {
+                return math::sin(lhs + rhs);
+            });
+    }
+
+    BENCHMARK(float64x2_sin_generic)
+    {
+        run_binary<double, 2>(iterations,
+            [](const float64x2& lhs, const float64x2& rhs)
+            {
+                return tue::detail_::sin_s<double>(lhs + rhs);
+            });
+    }
+
+    BENCHMARK(float64x2_exp)
+    {
+        run_binary<double, 2>(iterations,
+            [](const float64x2& lhs, const float64x2& rhs)
+            {
+                return math::exp(lhs - rhs);
+            });
+    }
+
+    BENCHMARK(float64x2_exp_generic)
+    {
+        run_binary<double, 2>(iterations,
+            [](const float64x2& lhs, const float64x2& rhs)
+            {
+                return tue::detail_::exp_s<double>(lhs - rhs);
+            });
+    }
+
+    BENCHMARK(float64x2_log)
+    {
+        run_binary<double, 2>(iterations,
+            [](const float64x2& lhs, const float64x2& rhs)
+            {
+                return math::log(lhs + rhs);
+            });
+    }
+
+    BENCHMARK(float64x2_log_generic)
+    {
+        run_binary<double, 2>(iterations,
+            [](const float64x2& lhs, const float64x2& rhs)
+            {
+                return tue::detail_::log_s<double>(lhs + rhs);
+            });
+    }
+
+    BENCHMARK(float64x2_pow)
+    {
+        run_binary<double, 2>(iterations,
+            [](const float64x2& lhs, const float64x2& rhs)
+            {
+                return math::pow(lhs, rhs / lhs);
+            });
+    }
+
+    BENCHMARK(float64x2_pow_generic)
+    {
+        run_binary<double, 2>(iterations,
+            [](const float64x2& lhs, const float64x2& rhs)
+            {
+                return tue::detail_::pow_ss<double>(lhs, rhs / lhs);
+            });
+    }
+
+    BENCHMARK(float64x2_atan2)
+    {
+        run_binary<double, 2>(iterations,
+            [](const float64x2& lhs, const float64x2& rhs)
+            {
+                return math::atan2(lhs, rhs);
+            });
+    }
+
+    BENCHMARK(float64x2_atan2_generic)
+    {
+        run_binary<double, 2>(iterations,
+            [](const float64x2& lhs, const float64x2& rhs)
+            {
+                return tue::detail_::atan2_ss<double>(lhs, rhs);
+            });
+    }
+
+    BENCHMARK(float64x2_cbrt)
+    {
+        run_binary<double, 2>(iterations,
+            [](const float64x2& lhs, const float64x2& rhs)
+            {
+                return math::cbrt(lhs - rhs);
+            });
+    }
+
+    BENCHMARK(float64x2_cbrt_generic)
+    {
+        run_binary<double, 2>(iterations,
+            [](const float64x2& lhs, const float64x2& rhs)
+            {
+                return tue::detail_::cbrt_s<double>(lhs - rhs);
+            });
+    }
+
+    BENCHMARK(float32x4_reduce_add)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4& rhs)
+            {
+                return math::reduce_add(lhs * rhs);
+            });
+    }
+
+    BENCHMARK(float32x4_reduce_add_generic)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4& rhs)
+            {
+                return tue::detail_::reduce_add_s<float>(lhs * rhs);
+            });
+    }
+
+    BENCHMARK(float32x4_shuffle)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4& rhs)
+            {
+                return shuffle<0, 4, 1, 5>(lhs, rhs)
+                    * shuffle<3, 2, 1, 0>(rhs);
+            });
+    }
+
+    BENCHMARK(float32x4_shuffle_generic)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4& rhs)
+            {
+                return tue::detail_::shuffle_ss<float, 4>(
+                    lhs, rhs, std::integer_sequence<int, 0, 4, 1, 5>())
+                    * tue::detail_::shuffle_s<float, 4>(
+                        rhs, std::integer_sequence<int, 3, 2, 1, 0>());
+            });
+    }
+
+    const float* gather_table() noexcept
+    {
+        static float table[1024];
+        for (int i = 0; i < 1024; ++i)
+        {
+            table[i] = static_cast<float>(i);
+        }
+        return table;
+    }
+
+    BENCHMARK(float32x4_gather)
+    {
+        const float* const table = gather_table();
+        run_binary<std::int32_t, 4>(iterations,
+            [table](const int32x4& lhs, const int32x4& rhs)
+            {
+                return float32x4::gather(
+                    table, (lhs ^ rhs) & int32x4(1023));
+            });
+    }
+
+    BENCHMARK(float32x4_gather_generic)
+    {
+        const float* const table = gather_table();
+        run_binary<std::int32_t, 4>(iterations,
+            [table](const int32x4& lhs, const int32x4& rhs)
+            {
+                return tue::detail_::gather_components<float32x4>(
+                    table, (lhs ^ rhs) & int32x4(1023));
+            });
+    }
+
+    BENCHMARK(bool32x4_any)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4& rhs)
+            {
+                return math::any(math::less(lhs, rhs));
+            });
+    }
+
+    BENCHMARK(bool32x4_any_generic)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4& rhs)
+            {
+                return tue::detail_::any_s<bool32>(math::less(lhs, rhs));
+            });
+    }
+
+    BENCHMARK(float32x4_exp_fast)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4& rhs)
+            {
+                return math::fast::exp(rhs / lhs);
+            });
+    }
+
+    BENCHMARK(float32x4_exp)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4& rhs)
+            {
+                return math::exp(rhs / lhs);
+            });
+    }
+
+    BENCHMARK(float32x4_exp_precise)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4& rhs)
+            {
+                return math::precise::exp(rhs / lhs);
+            });
+    }
+
+    BENCHMARK(float32x4_pow_fast)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4& rhs)
+            {
+                return math::fast::pow(lhs, rhs / lhs);
+            });
+    }
+
+    BENCHMARK(float32x4_pow)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4& rhs)
+            {
+                return math::pow(lhs, rhs / lhs);
+            });
+    }
+
+    BENCHMARK(float32x4_pow_precise)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4& rhs)
+            {
+                return math::precise::pow(lhs, rhs / lhs);
+            });
+    }
+
+    BENCHMARK(float32x4_rsqrt_fast)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4&)
+            {
+                return math::fast::rsqrt(lhs);
+            });
+    }
+
+    BENCHMARK(float32x4_rsqrt)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4&)
+            {
+                return math::rsqrt(lhs);
+            });
+    }
+
+    BENCHMARK(float32x4_rsqrt_precise)
+    {
+        run_binary<float, 4>(iterations,
+            [](const float32x4& lhs, const float32x4&)
+            {
+                return math::precise::rsqrt(lhs);
+            });
+    }
+
+    // Wide composites should compile to the same code as looping over the
+    // native registers by hand.
+
+    BENCHMARK(float32x64_multiply_add)
+    {
+        run_binary<float, 64>(iterations,
+            [](const simd64<float>& lhs, const simd64<float>& rhs)
+            {
+                return lhs * rhs + lhs;
+            });
+    }
+
+    BENCHMARK(float32x64_multiply_add_loop)
+    {
+        run_binary<float, 64>(iterations,
+            [](const simd64<float>& lhs, const simd64<float>& rhs)
+            {
+                simd64<float> result;
+                for (int i = 0; i < 64; i += 4)
+                {
+                    const auto l = float32x4::load(lhs.data() + i);
+                    const auto r = float32x4::load(rhs.data() + i);
+                    (l * r + l).store(result.data() + i);
+                }
+                return result;
+            });
+    }
+
+    BENCHMARK(int8x64_less)
+    {
+        run_binary<std::int8_t, 64>(iterations,
+            [](const int8x64& lhs, const int8x64& rhs)
+            {
+                return math::less(lhs, rhs);
+            });
+    }
+
+    BENCHMARK(int8x64_less_loop)
+    {
+        run_binary<std::int8_t, 64>(iterations,
+            [](const int8x64& lhs, const int8x64& rhs)
+            {
+                bool8x64 result;
+                for (int i = 0; i < 64; i += 16)
+                {
+                    const auto l = int8x16::load(lhs.data() + i);
+                    const auto r = int8x16::load(rhs.data() + i);
+                    math::less(l, r).store(result.data() + i);
+                }
+                return result;
+            });
+    }
+}
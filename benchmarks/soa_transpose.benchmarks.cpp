@@ -0,0 +1,135 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/soa_transpose.hpp>
+#include "tue.benchmarks.hpp"
+
+#include <tue/mat.hpp>
+#include <tue/simd.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    constexpr int count = 1024;
+
+    // Calls `f` on each group of `W` of `count` elements, which is
+    // expected to convert them to SoA and back.
+    template<typename V, int W, typename F>
+    void run_round_trip(int iterations, F f)
+    {
+        static V values[count];
+        for (int i = 0; i < count; ++i)
+        {
+            for (int k = 0; k < int(sizeof(V) / sizeof(float)); ++k)
+            {
+                values[i].data()[k] = float(i + k);
+            }
+        }
+
+        for (int i = 0; i < iterations; ++i)
+        {
+            for (int j = 0; j < count; j += W)
+            {
+                f(values[j].data());
+            }
+            tue::benchmarks::do_not_optimize(values);
+        }
+    }
+
+    template<int W>
+    void run_fvec3(int iterations)
+    {
+        run_round_trip<fvec3, W>(iterations, [](float* p)
+        {
+            const auto h = simd<float, W>(0.5f);
+            auto v = load_soa<W>(reinterpret_cast<fvec3*>(p));
+            store_aos(v * h, reinterpret_cast<fvec3*>(p));
+        });
+    }
+
+    template<int W>
+    void run_fvec3_generic(int iterations)
+    {
+        run_round_trip<fvec3, W>(iterations, [](float* p)
+        {
+            const auto h = simd<float, W>(0.5f);
+            simd<float, W> x, y, z;
+            tue::detail_::load_soa3<float, W>(p, x, y, z);
+            tue::detail_::store_aos3<float, W>(p, x * h, y * h, z * h);
+        });
+    }
+
+    template<int W>
+    void run_fmat4x4(int iterations)
+    {
+        run_round_trip<fmat4x4, W>(iterations, [](float* p)
+        {
+            const auto h = simd<float, W>(0.5f);
+            auto m = load_soa<W>(reinterpret_cast<fmat4x4*>(p));
+            store_aos(m * h, reinterpret_cast<fmat4x4*>(p));
+        });
+    }
+
+    template<int W>
+    void run_fmat4x4_generic(int iterations)
+    {
+        run_round_trip<fmat4x4, W>(iterations, [](float* p)
+        {
+            const auto h = simd<float, W>(0.5f);
+            for (int c = 0; c < 4; ++c)
+            {
+                simd<float, W> x, y, z, w;
+                tue::detail_::load_soa4<float, W>(p + c * 4, 16, x, y, z, w);
+                tue::detail_::store_aos4<float, W>(
+                    p + c * 4, 16, x * h, y * h, z * h, w * h);
+            }
+        });
+    }
+
+    BENCHMARK(fvec3_soa_round_trip4)
+    {
+        run_fvec3<4>(iterations);
+    }
+
+    BENCHMARK(fvec3_soa_round_trip4_generic)
+    {
+        run_fvec3_generic<4>(iterations);
+    }
+
+    BENCHMARK(fvec3_soa_round_trip8)
+    {
+        run_fvec3<8>(iterations);
+    }
+
+    BENCHMARK(fvec3_soa_round_trip8_generic)
+    {
+        run_fvec3_generic<8>(iterations);
+    }
+
+    BENCHMARK(fmat4x4_soa_round_trip4)
+    {
+        run_fmat4x4<4>(iterations);
+    }
+
+    BENCHMARK(fmat4x4_soa_round_trip4_generic)
+    {
+        run_fmat4x4_generic<4>(iterations);
+    }
+
+    BENCHMARK(fmat4x4_soa_round_trip8)
+    {
+        run_fmat4x4<8>(iterations);
+    }
+
+    BENCHMARK(fmat4x4_soa_round_trip8_generic)
+    {
+        run_fmat4x4_generic<8>(iterations);
+    }
+}
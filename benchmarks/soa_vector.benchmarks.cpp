@@ -0,0 +1,77 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/soa_vector.hpp>
+#include "tue.benchmarks.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include <tue/simd.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    constexpr int count = 4096;
+
+    fvec3 initial_value(int i)
+    {
+        return fvec3(float(i % 7 + 1), float(i % 11 + 2), float(i % 13 + 3));
+    }
+
+    template<int W>
+    void run_soa_normalize(int iterations)
+    {
+        static soa_vector<fvec3> values;
+        values.clear();
+        for (int i = 0; i < count; ++i)
+        {
+            values.push_back(initial_value(i));
+        }
+
+        for (int i = 0; i < iterations; ++i)
+        {
+            values.for_each_packet<W>([](const auto& p)
+            {
+                p.store(math::normalize(p.load()));
+            });
+            tue::benchmarks::do_not_optimize(*values.stream(0));
+        }
+    }
+
+    BENCHMARK(fvec3_normalize_aos)
+    {
+        static std::vector<fvec3> values;
+        values.clear();
+        for (int i = 0; i < count; ++i)
+        {
+            values.push_back(initial_value(i));
+        }
+
+        for (int i = 0; i < iterations; ++i)
+        {
+            for (auto& v : values)
+            {
+                v = math::normalize(v);
+            }
+            tue::benchmarks::do_not_optimize(values[0]);
+        }
+    }
+
+    BENCHMARK(fvec3_normalize_soa4)
+    {
+        run_soa_normalize<4>(iterations);
+    }
+
+    BENCHMARK(fvec3_normalize_soa8)
+    {
+        run_soa_normalize<8>(iterations);
+    }
+}
@@ -0,0 +1,62 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <vector>
+
+namespace tue
+{
+    namespace benchmarks
+    {
+        struct benchmark
+        {
+            const char* name;
+            void (*function)(int iterations);
+        };
+
+        inline std::vector<benchmark>& registry() noexcept
+        {
+            static std::vector<benchmark> benchmarks;
+            return benchmarks;
+        }
+
+        struct benchmark_registrar
+        {
+            benchmark_registrar(
+                const char* name, void (*function)(int iterations))
+            {
+                registry().push_back({ name, function });
+            }
+        };
+
+        template<typename T>
+        inline void do_not_optimize(const T& value) noexcept
+        {
+            // Reading value through an opaque asm statement (or a volatile
+            // on other compilers) keeps the loop that computed it from
+            // being thrown away.
+#ifdef __GNUC__
+            asm volatile("" : : "m"(value) : "memory");
+#else
+            static volatile char sink;
+            sink = *reinterpret_cast<const volatile char*>(&value);
+#endif
+        }
+    }
+}
+
+#define TUE_BENCHMARK_CAT2(a, b) a##b
+#define TUE_BENCHMARK_CAT(a, b) TUE_BENCHMARK_CAT2(a, b)
+
+#define BENCHMARK(name) \
+    static void TUE_BENCHMARK_CAT(benchmark_, name)(int iterations); \
+    static ::tue::benchmarks::benchmark_registrar \
+    TUE_BENCHMARK_CAT(benchmark_registrar_, name)( \
+        #name, &TUE_BENCHMARK_CAT(benchmark_, name)); \
+    static void TUE_BENCHMARK_CAT(benchmark_, name)(int iterations)
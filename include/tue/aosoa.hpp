@@ -0,0 +1,685 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include "simd.hpp"
+#include "soa_vector.hpp"
+
+namespace tue
+{
+    /*!
+     * \defgroup  aosoa_hpp <tue/aosoa.hpp>
+     *
+     * \brief     The `aosoa` class template.
+     * \details   An `aosoa<vec3<float>, 8>` stores its elements in blocks of
+     *            eight: eight x's, then eight y's, then eight z's, then the
+     *            next block. Each block can be loaded as a
+     *            `vec3<simd<float, 8>>` with one aligned load per component
+     *            like a `soa_vector`, while every component of a single
+     *            element stays within the same few cache lines like an
+     *            array of `vec3<float>`'s.
+     *
+     * @{
+     */
+
+    template<typename V, int W>
+    class aosoa;
+
+    /*!@}*/
+
+    namespace detail_
+    {
+        // The default block width of an `aosoa`: the widest accelerated
+        // `simd` type for its component type.
+        template<typename V>
+        inline constexpr int aosoa_width() noexcept
+        {
+            return tue::detail_::simd_chunk_width<
+                typename soa_traits<V>::component_type, 64>();
+        }
+    }
+
+    /*!
+     * \addtogroup  aosoa_hpp
+     * @{
+     */
+
+    /*!
+     * \brief     A dynamically-sized array of `vec`'s, `quat`'s, or `mat`'s
+     *            stored as an array of structures of arrays.
+     * \details   Each block of `W` elements holds `W` of their first
+     *            components, then `W` of their second components, and so
+     *            on. Since the components of an element aren't adjacent in
+     *            memory, `operator[]` returns a proxy `reference` rather
+     *            than a `V&`. The last block is always stored whole, so
+     *            packets never run past the end of the array; the padding
+     *            past `size()` is never observable through any other member
+     *            function.
+     *
+     * \tparam V  The element type. Must be a `vec`, `quat`, or `mat` type
+     *            whose component type is an arithmetic `simd` component
+     *            type.
+     * \tparam W  The number of elements per block. Defaults to the
+     *            component count of the widest accelerated `simd` type for
+     *            `V`'s component type.
+     */
+    template<typename V, int W = tue::detail_::aosoa_width<V>()>
+    class aosoa
+    {
+        using traits = tue::detail_::soa_traits<V>;
+
+        using T = typename traits::component_type;
+
+        static_assert(
+            is_arithmetic_simd_component<T>::value,
+            "aosoa requires an arithmetic simd component type");
+
+        static_assert(
+            W == 2 || W == 4 || W == 8 || W == 16 || W == 32 || W == 64,
+            "aosoa requires a simd component count for W");
+
+        // Every block starts on this boundary.
+        static constexpr std::size_t block_alignment = alignof(simd<T, W>);
+
+        void* allocation_ = nullptr;
+        T* blocks_ = nullptr;
+        std::size_t size_ = 0;
+        std::size_t capacity_ = 0;
+
+        static std::size_t block_count(std::size_t count) noexcept
+        {
+            return (count + W - 1) / W;
+        }
+
+        void reallocate(std::size_t capacity)
+        {
+            const std::size_t bytes = capacity * stream_count * sizeof(T);
+            void* allocation = ::operator new(bytes + block_alignment - 1);
+            const auto address =
+                (reinterpret_cast<std::uintptr_t>(allocation)
+                    + block_alignment - 1)
+                & ~std::uintptr_t(block_alignment - 1);
+            const auto blocks = reinterpret_cast<T*>(address);
+
+            // Blocks don't move relative to each other, so the used ones
+            // are copied in one go.
+            const std::size_t used =
+                block_count(this->size_) * block_size * sizeof(T);
+            if (used > 0)
+            {
+                std::memcpy(blocks, this->blocks_, used);
+            }
+            std::memset(
+                reinterpret_cast<char*>(blocks) + used, 0, bytes - used);
+
+            ::operator delete(this->allocation_);
+            this->allocation_ = allocation;
+            this->blocks_ = blocks;
+            this->capacity_ = capacity;
+        }
+
+        const T* component(std::size_t i, int k) const noexcept
+        {
+            return this->blocks_
+                + i / W * block_size + k * W + i % W;
+        }
+
+        T* component(std::size_t i, int k) noexcept
+        {
+            return this->blocks_
+                + i / W * block_size + k * W + i % W;
+        }
+
+    public:
+        /*!
+         * \brief  This `aosoa` type's element type.
+         */
+        using value_type = V;
+
+        /*!
+         * \brief  The component type of this `aosoa` type's elements.
+         */
+        using component_type = T;
+
+        /*!
+         * \brief  The type of sizes and indices.
+         */
+        using size_type = std::size_t;
+
+        /*!
+         * \brief     The type that holds `P` consecutive elements, e.g.,
+         *            `vec3<simd<float, P>>` for `aosoa<vec3<float>, W>`.
+         *
+         * \tparam P  The number of elements.
+         */
+        template<int P>
+        using packet_type = typename traits::template packet_type<P>;
+
+        /*!
+         * \brief  The number of components in each element.
+         */
+        static constexpr int stream_count = traits::stream_count;
+
+        /*!
+         * \brief  The number of elements in each block.
+         */
+        static constexpr int block_width = W;
+
+        /*!
+         * \brief  The number of components in each block.
+         */
+        static constexpr int block_size = stream_count * W;
+
+        /*!
+         * \brief  A proxy for a single element, as returned by the
+         *         non-`const` `operator[]`.
+         */
+        class reference
+        {
+            aosoa* array_;
+            size_type index_;
+
+        public:
+            /*!
+             * \brief        Constructs a proxy for the element at `index`.
+             *
+             * \param array  The `aosoa` holding the element.
+             * \param index  The index of the element.
+             */
+            reference(aosoa& array, size_type index) noexcept
+            :
+                array_(&array),
+                index_(index)
+            {
+            }
+
+            /*!
+             * \brief   Returns a copy of the element.
+             *
+             * \return  A copy of the element.
+             */
+            operator V() const noexcept
+            {
+                return this->array_->get(this->index_);
+            }
+
+            /*!
+             * \brief        Replaces the element with `value`.
+             *
+             * \param value  The new value of the element.
+             *
+             * \return       A reference to this proxy.
+             */
+            const reference& operator=(const V& value) const noexcept
+            {
+                this->array_->set(this->index_, value);
+                return *this;
+            }
+
+            /*!
+             * \brief        Replaces the element with a copy of the one
+             *               `other` refers to.
+             *
+             * \param other  A proxy for the element to copy.
+             *
+             * \return       A reference to this proxy.
+             */
+            const reference& operator=(const reference& other) const noexcept
+            {
+                return *this = V(other);
+            }
+
+            /*!
+             * \brief    Returns component `k` of the element.
+             *
+             * \param k  The component index, from `0` to
+             *           `stream_count - 1`.
+             *
+             * \return   A reference to component `k` of the element.
+             */
+            T& operator[](int k) const noexcept
+            {
+                return *this->array_->component(this->index_, k);
+            }
+        };
+
+        /*!
+         * \name Constructors, Assignment, and Destructor
+         * @{
+         */
+        /*!
+         * \brief  Constructs an empty `aosoa`.
+         */
+        aosoa() noexcept = default;
+
+        /*!
+         * \brief        Constructs an `aosoa` with `count` elements whose
+         *               components are all `0`.
+         *
+         * \param count  The number of elements.
+         */
+        explicit aosoa(size_type count)
+        {
+            this->resize(count);
+        }
+
+        /*!
+         * \brief        Constructs an `aosoa` with `count` copies of `value`.
+         *
+         * \param count  The number of elements.
+         * \param value  The value to copy into each element.
+         */
+        aosoa(size_type count, const V& value)
+        {
+            this->resize(count, value);
+        }
+
+        /*!
+         * \brief        Copies another `aosoa`'s elements.
+         *
+         * \param other  The `aosoa` to copy.
+         */
+        aosoa(const aosoa& other)
+        {
+            this->reserve(other.size_);
+            const std::size_t used =
+                block_count(other.size_) * block_size * sizeof(T);
+            if (used > 0)
+            {
+                std::memcpy(this->blocks_, other.blocks_, used);
+            }
+            this->size_ = other.size_;
+        }
+
+        /*!
+         * \brief        Takes ownership of another `aosoa`'s elements,
+         *               leaving it empty.
+         *
+         * \param other  The `aosoa` to move from.
+         */
+        aosoa(aosoa&& other) noexcept
+        {
+            this->swap(other);
+        }
+
+        /*!
+         * \brief        Replaces this `aosoa`'s elements with copies of
+         *               another's.
+         *
+         * \param other  The `aosoa` to copy.
+         *
+         * \return       A reference to this `aosoa`.
+         */
+        aosoa& operator=(const aosoa& other)
+        {
+            aosoa copy(other);
+            this->swap(copy);
+            return *this;
+        }
+
+        /*!
+         * \brief        Replaces this `aosoa`'s elements with another's,
+         *               leaving it empty.
+         *
+         * \param other  The `aosoa` to move from.
+         *
+         * \return       A reference to this `aosoa`.
+         */
+        aosoa& operator=(aosoa&& other) noexcept
+        {
+            aosoa moved(std::move(other));
+            this->swap(moved);
+            return *this;
+        }
+
+        /*!
+         * \brief  Frees this `aosoa`'s blocks.
+         */
+        ~aosoa()
+        {
+            ::operator delete(this->allocation_);
+        }
+
+        /*!@}*/
+        /*!
+         * \name Capacity
+         * @{
+         */
+        /*!
+         * \brief   Returns the number of elements.
+         *
+         * \return  The number of elements.
+         */
+        size_type size() const noexcept
+        {
+            return this->size_;
+        }
+
+        /*!
+         * \brief   Returns the number of elements that fit without
+         *          reallocating. Always a multiple of `W`.
+         *
+         * \return  The number of elements that fit without reallocating.
+         */
+        size_type capacity() const noexcept
+        {
+            return this->capacity_;
+        }
+
+        /*!
+         * \brief   Determines whether or not there are no elements.
+         *
+         * \return  `true` if there are no elements and `false` otherwise.
+         */
+        bool empty() const noexcept
+        {
+            return this->size_ == 0;
+        }
+
+        /*!
+         * \brief           Makes room for at least `capacity` elements.
+         * \details         Pointers, proxies, and packets are invalidated if
+         *                  this reallocates.
+         *
+         * \param capacity  The minimum number of elements to make room for.
+         */
+        void reserve(size_type capacity)
+        {
+            if (capacity > this->capacity_)
+            {
+                if (capacity < this->capacity_ * 2)
+                {
+                    capacity = this->capacity_ * 2;
+                }
+                this->reallocate(block_count(capacity) * W);
+            }
+        }
+
+        /*!
+         * \brief        Changes the number of elements. New elements have all
+         *               of their components set to `0`.
+         *
+         * \param count  The new number of elements.
+         */
+        void resize(size_type count)
+        {
+            this->reserve(count);
+            for (size_type i = this->size_; i < count; ++i)
+            {
+                for (int k = 0; k < stream_count; ++k)
+                {
+                    *this->component(i, k) = static_cast<T>(0);
+                }
+            }
+            this->size_ = count;
+        }
+
+        /*!
+         * \brief        Changes the number of elements. New elements are
+         *               copies of `value`.
+         *
+         * \param count  The new number of elements.
+         * \param value  The value to copy into each new element.
+         */
+        void resize(size_type count, const V& value)
+        {
+            this->reserve(count);
+            for (size_type i = this->size_; i < count; ++i)
+            {
+                this->set(i, value);
+            }
+            this->size_ = count;
+        }
+
+        /*!
+         * \brief  Removes every element without freeing any memory.
+         */
+        void clear() noexcept
+        {
+            this->size_ = 0;
+        }
+
+        /*!@}*/
+        /*!
+         * \name Element Access
+         * @{
+         */
+        /*!
+         * \brief        Appends a copy of `value`.
+         *
+         * \param value  The value to append.
+         */
+        void push_back(const V& value)
+        {
+            if (this->size_ == this->capacity_)
+            {
+                this->reserve(this->size_ + 1);
+            }
+            this->set(this->size_++, value);
+        }
+
+        /*!
+         * \brief    Removes the last element.
+         * \details  If there are no elements, behavior is undefined.
+         */
+        void pop_back() noexcept
+        {
+            --this->size_;
+        }
+
+        /*!
+         * \brief    Returns a copy of the element at index `i`.
+         * \details  If `i` is out of range, behavior is undefined.
+         *
+         * \param i  The index of the element.
+         *
+         * \return   A copy of the element at index `i`.
+         */
+        V get(size_type i) const noexcept
+        {
+            const T* c = this->component(i, 0);
+            V value;
+            for (int k = 0; k < stream_count; ++k)
+            {
+                value.data()[k] = c[k * W];
+            }
+            return value;
+        }
+
+        /*!
+         * \brief        Replaces the element at index `i` with `value`.
+         * \details      If `i` is out of range, behavior is undefined.
+         *
+         * \param i      The index of the element.
+         * \param value  The new value of the element.
+         */
+        void set(size_type i, const V& value) noexcept
+        {
+            T* c = this->component(i, 0);
+            for (int k = 0; k < stream_count; ++k)
+            {
+                c[k * W] = value.data()[k];
+            }
+        }
+
+        /*!
+         * \brief    Returns a copy of the element at index `i`.
+         * \details  If `i` is out of range, behavior is undefined.
+         *
+         * \param i  The index of the element.
+         *
+         * \return   A copy of the element at index `i`.
+         */
+        V operator[](size_type i) const noexcept
+        {
+            return this->get(i);
+        }
+
+        /*!
+         * \brief    Returns a proxy for the element at index `i`.
+         * \details  If `i` is out of range, behavior is undefined.
+         *
+         * \param i  The index of the element.
+         *
+         * \return   A proxy for the element at index `i`.
+         */
+        reference operator[](size_type i) noexcept
+        {
+            return reference(*this, i);
+        }
+
+        /*!
+         * \brief    Returns a pointer to the first block.
+         * \details  Component `k` of element `i` is at
+         *           `data()[i / W * block_size + k * W + i % W]`, where
+         *           component `k` is the one at `V::data()[k]`. If
+         *           `capacity()` is `0`, the pointer is null.
+         *
+         * \return   A pointer to the first block.
+         */
+        const T* data() const noexcept
+        {
+            return this->blocks_;
+        }
+
+        /*!
+         * \brief    Returns a pointer to the first block.
+         * \details  Component `k` of element `i` is at
+         *           `data()[i / W * block_size + k * W + i % W]`, where
+         *           component `k` is the one at `V::data()[k]`. If
+         *           `capacity()` is `0`, the pointer is null.
+         *
+         * \return   A pointer to the first block.
+         */
+        T* data() noexcept
+        {
+            return this->blocks_;
+        }
+
+        /*!
+         * \brief     Loads the `P` elements starting at index `i`.
+         * \details   `P` must divide `W`, and `i` must be a multiple of `P`
+         *            less than `size()`. Elements past `size()` are padding
+         *            with unspecified values.
+         *
+         * \tparam P  The number of elements. Defaults to `W`.
+         *
+         * \param i   The index of the first element.
+         *
+         * \return    The `P` elements starting at index `i`.
+         */
+        template<int P = W>
+        packet_type<P> load_packet(size_type i) const noexcept
+        {
+            static_assert(W % P == 0, "packets can't span blocks");
+            const T* c = this->component(i, 0);
+            packet_type<P> packet;
+            for (int k = 0; k < stream_count; ++k)
+            {
+                packet.data()[k] = simd<T, P>::load(c + k * W);
+            }
+            return packet;
+        }
+
+        /*!
+         * \brief         Stores `P` elements starting at index `i`.
+         * \details       `P` must divide `W`, and `i` must be a multiple of
+         *                `P` less than `size()`. Elements past `size()` are
+         *                padding and are written too, but remain
+         *                unobservable.
+         *
+         * \tparam P      The number of elements. Defaults to `W`.
+         *
+         * \param i       The index of the first element.
+         * \param packet  The elements to store.
+         */
+        template<int P = W>
+        void store_packet(
+            size_type i, const packet_type<P>& packet) noexcept
+        {
+            static_assert(W % P == 0, "packets can't span blocks");
+            T* c = this->component(i, 0);
+            for (int k = 0; k < stream_count; ++k)
+            {
+                packet.data()[k].store(c + k * W);
+            }
+        }
+
+        /*!
+         * \brief     Calls `f` with a `soa_packet` for each group of `P`
+         *            consecutive elements, in order.
+         * \details   The last packet holds fewer than `P` elements if
+         *            `size()` isn't a multiple of `P`; see
+         *            `soa_packet::count()` and `soa_packet::mask()`.
+         *
+         * \tparam P  The number of elements per packet. Must divide `W`.
+         *            Defaults to `W`.
+         * \tparam F  The type of `f`.
+         *
+         * \param f   The function to call with each packet.
+         */
+        template<int P = W, typename F>
+        void for_each_packet(F&& f)
+        {
+            for (size_type i = 0; i < this->size_; i += P)
+            {
+                const auto remaining = this->size_ - i;
+                f(soa_packet<aosoa<V, W>, P>(
+                    *this, i, remaining < P ? int(remaining) : P));
+            }
+        }
+
+        /*!
+         * \brief     Calls `f` with a read-only `soa_packet` for each group
+         *            of `P` consecutive elements, in order.
+         * \details   The last packet holds fewer than `P` elements if
+         *            `size()` isn't a multiple of `P`; see
+         *            `soa_packet::count()` and `soa_packet::mask()`.
+         *
+         * \tparam P  The number of elements per packet. Must divide `W`.
+         *            Defaults to `W`.
+         * \tparam F  The type of `f`.
+         *
+         * \param f   The function to call with each packet.
+         */
+        template<int P = W, typename F>
+        void for_each_packet(F&& f) const
+        {
+            for (size_type i = 0; i < this->size_; i += P)
+            {
+                const auto remaining = this->size_ - i;
+                f(soa_packet<const aosoa<V, W>, P>(
+                    *this, i, remaining < P ? int(remaining) : P));
+            }
+        }
+
+        /*!@}*/
+        /*!
+         * \brief        Exchanges the elements of this `aosoa` with
+         *               another's.
+         *
+         * \param other  The `aosoa` to swap with.
+         */
+        void swap(aosoa& other) noexcept
+        {
+            std::swap(this->allocation_, other.allocation_);
+            std::swap(this->blocks_, other.blocks_);
+            std::swap(this->size_, other.size_);
+            std::swap(this->capacity_, other.capacity_);
+        }
+    };
+
+    /*!@}*/
+}
@@ -0,0 +1,851 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+// Included ahead of vec.hpp and the rest so that their functions see the
+// `simd` overloads when called on the results.
+#include "simd.hpp"
+
+#include "cpu_features.hpp"
+#include "mat.hpp"
+#include "parallel_for.hpp"
+#include "soa_transpose.hpp"
+#include "soa_vector.hpp"
+#include "vec.hpp"
+
+#ifdef TUE_RUNTIME_DISPATCH
+#include <immintrin.h>
+
+#include "detail_/simd/avx/soa_transpose.avx.hpp"
+#endif
+
+namespace tue
+{
+    /**/
+    namespace detail_
+    {
+        // Transforms one batch of points by the column-major 4x4 matrix `m`,
+        // dividing by the resulting `w` if `Projective`. Vectors and normals
+        // go through here too with a zero translation column.
+        template<bool Projective, typename S>
+        inline void transform3(const S* m, S& x, S& y, S& z) noexcept
+        {
+            const S rx = tue::detail_::madd(m[0], x, tue::detail_::madd(
+                m[4], y, tue::detail_::madd(m[8], z, m[12])));
+            const S ry = tue::detail_::madd(m[1], x, tue::detail_::madd(
+                m[5], y, tue::detail_::madd(m[9], z, m[13])));
+            const S rz = tue::detail_::madd(m[2], x, tue::detail_::madd(
+                m[6], y, tue::detail_::madd(m[10], z, m[14])));
+            if (Projective)
+            {
+                const S rw = tue::detail_::madd(m[3], x, tue::detail_::madd(
+                    m[7], y, tue::detail_::madd(m[11], z, m[15])));
+                x = rx / rw;
+                y = ry / rw;
+                z = rz / rw;
+            }
+            else
+            {
+                x = rx;
+                y = ry;
+                z = rz;
+            }
+        }
+
+        // The signature shared by every implementation of every batch
+        // transform. `m` is a column-major 4x4 matrix. Arrays of structures
+        // ignore the strides and `stream`. Structures of arrays hold each
+        // component `stride` elements after the previous one, are aligned
+        // and padded for the widest `simd`, and are written with
+        // non-temporal stores if `stream` is `true`.
+        template<typename T>
+        using transform3_kernel = void (*)(
+            const T* m,
+            const T* in,
+            std::size_t in_stride,
+            T* out,
+            std::size_t out_stride,
+            std::size_t count,
+            bool stream);
+
+        template<typename T, bool Projective, bool Soa>
+        inline void transform3_generic(
+            const T* m,
+            const T* in,
+            std::size_t in_stride,
+            T* out,
+            std::size_t out_stride,
+            std::size_t count,
+            bool stream) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, 64>();
+            using S = simd<T, W>;
+
+            S sm[16];
+            for (int k = 0; k < 16; ++k)
+            {
+                sm[k] = S(m[k]);
+            }
+
+            if (Soa)
+            {
+                for (std::size_t i = 0; i < count; i += W)
+                {
+                    S x = S::load(in + i);
+                    S y = S::load(in + in_stride + i);
+                    S z = S::load(in + in_stride * 2 + i);
+                    tue::detail_::transform3<Projective>(sm, x, y, z);
+                    if (stream)
+                    {
+                        x.stream(out + i);
+                        y.stream(out + out_stride + i);
+                        z.stream(out + out_stride * 2 + i);
+                    }
+                    else
+                    {
+                        x.store(out + i);
+                        y.store(out + out_stride + i);
+                        z.store(out + out_stride * 2 + i);
+                    }
+                }
+                if (stream)
+                {
+                    tue::stream_fence();
+                }
+                return;
+            }
+
+            std::size_t i = 0;
+            for (; i + W <= count; i += W)
+            {
+                S x, y, z;
+                tue::detail_::load_soa3(in + i * 3, x, y, z);
+                tue::detail_::transform3<Projective>(sm, x, y, z);
+                tue::detail_::store_aos3(out + i * 3, x, y, z);
+            }
+            for (; i < count; ++i)
+            {
+                T x = in[i * 3];
+                T y = in[i * 3 + 1];
+                T z = in[i * 3 + 2];
+                tue::detail_::transform3<Projective>(m, x, y, z);
+                out[i * 3] = x;
+                out[i * 3 + 1] = y;
+                out[i * 3 + 2] = z;
+            }
+        }
+
+#ifdef TUE_RUNTIME_DISPATCH
+        // The AVX kernels below are compiled for AVX regardless of the
+        // compiler options and only run if the CPU supports it. The AVX2
+        // one is the same loop with fused multiply-adds.
+        TUE_TARGET("avx") inline __m256 transform3_row_m256(
+            std::false_type,
+            const __m256* m,
+            int r,
+            const __m256& x,
+            const __m256& y,
+            const __m256& z) noexcept
+        {
+            return _mm256_add_ps(
+                _mm256_add_ps(
+                    _mm256_mul_ps(m[r], x),
+                    _mm256_mul_ps(m[r + 4], y)),
+                _mm256_add_ps(
+                    _mm256_mul_ps(m[r + 8], z),
+                    m[r + 12]));
+        }
+
+        TUE_TARGET("avx2,fma") inline __m256 transform3_row_m256(
+            std::true_type,
+            const __m256* m,
+            int r,
+            const __m256& x,
+            const __m256& y,
+            const __m256& z) noexcept
+        {
+            return _mm256_fmadd_ps(m[r], x, _mm256_fmadd_ps(
+                m[r + 4], y, _mm256_fmadd_ps(m[r + 8], z, m[r + 12])));
+        }
+
+        template<bool Projective, bool Fma>
+        TUE_TARGET("avx") inline void transform3_m256(
+            const __m256* m, __m256& x, __m256& y, __m256& z) noexcept
+        {
+            const std::integral_constant<bool, Fma> fma;
+            const __m256 rx =
+                tue::detail_::transform3_row_m256(fma, m, 0, x, y, z);
+            const __m256 ry =
+                tue::detail_::transform3_row_m256(fma, m, 1, x, y, z);
+            const __m256 rz =
+                tue::detail_::transform3_row_m256(fma, m, 2, x, y, z);
+            if (Projective)
+            {
+                const __m256 rw =
+                    tue::detail_::transform3_row_m256(fma, m, 3, x, y, z);
+                x = _mm256_div_ps(rx, rw);
+                y = _mm256_div_ps(ry, rw);
+                z = _mm256_div_ps(rz, rw);
+            }
+            else
+            {
+                x = rx;
+                y = ry;
+                z = rz;
+            }
+        }
+
+        // Only ever inlined into the kernels below, which are flattened so
+        // that the FMA version of transform3_row_m256() can be too.
+        template<bool Projective, bool Soa, bool Fma>
+        TUE_TARGET("avx") inline void transform3_m256_loop(
+            const float* m,
+            const float* in,
+            std::size_t in_stride,
+            float* out,
+            std::size_t out_stride,
+            std::size_t count,
+            bool stream) noexcept
+        {
+            __m256 sm[16];
+            for (int k = 0; k < 16; ++k)
+            {
+                sm[k] = _mm256_set1_ps(m[k]);
+            }
+
+            if (Soa)
+            {
+                for (std::size_t i = 0; i < count; i += 8)
+                {
+                    __m256 x = _mm256_load_ps(in + i);
+                    __m256 y = _mm256_load_ps(in + in_stride + i);
+                    __m256 z = _mm256_load_ps(in + in_stride * 2 + i);
+                    tue::detail_::transform3_m256<Projective, Fma>(
+                        sm, x, y, z);
+                    if (stream)
+                    {
+                        _mm256_stream_ps(out + i, x);
+                        _mm256_stream_ps(out + out_stride + i, y);
+                        _mm256_stream_ps(out + out_stride * 2 + i, z);
+                    }
+                    else
+                    {
+                        _mm256_store_ps(out + i, x);
+                        _mm256_store_ps(out + out_stride + i, y);
+                        _mm256_store_ps(out + out_stride * 2 + i, z);
+                    }
+                }
+                if (stream)
+                {
+                    _mm_sfence();
+                }
+                return;
+            }
+
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                __m256 x, y, z;
+                tue::detail_::load_soa3_avx(in + i * 3, x, y, z);
+                tue::detail_::transform3_m256<Projective, Fma>(sm, x, y, z);
+                tue::detail_::store_aos3_avx(out + i * 3, x, y, z);
+            }
+            for (; i < count; ++i)
+            {
+                float x = in[i * 3];
+                float y = in[i * 3 + 1];
+                float z = in[i * 3 + 2];
+                tue::detail_::transform3<Projective>(m, x, y, z);
+                out[i * 3] = x;
+                out[i * 3 + 1] = y;
+                out[i * 3 + 2] = z;
+            }
+        }
+
+        template<bool Projective, bool Soa>
+        TUE_TARGET("avx") TUE_FLATTEN void transform3_avx(
+            const float* m,
+            const float* in,
+            std::size_t in_stride,
+            float* out,
+            std::size_t out_stride,
+            std::size_t count,
+            bool stream) noexcept
+        {
+            tue::detail_::transform3_m256_loop<Projective, Soa, false>(
+                m, in, in_stride, out, out_stride, count, stream);
+        }
+
+        template<bool Projective, bool Soa>
+        TUE_TARGET("avx2,fma") TUE_FLATTEN void transform3_avx2(
+            const float* m,
+            const float* in,
+            std::size_t in_stride,
+            float* out,
+            std::size_t out_stride,
+            std::size_t count,
+            bool stream) noexcept
+        {
+            tue::detail_::transform3_m256_loop<Projective, Soa, true>(
+                m, in, in_stride, out, out_stride, count, stream);
+        }
+#endif
+
+        template<typename T, bool Projective, bool Soa>
+        struct transform3_kernels
+        {
+            static kernel_set<transform3_kernel<T>> get() noexcept
+            {
+                return {
+                    &transform3_generic<T, Projective, Soa>,
+                    nullptr,
+                    nullptr,
+                    nullptr,
+                    nullptr,
+                };
+            }
+        };
+
+#ifdef TUE_RUNTIME_DISPATCH
+        template<bool Projective, bool Soa>
+        struct transform3_kernels<float, Projective, Soa>
+        {
+            static kernel_set<transform3_kernel<float>> get() noexcept
+            {
+                return {
+                    &transform3_generic<float, Projective, Soa>,
+                    nullptr,
+                    nullptr,
+                    &transform3_avx<Projective, Soa>,
+                    &transform3_avx2<Projective, Soa>,
+                };
+            }
+        };
+#endif
+
+        // Picks the kernel for the CPU the first time it's called.
+        template<typename T, bool Projective, bool Soa>
+        inline transform3_kernel<T> select_transform3() noexcept
+        {
+            static const auto kernel = tue::select_kernel(
+                transform3_kernels<T, Projective, Soa>::get());
+            return kernel;
+        }
+
+        // Outputs bigger than this many bytes skip the cache since they
+        // won't fit in it anyway and would only evict everything else.
+        constexpr std::size_t transform3_stream_threshold = 8u << 20;
+
+        template<typename T, bool Projective>
+        inline void transform3_aos(
+            const mat4x4<T>& m,
+            const vec3<T>* in,
+            vec3<T>* out,
+            std::size_t count) noexcept
+        {
+            static_assert(tue::detail_::is_packed<vec3<T>, T, 3>(),
+                "vec3 must not have padding");
+            if (count > 0)
+            {
+                tue::detail_::select_transform3<T, Projective, false>()(
+                    m.data(), in->data(), 0, out->data(), 0, count, false);
+            }
+        }
+
+        template<typename T, bool Projective>
+        inline void transform3_soa(
+            const mat4x4<T>& m,
+            const soa_vector<vec3<T>>& in,
+            soa_vector<vec3<T>>& out)
+        {
+            out.resize(in.size());
+            if (in.size() > 0)
+            {
+                tue::detail_::select_transform3<T, Projective, true>()(
+                    m.data(),
+                    in.stream(0),
+                    in.capacity(),
+                    out.stream(0),
+                    out.capacity(),
+                    in.size(),
+                    in.size() * 3 * sizeof(T)
+                        > transform3_stream_threshold);
+            }
+        }
+
+        // The chunk size for `thread_pool`'s. It's a multiple of every
+        // `simd` width and of the elements per cache line, so chunks of
+        // structures of arrays stay aligned and none share a cache line.
+        constexpr std::size_t transform3_grain = 4096;
+
+        template<typename T, bool Projective>
+        inline void transform3_aos(
+            thread_pool& pool,
+            const mat4x4<T>& m,
+            const vec3<T>* in,
+            vec3<T>* out,
+            std::size_t count)
+        {
+            static_assert(tue::detail_::is_packed<vec3<T>, T, 3>(),
+                "vec3 must not have padding");
+            const auto kernel =
+                tue::detail_::select_transform3<T, Projective, false>();
+            pool.parallel_for(0, count, transform3_grain,
+                [&](std::size_t begin, std::size_t end)
+            {
+                kernel(m.data(), in[begin].data(), 0,
+                    out[begin].data(), 0, end - begin, false);
+            });
+        }
+
+        template<typename T, bool Projective>
+        inline void transform3_soa(
+            thread_pool& pool,
+            const mat4x4<T>& m,
+            const soa_vector<vec3<T>>& in,
+            soa_vector<vec3<T>>& out)
+        {
+            out.resize(in.size());
+            const auto kernel =
+                tue::detail_::select_transform3<T, Projective, true>();
+            const bool stream =
+                in.size() * 3 * sizeof(T) > transform3_stream_threshold;
+            pool.parallel_for(0, in.size(), transform3_grain,
+                [&](std::size_t begin, std::size_t end)
+            {
+                kernel(m.data(),
+                    in.stream(0) + begin, in.capacity(),
+                    out.stream(0) + begin, out.capacity(),
+                    end - begin, stream);
+            });
+        }
+
+        template<typename T>
+        inline mat4x4<T> vector_transform(const mat4x4<T>& m) noexcept
+        {
+            return {
+                m[0],
+                m[1],
+                m[2],
+                { T(0), T(0), T(0), T(1) },
+            };
+        }
+
+        // The inverse-transpose of the upper-left 3x3 of `m`, whose
+        // columns are the cross products of the original's columns over
+        // its determinant.
+        template<typename T>
+        inline mat4x4<T> normal_transform(const mat4x4<T>& m) noexcept
+        {
+            const vec3<T> a0(m[0]);
+            const vec3<T> a1(m[1]);
+            const vec3<T> a2(m[2]);
+            const vec3<T> c0 = tue::math::cross(a1, a2);
+            const vec3<T> c1 = tue::math::cross(a2, a0);
+            const vec3<T> c2 = tue::math::cross(a0, a1);
+            const T inv_det = T(1) / tue::math::dot(a0, c0);
+            return {
+                { c0 * inv_det, T(0) },
+                { c1 * inv_det, T(0) },
+                { c2 * inv_det, T(0) },
+                { T(0), T(0), T(0), T(1) },
+            };
+        }
+    }
+
+    /*!
+     * \defgroup  batch_transform_hpp <tue/batch_transform.hpp>
+     *
+     * \brief     Functions that transform whole arrays of `vec3`'s by the
+     *            same `mat4x4`.
+     * \details   The elements are transformed several at a time in `simd`
+     *            registers, transposing arrays of structures along the way.
+     *            `float` kernels for AVX and AVX2 are compiled in regardless
+     *            of the compiler options where `TUE_RUNTIME_DISPATCH` is
+     *            defined, and the one for the CPU this program is running
+     *            on is picked the first time each function is called.
+     *
+     *            Each function also has an overload that takes a
+     *            `thread_pool` first and splits the array into chunks across
+     *            its threads.
+     *
+     *            The input and output may be the same array, but they must
+     *            not otherwise overlap.
+     * @{
+     */
+
+    /*!
+     * \brief        Transforms `count` points as if each were multiplied by
+     *               `m` as a `vec4` with a `w` of `1`.
+     *
+     * \tparam T     The component type.
+     *
+     * \param m      The transformation matrix. Its last row is ignored.
+     * \param in     A pointer to the first point to transform.
+     * \param out    A pointer to where to write the first transformed point.
+     * \param count  The number of points.
+     */
+    template<typename T>
+    inline void transform_points(
+        const mat4x4<T>& m,
+        const vec3<T>* in,
+        vec3<T>* out,
+        std::size_t count) noexcept
+    {
+        tue::detail_::transform3_aos<T, false>(m, in, out, count);
+    }
+
+    /*!
+     * \brief      Transforms every point in `in` as if each were multiplied
+     *             by `m` as a `vec4` with a `w` of `1`.
+     * \details    `out` is resized to match `in`. Outputs bigger than a few
+     *             megabytes are written with non-temporal stores, so call
+     *             `stream_fence()` before handing `out` to another thread.
+     *
+     * \tparam T   The component type.
+     *
+     * \param m    The transformation matrix. Its last row is ignored.
+     * \param in   The points to transform.
+     * \param out  Where to write the transformed points.
+     */
+    template<typename T>
+    inline void transform_points(
+        const mat4x4<T>& m,
+        const soa_vector<vec3<T>>& in,
+        soa_vector<vec3<T>>& out)
+    {
+        tue::detail_::transform3_soa<T, false>(m, in, out);
+    }
+
+    /*!
+     * \brief        Like `transform_points(m, in, out, count)`, but split
+     *               across `pool`'s threads.
+     *
+     * \tparam T     The component type.
+     *
+     * \param pool   The `thread_pool` to run on.
+     * \param m      The transformation matrix.
+     * \param in     A pointer to the first element to transform.
+     * \param out    A pointer to where to write the first result.
+     * \param count  The number of elements.
+     */
+    template<typename T>
+    inline void transform_points(
+        thread_pool& pool,
+        const mat4x4<T>& m,
+        const vec3<T>* in,
+        vec3<T>* out,
+        std::size_t count)
+    {
+        tue::detail_::transform3_aos<T, false>(pool, m, in, out, count);
+    }
+
+    /*!
+     * \brief       Like `transform_points(m, in, out)`, but split across
+     *              `pool`'s threads.
+     *
+     * \tparam T    The component type.
+     *
+     * \param pool  The `thread_pool` to run on.
+     * \param m     The transformation matrix.
+     * \param in    The elements to transform.
+     * \param out   Where to write the results.
+     */
+    template<typename T>
+    inline void transform_points(
+        thread_pool& pool,
+        const mat4x4<T>& m,
+        const soa_vector<vec3<T>>& in,
+        soa_vector<vec3<T>>& out)
+    {
+        tue::detail_::transform3_soa<T, false>(pool, m, in, out);
+    }
+
+    /*!
+     * \brief        Transforms `count` direction vectors as if each were
+     *               multiplied by `m` as a `vec4` with a `w` of `0`.
+     *
+     * \tparam T     The component type.
+     *
+     * \param m      The transformation matrix. Its last row and column are
+     *               ignored.
+     * \param in     A pointer to the first vector to transform.
+     * \param out    A pointer to where to write the first transformed
+     *               vector.
+     * \param count  The number of vectors.
+     */
+    template<typename T>
+    inline void transform_vectors(
+        const mat4x4<T>& m,
+        const vec3<T>* in,
+        vec3<T>* out,
+        std::size_t count) noexcept
+    {
+        tue::detail_::transform3_aos<T, false>(
+            tue::detail_::vector_transform(m), in, out, count);
+    }
+
+    /*!
+     * \brief      Transforms every direction vector in `in` as if each were
+     *             multiplied by `m` as a `vec4` with a `w` of `0`.
+     * \details    `out` is resized to match `in` and may be written with
+     *             non-temporal stores, as with `transform_points()`.
+     *
+     * \tparam T   The component type.
+     *
+     * \param m    The transformation matrix. Its last row and column are
+     *             ignored.
+     * \param in   The vectors to transform.
+     * \param out  Where to write the transformed vectors.
+     */
+    template<typename T>
+    inline void transform_vectors(
+        const mat4x4<T>& m,
+        const soa_vector<vec3<T>>& in,
+        soa_vector<vec3<T>>& out)
+    {
+        tue::detail_::transform3_soa<T, false>(
+            tue::detail_::vector_transform(m), in, out);
+    }
+
+    /*!
+     * \brief        Like `transform_vectors(m, in, out, count)`, but split
+     *               across `pool`'s threads.
+     *
+     * \tparam T     The component type.
+     *
+     * \param pool   The `thread_pool` to run on.
+     * \param m      The transformation matrix.
+     * \param in     A pointer to the first element to transform.
+     * \param out    A pointer to where to write the first result.
+     * \param count  The number of elements.
+     */
+    template<typename T>
+    inline void transform_vectors(
+        thread_pool& pool,
+        const mat4x4<T>& m,
+        const vec3<T>* in,
+        vec3<T>* out,
+        std::size_t count)
+    {
+        tue::detail_::transform3_aos<T, false>(
+            pool, tue::detail_::vector_transform(m), in, out, count);
+    }
+
+    /*!
+     * \brief       Like `transform_vectors(m, in, out)`, but split across
+     *              `pool`'s threads.
+     *
+     * \tparam T    The component type.
+     *
+     * \param pool  The `thread_pool` to run on.
+     * \param m     The transformation matrix.
+     * \param in    The elements to transform.
+     * \param out   Where to write the results.
+     */
+    template<typename T>
+    inline void transform_vectors(
+        thread_pool& pool,
+        const mat4x4<T>& m,
+        const soa_vector<vec3<T>>& in,
+        soa_vector<vec3<T>>& out)
+    {
+        tue::detail_::transform3_soa<T, false>(
+            pool, tue::detail_::vector_transform(m), in, out);
+    }
+
+    /*!
+     * \brief        Transforms `count` surface normals by the
+     *               inverse-transpose of the upper-left 3x3 of `m`.
+     * \details      The results aren't normalized. The upper-left 3x3 of `m`
+     *               must be invertible.
+     *
+     * \tparam T     The component type.
+     *
+     * \param m      The transformation matrix the surfaces are transformed
+     *               by.
+     * \param in     A pointer to the first normal to transform.
+     * \param out    A pointer to where to write the first transformed
+     *               normal.
+     * \param count  The number of normals.
+     */
+    template<typename T>
+    inline void transform_normals(
+        const mat4x4<T>& m,
+        const vec3<T>* in,
+        vec3<T>* out,
+        std::size_t count) noexcept
+    {
+        tue::detail_::transform3_aos<T, false>(
+            tue::detail_::normal_transform(m), in, out, count);
+    }
+
+    /*!
+     * \brief      Transforms every surface normal in `in` by the
+     *             inverse-transpose of the upper-left 3x3 of `m`.
+     * \details    The results aren't normalized. The upper-left 3x3 of `m`
+     *             must be invertible. `out` is resized to match `in` and may
+     *             be written with non-temporal stores, as with
+     *             `transform_points()`.
+     *
+     * \tparam T   The component type.
+     *
+     * \param m    The transformation matrix the surfaces are transformed by.
+     * \param in   The normals to transform.
+     * \param out  Where to write the transformed normals.
+     */
+    template<typename T>
+    inline void transform_normals(
+        const mat4x4<T>& m,
+        const soa_vector<vec3<T>>& in,
+        soa_vector<vec3<T>>& out)
+    {
+        tue::detail_::transform3_soa<T, false>(
+            tue::detail_::normal_transform(m), in, out);
+    }
+
+    /*!
+     * \brief        Like `transform_normals(m, in, out, count)`, but split
+     *               across `pool`'s threads.
+     *
+     * \tparam T     The component type.
+     *
+     * \param pool   The `thread_pool` to run on.
+     * \param m      The transformation matrix.
+     * \param in     A pointer to the first element to transform.
+     * \param out    A pointer to where to write the first result.
+     * \param count  The number of elements.
+     */
+    template<typename T>
+    inline void transform_normals(
+        thread_pool& pool,
+        const mat4x4<T>& m,
+        const vec3<T>* in,
+        vec3<T>* out,
+        std::size_t count)
+    {
+        tue::detail_::transform3_aos<T, false>(
+            pool, tue::detail_::normal_transform(m), in, out, count);
+    }
+
+    /*!
+     * \brief       Like `transform_normals(m, in, out)`, but split across
+     *              `pool`'s threads.
+     *
+     * \tparam T    The component type.
+     *
+     * \param pool  The `thread_pool` to run on.
+     * \param m     The transformation matrix.
+     * \param in    The elements to transform.
+     * \param out   Where to write the results.
+     */
+    template<typename T>
+    inline void transform_normals(
+        thread_pool& pool,
+        const mat4x4<T>& m,
+        const soa_vector<vec3<T>>& in,
+        soa_vector<vec3<T>>& out)
+    {
+        tue::detail_::transform3_soa<T, false>(
+            pool, tue::detail_::normal_transform(m), in, out);
+    }
+
+    /*!
+     * \brief        Transforms `count` points as if each were multiplied by
+     *               `m` as a `vec4` with a `w` of `1`, then divides each
+     *               result by its `w`.
+     *
+     * \tparam T     The component type.
+     *
+     * \param m      The projection matrix.
+     * \param in     A pointer to the first point to project.
+     * \param out    A pointer to where to write the first projected point.
+     * \param count  The number of points.
+     */
+    template<typename T>
+    inline void project_points(
+        const mat4x4<T>& m,
+        const vec3<T>* in,
+        vec3<T>* out,
+        std::size_t count) noexcept
+    {
+        tue::detail_::transform3_aos<T, true>(m, in, out, count);
+    }
+
+    /*!
+     * \brief      Transforms every point in `in` as if each were multiplied
+     *             by `m` as a `vec4` with a `w` of `1`, then divides each
+     *             result by its `w`.
+     * \details    `out` is resized to match `in` and may be written with
+     *             non-temporal stores, as with `transform_points()`.
+     *
+     * \tparam T   The component type.
+     *
+     * \param m    The projection matrix.
+     * \param in   The points to project.
+     * \param out  Where to write the projected points.
+     */
+    template<typename T>
+    inline void project_points(
+        const mat4x4<T>& m,
+        const soa_vector<vec3<T>>& in,
+        soa_vector<vec3<T>>& out)
+    {
+        tue::detail_::transform3_soa<T, true>(m, in, out);
+    }
+
+    /*!
+     * \brief        Like `project_points(m, in, out, count)`, but split across
+     *               `pool`'s threads.
+     *
+     * \tparam T     The component type.
+     *
+     * \param pool   The `thread_pool` to run on.
+     * \param m      The transformation matrix.
+     * \param in     A pointer to the first element to transform.
+     * \param out    A pointer to where to write the first result.
+     * \param count  The number of elements.
+     */
+    template<typename T>
+    inline void project_points(
+        thread_pool& pool,
+        const mat4x4<T>& m,
+        const vec3<T>* in,
+        vec3<T>* out,
+        std::size_t count)
+    {
+        tue::detail_::transform3_aos<T, true>(pool, m, in, out, count);
+    }
+
+    /*!
+     * \brief       Like `project_points(m, in, out)`, but split across
+     *              `pool`'s threads.
+     *
+     * \tparam T    The component type.
+     *
+     * \param pool  The `thread_pool` to run on.
+     * \param m     The transformation matrix.
+     * \param in    The elements to transform.
+     * \param out   Where to write the results.
+     */
+    template<typename T>
+    inline void project_points(
+        thread_pool& pool,
+        const mat4x4<T>& m,
+        const soa_vector<vec3<T>>& in,
+        soa_vector<vec3<T>>& out)
+    {
+        tue::detail_::transform3_soa<T, true>(pool, m, in, out);
+    }
+
+    /*!@}*/
+}
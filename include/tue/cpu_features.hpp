@@ -0,0 +1,387 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstdint>
+
+#include "detail_/simd_support.hpp"
+
+#if defined(__i386__) || defined(__x86_64__)
+#include <cpuid.h>
+#endif
+
+#if defined(_M_IX86) || defined(_M_X64)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+/*!
+ * \defgroup  cpu_features_hpp <tue/cpu_features.hpp>
+ *
+ * \brief     Runtime detection of the instruction sets supported by the CPU
+ *            and selection between kernels compiled for each of them.
+ *
+ * \details   The `simd` specializations are chosen at compile time, so a
+ *            binary built for baseline x86-64 never uses AVX2 on its own.
+ *            Batch routines can instead provide one implementation per
+ *            `simd_target`, collect them into a `kernel_set`, and pick one
+ *            with `select_kernel()` once at startup.
+ *
+ *            Implementations for targets newer than the compiler options
+ *            should be marked with `TUE_TARGET` so they can use that
+ *            target's intrinsics directly. Building them in separate
+ *            translation units with different `-m` options instead is only
+ *            safe if those translation units don't share any of this
+ *            library's inline functions, since the linker is free to keep
+ *            whichever copy it likes, including one that uses instructions
+ *            the CPU doesn't have.
+ */
+namespace tue
+{
+    /*!
+     * \addtogroup  cpu_features_hpp
+     * @{
+     */
+
+    /*!
+     * \brief    The instruction set extensions supported by a CPU.
+     * \details  AVX, AVX2 and FMA3 are only reported if the operating system
+     *           also preserves the upper halves of the YMM registers.
+     */
+    struct cpu_feature_set
+    {
+        /*!
+         * \brief  Whether or not SSE instructions are supported.
+         */
+        bool sse;
+
+        /*!
+         * \brief  Whether or not SSE2 instructions are supported.
+         */
+        bool sse2;
+
+        /*!
+         * \brief  Whether or not SSE4.1 instructions are supported.
+         */
+        bool sse4_1;
+
+        /*!
+         * \brief  Whether or not AVX instructions are supported.
+         */
+        bool avx;
+
+        /*!
+         * \brief  Whether or not AVX2 instructions are supported.
+         */
+        bool avx2;
+
+        /*!
+         * \brief  Whether or not FMA3 instructions are supported.
+         */
+        bool fma;
+    };
+
+    /*!
+     * \brief  The instruction sets a batch kernel can be compiled for, from
+     *         least to most capable.
+     */
+    enum class simd_target
+    {
+        /*!
+         * \brief  No instruction set extensions.
+         */
+        generic,
+
+        /*!
+         * \brief  SSE and SSE2.
+         */
+        sse2,
+
+        /*!
+         * \brief  Up to and including SSE4.1.
+         */
+        sse4_1,
+
+        /*!
+         * \brief  Up to and including AVX.
+         */
+        avx,
+
+        /*!
+         * \brief  Up to and including AVX2 and FMA3.
+         */
+        avx2,
+    };
+
+    namespace detail_
+    {
+        inline cpu_feature_set detect_cpu_features() noexcept
+        {
+            cpu_feature_set result = {};
+            std::uint32_t leaf1[4] = {};
+            std::uint32_t leaf7[4] = {};
+            std::uint64_t xcr0 = 0;
+
+#if defined(__i386__) || defined(__x86_64__)
+            const unsigned int max_leaf = __get_cpuid_max(0, nullptr);
+            if (max_leaf >= 1)
+            {
+                __cpuid(1, leaf1[0], leaf1[1], leaf1[2], leaf1[3]);
+            }
+            if (max_leaf >= 7)
+            {
+                __cpuid_count(7, 0, leaf7[0], leaf7[1], leaf7[2], leaf7[3]);
+            }
+            if (leaf1[2] & (1u << 27))
+            {
+                std::uint32_t eax, edx;
+                __asm__ __volatile__(
+                    "xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+                xcr0 = (std::uint64_t(edx) << 32) | eax;
+            }
+#else
+#if defined(_M_IX86) || defined(_M_X64)
+            int regs[4];
+            __cpuid(regs, 0);
+            const int max_leaf = regs[0];
+            if (max_leaf >= 1)
+            {
+                __cpuid(regs, 1);
+                for (int i = 0; i < 4; ++i)
+                {
+                    leaf1[i] = static_cast<std::uint32_t>(regs[i]);
+                }
+            }
+            if (max_leaf >= 7)
+            {
+                __cpuidex(regs, 7, 0);
+                for (int i = 0; i < 4; ++i)
+                {
+                    leaf7[i] = static_cast<std::uint32_t>(regs[i]);
+                }
+            }
+            if (leaf1[2] & (1u << 27))
+            {
+                xcr0 = _xgetbv(0);
+            }
+#endif
+#endif
+
+            // The OS has to save the XMM and YMM state for AVX to be usable.
+            const bool ymm = (xcr0 & 0x6) == 0x6;
+            result.sse = (leaf1[3] & (1u << 25)) != 0;
+            result.sse2 = (leaf1[3] & (1u << 26)) != 0;
+            result.sse4_1 = (leaf1[2] & (1u << 19)) != 0;
+            result.avx = ymm && (leaf1[2] & (1u << 28)) != 0;
+            result.avx2 = result.avx && (leaf7[1] & (1u << 5)) != 0;
+            result.fma = result.avx && (leaf1[2] & (1u << 12)) != 0;
+            return result;
+        }
+    }
+
+    /*!
+     * \brief   Queries the instruction set extensions supported by the CPU
+     *          this program is running on.
+     * \details The CPU is only queried the first time this is called.
+     *          Extensions are never reported on non-x86 platforms.
+     *
+     * \return  The instruction set extensions supported by the CPU.
+     */
+    inline const cpu_feature_set& cpu_features() noexcept
+    {
+        static const cpu_feature_set features =
+            tue::detail_::detect_cpu_features();
+        return features;
+    }
+
+    /*!
+     * \brief   Determines the most capable `simd_target` the CPU this
+     *          program is running on supports.
+     *
+     * \return  The most capable supported `simd_target`.
+     */
+    inline simd_target best_simd_target() noexcept
+    {
+        const auto& features = tue::cpu_features();
+        if (features.avx2 && features.fma)
+        {
+            return simd_target::avx2;
+        }
+        if (features.avx)
+        {
+            return simd_target::avx;
+        }
+        if (features.sse4_1 && features.sse2)
+        {
+            return simd_target::sse4_1;
+        }
+        if (features.sse2 && features.sse)
+        {
+            return simd_target::sse2;
+        }
+        return simd_target::generic;
+    }
+
+    /*!
+     * \brief   Determines the `simd_target` the `simd` specializations were
+     *          compiled for in the current translation unit.
+     *
+     * \return  The `simd_target` matching the `TUE_*` support macros.
+     */
+    inline constexpr simd_target compiled_simd_target() noexcept
+    {
+#if defined(TUE_AVX2) && defined(TUE_FMA)
+        return simd_target::avx2;
+#else
+#ifdef TUE_AVX
+        return simd_target::avx;
+#else
+#ifdef TUE_SSE4_1
+        return simd_target::sse4_1;
+#else
+#ifdef TUE_SSE2
+        return simd_target::sse2;
+#else
+        return simd_target::generic;
+#endif
+#endif
+#endif
+#endif
+    }
+
+    /*!
+     * \brief     A set of alternative implementations of the same kernel,
+     *            one per `simd_target`.
+     * \details   Any entry but `generic` may be left null if there's no
+     *            implementation for that target.
+     *
+     * \tparam F  The function pointer type of the kernel.
+     */
+    template<typename F>
+    struct kernel_set
+    {
+        /*!
+         * \brief  The implementation that runs anywhere.
+         */
+        F generic;
+
+        /*!
+         * \brief  The SSE2 implementation, or null.
+         */
+        F sse2;
+
+        /*!
+         * \brief  The SSE4.1 implementation, or null.
+         */
+        F sse4_1;
+
+        /*!
+         * \brief  The AVX implementation, or null.
+         */
+        F avx;
+
+        /*!
+         * \brief  The AVX2 and FMA3 implementation, or null.
+         */
+        F avx2;
+    };
+
+    /*!
+     * \brief          Picks the implementation from `kernels` for the most
+     *                 capable `simd_target` at or below `target`.
+     *
+     * \tparam F       The function pointer type of the kernel.
+     *
+     * \param kernels  The alternative implementations.
+     * \param target   The most capable `simd_target` to consider.
+     *
+     * \return         The chosen implementation.
+     */
+    template<typename F>
+    inline F select_kernel(
+        const kernel_set<F>& kernels, simd_target target) noexcept
+    {
+        if (target >= simd_target::avx2 && kernels.avx2)
+        {
+            return kernels.avx2;
+        }
+        if (target >= simd_target::avx && kernels.avx)
+        {
+            return kernels.avx;
+        }
+        if (target >= simd_target::sse4_1 && kernels.sse4_1)
+        {
+            return kernels.sse4_1;
+        }
+        if (target >= simd_target::sse2 && kernels.sse2)
+        {
+            return kernels.sse2;
+        }
+        return kernels.generic;
+    }
+
+    /*!
+     * \brief          Picks the implementation from `kernels` for the most
+     *                 capable `simd_target` supported by the CPU this program
+     *                 is running on.
+     * \details        Store the result (e.g., in a function-local `static`)
+     *                 to only select once.
+     *
+     * \tparam F       The function pointer type of the kernel.
+     *
+     * \param kernels  The alternative implementations.
+     *
+     * \return         The chosen implementation.
+     */
+    template<typename F>
+    inline F select_kernel(const kernel_set<F>& kernels) noexcept
+    {
+        return tue::select_kernel(kernels, tue::best_simd_target());
+    }
+
+    /*!@}*/
+}
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+/*!
+ * \brief    Compiles the function it's applied to for the given target,
+ *           e.g., `TUE_TARGET("avx2,fma")`, regardless of the compiler
+ *           options.
+ * \details  Expands to nothing where target attributes aren't supported.
+ */
+#define TUE_TARGET(name) __attribute__((target(name)))
+#else
+#define TUE_TARGET(name)
+#endif
+
+#ifdef __GNUC__
+/*!
+ * \brief    Inlines every call in the function it's applied to, and every
+ *           call in those, wherever possible.
+ * \details  Functions with a `TUE_TARGET` are only inlined into callers
+ *           whose target includes theirs, which compilers don't always
+ *           bother with on their own. Applying both to a kernel lets it
+ *           share a body compiled for a lesser target with its other
+ *           `kernel_set` entries. Expands to nothing on other compilers.
+ */
+#define TUE_FLATTEN __attribute__((flatten))
+#else
+#define TUE_FLATTEN
+#endif
+
+#if (defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))) \
+    || defined(_M_IX86) || defined(_M_X64)
+/*!
+ * \brief  Defined if functions can use intrinsics for targets beyond the
+ *         compiler options, either through `TUE_TARGET` or because the
+ *         compiler always allows it, so that batch routines can include
+ *         kernels for each `simd_target` in their `kernel_set`'s.
+ */
+#define TUE_RUNTIME_DISPATCH
+#endif
@@ -804,6 +804,52 @@ namespace tue
             tue::math::sincos(m[1], sin_out[1], cos_out[1]);
         }
 
+        template<typename T, int R>
+        inline mat<T, 2, R> tan_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::tan(m[0]),
+                tue::math::tan(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> asin_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::asin(m[0]),
+                tue::math::asin(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> acos_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::acos(m[0]),
+                tue::math::acos(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> atan_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::atan(m[0]),
+                tue::math::atan(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> atan2_mm(
+            const mat<T, 2, R>& y, const mat<T, 2, R>& x) noexcept
+        {
+            return {
+                tue::math::atan2(y[0], x[0]),
+                tue::math::atan2(y[1], x[1]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 2, R> exp_m(const mat<T, 2, R>& m) noexcept
         {
@@ -813,6 +859,15 @@ namespace tue
             };
         }
 
+        template<typename T, int R>
+        inline mat<T, 2, R> exp2_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::exp2(m[0]),
+                tue::math::exp2(m[1]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 2, R> log_m(const mat<T, 2, R>& m) noexcept
         {
@@ -822,6 +877,24 @@ namespace tue
             };
         }
 
+        template<typename T, int R>
+        inline mat<T, 2, R> log2_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::log2(m[0]),
+                tue::math::log2(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> log10_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::log10(m[0]),
+                tue::math::log10(m[1]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 2, R> abs_m(const mat<T, 2, R>& m) noexcept
         {
@@ -859,6 +932,15 @@ namespace tue
             };
         }
 
+        template<typename T, int R>
+        inline mat<T, 2, R> cbrt_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::cbrt(m[0]),
+                tue::math::cbrt(m[1]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 2, R> rsqrt_m(const mat<T, 2, R>& m) noexcept
         {
@@ -868,6 +950,202 @@ namespace tue
             };
         }
 
+        template<typename T, int R>
+        inline mat<T, 2, R> fma_mmm(
+            const mat<T, 2, R>& m1,
+            const mat<T, 2, R>& m2,
+            const mat<T, 2, R>& m3) noexcept
+        {
+            return {
+                tue::math::fma(m1[0], m2[0], m3[0]),
+                tue::math::fma(m1[1], m2[1], m3[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> floor_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::floor(m[0]),
+                tue::math::floor(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> ceil_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::ceil(m[0]),
+                tue::math::ceil(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> round_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::round(m[0]),
+                tue::math::round(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> trunc_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::trunc(m[0]),
+                tue::math::trunc(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> fast_sin_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::fast::sin(m[0]),
+                tue::math::fast::sin(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> fast_cos_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::fast::cos(m[0]),
+                tue::math::fast::cos(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline void fast_sincos_m(
+            const mat<T, 2, R>& m,
+            mat<T, 2, R>& sin_out,
+            mat<T, 2, R>& cos_out) noexcept
+        {
+            tue::math::fast::sincos(m[0], sin_out[0], cos_out[0]);
+            tue::math::fast::sincos(m[1], sin_out[1], cos_out[1]);
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> fast_exp_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::fast::exp(m[0]),
+                tue::math::fast::exp(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> fast_log_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::fast::log(m[0]),
+                tue::math::fast::log(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> fast_pow_mm(
+            const mat<T, 2, R>& bases, const mat<T, 2, R>& exponents) noexcept
+        {
+            return {
+                tue::math::fast::pow(bases[0], exponents[0]),
+                tue::math::fast::pow(bases[1], exponents[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> fast_recip_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::fast::recip(m[0]),
+                tue::math::fast::recip(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> fast_rsqrt_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::fast::rsqrt(m[0]),
+                tue::math::fast::rsqrt(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> precise_sin_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::precise::sin(m[0]),
+                tue::math::precise::sin(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> precise_cos_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::precise::cos(m[0]),
+                tue::math::precise::cos(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline void precise_sincos_m(
+            const mat<T, 2, R>& m,
+            mat<T, 2, R>& sin_out,
+            mat<T, 2, R>& cos_out) noexcept
+        {
+            tue::math::precise::sincos(m[0], sin_out[0], cos_out[0]);
+            tue::math::precise::sincos(m[1], sin_out[1], cos_out[1]);
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> precise_exp_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::precise::exp(m[0]),
+                tue::math::precise::exp(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> precise_log_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::precise::log(m[0]),
+                tue::math::precise::log(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> precise_pow_mm(
+            const mat<T, 2, R>& bases, const mat<T, 2, R>& exponents) noexcept
+        {
+            return {
+                tue::math::precise::pow(bases[0], exponents[0]),
+                tue::math::precise::pow(bases[1], exponents[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> precise_recip_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::precise::recip(m[0]),
+                tue::math::precise::recip(m[1]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 2, R> precise_rsqrt_m(const mat<T, 2, R>& m) noexcept
+        {
+            return {
+                tue::math::precise::rsqrt(m[0]),
+                tue::math::precise::rsqrt(m[1]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 2, R> min_mm(
             const mat<T, 2, R>& m1, const mat<T, 2, R>& m2) noexcept
@@ -936,6 +936,62 @@ namespace tue
             tue::math::sincos(m[3], sin_out[3], cos_out[3]);
         }
 
+        template<typename T, int R>
+        inline mat<T, 4, R> tan_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::tan(m[0]),
+                tue::math::tan(m[1]),
+                tue::math::tan(m[2]),
+                tue::math::tan(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> asin_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::asin(m[0]),
+                tue::math::asin(m[1]),
+                tue::math::asin(m[2]),
+                tue::math::asin(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> acos_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::acos(m[0]),
+                tue::math::acos(m[1]),
+                tue::math::acos(m[2]),
+                tue::math::acos(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> atan_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::atan(m[0]),
+                tue::math::atan(m[1]),
+                tue::math::atan(m[2]),
+                tue::math::atan(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> atan2_mm(
+            const mat<T, 4, R>& y, const mat<T, 4, R>& x) noexcept
+        {
+            return {
+                tue::math::atan2(y[0], x[0]),
+                tue::math::atan2(y[1], x[1]),
+                tue::math::atan2(y[2], x[2]),
+                tue::math::atan2(y[3], x[3]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 4, R> exp_m(const mat<T, 4, R>& m) noexcept
         {
@@ -947,6 +1003,17 @@ namespace tue
             };
         }
 
+        template<typename T, int R>
+        inline mat<T, 4, R> exp2_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::exp2(m[0]),
+                tue::math::exp2(m[1]),
+                tue::math::exp2(m[2]),
+                tue::math::exp2(m[3]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 4, R> log_m(const mat<T, 4, R>& m) noexcept
         {
@@ -958,6 +1025,28 @@ namespace tue
             };
         }
 
+        template<typename T, int R>
+        inline mat<T, 4, R> log2_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::log2(m[0]),
+                tue::math::log2(m[1]),
+                tue::math::log2(m[2]),
+                tue::math::log2(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> log10_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::log10(m[0]),
+                tue::math::log10(m[1]),
+                tue::math::log10(m[2]),
+                tue::math::log10(m[3]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 4, R> abs_m(const mat<T, 4, R>& m) noexcept
         {
@@ -1003,6 +1092,17 @@ namespace tue
             };
         }
 
+        template<typename T, int R>
+        inline mat<T, 4, R> cbrt_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::cbrt(m[0]),
+                tue::math::cbrt(m[1]),
+                tue::math::cbrt(m[2]),
+                tue::math::cbrt(m[3]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 4, R> rsqrt_m(const mat<T, 4, R>& m) noexcept
         {
@@ -1014,6 +1114,244 @@ namespace tue
             };
         }
 
+        template<typename T, int R>
+        inline mat<T, 4, R> fma_mmm(
+            const mat<T, 4, R>& m1,
+            const mat<T, 4, R>& m2,
+            const mat<T, 4, R>& m3) noexcept
+        {
+            return {
+                tue::math::fma(m1[0], m2[0], m3[0]),
+                tue::math::fma(m1[1], m2[1], m3[1]),
+                tue::math::fma(m1[2], m2[2], m3[2]),
+                tue::math::fma(m1[3], m2[3], m3[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> floor_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::floor(m[0]),
+                tue::math::floor(m[1]),
+                tue::math::floor(m[2]),
+                tue::math::floor(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> ceil_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::ceil(m[0]),
+                tue::math::ceil(m[1]),
+                tue::math::ceil(m[2]),
+                tue::math::ceil(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> round_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::round(m[0]),
+                tue::math::round(m[1]),
+                tue::math::round(m[2]),
+                tue::math::round(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> trunc_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::trunc(m[0]),
+                tue::math::trunc(m[1]),
+                tue::math::trunc(m[2]),
+                tue::math::trunc(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> fast_sin_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::fast::sin(m[0]),
+                tue::math::fast::sin(m[1]),
+                tue::math::fast::sin(m[2]),
+                tue::math::fast::sin(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> fast_cos_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::fast::cos(m[0]),
+                tue::math::fast::cos(m[1]),
+                tue::math::fast::cos(m[2]),
+                tue::math::fast::cos(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline void fast_sincos_m(
+            const mat<T, 4, R>& m,
+            mat<T, 4, R>& sin_out,
+            mat<T, 4, R>& cos_out) noexcept
+        {
+            tue::math::fast::sincos(m[0], sin_out[0], cos_out[0]);
+            tue::math::fast::sincos(m[1], sin_out[1], cos_out[1]);
+            tue::math::fast::sincos(m[2], sin_out[2], cos_out[2]);
+            tue::math::fast::sincos(m[3], sin_out[3], cos_out[3]);
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> fast_exp_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::fast::exp(m[0]),
+                tue::math::fast::exp(m[1]),
+                tue::math::fast::exp(m[2]),
+                tue::math::fast::exp(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> fast_log_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::fast::log(m[0]),
+                tue::math::fast::log(m[1]),
+                tue::math::fast::log(m[2]),
+                tue::math::fast::log(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> fast_pow_mm(
+            const mat<T, 4, R>& bases, const mat<T, 4, R>& exponents) noexcept
+        {
+            return {
+                tue::math::fast::pow(bases[0], exponents[0]),
+                tue::math::fast::pow(bases[1], exponents[1]),
+                tue::math::fast::pow(bases[2], exponents[2]),
+                tue::math::fast::pow(bases[3], exponents[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> fast_recip_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::fast::recip(m[0]),
+                tue::math::fast::recip(m[1]),
+                tue::math::fast::recip(m[2]),
+                tue::math::fast::recip(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> fast_rsqrt_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::fast::rsqrt(m[0]),
+                tue::math::fast::rsqrt(m[1]),
+                tue::math::fast::rsqrt(m[2]),
+                tue::math::fast::rsqrt(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> precise_sin_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::precise::sin(m[0]),
+                tue::math::precise::sin(m[1]),
+                tue::math::precise::sin(m[2]),
+                tue::math::precise::sin(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> precise_cos_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::precise::cos(m[0]),
+                tue::math::precise::cos(m[1]),
+                tue::math::precise::cos(m[2]),
+                tue::math::precise::cos(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline void precise_sincos_m(
+            const mat<T, 4, R>& m,
+            mat<T, 4, R>& sin_out,
+            mat<T, 4, R>& cos_out) noexcept
+        {
+            tue::math::precise::sincos(m[0], sin_out[0], cos_out[0]);
+            tue::math::precise::sincos(m[1], sin_out[1], cos_out[1]);
+            tue::math::precise::sincos(m[2], sin_out[2], cos_out[2]);
+            tue::math::precise::sincos(m[3], sin_out[3], cos_out[3]);
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> precise_exp_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::precise::exp(m[0]),
+                tue::math::precise::exp(m[1]),
+                tue::math::precise::exp(m[2]),
+                tue::math::precise::exp(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> precise_log_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::precise::log(m[0]),
+                tue::math::precise::log(m[1]),
+                tue::math::precise::log(m[2]),
+                tue::math::precise::log(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> precise_pow_mm(
+            const mat<T, 4, R>& bases, const mat<T, 4, R>& exponents) noexcept
+        {
+            return {
+                tue::math::precise::pow(bases[0], exponents[0]),
+                tue::math::precise::pow(bases[1], exponents[1]),
+                tue::math::precise::pow(bases[2], exponents[2]),
+                tue::math::precise::pow(bases[3], exponents[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> precise_recip_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::precise::recip(m[0]),
+                tue::math::precise::recip(m[1]),
+                tue::math::precise::recip(m[2]),
+                tue::math::precise::recip(m[3]),
+            };
+        }
+
+        template<typename T, int R>
+        inline mat<T, 4, R> precise_rsqrt_m(const mat<T, 4, R>& m) noexcept
+        {
+            return {
+                tue::math::precise::rsqrt(m[0]),
+                tue::math::precise::rsqrt(m[1]),
+                tue::math::precise::rsqrt(m[2]),
+                tue::math::precise::rsqrt(m[3]),
+            };
+        }
+
         template<typename T, int R>
         inline mat<T, 4, R> min_mm(
             const mat<T, 4, R>& m1, const mat<T, 4, R>& m2) noexcept
@@ -22,8 +22,8 @@ namespace tue
         matmult_component_mv(
             const mat<T, 2, R>& lhs, const vec<U, 2>& rhs, int j) noexcept
         {
-            return lhs[0][j] * rhs[0]
-                 + lhs[1][j] * rhs[1];
+            return tue::detail_::madd(
+                lhs[1][j], rhs[1], lhs[0][j] * rhs[0]);
         }
 
         template<typename T, typename U, int R>
@@ -31,9 +31,9 @@ namespace tue
         matmult_component_mv(
             const mat<T, 3, R>& lhs, const vec<U, 3>& rhs, int j) noexcept
         {
-            return lhs[0][j] * rhs[0]
-                 + lhs[1][j] * rhs[1]
-                 + lhs[2][j] * rhs[2];
+            return tue::detail_::madd(
+                lhs[2][j], rhs[2], tue::detail_::madd(
+                lhs[1][j], rhs[1], lhs[0][j] * rhs[0]));
         }
 
         template<typename T, typename U, int R>
@@ -41,10 +41,10 @@ namespace tue
         matmult_component_mv(
             const mat<T, 4, R>& lhs, const vec<U, 4>& rhs, int j) noexcept
         {
-            return lhs[0][j] * rhs[0]
-                 + lhs[1][j] * rhs[1]
-                 + lhs[2][j] * rhs[2]
-                 + lhs[3][j] * rhs[3];
+            return tue::detail_::madd(
+                lhs[3][j], rhs[3], tue::detail_::madd(
+                lhs[2][j], rhs[2], tue::detail_::madd(
+                lhs[1][j], rhs[1], lhs[0][j] * rhs[0])));
         }
 
         template<typename T, typename U, int C, int R>
@@ -53,8 +53,8 @@ namespace tue
             const mat<T, 2, R>& lhs, const mat<U, C, 2>& rhs,
             int i, int j) noexcept
         {
-            return lhs[0][j] * rhs[i][0]
-                 + lhs[1][j] * rhs[i][1];
+            return tue::detail_::madd(
+                lhs[1][j], rhs[i][1], lhs[0][j] * rhs[i][0]);
         }
 
         template<typename T, typename U, int C, int R>
@@ -63,9 +63,9 @@ namespace tue
             const mat<T, 3, R>& lhs, const mat<U, C, 3>& rhs,
             int i, int j) noexcept
         {
-            return lhs[0][j] * rhs[i][0]
-                 + lhs[1][j] * rhs[i][1]
-                 + lhs[2][j] * rhs[i][2];
+            return tue::detail_::madd(
+                lhs[2][j], rhs[i][2], tue::detail_::madd(
+                lhs[1][j], rhs[i][1], lhs[0][j] * rhs[i][0]));
         }
 
         template<typename T, typename U, int C, int R>
@@ -74,10 +74,10 @@ namespace tue
             const mat<T, 4, R>& lhs, const mat<U, C, 4>& rhs,
             int i, int j) noexcept
         {
-            return lhs[0][j] * rhs[i][0]
-                 + lhs[1][j] * rhs[i][1]
-                 + lhs[2][j] * rhs[i][2]
-                 + lhs[3][j] * rhs[i][3];
+            return tue::detail_::madd(
+                lhs[3][j], rhs[i][3], tue::detail_::madd(
+                lhs[2][j], rhs[i][2], tue::detail_::madd(
+                lhs[1][j], rhs[i][1], lhs[0][j] * rhs[i][0])));
         }
 
         template<typename T, typename U, int C, int N>
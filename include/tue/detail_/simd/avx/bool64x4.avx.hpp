@@ -0,0 +1,384 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <type_traits>
+
+#include "../../../simd.hpp"
+#include "../../../sized_bool.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<bool64, 4>())
+    simd<bool64, 4>
+    {
+        __m256d underlying_;
+
+    private:
+        template<typename U>
+        static bool64x4 explicit_cast(const simd<U, 4>& s) noexcept
+        {
+            return {
+                bool64(s.data()[0]),
+                bool64(s.data()[1]),
+                bool64(s.data()[2]),
+                bool64(s.data()[3]),
+            };
+        }
+
+    public:
+        using component_type = bool64;
+
+        static constexpr int component_count = 4;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(bool64 x) noexcept
+        :
+            underlying_(_mm256_set1_pd(tue::detail_::binary_double(x)))
+        {
+        }
+
+        template<int M = 4, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            bool64 x, bool64 y) noexcept;
+
+        template<int M = 4, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            bool64 x, bool64 y, bool64 z, bool64 w) noexcept
+        :
+            underlying_(_mm256_setr_pd(
+                tue::detail_::binary_double(x),
+                tue::detail_::binary_double(y),
+                tue::detail_::binary_double(z),
+                tue::detail_::binary_double(w)))
+        {
+        }
+
+        template<int M = 4, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            bool64 s0, bool64 s1, bool64 s2, bool64 s3,
+            bool64 s4, bool64 s5, bool64 s6, bool64 s7) noexcept;
+
+        template<int M = 4, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            bool64  s0, bool64  s1, bool64  s2, bool64  s3,
+            bool64  s4, bool64  s5, bool64  s6, bool64  s7,
+            bool64  s8, bool64  s9, bool64 s10, bool64 s11,
+            bool64 s12, bool64 s13, bool64 s14, bool64 s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 4>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256d underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256d() const noexcept
+        {
+            return underlying_;
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(_mm256_castsi256_pd(underlying))
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return _mm256_castpd_si256(underlying_);
+        }
+
+        static bool64x4 zero() noexcept
+        {
+            return _mm256_setzero_pd();
+        }
+
+        static bool64x4 load(const bool64* data) noexcept
+        {
+            return _mm256_load_pd(reinterpret_cast<const double*>(data));
+        }
+
+        static bool64x4 loadu(const bool64* data) noexcept
+        {
+            return _mm256_loadu_pd(reinterpret_cast<const double*>(data));
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool64x4 gather(
+            const bool64* base, const simd<I, 4>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool64x4 gather(
+            const bool64* base,
+            const simd<I, 4>& indices,
+            const bool64x4& conditions) noexcept;
+
+        inline static bool64x4 load_partial(
+            const bool64* data, int count) noexcept;
+
+        inline static bool64x4 maskload(
+            const bool64* data, const bool64x4& conditions) noexcept;
+
+        void store(bool64* data) const noexcept
+        {
+            _mm256_store_pd(reinterpret_cast<double*>(data), underlying_);
+        }
+
+        void storeu(bool64* data) const noexcept
+        {
+            _mm256_storeu_pd(reinterpret_cast<double*>(data), underlying_);
+        }
+
+        void stream(bool64* data) const noexcept
+        {
+            _mm256_stream_pd(reinterpret_cast<double*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool64* base, const simd<I, 4>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool64* base,
+            const simd<I, 4>& indices,
+            const bool64x4& conditions) const noexcept;
+
+        inline void store_partial(bool64* data, int count) const noexcept;
+
+        inline void maskstore(
+            bool64* data, const bool64x4& conditions) const noexcept;
+
+        const bool64* data() const noexcept
+        {
+            return reinterpret_cast<const bool64*>(&underlying_);
+        }
+
+        bool64* data() noexcept
+        {
+            return reinterpret_cast<bool64*>(&underlying_);
+        }
+    };
+}
+
+namespace tue
+{
+    template<typename I, typename>
+    inline bool64x4 bool64x4::gather(
+        const bool64* base, const simd<I, 4>& indices) noexcept
+    {
+        return tue::detail_::gather_components<bool64x4>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline bool64x4 bool64x4::gather(
+        const bool64* base,
+        const simd<I, 4>& indices,
+        const bool64x4& conditions) noexcept
+    {
+        return tue::detail_::gather_components<bool64x4>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void bool64x4::scatter(
+        bool64* base, const simd<I, 4>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void bool64x4::scatter(
+        bool64* base,
+        const simd<I, 4>& indices,
+        const bool64x4& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline bool64x4 bool64x4::load_partial(
+        const bool64* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm256_cmp_pd(
+                _mm256_setr_pd(0.0, 1.0, 2.0, 3.0),
+                _mm256_set1_pd(count),
+                _CMP_LT_OQ));
+    }
+
+    inline bool64x4 bool64x4::maskload(
+        const bool64* data, const bool64x4& conditions) noexcept
+    {
+        return _mm256_maskload_pd(
+            reinterpret_cast<const double*>(data),
+            _mm256_castpd_si256(conditions));
+    }
+
+    inline void bool64x4::store_partial(bool64* data, int count) const noexcept
+    {
+        maskstore(
+            data,
+            _mm256_cmp_pd(
+                _mm256_setr_pd(0.0, 1.0, 2.0, 3.0),
+                _mm256_set1_pd(count),
+                _CMP_LT_OQ));
+    }
+
+    inline void bool64x4::maskstore(
+        bool64* data, const bool64x4& conditions) const noexcept
+    {
+        _mm256_maskstore_pd(
+            reinterpret_cast<double*>(data), _mm256_castpd_si256(conditions),
+            underlying_);
+    }
+
+    namespace detail_
+    {
+        inline bool64x4 bitwise_not_operator_s(
+            const bool64x4& s) noexcept
+        {
+            return _mm256_xor_pd(s, bool64x4(true64));
+        }
+
+        inline bool64x4 bitwise_and_operator_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return _mm256_and_pd(lhs, rhs);
+        }
+
+        inline bool64x4 bitwise_or_operator_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return _mm256_or_pd(lhs, rhs);
+        }
+
+        inline bool64x4 bitwise_xor_operator_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return _mm256_xor_pd(lhs, rhs);
+        }
+
+        inline bool64x4& bitwise_and_assignment_operator_ss(
+            bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return lhs = _mm256_and_pd(lhs, rhs);
+        }
+
+        inline bool64x4& bitwise_or_assignment_operator_ss(
+            bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return lhs = _mm256_or_pd(lhs, rhs);
+        }
+
+        inline bool64x4& bitwise_xor_assignment_operator_ss(
+            bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return lhs = _mm256_xor_pd(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            const __m256i diff = bool64x4(_mm256_xor_pd(lhs, rhs));
+            return _mm256_testz_si256(diff, diff) != 0;
+        }
+
+        inline bool inequality_operator_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            const __m256i diff = bool64x4(_mm256_xor_pd(lhs, rhs));
+            return _mm256_testz_si256(diff, diff) == 0;
+        }
+
+        inline bool64x4 mask_ss(
+            const bool64x4& conditions,
+            const bool64x4& values) noexcept
+        {
+            return _mm256_and_pd(conditions, values);
+        }
+
+        inline bool64x4 select_sss(
+            const bool64x4& conditions,
+            const bool64x4& values,
+            const bool64x4& otherwise) noexcept
+        {
+            return _mm256_blendv_pd(otherwise, values, conditions);
+        }
+
+        inline bool64x4 equal_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            // AVX has no 256-bit integer compare, so compare each 128-bit
+            // half with SSE2.
+            const __m256i l = lhs;
+            const __m256i r = rhs;
+            __m128i lo = _mm_cmpeq_epi32(
+                _mm256_castsi256_si128(l), _mm256_castsi256_si128(r));
+            __m128i hi = _mm_cmpeq_epi32(
+                _mm256_extractf128_si256(l, 1),
+                _mm256_extractf128_si256(r, 1));
+            lo = _mm_and_si128(
+                _mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 3, 1, 1)),
+                _mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 2, 0, 0)));
+            hi = _mm_and_si128(
+                _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 3, 1, 1)),
+                _mm_shuffle_epi32(hi, _MM_SHUFFLE(2, 2, 0, 0)));
+            return _mm256_insertf128_si256(
+                _mm256_castsi128_si256(lo), hi, 1);
+        }
+
+        inline bool64x4 not_equal_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            return _mm256_xor_pd(equal_ss(lhs, rhs), bool64x4(true64));
+        }
+
+        inline std::uint64_t movemask_s(const bool64x4& s) noexcept
+        {
+            return static_cast<std::uint64_t>(_mm256_movemask_pd(s));
+        }
+
+        inline bool any_s(const bool64x4& s) noexcept
+        {
+            return _mm256_movemask_pd(s) != 0;
+        }
+
+        inline bool all_s(const bool64x4& s) noexcept
+        {
+            return _mm256_movemask_pd(s) == 0xF;
+        }
+
+        inline bool none_s(const bool64x4& s) noexcept
+        {
+            return _mm256_movemask_pd(s) == 0;
+        }
+    }
+}
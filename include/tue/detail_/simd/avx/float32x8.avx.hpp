@@ -0,0 +1,1170 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+// This file contains code based on Julien Pommier's sse_mathfun.h originally
+// published at http://gruntthepeon.free.fr/ssemath/ under the following
+// license:
+//
+// Copyright (C) 2007 Julien Pommier
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from
+// the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software in
+//    a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// (this is the zlib license)
+
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../../../simd.hpp"
+#include "soa_transpose.avx.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<float, 8>())
+    simd<float, 8>
+    {
+        __m256 underlying_;
+
+    private:
+        template<typename U>
+        static float32x8 explicit_cast(const simd<U, 8>& s) noexcept
+        {
+            return {
+                float(s.data()[0]),
+                float(s.data()[1]),
+                float(s.data()[2]),
+                float(s.data()[3]),
+                float(s.data()[4]),
+                float(s.data()[5]),
+                float(s.data()[6]),
+                float(s.data()[7]),
+            };
+        }
+
+    public:
+        using component_type = float;
+
+        static constexpr int component_count = 8;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(float x) noexcept
+        :
+            underlying_(_mm256_set1_ps(x))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            float x, float y) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            float x, float y, float z, float w) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            float s0, float s1, float s2, float s3,
+            float s4, float s5, float s6, float s7) noexcept
+        :
+            underlying_(_mm256_setr_ps(s0, s1, s2, s3, s4, s5, s6, s7))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            float  s0, float  s1, float  s2, float  s3,
+            float  s4, float  s5, float  s6, float  s7,
+            float  s8, float  s9, float s10, float s11,
+            float s12, float s13, float s14, float s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 8>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256 underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256() const noexcept
+        {
+            return underlying_;
+        }
+
+        static float32x8 zero() noexcept
+        {
+            return _mm256_setzero_ps();
+        }
+
+        static float32x8 load(const float* data) noexcept
+        {
+            return _mm256_load_ps(data);
+        }
+
+        static float32x8 loadu(const float* data) noexcept
+        {
+            return _mm256_loadu_ps(data);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static float32x8 gather(
+            const float* base, const simd<I, 8>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static float32x8 gather(
+            const float* base,
+            const simd<I, 8>& indices,
+            const bool32x8& conditions) noexcept;
+
+        inline static float32x8 load_partial(
+            const float* data, int count) noexcept;
+
+        inline static float32x8 maskload(
+            const float* data, const bool32x8& conditions) noexcept;
+
+        void store(float* data) const noexcept
+        {
+            _mm256_store_ps(data, underlying_);
+        }
+
+        void storeu(float* data) const noexcept
+        {
+            _mm256_storeu_ps(data, underlying_);
+        }
+
+        void stream(float* data) const noexcept
+        {
+            _mm256_stream_ps(data, underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            float* base, const simd<I, 8>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            float* base,
+            const simd<I, 8>& indices,
+            const bool32x8& conditions) const noexcept;
+
+        inline void store_partial(float* data, int count) const noexcept;
+
+        inline void maskstore(
+            float* data, const bool32x8& conditions) const noexcept;
+
+        const float* data() const noexcept
+        {
+            return reinterpret_cast<const float*>(&underlying_);
+        }
+
+        float* data() noexcept
+        {
+            return reinterpret_cast<float*>(&underlying_);
+        }
+    };
+}
+
+#include "bool32x8.avx.hpp"
+#include "../sse/float32x4.sse.hpp"
+
+namespace tue
+{
+    template<typename I, typename>
+    inline float32x8 float32x8::gather(
+        const float* base, const simd<I, 8>& indices) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm256_i32gather_ps(base, indices, 4);
+#else
+        const auto iimpl = reinterpret_cast<const simd<I, 4>*>(&indices);
+        return _mm256_insertf128_ps(
+            _mm256_castps128_ps256(float32x4::gather(base, iimpl[0])),
+            float32x4::gather(base, iimpl[1]),
+            1);
+#endif
+    }
+
+    template<typename I, typename>
+    inline float32x8 float32x8::gather(
+        const float* base,
+        const simd<I, 8>& indices,
+        const bool32x8& conditions) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm256_mask_i32gather_ps(
+            _mm256_setzero_ps(), base, indices, conditions, 4);
+#else
+        return tue::detail_::gather_components<float32x8>(
+            base, indices, conditions);
+#endif
+    }
+
+    template<typename I, typename>
+    inline void float32x8::scatter(
+        float* base, const simd<I, 8>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void float32x8::scatter(
+        float* base,
+        const simd<I, 8>& indices,
+        const bool32x8& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline float32x8 float32x8::load_partial(
+        const float* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm256_cmp_ps(
+                _mm256_setr_ps(
+                    0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f),
+                _mm256_set1_ps(static_cast<float>(count)),
+                _CMP_LT_OQ));
+    }
+
+    inline float32x8 float32x8::maskload(
+        const float* data, const bool32x8& conditions) noexcept
+    {
+        return _mm256_maskload_ps(data, _mm256_castps_si256(conditions));
+    }
+
+    inline void float32x8::store_partial(float* data, int count) const noexcept
+    {
+        maskstore(
+            data,
+            _mm256_cmp_ps(
+                _mm256_setr_ps(
+                    0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f),
+                _mm256_set1_ps(static_cast<float>(count)),
+                _CMP_LT_OQ));
+    }
+
+    inline void float32x8::maskstore(
+        float* data, const bool32x8& conditions) const noexcept
+    {
+        _mm256_maskstore_ps(
+            data, _mm256_castps_si256(conditions), underlying_);
+    }
+
+    namespace detail_
+    {
+        inline float32x8 unary_plus_operator_s(const float32x8& s) noexcept
+        {
+            return s;
+        }
+
+        inline float32x8& pre_increment_operator_s(float32x8& s) noexcept
+        {
+            return s = _mm256_add_ps(s, float32x8(1.0f));
+        }
+
+        inline float32x8 post_increment_operator_s(float32x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_ps(s, float32x8(1.0f));
+            return result;
+        }
+
+        inline float32x8 unary_minus_operator_s(const float32x8& s) noexcept
+        {
+            return _mm256_xor_ps(s, float32x8(binary_float(0x80000000u)));
+        }
+
+        inline float32x8& pre_decrement_operator_s(float32x8& s) noexcept
+        {
+            return s = _mm256_sub_ps(s, float32x8(1.0f));
+        }
+
+        inline float32x8 post_decrement_operator_s(float32x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_ps(s, float32x8(1.0f));
+            return result;
+        }
+
+        inline float32x8 addition_operator_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_add_ps(lhs, rhs);
+        }
+
+        inline float32x8 subtraction_operator_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_sub_ps(lhs, rhs);
+        }
+
+        inline float32x8 multiplication_operator_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_mul_ps(lhs, rhs);
+        }
+
+        inline float32x8 division_operator_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_div_ps(lhs, rhs);
+        }
+
+        inline float32x8& addition_assignment_operator_ss(
+            float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return lhs = _mm256_add_ps(lhs, rhs);
+        }
+
+        inline float32x8& subtraction_assignment_operator_ss(
+            float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return lhs = _mm256_sub_ps(lhs, rhs);
+        }
+
+        inline float32x8& multiplication_assignment_operator_ss(
+            float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return lhs = _mm256_mul_ps(lhs, rhs);
+        }
+
+        inline float32x8& division_assignment_operator_ss(
+            float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return lhs = _mm256_div_ps(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_movemask_ps(
+                _mm256_cmp_ps(lhs, rhs, _CMP_NEQ_UQ)) == 0;
+        }
+
+        inline bool inequality_operator_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_movemask_ps(
+                _mm256_cmp_ps(lhs, rhs, _CMP_NEQ_UQ)) != 0;
+        }
+
+        inline void sincos_s(
+            const float32x8& s,
+            float32x8& sin_out,
+            float32x8& cos_out) noexcept
+        {
+            // This function's implementation is based on Julien Pommier's
+            // sincos_ps(). See the top of this file for details.
+            //
+            // AVX lacks 256-bit integer arithmetic, so the octant flags are
+            // derived from j mod 8 with floating point arithmetic instead of
+            // integer masks and shifts.
+            __m256 x = s;
+
+            __m256 xmm1, xmm2, xmm3, sign_bit_sin, y;
+
+            const __m256 sign_mask = _mm256_set1_ps(binary_float(0x80000000));
+
+            sign_bit_sin = x;
+
+            /* take the absolute value */
+            x = _mm256_andnot_ps(sign_mask, x);
+
+            /* extract the sign bit (upper one) */
+            sign_bit_sin = _mm256_and_ps(sign_bit_sin, sign_mask);
+
+            /* scale by 4/Pi */
+            y = _mm256_mul_ps(x, _mm256_set1_ps(1.27323954473516f));
+
+            /* j=(j+1) & (~1) (see the cephes sources) */
+            y = _mm256_floor_ps(y);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.0f));
+            y = _mm256_mul_ps(y, _mm256_set1_ps(0.5f));
+            y = _mm256_floor_ps(y);
+            y = _mm256_add_ps(y, y);
+
+            /* octant = j mod 8, one of 0, 2, 4 or 6 */
+            __m256 octant = _mm256_mul_ps(y, _mm256_set1_ps(0.125f));
+            octant = _mm256_floor_ps(octant);
+            octant = _mm256_mul_ps(octant, _mm256_set1_ps(8.0f));
+            octant = _mm256_sub_ps(y, octant);
+
+            /* get the swap sign flag for the sine */
+            __m256 swap_sign_bit_sin = _mm256_and_ps(
+                _mm256_cmp_ps(octant, _mm256_set1_ps(4.0f), _CMP_GE_OQ),
+                sign_mask);
+
+            /* get the polynom selection mask for the sine */
+            __m256 poly_mask = _mm256_or_ps(
+                _mm256_cmp_ps(octant, _mm256_setzero_ps(), _CMP_EQ_OQ),
+                _mm256_cmp_ps(octant, _mm256_set1_ps(4.0f), _CMP_EQ_OQ));
+
+            /* get the sign flag for the cosine */
+            __m256 sign_bit_cos = _mm256_and_ps(
+                _mm256_and_ps(
+                    _mm256_cmp_ps(octant, _mm256_set1_ps(2.0f), _CMP_GE_OQ),
+                    _mm256_cmp_ps(octant, _mm256_set1_ps(4.0f), _CMP_LE_OQ)),
+                sign_mask);
+
+            sign_bit_sin = _mm256_xor_ps(sign_bit_sin, swap_sign_bit_sin);
+
+            /* The magic pass: "Extended precision modular arithmetic"
+               x = ((x - y * DP1) - y * DP2) - y * DP3; */
+            xmm1 = _mm256_set1_ps(-0.78515625f);
+            xmm2 = _mm256_set1_ps(-2.4187564849853515625e-4f);
+            xmm3 = _mm256_set1_ps(-3.77489497744594108e-8f);
+            xmm1 = _mm256_mul_ps(y, xmm1);
+            xmm2 = _mm256_mul_ps(y, xmm2);
+            xmm3 = _mm256_mul_ps(y, xmm3);
+            x = _mm256_add_ps(x, xmm1);
+            x = _mm256_add_ps(x, xmm2);
+            x = _mm256_add_ps(x, xmm3);
+
+            /* Evaluate the first polynom  (0 <= x <= Pi/4) */
+            __m256 z = _mm256_mul_ps(x,x);
+            y = _mm256_set1_ps(2.443315711809948e-5f);
+
+            y = _mm256_mul_ps(y, z);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-1.388731625493765e-3f));
+            y = _mm256_mul_ps(y, z);
+            y = _mm256_add_ps(y, _mm256_set1_ps(4.166664568298827e-2f));
+            y = _mm256_mul_ps(y, z);
+            y = _mm256_mul_ps(y, z);
+            __m256 tmp = _mm256_mul_ps(z, _mm256_set1_ps(0.5f));
+            y = _mm256_sub_ps(y, tmp);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.0f));
+
+            /* Evaluate the second polynom  (Pi/4 <= x <= 0) */
+            __m256 y2 = _mm256_set1_ps(-1.9515295891e-4f);
+            y2 = _mm256_mul_ps(y2, z);
+            y2 = _mm256_add_ps(y2, _mm256_set1_ps(8.3321608736e-3f));
+            y2 = _mm256_mul_ps(y2, z);
+            y2 = _mm256_add_ps(y2, _mm256_set1_ps(-1.6666654611e-1f));
+            y2 = _mm256_mul_ps(y2, z);
+            y2 = _mm256_mul_ps(y2, x);
+            y2 = _mm256_add_ps(y2, x);
+
+            /* select the correct result from the two polynoms */
+            xmm3 = poly_mask;
+            __m256 ysin2 = _mm256_and_ps(xmm3, y2);
+            __m256 ysin1 = _mm256_andnot_ps(xmm3, y);
+            y2 = _mm256_sub_ps(y2,ysin2);
+            y = _mm256_sub_ps(y, ysin1);
+
+            xmm1 = _mm256_add_ps(ysin1,ysin2);
+            xmm2 = _mm256_add_ps(y,y2);
+
+            /* update the sign */
+            sin_out = _mm256_xor_ps(xmm1, sign_bit_sin);
+            cos_out = _mm256_xor_ps(xmm2, sign_bit_cos);
+        }
+
+        inline float32x8 sin_s(const float32x8& s) noexcept
+        {
+            float32x8 sin, cos;
+            sincos_s(s, sin, cos);
+            return sin;
+        }
+
+        inline float32x8 cos_s(const float32x8& s) noexcept
+        {
+            float32x8 sin, cos;
+            sincos_s(s, sin, cos);
+            return cos;
+        }
+
+        inline float32x8 exp_s(const float32x8& s) noexcept
+        {
+            // This function's implementation is based on Julien Pommier's
+            // exp_ps(). See the top of this file for details.
+            __m256 x = s;
+
+            __m256 tmp, fx;
+
+            __m256 one = _mm256_set1_ps(1.0f);
+
+            x = _mm256_min_ps(x, _mm256_set1_ps(88.3762626647949f));
+            x = _mm256_max_ps(x, _mm256_set1_ps(-88.3762626647949f));
+
+            /* express exp(x) as exp(g + n*log(2)) */
+            fx = _mm256_mul_ps(x, _mm256_set1_ps(1.44269504088896341f));
+            fx = _mm256_add_ps(fx, _mm256_set1_ps(0.5f));
+            fx = _mm256_floor_ps(fx);
+
+            tmp = _mm256_mul_ps(fx, _mm256_set1_ps(0.693359375f));
+            __m256 z = _mm256_mul_ps(fx, _mm256_set1_ps(-2.12194440e-4f));
+            x = _mm256_sub_ps(x, tmp);
+            x = _mm256_sub_ps(x, z);
+
+            z = _mm256_mul_ps(x, x);
+
+            __m256 y = _mm256_set1_ps(1.9875691500e-4f);
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.3981999507e-3f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(8.3334519073e-3f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(4.1665795894e-2f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.6666665459e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(5.0000001201e-1f));
+            y = _mm256_mul_ps(y, z);
+            y = _mm256_add_ps(y, x);
+            y = _mm256_add_ps(y, one);
+
+            /* build 2^n: (n + 127) << 23 is computed as (n + 127) * 2^23 so
+               the conversion to integer produces the bit pattern directly */
+            tmp = _mm256_add_ps(fx, _mm256_set1_ps(127.0f));
+            tmp = _mm256_mul_ps(tmp, _mm256_set1_ps(8388608.0f));
+            __m256 pow2n = _mm256_castsi256_ps(_mm256_cvttps_epi32(tmp));
+
+            y = _mm256_mul_ps(y, pow2n);
+            return y;
+        }
+
+        inline float32x8 log_s(const float32x8& s) noexcept
+        {
+            // This function's implementation is based on Julien Pommier's
+            // log_ps(). See the top of this file for details.
+            __m256 x = s;
+
+            __m256 one = _mm256_set1_ps(1.0f);
+
+            __m256 invalid_mask = _mm256_cmp_ps(
+                x, _mm256_setzero_ps(), _CMP_LE_OS);
+
+            /* cut off denormalized stuff */
+            x = _mm256_max_ps(x, _mm256_set1_ps(binary_float(0x00800000)));
+
+            /* part 1: x = frexpf(x, &e); the masked exponent bits convert
+               exactly to (e + 127) * 2^23 */
+            __m256 e = _mm256_and_ps(
+                x, _mm256_set1_ps(binary_float(0x7f800000)));
+            e = _mm256_cvtepi32_ps(_mm256_castps_si256(e));
+            e = _mm256_mul_ps(e, _mm256_set1_ps(1.0f / 8388608.0f));
+            e = _mm256_sub_ps(e, _mm256_set1_ps(127.0f));
+            e = _mm256_add_ps(e, one);
+
+            /* keep only the fractional part */
+            x = _mm256_and_ps(x, _mm256_set1_ps(binary_float(~0x7f800000)));
+            x = _mm256_or_ps(x, _mm256_set1_ps(0.5f));
+
+            /* part2:
+            if( x < SQRTHF ) {
+            e -= 1;
+            x = x + x - 1.0;
+            } else { x = x - 1.0; }
+            */
+            __m256 mask = _mm256_cmp_ps(
+                x, _mm256_set1_ps(0.707106781186547524f), _CMP_LT_OS);
+            __m256 tmp = _mm256_and_ps(x, mask);
+            x = _mm256_sub_ps(x, one);
+            e = _mm256_sub_ps(e, _mm256_and_ps(one, mask));
+            x = _mm256_add_ps(x, tmp);
+
+            __m256 z = _mm256_mul_ps(x, x);
+
+            __m256 y = _mm256_set1_ps(7.0376836292e-2f);
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-1.1514610310e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.1676998740e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-1.2420140846e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.4249322787e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-1.6668057665e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(2.0000714765e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(-2.4999993993e-1f));
+            y = _mm256_mul_ps(y, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(3.3333331174e-1f));
+            y = _mm256_mul_ps(y, x);
+
+            y = _mm256_mul_ps(y, z);
+
+            tmp = _mm256_mul_ps(e, _mm256_set1_ps(-2.12194440e-4f));
+            y = _mm256_add_ps(y, tmp);
+
+            tmp = _mm256_mul_ps(z, _mm256_set1_ps(0.5f));
+            y = _mm256_sub_ps(y, tmp);
+
+            tmp = _mm256_mul_ps(e, _mm256_set1_ps(0.693359375f));
+            x = _mm256_add_ps(x, y);
+            x = _mm256_add_ps(x, tmp);
+            x = _mm256_or_ps(x, invalid_mask); // negative arg will be NAN
+            return x;
+        }
+
+        inline float32x8 abs_s(const float32x8& s) noexcept
+        {
+            return _mm256_and_ps(s, float32x8(binary_float(0x7FFFFFFF)));
+        }
+
+        inline float32x8 pow_ss(
+            const float32x8& bases, const float32x8& exponents) noexcept
+        {
+            // See the float32x4 version.
+            const __m256 one = _mm256_set1_ps(1.0f);
+            const __m256 ones = _mm256_or_ps(
+                _mm256_cmp_ps(exponents, _mm256_setzero_ps(), _CMP_EQ_OQ),
+                _mm256_cmp_ps(bases, one, _CMP_EQ_OQ));
+            const __m256 x =
+                exp_s(float32x8(_mm256_mul_ps(log_s(bases), exponents)));
+            return _mm256_blendv_ps(x, one, ones);
+        }
+
+        inline float32x8 tan_s(const float32x8& s) noexcept
+        {
+            // Each 128-bit half goes through the narrower kernel.
+            const __m256 x = s;
+            const float32x4 lo = _mm256_castps256_ps128(x);
+            const float32x4 hi = _mm256_extractf128_ps(x, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(tan_s(lo)), tan_s(hi), 1);
+        }
+
+        inline float32x8 asin_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            const float32x4 lo = _mm256_castps256_ps128(x);
+            const float32x4 hi = _mm256_extractf128_ps(x, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(asin_s(lo)), asin_s(hi), 1);
+        }
+
+        inline float32x8 acos_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            const float32x4 lo = _mm256_castps256_ps128(x);
+            const float32x4 hi = _mm256_extractf128_ps(x, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(acos_s(lo)), acos_s(hi), 1);
+        }
+
+        inline float32x8 atan_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            const float32x4 lo = _mm256_castps256_ps128(x);
+            const float32x4 hi = _mm256_extractf128_ps(x, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(atan_s(lo)), atan_s(hi), 1);
+        }
+
+        inline float32x8 atan2_ss(
+            const float32x8& y, const float32x8& x) noexcept
+        {
+            const __m256 a = y;
+            const __m256 b = x;
+            const float32x4 alo = _mm256_castps256_ps128(a);
+            const float32x4 ahi = _mm256_extractf128_ps(a, 1);
+            const float32x4 blo = _mm256_castps256_ps128(b);
+            const float32x4 bhi = _mm256_extractf128_ps(b, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(atan2_ss(alo, blo)),
+                atan2_ss(ahi, bhi), 1);
+        }
+
+        inline float32x8 exp2_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            const float32x4 lo = _mm256_castps256_ps128(x);
+            const float32x4 hi = _mm256_extractf128_ps(x, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(exp2_s(lo)), exp2_s(hi), 1);
+        }
+
+        inline float32x8 log2_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            const float32x4 lo = _mm256_castps256_ps128(x);
+            const float32x4 hi = _mm256_extractf128_ps(x, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(log2_s(lo)), log2_s(hi), 1);
+        }
+
+        inline float32x8 log10_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            const float32x4 lo = _mm256_castps256_ps128(x);
+            const float32x4 hi = _mm256_extractf128_ps(x, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(log10_s(lo)), log10_s(hi), 1);
+        }
+
+        inline float32x8 cbrt_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            const float32x4 lo = _mm256_castps256_ps128(x);
+            const float32x4 hi = _mm256_extractf128_ps(x, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(cbrt_s(lo)), cbrt_s(hi), 1);
+        }
+
+        inline void fast_sincos_s(
+            const float32x8& s,
+            float32x8& sin_out,
+            float32x8& cos_out) noexcept
+        {
+            const __m256 x = s;
+            float32x4 slo, shi, clo, chi;
+            fast_sincos_s(_mm256_castps256_ps128(x), slo, clo);
+            fast_sincos_s(_mm256_extractf128_ps(x, 1), shi, chi);
+            sin_out = _mm256_insertf128_ps(
+                _mm256_castps128_ps256(slo), shi, 1);
+            cos_out = _mm256_insertf128_ps(
+                _mm256_castps128_ps256(clo), chi, 1);
+        }
+
+        inline float32x8 fast_sin_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            const float32x4 lo = _mm256_castps256_ps128(x);
+            const float32x4 hi = _mm256_extractf128_ps(x, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(fast_sin_s(lo)), fast_sin_s(hi), 1);
+        }
+
+        inline float32x8 fast_cos_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            const float32x4 lo = _mm256_castps256_ps128(x);
+            const float32x4 hi = _mm256_extractf128_ps(x, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(fast_cos_s(lo)), fast_cos_s(hi), 1);
+        }
+
+        inline float32x8 fast_exp_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            const float32x4 lo = _mm256_castps256_ps128(x);
+            const float32x4 hi = _mm256_extractf128_ps(x, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(fast_exp_s(lo)), fast_exp_s(hi), 1);
+        }
+
+        inline float32x8 fast_log_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            const float32x4 lo = _mm256_castps256_ps128(x);
+            const float32x4 hi = _mm256_extractf128_ps(x, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(fast_log_s(lo)), fast_log_s(hi), 1);
+        }
+
+        inline float32x8 fast_pow_ss(
+            const float32x8& bases, const float32x8& exponents) noexcept
+        {
+            const __m256 b = bases;
+            const __m256 e = exponents;
+            const float32x4 blo = _mm256_castps256_ps128(b);
+            const float32x4 bhi = _mm256_extractf128_ps(b, 1);
+            const float32x4 elo = _mm256_castps256_ps128(e);
+            const float32x4 ehi = _mm256_extractf128_ps(e, 1);
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(fast_pow_ss(blo, elo)),
+                fast_pow_ss(bhi, ehi), 1);
+        }
+
+        inline float32x8 fast_recip_s(const float32x8& s) noexcept
+        {
+            return _mm256_rcp_ps(s);
+        }
+
+        inline float32x8 recip_s(const float32x8& s) noexcept
+        {
+            // See the float32x4 version.
+            const __m256 x = s;
+            const __m256 r = _mm256_rcp_ps(x);
+#ifdef TUE_FMA
+            const __m256 e = _mm256_fnmadd_ps(x, r, _mm256_set1_ps(1.0f));
+            const __m256 y = _mm256_fmadd_ps(r, e, r);
+#else
+            const __m256 e = _mm256_sub_ps(
+                _mm256_set1_ps(1.0f), _mm256_mul_ps(x, r));
+            const __m256 y = _mm256_add_ps(r, _mm256_mul_ps(r, e));
+#endif
+            return _mm256_blendv_ps(r, y, _mm256_cmp_ps(y, y, _CMP_ORD_Q));
+        }
+
+        inline float32x8 precise_recip_s(const float32x8& s) noexcept
+        {
+            return _mm256_div_ps(_mm256_set1_ps(1.0f), s);
+        }
+
+        inline float32x8 sqrt_s(const float32x8& s) noexcept
+        {
+            return _mm256_sqrt_ps(s);
+        }
+
+        inline float32x8 fast_rsqrt_s(const float32x8& s) noexcept
+        {
+            return _mm256_rsqrt_ps(s);
+        }
+
+        inline float32x8 rsqrt_s(const float32x8& s) noexcept
+        {
+            // See the float32x4 version.
+            const __m256 x = s;
+            const __m256 r = _mm256_rsqrt_ps(x);
+#ifdef TUE_FMA
+            const __m256 e = _mm256_fnmadd_ps(
+                _mm256_mul_ps(x, r), r, _mm256_set1_ps(1.0f));
+            const __m256 y = _mm256_fmadd_ps(
+                _mm256_mul_ps(r, _mm256_set1_ps(0.5f)), e, r);
+#else
+            const __m256 h = _mm256_mul_ps(_mm256_set1_ps(0.5f), x);
+            const __m256 e = _mm256_sub_ps(
+                _mm256_set1_ps(1.5f),
+                _mm256_mul_ps(h, _mm256_mul_ps(r, r)));
+            const __m256 y = _mm256_mul_ps(r, e);
+#endif
+            return _mm256_blendv_ps(r, y, _mm256_cmp_ps(y, y, _CMP_ORD_Q));
+        }
+
+        inline float32x8 precise_rsqrt_s(const float32x8& s) noexcept
+        {
+            return _mm256_div_ps(
+                _mm256_set1_ps(1.0f), _mm256_sqrt_ps(s));
+        }
+
+        inline float32x8 floor_s(const float32x8& s) noexcept
+        {
+            return _mm256_round_ps(
+                s, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+
+        inline float32x8 ceil_s(const float32x8& s) noexcept
+        {
+            return _mm256_round_ps(
+                s, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        }
+
+        inline float32x8 round_s(const float32x8& s) noexcept
+        {
+            // _MM_FROUND_TO_NEAREST_INT rounds halfway cases to even, so add
+            // the largest value below 0.5 with the sign of s and truncate.
+            const auto half = _mm256_or_ps(
+                _mm256_and_ps(s, float32x8(binary_float(0x80000000))),
+                float32x8(binary_float(0x3EFFFFFF)));
+            return _mm256_round_ps(
+                _mm256_add_ps(s, half), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+        inline float32x8 trunc_s(const float32x8& s) noexcept
+        {
+            return _mm256_round_ps(
+                s, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+        inline float32x8 fma_sss(
+            const float32x8& s1,
+            const float32x8& s2,
+            const float32x8& s3) noexcept
+        {
+#ifdef TUE_FMA
+            return _mm256_fmadd_ps(s1, s2, s3);
+#else
+            return _mm256_add_ps(_mm256_mul_ps(s1, s2), s3);
+#endif
+        }
+
+        inline float32x8 min_ss(
+            const float32x8& s1, const float32x8& s2) noexcept
+        {
+            return _mm256_min_ps(s1, s2);
+        }
+
+        inline float32x8 max_ss(
+            const float32x8& s1, const float32x8& s2) noexcept
+        {
+            return _mm256_max_ps(s1, s2);
+        }
+
+        inline float reduce_add_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            return reduce_add_s(float32x4(_mm_add_ps(
+                _mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1))));
+        }
+
+        inline float reduce_min_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            return reduce_min_s(float32x4(_mm_min_ps(
+                _mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1))));
+        }
+
+        inline float reduce_max_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            return reduce_max_s(float32x4(_mm_max_ps(
+                _mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1))));
+        }
+
+        inline float32x8 mask_ss(
+            const bool32x8& conditions,
+            const float32x8& values) noexcept
+        {
+            return _mm256_and_ps(conditions, values);
+        }
+
+        inline float32x8 select_sss(
+            const bool32x8& conditions,
+            const float32x8& values,
+            const float32x8& otherwise) noexcept
+        {
+            return _mm256_blendv_ps(otherwise, values, conditions);
+        }
+
+        inline bool32x8 less_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OS);
+        }
+
+        inline bool32x8 less_equal_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_cmp_ps(lhs, rhs, _CMP_LE_OS);
+        }
+
+        inline bool32x8 greater_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_cmp_ps(lhs, rhs, _CMP_GT_OS);
+        }
+
+        inline bool32x8 greater_equal_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_cmp_ps(lhs, rhs, _CMP_GE_OS);
+        }
+
+        inline bool32x8 equal_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ);
+        }
+
+        inline bool32x8 not_equal_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            return _mm256_cmp_ps(lhs, rhs, _CMP_NEQ_UQ);
+        }
+
+        template<int... I>
+        inline float32x8 shuffle_s(
+            const float32x8& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+#ifdef TUE_AVX2
+            return _mm256_permutevar8x32_ps(s, _mm256_setr_epi32(I...));
+#else
+            // vpermilps only shuffles within each 128-bit half, so shuffle
+            // both s and s with its halves swapped, then blend in the
+            // components that cross over.
+            constexpr int crossing = tue::detail_::crossing_lanes<4, I...>();
+            const __m256i indices = _mm256_setr_epi32(I...);
+            const __m256 swapped = _mm256_permute2f128_ps(s, s, 0x01);
+            return _mm256_blend_ps(
+                _mm256_permutevar_ps(s, indices),
+                _mm256_permutevar_ps(swapped, indices),
+                crossing);
+#endif
+        }
+
+        template<int... I>
+        inline float32x8 shuffle_ss(
+            const float32x8& lhs,
+            const float32x8& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            constexpr int from_rhs =
+                tue::detail_::second_source_lanes<8, I...>();
+            return _mm256_blend_ps(
+                tue::detail_::shuffle_s(
+                    lhs, std::integer_sequence<int, (I % 8)...>()),
+                tue::detail_::shuffle_s(
+                    rhs, std::integer_sequence<int, (I % 8)...>()),
+                from_rhs);
+        }
+
+        template<int I>
+        inline float extract_s(
+            const float32x8& s, std::integral_constant<int, I>) noexcept
+        {
+            const __m128 half = _mm256_extractf128_ps(s, I / 4);
+            return _mm_cvtss_f32(_mm_shuffle_ps(half, half, I % 4));
+        }
+
+        template<int I>
+        inline float32x8 insert_s(
+            const float32x8& s,
+            float x,
+            std::integral_constant<int, I>) noexcept
+        {
+            return _mm256_blend_ps(s, _mm256_set1_ps(x), 1 << I);
+        }
+
+        inline float32x8 interleave_lo_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            // The unpack instructions interleave within each 128-bit half,
+            // so put the halves back in order afterwards.
+            const __m256 lo = _mm256_unpacklo_ps(lhs, rhs);
+            const __m256 hi = _mm256_unpackhi_ps(lhs, rhs);
+            return _mm256_permute2f128_ps(lo, hi, 0x20);
+        }
+
+        inline float32x8 interleave_hi_ss(
+            const float32x8& lhs, const float32x8& rhs) noexcept
+        {
+            const __m256 lo = _mm256_unpacklo_ps(lhs, rhs);
+            const __m256 hi = _mm256_unpackhi_ps(lhs, rhs);
+            return _mm256_permute2f128_ps(lo, hi, 0x31);
+        }
+
+        template<int... I>
+        inline bool32x8 shuffle_s(
+            const bool32x8& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return __m256(tue::detail_::shuffle_s(
+                float32x8(__m256(s)), std::integer_sequence<int, I...>()));
+        }
+
+        template<int... I>
+        inline bool32x8 shuffle_ss(
+            const bool32x8& lhs,
+            const bool32x8& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return __m256(tue::detail_::shuffle_ss(
+                float32x8(__m256(lhs)),
+                float32x8(__m256(rhs)),
+                std::integer_sequence<int, I...>()));
+        }
+
+        inline bool32x8 interleave_lo_ss(
+            const bool32x8& lhs, const bool32x8& rhs) noexcept
+        {
+            // The unpack instructions interleave within each 128-bit half,
+            // so put the halves back in order afterwards.
+            const __m256 lo = _mm256_unpacklo_ps(lhs, rhs);
+            const __m256 hi = _mm256_unpackhi_ps(lhs, rhs);
+            return _mm256_permute2f128_ps(lo, hi, 0x20);
+        }
+
+        inline bool32x8 interleave_hi_ss(
+            const bool32x8& lhs, const bool32x8& rhs) noexcept
+        {
+            const __m256 lo = _mm256_unpacklo_ps(lhs, rhs);
+            const __m256 hi = _mm256_unpackhi_ps(lhs, rhs);
+            return _mm256_permute2f128_ps(lo, hi, 0x31);
+        }
+
+        inline void load_soa2(
+            const float* aos, float32x8& x, float32x8& y) noexcept
+        {
+            __m256 rx, ry;
+            tue::detail_::load_soa2_avx(aos, rx, ry);
+            x = rx;
+            y = ry;
+        }
+
+        inline void load_soa3(
+            const float* aos,
+            float32x8& x, float32x8& y, float32x8& z) noexcept
+        {
+            __m256 rx, ry, rz;
+            tue::detail_::load_soa3_avx(aos, rx, ry, rz);
+            x = rx;
+            y = ry;
+            z = rz;
+        }
+
+        inline void load_soa4(
+            const float* aos,
+            std::size_t stride,
+            float32x8& x, float32x8& y, float32x8& z, float32x8& w) noexcept
+        {
+            __m256 rx, ry, rz, rw;
+            tue::detail_::load_soa4_avx(aos, stride, rx, ry, rz, rw);
+            x = rx;
+            y = ry;
+            z = rz;
+            w = rw;
+        }
+
+        inline void store_aos2(
+            float* aos, const float32x8& x, const float32x8& y) noexcept
+        {
+            tue::detail_::store_aos2_avx(aos, x, y);
+        }
+
+        inline void store_aos3(
+            float* aos,
+            const float32x8& x,
+            const float32x8& y,
+            const float32x8& z) noexcept
+        {
+            tue::detail_::store_aos3_avx(aos, x, y, z);
+        }
+
+        inline void store_aos4(
+            float* aos,
+            std::size_t stride,
+            const float32x8& x,
+            const float32x8& y,
+            const float32x8& z,
+            const float32x8& w) noexcept
+        {
+            tue::detail_::store_aos4_avx(aos, stride, x, y, z, w);
+        }
+    }
+}
@@ -0,0 +1,1321 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+// This file contains code based on Julien Pommier's sse_mathfun.h originally
+// published at http://gruntthepeon.free.fr/ssemath/ under the following
+// license:
+//
+// Copyright (C) 2007 Julien Pommier
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from
+// the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software in
+//    a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// (this is the zlib license)
+
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<double, 4>())
+    simd<double, 4>
+    {
+        __m256d underlying_;
+
+    private:
+        template<typename U>
+        static float64x4 explicit_cast(const simd<U, 4>& s) noexcept
+        {
+            return {
+                double(s.data()[0]),
+                double(s.data()[1]),
+                double(s.data()[2]),
+                double(s.data()[3]),
+            };
+        }
+
+    public:
+        using component_type = double;
+
+        static constexpr int component_count = 4;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(double x) noexcept
+        :
+            underlying_(_mm256_set1_pd(x))
+        {
+        }
+
+        template<int M = 4, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            double x, double y) noexcept;
+
+        template<int M = 4, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            double x, double y, double z, double w) noexcept
+        :
+            underlying_(_mm256_setr_pd(x, y, z, w))
+        {
+        }
+
+        template<int M = 4, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            double s0, double s1, double s2, double s3,
+            double s4, double s5, double s6, double s7) noexcept;
+
+        template<int M = 4, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            double  s0, double  s1, double  s2, double  s3,
+            double  s4, double  s5, double  s6, double  s7,
+            double  s8, double  s9, double s10, double s11,
+            double s12, double s13, double s14, double s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 4>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256d underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256d() const noexcept
+        {
+            return underlying_;
+        }
+
+        static float64x4 zero() noexcept
+        {
+            return _mm256_setzero_pd();
+        }
+
+        static float64x4 load(const double* data) noexcept
+        {
+            return _mm256_load_pd(data);
+        }
+
+        static float64x4 loadu(const double* data) noexcept
+        {
+            return _mm256_loadu_pd(data);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static float64x4 gather(
+            const double* base, const simd<I, 4>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static float64x4 gather(
+            const double* base,
+            const simd<I, 4>& indices,
+            const bool64x4& conditions) noexcept;
+
+        inline static float64x4 load_partial(
+            const double* data, int count) noexcept;
+
+        inline static float64x4 maskload(
+            const double* data, const bool64x4& conditions) noexcept;
+
+        void store(double* data) const noexcept
+        {
+            _mm256_store_pd(data, underlying_);
+        }
+
+        void storeu(double* data) const noexcept
+        {
+            _mm256_storeu_pd(data, underlying_);
+        }
+
+        void stream(double* data) const noexcept
+        {
+            _mm256_stream_pd(data, underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            double* base, const simd<I, 4>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            double* base,
+            const simd<I, 4>& indices,
+            const bool64x4& conditions) const noexcept;
+
+        inline void store_partial(double* data, int count) const noexcept;
+
+        inline void maskstore(
+            double* data, const bool64x4& conditions) const noexcept;
+
+        const double* data() const noexcept
+        {
+            return reinterpret_cast<const double*>(&underlying_);
+        }
+
+        double* data() noexcept
+        {
+            return reinterpret_cast<double*>(&underlying_);
+        }
+    };
+}
+
+#include "bool64x4.avx.hpp"
+#include "float32x8.avx.hpp"
+#include "../sse2/float64x2.sse2.hpp"
+
+namespace tue
+{
+    template<typename I, typename>
+    inline float64x4 float64x4::gather(
+        const double* base, const simd<I, 4>& indices) noexcept
+    {
+#ifdef TUE_AVX2
+        // Equivalent to _mm256_i32gather_pd, which trips -Wuninitialized
+        // in some versions of GCC.
+        return _mm256_mask_i32gather_pd(
+            _mm256_setzero_pd(),
+            base,
+            indices,
+            _mm256_castsi256_pd(_mm256_set1_epi64x(-1)),
+            8);
+#else
+        const __m128i i = indices;
+        return _mm256_setr_pd(
+            base[_mm_cvtsi128_si32(i)],
+            base[_mm_cvtsi128_si32(_mm_shuffle_epi32(i, 1))],
+            base[_mm_cvtsi128_si32(_mm_shuffle_epi32(i, 2))],
+            base[_mm_cvtsi128_si32(_mm_shuffle_epi32(i, 3))]);
+#endif
+    }
+
+    template<typename I, typename>
+    inline float64x4 float64x4::gather(
+        const double* base,
+        const simd<I, 4>& indices,
+        const bool64x4& conditions) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm256_mask_i32gather_pd(
+            _mm256_setzero_pd(), base, indices, conditions, 8);
+#else
+        return tue::detail_::gather_components<float64x4>(
+            base, indices, conditions);
+#endif
+    }
+
+    template<typename I, typename>
+    inline void float64x4::scatter(
+        double* base, const simd<I, 4>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void float64x4::scatter(
+        double* base,
+        const simd<I, 4>& indices,
+        const bool64x4& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline float64x4 float64x4::load_partial(
+        const double* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm256_cmp_pd(
+                _mm256_setr_pd(0.0, 1.0, 2.0, 3.0),
+                _mm256_set1_pd(count),
+                _CMP_LT_OQ));
+    }
+
+    inline float64x4 float64x4::maskload(
+        const double* data, const bool64x4& conditions) noexcept
+    {
+        return _mm256_maskload_pd(data, _mm256_castpd_si256(conditions));
+    }
+
+    inline void float64x4::store_partial(
+        double* data, int count) const noexcept
+    {
+        maskstore(
+            data,
+            _mm256_cmp_pd(
+                _mm256_setr_pd(0.0, 1.0, 2.0, 3.0),
+                _mm256_set1_pd(count),
+                _CMP_LT_OQ));
+    }
+
+    inline void float64x4::maskstore(
+        double* data, const bool64x4& conditions) const noexcept
+    {
+        _mm256_maskstore_pd(
+            data, _mm256_castpd_si256(conditions), underlying_);
+    }
+
+    namespace detail_
+    {
+        inline float64x4 unary_plus_operator_s(const float64x4& s) noexcept
+        {
+            return s;
+        }
+
+        inline float64x4& pre_increment_operator_s(float64x4& s) noexcept
+        {
+            return s = _mm256_add_pd(s, float64x4(1.0));
+        }
+
+        inline float64x4 post_increment_operator_s(float64x4& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_pd(s, float64x4(1.0));
+            return result;
+        }
+
+        inline float64x4 unary_minus_operator_s(const float64x4& s) noexcept
+        {
+            return _mm256_xor_pd(
+                s, float64x4(binary_double(0x8000000000000000ull)));
+        }
+
+        inline float64x4& pre_decrement_operator_s(float64x4& s) noexcept
+        {
+            return s = _mm256_sub_pd(s, float64x4(1.0));
+        }
+
+        inline float64x4 post_decrement_operator_s(float64x4& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_pd(s, float64x4(1.0));
+            return result;
+        }
+
+        inline float64x4 addition_operator_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_add_pd(lhs, rhs);
+        }
+
+        inline float64x4 subtraction_operator_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_sub_pd(lhs, rhs);
+        }
+
+        inline float64x4 multiplication_operator_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_mul_pd(lhs, rhs);
+        }
+
+        inline float64x4 division_operator_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_div_pd(lhs, rhs);
+        }
+
+        inline float64x4& addition_assignment_operator_ss(
+            float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return lhs = _mm256_add_pd(lhs, rhs);
+        }
+
+        inline float64x4& subtraction_assignment_operator_ss(
+            float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return lhs = _mm256_sub_pd(lhs, rhs);
+        }
+
+        inline float64x4& multiplication_assignment_operator_ss(
+            float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return lhs = _mm256_mul_pd(lhs, rhs);
+        }
+
+        inline float64x4& division_assignment_operator_ss(
+            float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return lhs = _mm256_div_pd(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_movemask_pd(
+                _mm256_cmp_pd(lhs, rhs, _CMP_NEQ_UQ)) == 0;
+        }
+
+        inline bool inequality_operator_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_movemask_pd(
+                _mm256_cmp_pd(lhs, rhs, _CMP_NEQ_UQ)) != 0;
+        }
+
+        // See the float64x2 version.
+        inline void sincos_large_pd(
+            const float64x4& s,
+            int lanes,
+            float64x4& sin_out,
+            float64x4& cos_out) noexcept
+        {
+            alignas(32) double x[4], sin[4], cos[4];
+            _mm256_store_pd(x, s);
+            _mm256_store_pd(sin, sin_out);
+            _mm256_store_pd(cos, cos_out);
+            for (int i = 0; i < 4; ++i)
+            {
+                if (lanes & (1 << i))
+                {
+                    sin[i] = tue::math::sin(x[i]);
+                    cos[i] = tue::math::cos(x[i]);
+                }
+            }
+            sin_out = _mm256_load_pd(sin);
+            cos_out = _mm256_load_pd(cos);
+        }
+
+        inline void sincos_s(
+            const float64x4& s,
+            float64x4& sin_out,
+            float64x4& cos_out) noexcept
+        {
+            // This function's implementation is based on Julien Pommier's
+            // sincos_ps(), with the reduction constants and polynomials
+            // replaced by the double precision ones from the cephes sin.c
+            // sources. The reduction is accurate for |x| up to 2^30, so
+            // bigger finite arguments go through sincos_large_pd() instead.
+            //
+            // AVX lacks 256-bit integer arithmetic, so the octant flags are
+            // derived from j mod 8 with floating point arithmetic instead of
+            // integer masks and shifts.
+            __m256d x = s;
+
+            __m256d xmm1, xmm2, xmm3, sign_bit_sin, y;
+
+            const __m256d sign_mask = _mm256_set1_pd(
+                binary_double(0x8000000000000000ull));
+
+            sign_bit_sin = x;
+
+            /* take the absolute value */
+            x = _mm256_andnot_pd(sign_mask, x);
+
+            /* extract the sign bit (upper one) */
+            sign_bit_sin = _mm256_and_pd(sign_bit_sin, sign_mask);
+
+            __m256d invalid_mask = _mm256_cmp_pd(
+                x,
+                _mm256_set1_pd(binary_double(0x7FF0000000000000ull)),
+                _CMP_NLT_UQ);
+
+            const int large_lanes = _mm256_movemask_pd(_mm256_andnot_pd(
+                invalid_mask,
+                _mm256_cmp_pd(
+                    x, _mm256_set1_pd(1073741824.0), _CMP_GT_OQ)));
+
+            /* scale by 4/Pi */
+            y = _mm256_mul_pd(x, _mm256_set1_pd(1.27323954473516268615));
+
+            /* j=(j+1) & (~1) (see the cephes sources) */
+            y = _mm256_floor_pd(y);
+            y = _mm256_add_pd(y, _mm256_set1_pd(1.0));
+            y = _mm256_mul_pd(y, _mm256_set1_pd(0.5));
+            y = _mm256_floor_pd(y);
+            y = _mm256_add_pd(y, y);
+
+            /* octant = j mod 8, one of 0, 2, 4 or 6 */
+            __m256d octant = _mm256_mul_pd(y, _mm256_set1_pd(0.125));
+            octant = _mm256_floor_pd(octant);
+            octant = _mm256_mul_pd(octant, _mm256_set1_pd(8.0));
+            octant = _mm256_sub_pd(y, octant);
+
+            /* get the swap sign flag for the sine */
+            __m256d swap_sign_bit_sin = _mm256_and_pd(
+                _mm256_cmp_pd(octant, _mm256_set1_pd(4.0), _CMP_GE_OQ),
+                sign_mask);
+
+            /* get the polynom selection mask for the sine */
+            __m256d poly_mask = _mm256_or_pd(
+                _mm256_cmp_pd(octant, _mm256_setzero_pd(), _CMP_EQ_OQ),
+                _mm256_cmp_pd(octant, _mm256_set1_pd(4.0), _CMP_EQ_OQ));
+
+            /* get the sign flag for the cosine */
+            __m256d sign_bit_cos = _mm256_and_pd(
+                _mm256_and_pd(
+                    _mm256_cmp_pd(octant, _mm256_set1_pd(2.0), _CMP_GE_OQ),
+                    _mm256_cmp_pd(octant, _mm256_set1_pd(4.0), _CMP_LE_OQ)),
+                sign_mask);
+
+            sign_bit_sin = _mm256_xor_pd(sign_bit_sin, swap_sign_bit_sin);
+
+            /* The magic pass: "Extended precision modular arithmetic"
+               x = ((x - y * DP1) - y * DP2) - y * DP3; */
+            xmm1 = _mm256_set1_pd(-7.85398125648498535156e-1);
+            xmm2 = _mm256_set1_pd(-3.77489470793079817668e-8);
+            xmm3 = _mm256_set1_pd(-2.69515142907905952645e-15);
+            xmm1 = _mm256_mul_pd(y, xmm1);
+            xmm2 = _mm256_mul_pd(y, xmm2);
+            xmm3 = _mm256_mul_pd(y, xmm3);
+            x = _mm256_add_pd(x, xmm1);
+            x = _mm256_add_pd(x, xmm2);
+            x = _mm256_add_pd(x, xmm3);
+
+            /* Evaluate the first polynom  (0 <= x <= Pi/4) */
+            __m256d z = _mm256_mul_pd(x,x);
+            y = _mm256_set1_pd(-1.13585365213876817300e-11);
+
+            y = _mm256_mul_pd(y, z);
+            y = _mm256_add_pd(y, _mm256_set1_pd(2.08757008419747316778e-9));
+            y = _mm256_mul_pd(y, z);
+            y = _mm256_add_pd(y, _mm256_set1_pd(-2.75573141792967388112e-7));
+            y = _mm256_mul_pd(y, z);
+            y = _mm256_add_pd(y, _mm256_set1_pd(2.48015872888517045348e-5));
+            y = _mm256_mul_pd(y, z);
+            y = _mm256_add_pd(y, _mm256_set1_pd(-1.38888888888730564116e-3));
+            y = _mm256_mul_pd(y, z);
+            y = _mm256_add_pd(y, _mm256_set1_pd(4.16666666666665929218e-2));
+            y = _mm256_mul_pd(y, z);
+            y = _mm256_mul_pd(y, z);
+            __m256d tmp = _mm256_mul_pd(z, _mm256_set1_pd(0.5));
+            y = _mm256_sub_pd(y, tmp);
+            y = _mm256_add_pd(y, _mm256_set1_pd(1.0));
+
+            /* Evaluate the second polynom  (Pi/4 <= x <= 0) */
+            __m256d y2 = _mm256_set1_pd(1.58962301576546568060e-10);
+            y2 = _mm256_mul_pd(y2, z);
+            y2 = _mm256_add_pd(y2, _mm256_set1_pd(-2.50507477628578072866e-8));
+            y2 = _mm256_mul_pd(y2, z);
+            y2 = _mm256_add_pd(y2, _mm256_set1_pd(2.75573136213857245213e-6));
+            y2 = _mm256_mul_pd(y2, z);
+            y2 = _mm256_add_pd(y2, _mm256_set1_pd(-1.98412698295895385996e-4));
+            y2 = _mm256_mul_pd(y2, z);
+            y2 = _mm256_add_pd(y2, _mm256_set1_pd(8.33333333332211858878e-3));
+            y2 = _mm256_mul_pd(y2, z);
+            y2 = _mm256_add_pd(y2, _mm256_set1_pd(-1.66666666666666307295e-1));
+            y2 = _mm256_mul_pd(y2, z);
+            y2 = _mm256_mul_pd(y2, x);
+            y2 = _mm256_add_pd(y2, x);
+
+            /* select the correct result from the two polynoms */
+            xmm3 = poly_mask;
+            __m256d ysin2 = _mm256_and_pd(xmm3, y2);
+            __m256d ysin1 = _mm256_andnot_pd(xmm3, y);
+            y2 = _mm256_sub_pd(y2,ysin2);
+            y = _mm256_sub_pd(y, ysin1);
+
+            xmm1 = _mm256_add_pd(ysin1,ysin2);
+            xmm2 = _mm256_add_pd(y,y2);
+
+            /* update the sign */
+            xmm1 = _mm256_xor_pd(xmm1, sign_bit_sin);
+            xmm2 = _mm256_xor_pd(xmm2, sign_bit_cos);
+
+            /* sin(inf) and cos(inf) are NaN */
+            sin_out = _mm256_or_pd(xmm1, invalid_mask);
+            cos_out = _mm256_or_pd(xmm2, invalid_mask);
+
+            if (large_lanes != 0)
+            {
+                sincos_large_pd(s, large_lanes, sin_out, cos_out);
+            }
+        }
+
+        inline float64x4 sin_s(const float64x4& s) noexcept
+        {
+            float64x4 sin, cos;
+            sincos_s(s, sin, cos);
+            return sin;
+        }
+
+        inline float64x4 cos_s(const float64x4& s) noexcept
+        {
+            float64x4 sin, cos;
+            sincos_s(s, sin, cos);
+            return cos;
+        }
+
+        inline float64x4 exp_s(const float64x4& s) noexcept
+        {
+            // exp(x) = 2^n * exp(r) with n = round(x / log(2)) and
+            // r = x - n * log(2), where log(2) is split in two (Cody-Waite)
+            // so that r is exact. exp(r) is evaluated with its degree 13
+            // Taylor polynomial, which is accurate to below one ulp for
+            // |r| <= log(2) / 2. 2^n is applied as two factors so that
+            // results covering the whole exponent range, subnormals
+            // included, don't overflow the intermediate scale.
+            __m256d x = s;
+
+            __m256d nan_mask = _mm256_cmp_pd(x, x, _CMP_UNORD_Q);
+
+            x = _mm256_min_pd(x, _mm256_set1_pd(710.0));
+            x = _mm256_max_pd(x, _mm256_set1_pd(-746.0));
+
+            /* n = round(x / log(2)) */
+            __m256d fx = _mm256_mul_pd(
+                x, _mm256_set1_pd(1.44269504088896340736));
+            fx = _mm256_round_pd(
+                fx, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+            /* r = x - n * log(2) */
+            x = _mm256_sub_pd(x, _mm256_mul_pd(
+                fx, _mm256_set1_pd(6.93147180369123816490e-1)));
+            x = _mm256_sub_pd(x, _mm256_mul_pd(
+                fx, _mm256_set1_pd(1.90821492927058770002e-10)));
+
+            __m256d z = _mm256_mul_pd(x, x);
+
+            /* 1 + r + r^2 * P(r), with P evaluated in Estrin's scheme */
+            __m256d z2 = _mm256_mul_pd(z, z);
+            __m256d p0 = _mm256_add_pd(_mm256_set1_pd(0.5),
+                _mm256_mul_pd(x, _mm256_set1_pd(1.0 / 6.0)));
+            __m256d p1 = _mm256_add_pd(_mm256_set1_pd(1.0 / 24.0),
+                _mm256_mul_pd(x, _mm256_set1_pd(1.0 / 120.0)));
+            __m256d p2 = _mm256_add_pd(_mm256_set1_pd(1.0 / 720.0),
+                _mm256_mul_pd(x, _mm256_set1_pd(1.0 / 5040.0)));
+            __m256d p3 = _mm256_add_pd(_mm256_set1_pd(1.0 / 40320.0),
+                _mm256_mul_pd(x, _mm256_set1_pd(1.0 / 362880.0)));
+            __m256d p4 = _mm256_add_pd(_mm256_set1_pd(1.0 / 3628800.0),
+                _mm256_mul_pd(x, _mm256_set1_pd(1.0 / 39916800.0)));
+            __m256d p5 = _mm256_add_pd(_mm256_set1_pd(1.0 / 479001600.0),
+                _mm256_mul_pd(x, _mm256_set1_pd(1.0 / 6227020800.0)));
+            p0 = _mm256_add_pd(p0, _mm256_mul_pd(p1, z));
+            p2 = _mm256_add_pd(p2, _mm256_mul_pd(p3, z));
+            p4 = _mm256_add_pd(p4, _mm256_mul_pd(p5, z));
+            p2 = _mm256_add_pd(p2, _mm256_mul_pd(p4, z2));
+            __m256d y = _mm256_add_pd(p0, _mm256_mul_pd(p2, z2));
+            y = _mm256_mul_pd(y, z);
+            y = _mm256_add_pd(y, x);
+            y = _mm256_add_pd(y, _mm256_set1_pd(1.0));
+
+            /* build 2^n1 and 2^n2 with n1 + n2 = n; the high dword of each
+               lane is (n + 1023) << 20, computed as (n + 1023) * 2^20 and
+               converted to integer */
+            __m256d n1 = _mm256_floor_pd(
+                _mm256_mul_pd(fx, _mm256_set1_pd(0.5)));
+            __m256d n2 = _mm256_sub_pd(fx, n1);
+            n1 = _mm256_add_pd(n1, _mm256_set1_pd(1023.0));
+            n1 = _mm256_mul_pd(n1, _mm256_set1_pd(1048576.0));
+            n2 = _mm256_add_pd(n2, _mm256_set1_pd(1023.0));
+            n2 = _mm256_mul_pd(n2, _mm256_set1_pd(1048576.0));
+            __m128i emm0 = _mm256_cvttpd_epi32(n1);
+            __m128i emm1 = _mm256_cvttpd_epi32(n2);
+            __m256d pow2n1 = _mm256_castsi256_pd(_mm256_insertf128_si256(
+                _mm256_castsi128_si256(
+                    _mm_unpacklo_epi32(_mm_setzero_si128(), emm0)),
+                _mm_unpackhi_epi32(_mm_setzero_si128(), emm0), 1));
+            __m256d pow2n2 = _mm256_castsi256_pd(_mm256_insertf128_si256(
+                _mm256_castsi128_si256(
+                    _mm_unpacklo_epi32(_mm_setzero_si128(), emm1)),
+                _mm_unpackhi_epi32(_mm_setzero_si128(), emm1), 1));
+
+            y = _mm256_mul_pd(_mm256_mul_pd(y, pow2n1), pow2n2);
+
+            /* NaN in, NaN out */
+            return _mm256_or_pd(y, nan_mask);
+        }
+
+        inline float64x4 log_s(const float64x4& s) noexcept
+        {
+            // log(x) = e * log(2) + log(1 + f) with x = 2^e * (1 + f) and
+            // 1 + f in [sqrt(2)/2, sqrt(2)). log(1 + f) is evaluated as
+            // 2 * atanh(f / (2 + f)) with fdlibm's degree 14 minimax
+            // polynomial, arranged as in fdlibm's log() so that the largest
+            // terms are added last. Subnormal inputs are scaled by 2^54
+            // before the exponent is extracted.
+            __m256d x = s;
+
+            const __m256d one = _mm256_set1_pd(1.0);
+
+            /* scale up subnormals */
+            __m256d mask = _mm256_cmp_pd(
+                x, _mm256_set1_pd(2.2250738585072014e-308), _CMP_LT_OQ);
+            __m256d scaled = _mm256_mul_pd(
+                x, _mm256_set1_pd(18014398509481984.0));
+            x = _mm256_blendv_pd(x, scaled, mask);
+            __m256d e = _mm256_and_pd(mask, _mm256_set1_pd(-54.0));
+
+            /* x = frexp(x, &e) with the mantissa in [1, 2); the high
+               dword of the masked exponent bits converts exactly to
+               (e + 1023) * 2^20 */
+            __m256 ebits = _mm256_castpd_ps(_mm256_and_pd(
+                x, _mm256_set1_pd(binary_double(0x7FFull << 52ull))));
+            __m128 ehi = _mm_shuffle_ps(
+                _mm256_castps256_ps128(ebits),
+                _mm256_extractf128_ps(ebits, 1),
+                _MM_SHUFFLE(3, 1, 3, 1));
+            __m256d ex = _mm256_cvtepi32_pd(_mm_castps_si128(ehi));
+            ex = _mm256_mul_pd(ex, _mm256_set1_pd(1.0 / 1048576.0));
+            ex = _mm256_sub_pd(ex, _mm256_set1_pd(1023.0));
+            e = _mm256_add_pd(e, ex);
+
+            x = _mm256_and_pd(
+                x, _mm256_set1_pd(binary_double(0x000FFFFFFFFFFFFFull)));
+            x = _mm256_or_pd(x, one);
+
+            /* if (x > SQRT2) { e += 1; x *= 0.5; } */
+            mask = _mm256_cmp_pd(
+                x, _mm256_set1_pd(1.41421356237309504880), _CMP_GT_OQ);
+            x = _mm256_blendv_pd(
+                x, _mm256_mul_pd(x, _mm256_set1_pd(0.5)), mask);
+            e = _mm256_add_pd(e, _mm256_and_pd(mask, one));
+
+            __m256d f = _mm256_sub_pd(x, one);
+            __m256d hfsq = _mm256_mul_pd(
+                _mm256_mul_pd(f, f), _mm256_set1_pd(0.5));
+            __m256d r = _mm256_div_pd(
+                f, _mm256_add_pd(f, _mm256_set1_pd(2.0)));
+            __m256d z = _mm256_mul_pd(r, r);
+
+            __m256d w = _mm256_mul_pd(z, z);
+
+            /* fdlibm's minimax approximation of (atanh(r) / r - 1) * 2,
+               split into even and odd terms */
+            __m256d t1 = _mm256_set1_pd(1.531383769920937332e-1);
+            t1 = _mm256_mul_pd(t1, w);
+            t1 = _mm256_add_pd(t1, _mm256_set1_pd(2.222219843214978396e-1));
+            t1 = _mm256_mul_pd(t1, w);
+            t1 = _mm256_add_pd(t1, _mm256_set1_pd(3.999999999940941908e-1));
+            t1 = _mm256_mul_pd(t1, w);
+
+            __m256d t2 = _mm256_set1_pd(1.479819860511658591e-1);
+            t2 = _mm256_mul_pd(t2, w);
+            t2 = _mm256_add_pd(t2, _mm256_set1_pd(1.818357216161805012e-1));
+            t2 = _mm256_mul_pd(t2, w);
+            t2 = _mm256_add_pd(t2, _mm256_set1_pd(2.857142874366239149e-1));
+            t2 = _mm256_mul_pd(t2, w);
+            t2 = _mm256_add_pd(t2, _mm256_set1_pd(6.666666666666735130e-1));
+            t2 = _mm256_mul_pd(t2, z);
+
+            __m256d y = _mm256_add_pd(t1, t2);
+
+            /* e*ln2_hi - ((hfsq - (r*(hfsq+y) + e*ln2_lo)) - f) */
+            y = _mm256_mul_pd(r, _mm256_add_pd(hfsq, y));
+            y = _mm256_add_pd(y, _mm256_mul_pd(
+                e, _mm256_set1_pd(1.90821492927058770002e-10)));
+            y = _mm256_sub_pd(hfsq, y);
+            y = _mm256_sub_pd(y, f);
+            x = _mm256_sub_pd(_mm256_mul_pd(
+                e, _mm256_set1_pd(6.93147180369123816490e-1)), y);
+
+            /* log(inf) = inf, log(0) = -inf, log(x < 0) = NaN */
+            x = _mm256_blendv_pd(
+                x,
+                s,
+                _mm256_cmp_pd(
+                    s,
+                    _mm256_set1_pd(binary_double(0x7FF0000000000000ull)),
+                    _CMP_EQ_OQ));
+            x = _mm256_blendv_pd(
+                x,
+                _mm256_set1_pd(binary_double(0xFFF0000000000000ull)),
+                _mm256_cmp_pd(s, _mm256_setzero_pd(), _CMP_EQ_OQ));
+            x = _mm256_or_pd(
+                x, _mm256_cmp_pd(s, _mm256_setzero_pd(), _CMP_NGE_UQ));
+            return x;
+        }
+
+        inline float64x4 abs_s(const float64x4& s) noexcept
+        {
+            return _mm256_and_pd(
+                s, float64x4(binary_double(0x7FFFFFFFFFFFFFFFull)));
+        }
+
+        inline float64x4 pow_ss(
+            const float64x4& bases, const float64x4& exponents) noexcept
+        {
+            // See the float64x2 version.
+            const __m256d one = _mm256_set1_pd(1.0);
+            const __m256d ones = _mm256_or_pd(
+                _mm256_cmp_pd(exponents, _mm256_setzero_pd(), _CMP_EQ_OQ),
+                _mm256_cmp_pd(bases, one, _CMP_EQ_OQ));
+            const __m256d x =
+                exp_s(float64x4(_mm256_mul_pd(log_s(bases), exponents)));
+            return _mm256_blendv_pd(x, one, ones);
+        }
+
+        inline float64x4 tan_s(const float64x4& s) noexcept
+        {
+            // Each 128-bit half goes through the narrower kernel.
+            const __m256d x = s;
+            const float64x2 lo = _mm256_castpd256_pd128(x);
+            const float64x2 hi = _mm256_extractf128_pd(x, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(tan_s(lo)), tan_s(hi), 1);
+        }
+
+        inline float64x4 asin_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            const float64x2 lo = _mm256_castpd256_pd128(x);
+            const float64x2 hi = _mm256_extractf128_pd(x, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(asin_s(lo)), asin_s(hi), 1);
+        }
+
+        inline float64x4 acos_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            const float64x2 lo = _mm256_castpd256_pd128(x);
+            const float64x2 hi = _mm256_extractf128_pd(x, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(acos_s(lo)), acos_s(hi), 1);
+        }
+
+        inline float64x4 atan_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            const float64x2 lo = _mm256_castpd256_pd128(x);
+            const float64x2 hi = _mm256_extractf128_pd(x, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(atan_s(lo)), atan_s(hi), 1);
+        }
+
+        inline float64x4 atan2_ss(
+            const float64x4& y, const float64x4& x) noexcept
+        {
+            const __m256d a = y;
+            const __m256d b = x;
+            const float64x2 alo = _mm256_castpd256_pd128(a);
+            const float64x2 ahi = _mm256_extractf128_pd(a, 1);
+            const float64x2 blo = _mm256_castpd256_pd128(b);
+            const float64x2 bhi = _mm256_extractf128_pd(b, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(atan2_ss(alo, blo)),
+                atan2_ss(ahi, bhi), 1);
+        }
+
+        inline float64x4 exp2_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            const float64x2 lo = _mm256_castpd256_pd128(x);
+            const float64x2 hi = _mm256_extractf128_pd(x, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(exp2_s(lo)), exp2_s(hi), 1);
+        }
+
+        inline float64x4 log2_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            const float64x2 lo = _mm256_castpd256_pd128(x);
+            const float64x2 hi = _mm256_extractf128_pd(x, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(log2_s(lo)), log2_s(hi), 1);
+        }
+
+        inline float64x4 log10_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            const float64x2 lo = _mm256_castpd256_pd128(x);
+            const float64x2 hi = _mm256_extractf128_pd(x, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(log10_s(lo)), log10_s(hi), 1);
+        }
+
+        inline float64x4 cbrt_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            const float64x2 lo = _mm256_castpd256_pd128(x);
+            const float64x2 hi = _mm256_extractf128_pd(x, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(cbrt_s(lo)), cbrt_s(hi), 1);
+        }
+
+        inline void fast_sincos_s(
+            const float64x4& s,
+            float64x4& sin_out,
+            float64x4& cos_out) noexcept
+        {
+            const __m256d x = s;
+            float64x2 slo, shi, clo, chi;
+            fast_sincos_s(_mm256_castpd256_pd128(x), slo, clo);
+            fast_sincos_s(_mm256_extractf128_pd(x, 1), shi, chi);
+            sin_out = _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(slo), shi, 1);
+            cos_out = _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(clo), chi, 1);
+        }
+
+        inline float64x4 fast_sin_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            const float64x2 lo = _mm256_castpd256_pd128(x);
+            const float64x2 hi = _mm256_extractf128_pd(x, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(fast_sin_s(lo)), fast_sin_s(hi), 1);
+        }
+
+        inline float64x4 fast_cos_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            const float64x2 lo = _mm256_castpd256_pd128(x);
+            const float64x2 hi = _mm256_extractf128_pd(x, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(fast_cos_s(lo)), fast_cos_s(hi), 1);
+        }
+
+        inline float64x4 fast_exp_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            const float64x2 lo = _mm256_castpd256_pd128(x);
+            const float64x2 hi = _mm256_extractf128_pd(x, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(fast_exp_s(lo)), fast_exp_s(hi), 1);
+        }
+
+        inline float64x4 fast_log_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            const float64x2 lo = _mm256_castpd256_pd128(x);
+            const float64x2 hi = _mm256_extractf128_pd(x, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(fast_log_s(lo)), fast_log_s(hi), 1);
+        }
+
+        inline float64x4 fast_pow_ss(
+            const float64x4& bases, const float64x4& exponents) noexcept
+        {
+            const __m256d b = bases;
+            const __m256d e = exponents;
+            const float64x2 blo = _mm256_castpd256_pd128(b);
+            const float64x2 bhi = _mm256_extractf128_pd(b, 1);
+            const float64x2 elo = _mm256_castpd256_pd128(e);
+            const float64x2 ehi = _mm256_extractf128_pd(e, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(fast_pow_ss(blo, elo)),
+                fast_pow_ss(bhi, ehi), 1);
+        }
+
+        inline void precise_sincos_s(
+            const float64x4& s,
+            float64x4& sin_result,
+            float64x4& cos_result) noexcept
+        {
+            sincos_s(s, sin_result, cos_result);
+        }
+
+        inline float64x4 precise_sin_s(const float64x4& s) noexcept
+        {
+            return sin_s(s);
+        }
+
+        inline float64x4 precise_cos_s(const float64x4& s) noexcept
+        {
+            return cos_s(s);
+        }
+
+        inline float64x4 precise_exp_s(const float64x4& s) noexcept
+        {
+            return exp_s(s);
+        }
+
+        inline float64x4 precise_log_s(const float64x4& s) noexcept
+        {
+            return log_s(s);
+        }
+
+        inline float64x4 precise_pow_ss(
+            const float64x4& bases, const float64x4& exponents) noexcept
+        {
+            const __m256d b = bases;
+            const __m256d e = exponents;
+            const float64x2 blo = _mm256_castpd256_pd128(b);
+            const float64x2 bhi = _mm256_extractf128_pd(b, 1);
+            const float64x2 elo = _mm256_castpd256_pd128(e);
+            const float64x2 ehi = _mm256_extractf128_pd(e, 1);
+            return _mm256_insertf128_pd(
+                _mm256_castpd128_pd256(precise_pow_ss(blo, elo)),
+                precise_pow_ss(bhi, ehi), 1);
+        }
+
+        inline float64x4 fast_recip_s(const float64x4& s) noexcept
+        {
+            // AVX has no double precision estimate, so all three tiers
+            // divide.
+            return _mm256_div_pd(_mm256_set1_pd(1.0), s);
+        }
+
+        inline float64x4 recip_s(const float64x4& s) noexcept
+        {
+            return _mm256_div_pd(_mm256_set1_pd(1.0), s);
+        }
+
+        inline float64x4 precise_recip_s(const float64x4& s) noexcept
+        {
+            return _mm256_div_pd(_mm256_set1_pd(1.0), s);
+        }
+
+        inline float64x4 sqrt_s(const float64x4& s) noexcept
+        {
+            return _mm256_sqrt_pd(s);
+        }
+
+        inline float64x4 fast_rsqrt_s(const float64x4& s) noexcept
+        {
+            return _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(s));
+        }
+
+        inline float64x4 rsqrt_s(const float64x4& s) noexcept
+        {
+            return _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(s));
+        }
+
+        inline float64x4 precise_rsqrt_s(const float64x4& s) noexcept
+        {
+            return _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(s));
+        }
+
+        inline float64x4 floor_s(const float64x4& s) noexcept
+        {
+            return _mm256_round_pd(
+                s, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+
+        inline float64x4 ceil_s(const float64x4& s) noexcept
+        {
+            return _mm256_round_pd(
+                s, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        }
+
+        inline float64x4 round_s(const float64x4& s) noexcept
+        {
+            // _MM_FROUND_TO_NEAREST_INT rounds halfway cases to even, so add
+            // the largest value below 0.5 with the sign of s and truncate.
+            const auto half = _mm256_or_pd(
+                _mm256_and_pd(
+                    s, float64x4(binary_double(0x8000000000000000ull))),
+                float64x4(binary_double(0x3FDFFFFFFFFFFFFFull)));
+            return _mm256_round_pd(
+                _mm256_add_pd(s, half), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+        inline float64x4 trunc_s(const float64x4& s) noexcept
+        {
+            return _mm256_round_pd(
+                s, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+        inline float64x4 fma_sss(
+            const float64x4& s1,
+            const float64x4& s2,
+            const float64x4& s3) noexcept
+        {
+#ifdef TUE_FMA
+            return _mm256_fmadd_pd(s1, s2, s3);
+#else
+            return _mm256_add_pd(_mm256_mul_pd(s1, s2), s3);
+#endif
+        }
+
+        inline float64x4 min_ss(
+            const float64x4& s1, const float64x4& s2) noexcept
+        {
+            return _mm256_min_pd(s1, s2);
+        }
+
+        inline float64x4 max_ss(
+            const float64x4& s1, const float64x4& s2) noexcept
+        {
+            return _mm256_max_pd(s1, s2);
+        }
+
+        inline double reduce_add_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            return reduce_add_s(float64x2(_mm_add_pd(
+                _mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1))));
+        }
+
+        inline double reduce_min_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            return reduce_min_s(float64x2(_mm_min_pd(
+                _mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1))));
+        }
+
+        inline double reduce_max_s(const float64x4& s) noexcept
+        {
+            const __m256d x = s;
+            return reduce_max_s(float64x2(_mm_max_pd(
+                _mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1))));
+        }
+
+        inline float64x4 mask_ss(
+            const bool64x4& conditions,
+            const float64x4& values) noexcept
+        {
+            return _mm256_and_pd(conditions, values);
+        }
+
+        inline float64x4 select_sss(
+            const bool64x4& conditions,
+            const float64x4& values,
+            const float64x4& otherwise) noexcept
+        {
+            return _mm256_blendv_pd(otherwise, values, conditions);
+        }
+
+        inline bool64x4 less_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OS);
+        }
+
+        inline bool64x4 less_equal_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_cmp_pd(lhs, rhs, _CMP_LE_OS);
+        }
+
+        inline bool64x4 greater_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_cmp_pd(lhs, rhs, _CMP_GT_OS);
+        }
+
+        inline bool64x4 greater_equal_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_cmp_pd(lhs, rhs, _CMP_GE_OS);
+        }
+
+        inline bool64x4 equal_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ);
+        }
+
+        inline bool64x4 not_equal_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            return _mm256_cmp_pd(lhs, rhs, _CMP_NEQ_UQ);
+        }
+
+        // The precise float32x8 kernels run the float64x4 ones on each half,
+        // so their results are only rounded once, to float.
+        inline void precise_sincos_s(
+            const float32x8& s,
+            float32x8& sin_out,
+            float32x8& cos_out) noexcept
+        {
+            const __m256 x = s;
+            float64x4 lo_sin, lo_cos, hi_sin, hi_cos;
+            sincos_s(
+                float64x4(_mm256_cvtps_pd(_mm256_castps256_ps128(x))),
+                lo_sin, lo_cos);
+            sincos_s(
+                float64x4(_mm256_cvtps_pd(_mm256_extractf128_ps(x, 1))),
+                hi_sin, hi_cos);
+            sin_out = _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm256_cvtpd_ps(lo_sin)),
+                _mm256_cvtpd_ps(hi_sin), 1);
+            cos_out = _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm256_cvtpd_ps(lo_cos)),
+                _mm256_cvtpd_ps(hi_cos), 1);
+        }
+
+        inline float32x8 precise_sin_s(const float32x8& s) noexcept
+        {
+            float32x8 sin, cos;
+            precise_sincos_s(s, sin, cos);
+            return sin;
+        }
+
+        inline float32x8 precise_cos_s(const float32x8& s) noexcept
+        {
+            float32x8 sin, cos;
+            precise_sincos_s(s, sin, cos);
+            return cos;
+        }
+
+        inline float32x8 precise_exp_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            const float64x4 lo = _mm256_cvtps_pd(_mm256_castps256_ps128(x));
+            const float64x4 hi = _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1));
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm256_cvtpd_ps(exp_s(lo))),
+                _mm256_cvtpd_ps(exp_s(hi)), 1);
+        }
+
+        inline float32x8 precise_log_s(const float32x8& s) noexcept
+        {
+            const __m256 x = s;
+            const float64x4 lo = _mm256_cvtps_pd(_mm256_castps256_ps128(x));
+            const float64x4 hi = _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1));
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm256_cvtpd_ps(log_s(lo))),
+                _mm256_cvtpd_ps(log_s(hi)), 1);
+        }
+
+        inline float32x8 precise_pow_ss(
+            const float32x8& bases, const float32x8& exponents) noexcept
+        {
+            const __m256 b = bases;
+            const __m256 e = exponents;
+            const float64x4 lo = _mm256_mul_pd(
+                log_s(float64x4(_mm256_cvtps_pd(_mm256_castps256_ps128(b)))),
+                _mm256_cvtps_pd(_mm256_castps256_ps128(e)));
+            const float64x4 hi = _mm256_mul_pd(
+                log_s(float64x4(_mm256_cvtps_pd(_mm256_extractf128_ps(b, 1)))),
+                _mm256_cvtps_pd(_mm256_extractf128_ps(e, 1)));
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm256_cvtpd_ps(exp_s(lo))),
+                _mm256_cvtpd_ps(exp_s(hi)), 1);
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline float64x4 shuffle_s(
+            const float64x4& s,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+#ifdef TUE_AVX2
+            return _mm256_permute4x64_pd(s, _MM_SHUFFLE(I3, I2, I1, I0));
+#else
+            // vpermilpd only shuffles within each 128-bit half, so shuffle
+            // both s and s with its halves swapped, then blend in the
+            // components that cross over.
+            constexpr int within =
+                (I0 % 2) | ((I1 % 2) << 1) | ((I2 % 2) << 2) | ((I3 % 2) << 3);
+            constexpr int crossing =
+                tue::detail_::crossing_lanes<2, I0, I1, I2, I3>();
+            const __m256d swapped = _mm256_permute2f128_pd(s, s, 0x01);
+            return _mm256_blend_pd(
+                _mm256_permute_pd(s, within),
+                _mm256_permute_pd(swapped, within),
+                crossing);
+#endif
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline float64x4 shuffle_ss(
+            const float64x4& lhs,
+            const float64x4& rhs,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+            constexpr int from_rhs =
+                tue::detail_::second_source_lanes<4, I0, I1, I2, I3>();
+            return _mm256_blend_pd(
+                tue::detail_::shuffle_s(lhs, std::integer_sequence<int,
+                    I0 % 4, I1 % 4, I2 % 4, I3 % 4>()),
+                tue::detail_::shuffle_s(rhs, std::integer_sequence<int,
+                    I0 % 4, I1 % 4, I2 % 4, I3 % 4>()),
+                from_rhs);
+        }
+
+        template<int I>
+        inline double extract_s(
+            const float64x4& s, std::integral_constant<int, I>) noexcept
+        {
+            const __m128d half = _mm256_extractf128_pd(s, I / 2);
+            return _mm_cvtsd_f64(_mm_shuffle_pd(half, half, I % 2));
+        }
+
+        template<int I>
+        inline float64x4 insert_s(
+            const float64x4& s,
+            double x,
+            std::integral_constant<int, I>) noexcept
+        {
+            return _mm256_blend_pd(s, _mm256_set1_pd(x), 1 << I);
+        }
+
+        inline float64x4 interleave_lo_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            // The unpack instructions interleave within each 128-bit half,
+            // so put the halves back in order afterwards.
+            const __m256d lo = _mm256_unpacklo_pd(lhs, rhs);
+            const __m256d hi = _mm256_unpackhi_pd(lhs, rhs);
+            return _mm256_permute2f128_pd(lo, hi, 0x20);
+        }
+
+        inline float64x4 interleave_hi_ss(
+            const float64x4& lhs, const float64x4& rhs) noexcept
+        {
+            const __m256d lo = _mm256_unpacklo_pd(lhs, rhs);
+            const __m256d hi = _mm256_unpackhi_pd(lhs, rhs);
+            return _mm256_permute2f128_pd(lo, hi, 0x31);
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline bool64x4 shuffle_s(
+            const bool64x4& s,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+            return __m256d(tue::detail_::shuffle_s(
+                float64x4(__m256d(s)),
+                std::integer_sequence<int, I0, I1, I2, I3>()));
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline bool64x4 shuffle_ss(
+            const bool64x4& lhs,
+            const bool64x4& rhs,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+            return __m256d(tue::detail_::shuffle_ss(
+                float64x4(__m256d(lhs)),
+                float64x4(__m256d(rhs)),
+                std::integer_sequence<int, I0, I1, I2, I3>()));
+        }
+
+        inline bool64x4 interleave_lo_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            // The unpack instructions interleave within each 128-bit half,
+            // so put the halves back in order afterwards.
+            const __m256d lo = _mm256_unpacklo_pd(lhs, rhs);
+            const __m256d hi = _mm256_unpackhi_pd(lhs, rhs);
+            return _mm256_permute2f128_pd(lo, hi, 0x20);
+        }
+
+        inline bool64x4 interleave_hi_ss(
+            const bool64x4& lhs, const bool64x4& rhs) noexcept
+        {
+            const __m256d lo = _mm256_unpacklo_pd(lhs, rhs);
+            const __m256d hi = _mm256_unpackhi_pd(lhs, rhs);
+            return _mm256_permute2f128_pd(lo, hi, 0x31);
+        }
+    }
+}
@@ -0,0 +1,168 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstddef>
+
+#include "../../../cpu_features.hpp"
+
+// AoS/SoA conversions on raw AVX registers. They're compiled for AVX even
+// without AVX compiler options so that runtime-dispatched kernels can share
+// them with the float32x8 specialization.
+namespace tue
+{
+    namespace detail_
+    {
+        // The 8-wide AoS/SoA conversions regroup the 128-bit halves of the
+        // input so that elements 0-3 sit in the lower halves and elements
+        // 4-7 in the upper halves. The in-lane shuffles of the 4-wide
+        // versions then finish the job in both halves at once.
+
+        TUE_TARGET("avx") inline void load_soa2_avx(
+            const float* aos, __m256& x, __m256& y) noexcept
+        {
+            const __m256 r0 = _mm256_loadu_ps(aos);
+            const __m256 r1 = _mm256_loadu_ps(aos + 8);
+            const __m256 a = _mm256_permute2f128_ps(r0, r1, 0x20);
+            const __m256 b = _mm256_permute2f128_ps(r0, r1, 0x31);
+            x = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            y = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        }
+
+        TUE_TARGET("avx") inline void load_soa3_avx(
+            const float* aos,
+            __m256& x, __m256& y, __m256& z) noexcept
+        {
+            const __m256 r0 = _mm256_loadu_ps(aos);
+            const __m256 r1 = _mm256_loadu_ps(aos + 8);
+            const __m256 r2 = _mm256_loadu_ps(aos + 16);
+            const __m256 a = _mm256_permute2f128_ps(r0, r1, 0x30);
+            const __m256 b = _mm256_permute2f128_ps(r0, r2, 0x21);
+            const __m256 c = _mm256_permute2f128_ps(r1, r2, 0x30);
+
+            const __m256 b2c1 =
+                _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2));
+            x = _mm256_shuffle_ps(a, b2c1, _MM_SHUFFLE(3, 0, 3, 0));
+
+            const __m256 a1b0 =
+                _mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+            const __m256 b3c2 =
+                _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+            y = _mm256_shuffle_ps(a1b0, b3c2, _MM_SHUFFLE(2, 0, 2, 0));
+
+            const __m256 a2b1 =
+                _mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+            z = _mm256_shuffle_ps(a2b1, c, _MM_SHUFFLE(3, 0, 2, 0));
+        }
+
+        TUE_TARGET("avx") inline void transpose4x4_avx(
+            __m256& r0, __m256& r1, __m256& r2, __m256& r3) noexcept
+        {
+            const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+            const __m256 t1 = _mm256_unpacklo_ps(r2, r3);
+            const __m256 t2 = _mm256_unpackhi_ps(r0, r1);
+            const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+            r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+            r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+            r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        // Element `i` goes in the lower half of row `i` and element `i + 4`
+        // in its upper half.
+        TUE_TARGET("avx") inline __m256 load_soa4_row_avx(
+            const float* lo, const float* hi) noexcept
+        {
+            return _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm_loadu_ps(lo)),
+                _mm_loadu_ps(hi),
+                1);
+        }
+
+        TUE_TARGET("avx") inline void load_soa4_avx(
+            const float* aos,
+            std::size_t stride,
+            __m256& x, __m256& y, __m256& z, __m256& w) noexcept
+        {
+            __m256 r0 = tue::detail_::load_soa4_row_avx(aos, aos + stride * 4);
+            __m256 r1 = tue::detail_::load_soa4_row_avx(
+                aos + stride, aos + stride * 5);
+            __m256 r2 = tue::detail_::load_soa4_row_avx(
+                aos + stride * 2, aos + stride * 6);
+            __m256 r3 = tue::detail_::load_soa4_row_avx(
+                aos + stride * 3, aos + stride * 7);
+            tue::detail_::transpose4x4_avx(r0, r1, r2, r3);
+            x = r0;
+            y = r1;
+            z = r2;
+            w = r3;
+        }
+
+        TUE_TARGET("avx") inline void store_aos2_avx(
+            float* aos, const __m256& x, const __m256& y) noexcept
+        {
+            const __m256 a = _mm256_unpacklo_ps(x, y);
+            const __m256 b = _mm256_unpackhi_ps(x, y);
+            _mm256_storeu_ps(aos, _mm256_permute2f128_ps(a, b, 0x20));
+            _mm256_storeu_ps(aos + 8, _mm256_permute2f128_ps(a, b, 0x31));
+        }
+
+        TUE_TARGET("avx") inline void store_aos3_avx(
+            float* aos,
+            const __m256& x,
+            const __m256& y,
+            const __m256& z) noexcept
+        {
+            const __m256 x0y0 =
+                _mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0));
+            const __m256 z0x1 =
+                _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+            const __m256 a =
+                _mm256_shuffle_ps(x0y0, z0x1, _MM_SHUFFLE(2, 0, 2, 0));
+
+            const __m256 y1z1 =
+                _mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+            const __m256 x2y2 =
+                _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));
+            const __m256 b =
+                _mm256_shuffle_ps(y1z1, x2y2, _MM_SHUFFLE(2, 0, 2, 0));
+
+            const __m256 z2x3 =
+                _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+            const __m256 y3z3 =
+                _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+            const __m256 c =
+                _mm256_shuffle_ps(z2x3, y3z3, _MM_SHUFFLE(2, 0, 2, 0));
+
+            _mm256_storeu_ps(aos, _mm256_permute2f128_ps(a, b, 0x20));
+            _mm256_storeu_ps(aos + 8, _mm256_permute2f128_ps(c, a, 0x30));
+            _mm256_storeu_ps(aos + 16, _mm256_permute2f128_ps(b, c, 0x31));
+        }
+
+        TUE_TARGET("avx") inline void store_aos4_avx(
+            float* aos,
+            std::size_t stride,
+            const __m256& x,
+            const __m256& y,
+            const __m256& z,
+            const __m256& w) noexcept
+        {
+            __m256 r[] = { x, y, z, w };
+            tue::detail_::transpose4x4_avx(r[0], r[1], r[2], r[3]);
+            for (int i = 0; i < 4; ++i)
+            {
+                _mm_storeu_ps(aos + stride * i, _mm256_castps256_ps128(r[i]));
+                _mm_storeu_ps(
+                    aos + stride * (i + 4), _mm256_extractf128_ps(r[i], 1));
+            }
+        }
+    }
+}
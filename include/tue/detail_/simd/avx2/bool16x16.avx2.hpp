@@ -0,0 +1,463 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../../../simd.hpp"
+#include "../../../sized_bool.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<bool16, 16>())
+    simd<bool16, 16>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static bool16x16 explicit_cast(const simd<U, 16>& s) noexcept
+        {
+            return {
+                bool16(s.data()[0]),
+                bool16(s.data()[1]),
+                bool16(s.data()[2]),
+                bool16(s.data()[3]),
+                bool16(s.data()[4]),
+                bool16(s.data()[5]),
+                bool16(s.data()[6]),
+                bool16(s.data()[7]),
+                bool16(s.data()[8]),
+                bool16(s.data()[9]),
+                bool16(s.data()[10]),
+                bool16(s.data()[11]),
+                bool16(s.data()[12]),
+                bool16(s.data()[13]),
+                bool16(s.data()[14]),
+                bool16(s.data()[15]),
+            };
+        }
+
+        inline static bool16x16 explicit_cast(const int16x16& s) noexcept;
+
+        inline static bool16x16 explicit_cast(const uint16x16& s) noexcept;
+
+    public:
+        using component_type = bool16;
+
+        static constexpr int component_count = 16;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(bool16 x) noexcept
+        :
+            underlying_(_mm256_set1_epi16(x))
+        {
+        }
+
+        template<int M = 16, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            bool16 x, bool16 y) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            bool16 x, bool16 y, bool16 z, bool16 w) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            bool16 s0, bool16 s1, bool16 s2, bool16 s3,
+            bool16 s4, bool16 s5, bool16 s6, bool16 s7) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            bool16  s0, bool16  s1, bool16  s2, bool16  s3,
+            bool16  s4, bool16  s5, bool16  s6, bool16  s7,
+            bool16  s8, bool16  s9, bool16 s10, bool16 s11,
+            bool16 s12, bool16 s13, bool16 s14, bool16 s15) noexcept
+        :
+            underlying_(_mm256_setr_epi16(
+                s0, s1,  s2,  s3,  s4,  s5,  s6,  s7,
+                s8, s9, s10, s11, s12, s13, s14, s15))
+        {
+        }
+
+        template<typename U>
+        explicit simd(const simd<U, 16>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static bool16x16 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static bool16x16 load(const bool16* data) noexcept
+        {
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        static bool16x16 loadu(const bool16* data) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool16x16 gather(
+            const bool16* base, const simd<I, 16>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool16x16 gather(
+            const bool16* base,
+            const simd<I, 16>& indices,
+            const bool16x16& conditions) noexcept;
+
+        inline static bool16x16 load_partial(
+            const bool16* data, int count) noexcept;
+
+        inline static bool16x16 maskload(
+            const bool16* data, const bool16x16& conditions) noexcept;
+
+        void store(bool16* data) const noexcept
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(bool16* data) const noexcept
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void stream(bool16* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool16* base, const simd<I, 16>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool16* base,
+            const simd<I, 16>& indices,
+            const bool16x16& conditions) const noexcept;
+
+        inline void store_partial(bool16* data, int count) const noexcept;
+
+        inline void maskstore(
+            bool16* data, const bool16x16& conditions) const noexcept;
+
+        const bool16* data() const noexcept
+        {
+            return reinterpret_cast<const bool16*>(&underlying_);
+        }
+
+        bool16* data() noexcept
+        {
+            return reinterpret_cast<bool16*>(&underlying_);
+        }
+    };
+}
+
+#include "int16x16.avx2.hpp"
+#include "uint16x16.avx2.hpp"
+
+namespace tue
+{
+    inline bool16x16 bool16x16::explicit_cast(const int16x16& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline bool16x16 bool16x16::explicit_cast(const uint16x16& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    template<typename I, typename>
+    inline bool16x16 bool16x16::gather(
+        const bool16* base, const simd<I, 16>& indices) noexcept
+    {
+        return tue::detail_::gather_components<bool16x16>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline bool16x16 bool16x16::gather(
+        const bool16* base,
+        const simd<I, 16>& indices,
+        const bool16x16& conditions) noexcept
+    {
+        return tue::detail_::gather_components<bool16x16>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void bool16x16::scatter(
+        bool16* base, const simd<I, 16>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void bool16x16::scatter(
+        bool16* base,
+        const simd<I, 16>& indices,
+        const bool16x16& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline bool16x16 bool16x16::load_partial(
+        const bool16* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm256_cmpgt_epi16(
+                _mm256_set1_epi16(static_cast<short>(count)),
+                _mm256_setr_epi16(
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)));
+    }
+
+    inline bool16x16 bool16x16::maskload(
+        const bool16* data, const bool16x16& conditions) noexcept
+    {
+        if (_mm256_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(bool16x16)))
+        {
+            return _mm256_and_si256(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<bool16x16>(data, conditions);
+    }
+
+    inline void bool16x16::store_partial(
+        bool16* data, int count) const noexcept
+    {
+        const int size = count * 2;
+        tue::detail_::storeu_partial_si128(
+            data, _mm256_castsi256_si128(underlying_), size);
+        if (size > 16)
+        {
+            tue::detail_::storeu_partial_si128(
+                reinterpret_cast<char*>(data) + 16,
+                _mm256_extracti128_si256(underlying_, 1),
+                size - 16);
+        }
+    }
+
+    inline void bool16x16::maskstore(
+        bool16* data, const bool16x16& conditions) const noexcept
+    {
+        const auto c = reinterpret_cast<char*>(data);
+        _mm_maskmoveu_si128(
+            _mm256_castsi256_si128(underlying_),
+            _mm256_castsi256_si128(conditions),
+            c);
+        _mm_maskmoveu_si128(
+            _mm256_extracti128_si256(underlying_, 1),
+            _mm256_extracti128_si256(conditions, 1),
+            c + 16);
+    }
+
+    namespace detail_
+    {
+        inline bool16x16 bitwise_not_operator_s(
+            const bool16x16& s) noexcept
+        {
+            return _mm256_xor_si256(s, bool16x16(true16));
+        }
+
+        inline bool16x16 bitwise_and_operator_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline bool16x16 bitwise_or_operator_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline bool16x16 bitwise_xor_operator_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline bool16x16& bitwise_and_assignment_operator_ss(
+            bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline bool16x16& bitwise_or_assignment_operator_ss(
+            bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline bool16x16& bitwise_xor_assignment_operator_ss(
+            bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline bool16x16 mask_ss(
+            const bool16x16& conditions,
+            const bool16x16& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline bool16x16 select_sss(
+            const bool16x16& conditions,
+            const bool16x16& values,
+            const bool16x16& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool16x16 equal_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi16(lhs, rhs);
+        }
+
+        inline bool16x16 not_equal_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi16(lhs, rhs), bool16x16(true16));
+        }
+
+        inline std::uint64_t movemask_s(const bool16x16& s) noexcept
+        {
+            // Narrow each component to a byte first, so there's one bit per
+            // component. Packing the two 128-bit halves against each other
+            // keeps the components in order.
+            const __m256i x = s;
+            return static_cast<std::uint64_t>(_mm_movemask_epi8(
+                _mm_packs_epi16(
+                    _mm256_castsi256_si128(x),
+                    _mm256_extracti128_si256(x, 1))));
+        }
+
+        inline bool any_s(const bool16x16& s) noexcept
+        {
+            return _mm256_movemask_epi8(s) != 0;
+        }
+
+        inline bool all_s(const bool16x16& s) noexcept
+        {
+            return _mm256_movemask_epi8(s) == -1;
+        }
+
+        inline bool none_s(const bool16x16& s) noexcept
+        {
+            return _mm256_movemask_epi8(s) == 0;
+        }
+
+        template<int... I>
+        inline bool16x16 shuffle_s(
+            const bool16x16& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            // vpshufb only shuffles within each 128-bit half, so shuffle
+            // both s and s with its halves swapped, then blend in the
+            // components that cross over. Bit 4 of each
+            // control byte picks the half, so comparing it against the half
+            // each byte lands in and moving it up to bit 7 gives the blend
+            // mask.
+            const __m256i indices = _mm256_setr_epi16(
+                static_cast<short>(I * 0x0202 + 0x0100)...);
+            const __m256i halves = _mm256_setr_epi64x(
+                0, 0, 0x1010101010101010, 0x1010101010101010);
+            const __m256i swapped = _mm256_permute2x128_si256(s, s, 0x01);
+            const __m256i crossing =
+                _mm256_slli_epi16(_mm256_xor_si256(indices, halves), 3);
+            return _mm256_blendv_epi8(
+                _mm256_shuffle_epi8(s, indices),
+                _mm256_shuffle_epi8(swapped, indices),
+                crossing);
+        }
+
+        template<int... I>
+        inline bool16x16 shuffle_ss(
+            const bool16x16& lhs,
+            const bool16x16& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return _mm256_blendv_epi8(
+                tue::detail_::shuffle_s(
+                    lhs, std::integer_sequence<int, (I % 16)...>()),
+                tue::detail_::shuffle_s(
+                    rhs, std::integer_sequence<int, (I % 16)...>()),
+                _mm256_setr_epi16(static_cast<short>(I < 16 ? 0 : -1)...));
+        }
+
+        inline bool16x16 interleave_lo_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            // The unpack instructions interleave within each 128-bit half,
+            // so put the halves back in order afterwards.
+            const __m256i lo = _mm256_unpacklo_epi16(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi16(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x20);
+        }
+
+        inline bool16x16 interleave_hi_ss(
+            const bool16x16& lhs, const bool16x16& rhs) noexcept
+        {
+            const __m256i lo = _mm256_unpacklo_epi16(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi16(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x31);
+        }
+    }
+}
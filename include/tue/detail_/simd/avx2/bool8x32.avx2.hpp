@@ -0,0 +1,438 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../../../simd.hpp"
+#include "../../../sized_bool.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<bool8, 32>())
+    simd<bool8, 32>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static bool8x32 explicit_cast(const simd<U, 32>& s) noexcept
+        {
+            bool8x32 result;
+            for (int i = 0; i < 32; ++i)
+            {
+                result.data()[i] = bool8(s.data()[i]);
+            }
+            return result;
+        }
+
+        inline static bool8x32 explicit_cast(const int8x32& s) noexcept;
+
+        inline static bool8x32 explicit_cast(const uint8x32& s) noexcept;
+
+    public:
+        using component_type = bool8;
+
+        static constexpr int component_count = 32;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(bool8 x) noexcept
+        :
+            underlying_(_mm256_set1_epi8(x))
+        {
+        }
+
+        template<int M = 32, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            bool8 x, bool8 y) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            bool8 x, bool8 y, bool8 z, bool8 w) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            bool8 s0, bool8 s1, bool8 s2, bool8 s3,
+            bool8 s4, bool8 s5, bool8 s6, bool8 s7) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            bool8  s0, bool8  s1, bool8  s2, bool8  s3,
+            bool8  s4, bool8  s5, bool8  s6, bool8  s7,
+            bool8  s8, bool8  s9, bool8 s10, bool8 s11,
+            bool8 s12, bool8 s13, bool8 s14, bool8 s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 32>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static bool8x32 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static bool8x32 load(const bool8* data) noexcept
+        {
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        static bool8x32 loadu(const bool8* data) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool8x32 gather(
+            const bool8* base, const simd<I, 32>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool8x32 gather(
+            const bool8* base,
+            const simd<I, 32>& indices,
+            const bool8x32& conditions) noexcept;
+
+        inline static bool8x32 load_partial(
+            const bool8* data, int count) noexcept;
+
+        inline static bool8x32 maskload(
+            const bool8* data, const bool8x32& conditions) noexcept;
+
+        void store(bool8* data) const noexcept
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(bool8* data) const noexcept
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void stream(bool8* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool8* base, const simd<I, 32>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool8* base,
+            const simd<I, 32>& indices,
+            const bool8x32& conditions) const noexcept;
+
+        inline void store_partial(bool8* data, int count) const noexcept;
+
+        inline void maskstore(
+            bool8* data, const bool8x32& conditions) const noexcept;
+
+        const bool8* data() const noexcept
+        {
+            return reinterpret_cast<const bool8*>(&underlying_);
+        }
+
+        bool8* data() noexcept
+        {
+            return reinterpret_cast<bool8*>(&underlying_);
+        }
+    };
+}
+
+#include "int8x32.avx2.hpp"
+#include "uint8x32.avx2.hpp"
+
+namespace tue
+{
+    inline bool8x32 bool8x32::explicit_cast(const int8x32& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline bool8x32 bool8x32::explicit_cast(const uint8x32& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    template<typename I, typename>
+    inline bool8x32 bool8x32::gather(
+        const bool8* base, const simd<I, 32>& indices) noexcept
+    {
+        return tue::detail_::gather_components<bool8x32>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline bool8x32 bool8x32::gather(
+        const bool8* base,
+        const simd<I, 32>& indices,
+        const bool8x32& conditions) noexcept
+    {
+        return tue::detail_::gather_components<bool8x32>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void bool8x32::scatter(
+        bool8* base, const simd<I, 32>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void bool8x32::scatter(
+        bool8* base,
+        const simd<I, 32>& indices,
+        const bool8x32& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline bool8x32 bool8x32::load_partial(
+        const bool8* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm256_cmpgt_epi8(
+                _mm256_set1_epi8(static_cast<char>(count)),
+                _mm256_setr_epi8(
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+                    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+                    31)));
+    }
+
+    inline bool8x32 bool8x32::maskload(
+        const bool8* data, const bool8x32& conditions) noexcept
+    {
+        if (_mm256_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(bool8x32)))
+        {
+            return _mm256_and_si256(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<bool8x32>(data, conditions);
+    }
+
+    inline void bool8x32::store_partial(bool8* data, int count) const noexcept
+    {
+        const int size = count * 1;
+        tue::detail_::storeu_partial_si128(
+            data, _mm256_castsi256_si128(underlying_), size);
+        if (size > 16)
+        {
+            tue::detail_::storeu_partial_si128(
+                reinterpret_cast<char*>(data) + 16,
+                _mm256_extracti128_si256(underlying_, 1),
+                size - 16);
+        }
+    }
+
+    inline void bool8x32::maskstore(
+        bool8* data, const bool8x32& conditions) const noexcept
+    {
+        const auto c = reinterpret_cast<char*>(data);
+        _mm_maskmoveu_si128(
+            _mm256_castsi256_si128(underlying_),
+            _mm256_castsi256_si128(conditions),
+            c);
+        _mm_maskmoveu_si128(
+            _mm256_extracti128_si256(underlying_, 1),
+            _mm256_extracti128_si256(conditions, 1),
+            c + 16);
+    }
+
+    namespace detail_
+    {
+        inline bool8x32 bitwise_not_operator_s(
+            const bool8x32& s) noexcept
+        {
+            return _mm256_xor_si256(s, bool8x32(true8));
+        }
+
+        inline bool8x32 bitwise_and_operator_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline bool8x32 bitwise_or_operator_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline bool8x32 bitwise_xor_operator_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline bool8x32& bitwise_and_assignment_operator_ss(
+            bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline bool8x32& bitwise_or_assignment_operator_ss(
+            bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline bool8x32& bitwise_xor_assignment_operator_ss(
+            bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline bool8x32 mask_ss(
+            const bool8x32& conditions,
+            const bool8x32& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline bool8x32 select_sss(
+            const bool8x32& conditions,
+            const bool8x32& values,
+            const bool8x32& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool8x32 equal_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi8(lhs, rhs);
+        }
+
+        inline bool8x32 not_equal_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi8(lhs, rhs), bool8x32(true8));
+        }
+
+        inline std::uint64_t movemask_s(const bool8x32& s) noexcept
+        {
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(s));
+        }
+
+        inline bool any_s(const bool8x32& s) noexcept
+        {
+            return _mm256_movemask_epi8(s) != 0;
+        }
+
+        inline bool all_s(const bool8x32& s) noexcept
+        {
+            return _mm256_movemask_epi8(s) == -1;
+        }
+
+        inline bool none_s(const bool8x32& s) noexcept
+        {
+            return _mm256_movemask_epi8(s) == 0;
+        }
+
+        template<int... I>
+        inline bool8x32 shuffle_s(
+            const bool8x32& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            // vpshufb only shuffles within each 128-bit half, so shuffle
+            // both s and s with its halves swapped, then blend in the
+            // components that cross over. Bit 4 of each
+            // control byte picks the half, so comparing it against the half
+            // each byte lands in and moving it up to bit 7 gives the blend
+            // mask.
+            const __m256i indices = _mm256_setr_epi8(static_cast<char>(I)...);
+            const __m256i halves = _mm256_setr_epi64x(
+                0, 0, 0x1010101010101010, 0x1010101010101010);
+            const __m256i swapped = _mm256_permute2x128_si256(s, s, 0x01);
+            const __m256i crossing =
+                _mm256_slli_epi16(_mm256_xor_si256(indices, halves), 3);
+            return _mm256_blendv_epi8(
+                _mm256_shuffle_epi8(s, indices),
+                _mm256_shuffle_epi8(swapped, indices),
+                crossing);
+        }
+
+        template<int... I>
+        inline bool8x32 shuffle_ss(
+            const bool8x32& lhs,
+            const bool8x32& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return _mm256_blendv_epi8(
+                tue::detail_::shuffle_s(
+                    lhs, std::integer_sequence<int, (I % 32)...>()),
+                tue::detail_::shuffle_s(
+                    rhs, std::integer_sequence<int, (I % 32)...>()),
+                _mm256_setr_epi8(static_cast<char>(I < 32 ? 0 : -1)...));
+        }
+
+        inline bool8x32 interleave_lo_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            // The unpack instructions interleave within each 128-bit half,
+            // so put the halves back in order afterwards.
+            const __m256i lo = _mm256_unpacklo_epi8(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi8(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x20);
+        }
+
+        inline bool8x32 interleave_hi_ss(
+            const bool8x32& lhs, const bool8x32& rhs) noexcept
+        {
+            const __m256i lo = _mm256_unpacklo_epi8(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi8(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x31);
+        }
+    }
+}
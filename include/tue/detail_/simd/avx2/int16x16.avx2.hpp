@@ -0,0 +1,680 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<std::int16_t, 16>())
+    simd<std::int16_t, 16>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static int16x16 explicit_cast(const simd<U, 16>& s) noexcept
+        {
+            return {
+                std::int16_t(s.data()[0]),
+                std::int16_t(s.data()[1]),
+                std::int16_t(s.data()[2]),
+                std::int16_t(s.data()[3]),
+                std::int16_t(s.data()[4]),
+                std::int16_t(s.data()[5]),
+                std::int16_t(s.data()[6]),
+                std::int16_t(s.data()[7]),
+                std::int16_t(s.data()[8]),
+                std::int16_t(s.data()[9]),
+                std::int16_t(s.data()[10]),
+                std::int16_t(s.data()[11]),
+                std::int16_t(s.data()[12]),
+                std::int16_t(s.data()[13]),
+                std::int16_t(s.data()[14]),
+                std::int16_t(s.data()[15]),
+            };
+        }
+
+        inline static int16x16 explicit_cast(const bool16x16& s) noexcept;
+
+        inline static int16x16 explicit_cast(const uint16x16& s) noexcept;
+
+    public:
+        using component_type = std::int16_t;
+
+        static constexpr int component_count = 16;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(std::int16_t x) noexcept
+        :
+            underlying_(_mm256_set1_epi16(x))
+        {
+        }
+
+        template<int M = 16, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            std::int16_t x, std::int16_t y) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            std::int16_t x, std::int16_t y,
+            std::int16_t z, std::int16_t w) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            std::int16_t s0, std::int16_t s1,
+            std::int16_t s2, std::int16_t s3,
+            std::int16_t s4, std::int16_t s5,
+            std::int16_t s6, std::int16_t s7) noexcept;
+
+        template<int M = 16, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            std::int16_t  s0, std::int16_t  s1,
+            std::int16_t  s2, std::int16_t  s3,
+            std::int16_t  s4, std::int16_t  s5,
+            std::int16_t  s6, std::int16_t  s7,
+            std::int16_t  s8, std::int16_t  s9,
+            std::int16_t s10, std::int16_t s11,
+            std::int16_t s12, std::int16_t s13,
+            std::int16_t s14, std::int16_t s15) noexcept
+        :
+            underlying_(_mm256_setr_epi16(
+                s0, s1,  s2,  s3,  s4,  s5,  s6,  s7,
+                s8, s9, s10, s11, s12, s13, s14, s15))
+        {
+        }
+
+        template<typename U>
+        explicit simd(const simd<U, 16>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static int16x16 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static int16x16 load(const std::int16_t* data) noexcept
+        {
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        static int16x16 loadu(const std::int16_t* data) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int16x16 gather(
+            const std::int16_t* base, const simd<I, 16>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int16x16 gather(
+            const std::int16_t* base,
+            const simd<I, 16>& indices,
+            const bool16x16& conditions) noexcept;
+
+        inline static int16x16 load_partial(
+            const std::int16_t* data, int count) noexcept;
+
+        inline static int16x16 maskload(
+            const std::int16_t* data, const bool16x16& conditions) noexcept;
+
+        void store(std::int16_t* data) const noexcept
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(std::int16_t* data) const noexcept
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void stream(std::int16_t* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int16_t* base, const simd<I, 16>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int16_t* base,
+            const simd<I, 16>& indices,
+            const bool16x16& conditions) const noexcept;
+
+        inline void store_partial(
+            std::int16_t* data, int count) const noexcept;
+
+        inline void maskstore(
+            std::int16_t* data, const bool16x16& conditions) const noexcept;
+
+        const std::int16_t* data() const noexcept
+        {
+            return reinterpret_cast<const std::int16_t*>(&underlying_);
+        }
+
+        std::int16_t* data() noexcept
+        {
+            return reinterpret_cast<std::int16_t*>(&underlying_);
+        }
+    };
+}
+
+#include "bool16x16.avx2.hpp"
+#include "uint16x16.avx2.hpp"
+#include "../sse2/int16x8.sse2.hpp"
+#include "int8x32.avx2.hpp"
+#include "uint8x32.avx2.hpp"
+
+namespace tue
+{
+    inline int16x16 int16x16::explicit_cast(const bool16x16& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline int16x16 int16x16::explicit_cast(const uint16x16& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    template<typename I, typename>
+    inline int16x16 int16x16::gather(
+        const std::int16_t* base, const simd<I, 16>& indices) noexcept
+    {
+        return tue::detail_::gather_components<int16x16>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline int16x16 int16x16::gather(
+        const std::int16_t* base,
+        const simd<I, 16>& indices,
+        const bool16x16& conditions) noexcept
+    {
+        return tue::detail_::gather_components<int16x16>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void int16x16::scatter(
+        std::int16_t* base, const simd<I, 16>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void int16x16::scatter(
+        std::int16_t* base,
+        const simd<I, 16>& indices,
+        const bool16x16& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline int16x16 int16x16::load_partial(
+        const std::int16_t* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm256_cmpgt_epi16(
+                _mm256_set1_epi16(static_cast<short>(count)),
+                _mm256_setr_epi16(
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)));
+    }
+
+    inline int16x16 int16x16::maskload(
+        const std::int16_t* data, const bool16x16& conditions) noexcept
+    {
+        if (_mm256_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(int16x16)))
+        {
+            return _mm256_and_si256(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<int16x16>(data, conditions);
+    }
+
+    inline void int16x16::store_partial(
+        std::int16_t* data, int count) const noexcept
+    {
+        const int size = count * 2;
+        tue::detail_::storeu_partial_si128(
+            data, _mm256_castsi256_si128(underlying_), size);
+        if (size > 16)
+        {
+            tue::detail_::storeu_partial_si128(
+                reinterpret_cast<char*>(data) + 16,
+                _mm256_extracti128_si256(underlying_, 1),
+                size - 16);
+        }
+    }
+
+    inline void int16x16::maskstore(
+        std::int16_t* data, const bool16x16& conditions) const noexcept
+    {
+        const auto c = reinterpret_cast<char*>(data);
+        _mm_maskmoveu_si128(
+            _mm256_castsi256_si128(underlying_),
+            _mm256_castsi256_si128(conditions),
+            c);
+        _mm_maskmoveu_si128(
+            _mm256_extracti128_si256(underlying_, 1),
+            _mm256_extracti128_si256(conditions, 1),
+            c + 16);
+    }
+
+    namespace detail_
+    {
+        inline int16x16 unary_plus_operator_s(const int16x16& s) noexcept
+        {
+            return s;
+        }
+
+        inline int16x16& pre_increment_operator_s(int16x16& s) noexcept
+        {
+            return s = _mm256_add_epi16(s, int16x16(1));
+        }
+
+        inline int16x16 post_increment_operator_s(int16x16& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_epi16(s, int16x16(1));
+            return result;
+        }
+
+        inline int16x16 unary_minus_operator_s(const int16x16& s) noexcept
+        {
+            return _mm256_sub_epi16(_mm256_setzero_si256(), s);
+        }
+
+        inline int16x16& pre_decrement_operator_s(int16x16& s) noexcept
+        {
+            return s = _mm256_sub_epi16(s, int16x16(1));
+        }
+
+        inline int16x16 post_decrement_operator_s(int16x16& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_epi16(s, int16x16(1));
+            return result;
+        }
+
+        inline int16x16 bitwise_not_operator_s(const int16x16& s) noexcept
+        {
+            return _mm256_xor_si256(s, int16x16(0xFFFF));
+        }
+
+        inline int16x16 addition_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_add_epi16(lhs, rhs);
+        }
+
+        inline int16x16 subtraction_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_sub_epi16(lhs, rhs);
+        }
+
+        inline int16x16 multiplication_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_mullo_epi16(lhs, rhs);
+        }
+
+        inline int16x16 bitwise_and_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline int16x16 bitwise_or_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline int16x16 bitwise_xor_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline int16x16 bitwise_shift_left_operator_si(
+            const int16x16& lhs, int rhs) noexcept
+        {
+            return _mm256_slli_epi16(lhs, rhs);
+        }
+
+        inline int16x16 bitwise_shift_right_operator_si(
+            const int16x16& lhs, int rhs) noexcept
+        {
+            return _mm256_srai_epi16(lhs, rhs);
+        }
+
+        inline int16x16& addition_assignment_operator_ss(
+            int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return lhs = _mm256_add_epi16(lhs, rhs);
+        }
+
+        inline int16x16& subtraction_assignment_operator_ss(
+            int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return lhs = _mm256_sub_epi16(lhs, rhs);
+        }
+
+        inline int16x16& multiplication_assignment_operator_ss(
+            int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return lhs = multiplication_operator_ss(lhs, rhs);
+        }
+
+        inline int16x16& bitwise_and_assignment_operator_ss(
+            int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline int16x16& bitwise_or_assignment_operator_ss(
+            int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline int16x16& bitwise_xor_assignment_operator_ss(
+            int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline int16x16& bitwise_shift_left_assignment_operator_si(
+            int16x16& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_si(lhs, rhs);
+        }
+
+        inline int16x16& bitwise_shift_right_assignment_operator_si(
+            int16x16& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline int16x16 abs_s(const int16x16& s) noexcept
+        {
+            return _mm256_abs_epi16(s);
+        }
+
+        inline int16x16 min_ss(
+            const int16x16& s1, const int16x16& s2) noexcept
+        {
+            return _mm256_min_epi16(s1, s2);
+        }
+
+        inline int16x16 max_ss(
+            const int16x16& s1, const int16x16& s2) noexcept
+        {
+            return _mm256_max_epi16(s1, s2);
+        }
+
+        inline std::int16_t reduce_add_s(const int16x16& s) noexcept
+        {
+            // Fold the upper 128 bits onto the lower ones first.
+            const __m256i x = s;
+            return reduce_add_s(addition_operator_ss(
+                int16x8(_mm256_castsi256_si128(x)),
+                int16x8(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline std::int16_t reduce_min_s(const int16x16& s) noexcept
+        {
+            const __m256i x = s;
+            return reduce_min_s(min_ss(
+                int16x8(_mm256_castsi256_si128(x)),
+                int16x8(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline std::int16_t reduce_max_s(const int16x16& s) noexcept
+        {
+            const __m256i x = s;
+            return reduce_max_s(max_ss(
+                int16x8(_mm256_castsi256_si128(x)),
+                int16x8(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline int16x16 adds_ss(
+            const int16x16& s1, const int16x16& s2) noexcept
+        {
+            return _mm256_adds_epi16(s1, s2);
+        }
+
+        inline int16x16 subs_ss(
+            const int16x16& s1, const int16x16& s2) noexcept
+        {
+            return _mm256_subs_epi16(s1, s2);
+        }
+
+        inline int16x16 avg_ss(
+            const int16x16& s1, const int16x16& s2) noexcept
+        {
+            const auto bias = _mm256_set1_epi16(-0x8000);
+            return _mm256_xor_si256(
+                _mm256_avg_epu16(
+                    _mm256_xor_si256(s1, bias), _mm256_xor_si256(s2, bias)),
+                bias);
+        }
+
+        inline int16x16 mask_ss(
+            const bool16x16& conditions,
+            const int16x16& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline int16x16 select_sss(
+            const bool16x16& conditions,
+            const int16x16& values,
+            const int16x16& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool16x16 less_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_cmpgt_epi16(rhs, lhs);
+        }
+
+        inline bool16x16 less_equal_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi16(lhs, rhs), int16x16(0xFFFF));
+        }
+
+        inline bool16x16 greater_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_cmpgt_epi16(lhs, rhs);
+        }
+
+        inline bool16x16 greater_equal_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi16(rhs, lhs), int16x16(0xFFFF));
+        }
+
+        inline bool16x16 equal_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi16(lhs, rhs);
+        }
+
+        inline bool16x16 not_equal_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi16(lhs, rhs), int16x16(0xFFFF));
+        }
+
+        template<int... I>
+        inline int16x16 shuffle_s(
+            const int16x16& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            // vpshufb only shuffles within each 128-bit half, so shuffle
+            // both s and s with its halves swapped, then blend in the
+            // components that cross over. Bit 4 of each
+            // control byte picks the half, so comparing it against the half
+            // each byte lands in and moving it up to bit 7 gives the blend
+            // mask.
+            const __m256i indices = _mm256_setr_epi16(
+                static_cast<short>(I * 0x0202 + 0x0100)...);
+            const __m256i halves = _mm256_setr_epi64x(
+                0, 0, 0x1010101010101010, 0x1010101010101010);
+            const __m256i swapped = _mm256_permute2x128_si256(s, s, 0x01);
+            const __m256i crossing =
+                _mm256_slli_epi16(_mm256_xor_si256(indices, halves), 3);
+            return _mm256_blendv_epi8(
+                _mm256_shuffle_epi8(s, indices),
+                _mm256_shuffle_epi8(swapped, indices),
+                crossing);
+        }
+
+        template<int... I>
+        inline int16x16 shuffle_ss(
+            const int16x16& lhs,
+            const int16x16& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return _mm256_blendv_epi8(
+                tue::detail_::shuffle_s(
+                    lhs, std::integer_sequence<int, (I % 16)...>()),
+                tue::detail_::shuffle_s(
+                    rhs, std::integer_sequence<int, (I % 16)...>()),
+                _mm256_setr_epi16(static_cast<short>(I < 16 ? 0 : -1)...));
+        }
+
+        template<int I>
+        inline std::int16_t extract_s(
+            const int16x16& s, std::integral_constant<int, I>) noexcept
+        {
+            return static_cast<std::int16_t>(_mm256_extract_epi16(s, I));
+        }
+
+        template<int I>
+        inline int16x16 insert_s(
+            const int16x16& s,
+            std::int16_t x,
+            std::integral_constant<int, I>) noexcept
+        {
+            return _mm256_insert_epi16(s, static_cast<short>(x), I);
+        }
+
+        inline int16x16 interleave_lo_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            // The unpack instructions interleave within each 128-bit half,
+            // so put the halves back in order afterwards.
+            const __m256i lo = _mm256_unpacklo_epi16(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi16(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x20);
+        }
+
+        inline int16x16 interleave_hi_ss(
+            const int16x16& lhs, const int16x16& rhs) noexcept
+        {
+            const __m256i lo = _mm256_unpacklo_epi16(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi16(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x31);
+        }
+
+        inline int8x32 packs_ss(
+            const int16x16& lo, const int16x16& hi) noexcept
+        {
+            // The 256-bit packs work within 128-bit halves.
+            return _mm256_permute4x64_epi64(
+                _mm256_packs_epi16(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+        }
+
+        inline uint8x32 packus_ss(
+            const int16x16& lo, const int16x16& hi) noexcept
+        {
+            return _mm256_permute4x64_epi64(
+                _mm256_packus_epi16(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+        }
+
+        inline int16x16 widen_lo_s(const int8x32& s) noexcept
+        {
+            return _mm256_cvtepi8_epi16(_mm256_castsi256_si128(s));
+        }
+
+        inline int16x16 widen_hi_s(const int8x32& s) noexcept
+        {
+            return _mm256_cvtepi8_epi16(_mm256_extracti128_si256(s, 1));
+        }
+
+        inline uint16x16 widen_lo_s(const uint8x32& s) noexcept
+        {
+            return _mm256_cvtepu8_epi16(_mm256_castsi256_si128(s));
+        }
+
+        inline uint16x16 widen_hi_s(const uint8x32& s) noexcept
+        {
+            return _mm256_cvtepu8_epi16(_mm256_extracti128_si256(s, 1));
+        }
+    }
+}
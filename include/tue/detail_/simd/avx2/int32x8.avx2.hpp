@@ -0,0 +1,704 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<std::int32_t, 8>())
+    simd<std::int32_t, 8>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static int32x8 explicit_cast(const simd<U, 8>& s) noexcept
+        {
+            return {
+                std::int32_t(s.data()[0]),
+                std::int32_t(s.data()[1]),
+                std::int32_t(s.data()[2]),
+                std::int32_t(s.data()[3]),
+                std::int32_t(s.data()[4]),
+                std::int32_t(s.data()[5]),
+                std::int32_t(s.data()[6]),
+                std::int32_t(s.data()[7]),
+            };
+        }
+
+        inline static int32x8 explicit_cast(const bool32x8& s) noexcept;
+
+        inline static int32x8 explicit_cast(const float32x8& s) noexcept;
+
+        inline static int32x8 explicit_cast(const uint32x8& s) noexcept;
+
+    public:
+        using component_type = std::int32_t;
+
+        static constexpr int component_count = 8;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(std::int32_t x) noexcept
+        :
+            underlying_(_mm256_set1_epi32(x))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            std::int32_t x, std::int32_t y) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            std::int32_t x, std::int32_t y,
+            std::int32_t z, std::int32_t w) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            std::int32_t s0, std::int32_t s1,
+            std::int32_t s2, std::int32_t s3,
+            std::int32_t s4, std::int32_t s5,
+            std::int32_t s6, std::int32_t s7) noexcept
+        :
+            underlying_(_mm256_setr_epi32(
+                s0, s1, s2, s3, s4, s5, s6, s7))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            std::int32_t  s0, std::int32_t  s1,
+            std::int32_t  s2, std::int32_t  s3,
+            std::int32_t  s4, std::int32_t  s5,
+            std::int32_t  s6, std::int32_t  s7,
+            std::int32_t  s8, std::int32_t  s9,
+            std::int32_t s10, std::int32_t s11,
+            std::int32_t s12, std::int32_t s13,
+            std::int32_t s14, std::int32_t s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 8>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static int32x8 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static int32x8 load(const std::int32_t* data) noexcept
+        {
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        static int32x8 loadu(const std::int32_t* data) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int32x8 gather(
+            const std::int32_t* base, const simd<I, 8>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int32x8 gather(
+            const std::int32_t* base,
+            const simd<I, 8>& indices,
+            const bool32x8& conditions) noexcept;
+
+        inline static int32x8 load_partial(
+            const std::int32_t* data, int count) noexcept;
+
+        inline static int32x8 maskload(
+            const std::int32_t* data, const bool32x8& conditions) noexcept;
+
+        void store(std::int32_t* data) const noexcept
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(std::int32_t* data) const noexcept
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void stream(std::int32_t* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int32_t* base, const simd<I, 8>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int32_t* base,
+            const simd<I, 8>& indices,
+            const bool32x8& conditions) const noexcept;
+
+        inline void store_partial(
+            std::int32_t* data, int count) const noexcept;
+
+        inline void maskstore(
+            std::int32_t* data, const bool32x8& conditions) const noexcept;
+
+        const std::int32_t* data() const noexcept
+        {
+            return reinterpret_cast<const std::int32_t*>(&underlying_);
+        }
+
+        std::int32_t* data() noexcept
+        {
+            return reinterpret_cast<std::int32_t*>(&underlying_);
+        }
+    };
+}
+
+#include "../avx/bool32x8.avx.hpp"
+#include "../avx/float32x8.avx.hpp"
+#include "uint32x8.avx2.hpp"
+#include "../sse2/int32x4.sse2.hpp"
+#include "int16x16.avx2.hpp"
+#include "uint16x16.avx2.hpp"
+
+namespace tue
+{
+    inline int32x8 int32x8::explicit_cast(const bool32x8& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline int32x8 int32x8::explicit_cast(const float32x8& s) noexcept
+    {
+        return _mm256_cvttps_epi32(s);
+    }
+
+    inline int32x8 int32x8::explicit_cast(const uint32x8& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    template<typename I, typename>
+    inline int32x8 int32x8::gather(
+        const std::int32_t* base, const simd<I, 8>& indices) noexcept
+    {
+        return _mm256_i32gather_epi32(
+            reinterpret_cast<const int*>(base), indices, 4);
+    }
+
+    template<typename I, typename>
+    inline int32x8 int32x8::gather(
+        const std::int32_t* base,
+        const simd<I, 8>& indices,
+        const bool32x8& conditions) noexcept
+    {
+        return _mm256_mask_i32gather_epi32(
+            _mm256_setzero_si256(),
+            reinterpret_cast<const int*>(base),
+            indices,
+            _mm256_castps_si256(conditions),
+            4);
+    }
+
+    template<typename I, typename>
+    inline void int32x8::scatter(
+        std::int32_t* base, const simd<I, 8>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void int32x8::scatter(
+        std::int32_t* base,
+        const simd<I, 8>& indices,
+        const bool32x8& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline int32x8 int32x8::load_partial(
+        const std::int32_t* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm256_cmp_ps(
+                _mm256_setr_ps(
+                    0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f),
+                _mm256_set1_ps(static_cast<float>(count)),
+                _CMP_LT_OQ));
+    }
+
+    inline int32x8 int32x8::maskload(
+        const std::int32_t* data, const bool32x8& conditions) noexcept
+    {
+        return _mm256_maskload_epi32(
+            reinterpret_cast<const int*>(data),
+            _mm256_castps_si256(conditions));
+    }
+
+    inline void int32x8::store_partial(
+        std::int32_t* data, int count) const noexcept
+    {
+        maskstore(
+            data,
+            _mm256_cmp_ps(
+                _mm256_setr_ps(
+                    0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f),
+                _mm256_set1_ps(static_cast<float>(count)),
+                _CMP_LT_OQ));
+    }
+
+    inline void int32x8::maskstore(
+        std::int32_t* data, const bool32x8& conditions) const noexcept
+    {
+        _mm256_maskstore_epi32(
+            reinterpret_cast<int*>(data), _mm256_castps_si256(conditions),
+            underlying_);
+    }
+
+    namespace detail_
+    {
+        inline int32x8 unary_plus_operator_s(const int32x8& s) noexcept
+        {
+            return s;
+        }
+
+        inline int32x8& pre_increment_operator_s(int32x8& s) noexcept
+        {
+            return s = _mm256_add_epi32(s, int32x8(1));
+        }
+
+        inline int32x8 post_increment_operator_s(int32x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_epi32(s, int32x8(1));
+            return result;
+        }
+
+        inline int32x8 unary_minus_operator_s(const int32x8& s) noexcept
+        {
+            return _mm256_sub_epi32(_mm256_setzero_si256(), s);
+        }
+
+        inline int32x8& pre_decrement_operator_s(int32x8& s) noexcept
+        {
+            return s = _mm256_sub_epi32(s, int32x8(1));
+        }
+
+        inline int32x8 post_decrement_operator_s(int32x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_epi32(s, int32x8(1));
+            return result;
+        }
+
+        inline int32x8 bitwise_not_operator_s(const int32x8& s) noexcept
+        {
+            return _mm256_xor_si256(s, int32x8(0xFFFFFFFF));
+        }
+
+        inline int32x8 addition_operator_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_add_epi32(lhs, rhs);
+        }
+
+        inline int32x8 subtraction_operator_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_sub_epi32(lhs, rhs);
+        }
+
+        inline int32x8 multiplication_operator_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_mullo_epi32(lhs, rhs);
+        }
+
+        inline int32x8 division_operator_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            // Every int32 is exactly representable as a double, and the
+            // double quotient is never rounded across an integer boundary,
+            // so truncating it gives the same result as integer division.
+            const auto lo = _mm256_cvttpd_epi32(_mm256_div_pd(
+                _mm256_cvtepi32_pd(_mm256_castsi256_si128(lhs)),
+                _mm256_cvtepi32_pd(_mm256_castsi256_si128(rhs))));
+            const auto hi = _mm256_cvttpd_epi32(_mm256_div_pd(
+                _mm256_cvtepi32_pd(_mm256_extracti128_si256(lhs, 1)),
+                _mm256_cvtepi32_pd(_mm256_extracti128_si256(rhs, 1))));
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        }
+
+        inline int32x8 modulo_operator_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_sub_epi32(lhs, _mm256_mullo_epi32(
+                division_operator_ss(lhs, rhs), rhs));
+        }
+
+        inline int32x8 bitwise_and_operator_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline int32x8 bitwise_or_operator_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline int32x8 bitwise_xor_operator_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline int32x8 bitwise_shift_left_operator_si(
+            const int32x8& lhs, int rhs) noexcept
+        {
+            return _mm256_slli_epi32(lhs, rhs);
+        }
+
+        inline int32x8 bitwise_shift_right_operator_si(
+            const int32x8& lhs, int rhs) noexcept
+        {
+            return _mm256_srai_epi32(lhs, rhs);
+        }
+
+        inline int32x8 bitwise_shift_left_operator_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_sllv_epi32(lhs, rhs);
+        }
+
+        inline int32x8 bitwise_shift_right_operator_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_srav_epi32(lhs, rhs);
+        }
+
+        inline int32x8& addition_assignment_operator_ss(
+            int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return lhs = _mm256_add_epi32(lhs, rhs);
+        }
+
+        inline int32x8& subtraction_assignment_operator_ss(
+            int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return lhs = _mm256_sub_epi32(lhs, rhs);
+        }
+
+        inline int32x8& multiplication_assignment_operator_ss(
+            int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return lhs = multiplication_operator_ss(lhs, rhs);
+        }
+
+        inline int32x8& division_assignment_operator_ss(
+            int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return lhs = division_operator_ss(lhs, rhs);
+        }
+
+        inline int32x8& modulo_assignment_operator_ss(
+            int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return lhs = modulo_operator_ss(lhs, rhs);
+        }
+
+        inline int32x8& bitwise_and_assignment_operator_ss(
+            int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline int32x8& bitwise_or_assignment_operator_ss(
+            int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline int32x8& bitwise_xor_assignment_operator_ss(
+            int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline int32x8& bitwise_shift_left_assignment_operator_si(
+            int32x8& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_si(lhs, rhs);
+        }
+
+        inline int32x8& bitwise_shift_right_assignment_operator_si(
+            int32x8& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
+        }
+
+        inline int32x8& bitwise_shift_left_assignment_operator_ss(
+            int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_ss(lhs, rhs);
+        }
+
+        inline int32x8& bitwise_shift_right_assignment_operator_ss(
+            int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_ss(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline int32x8 abs_s(const int32x8& s) noexcept
+        {
+            return _mm256_abs_epi32(s);
+        }
+
+        inline int32x8 min_ss(
+            const int32x8& s1, const int32x8& s2) noexcept
+        {
+            return _mm256_min_epi32(s1, s2);
+        }
+
+        inline int32x8 max_ss(
+            const int32x8& s1, const int32x8& s2) noexcept
+        {
+            return _mm256_max_epi32(s1, s2);
+        }
+
+        inline std::int32_t reduce_add_s(const int32x8& s) noexcept
+        {
+            // Fold the upper 128 bits onto the lower ones first.
+            const __m256i x = s;
+            return reduce_add_s(addition_operator_ss(
+                int32x4(_mm256_castsi256_si128(x)),
+                int32x4(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline std::int32_t reduce_min_s(const int32x8& s) noexcept
+        {
+            const __m256i x = s;
+            return reduce_min_s(min_ss(
+                int32x4(_mm256_castsi256_si128(x)),
+                int32x4(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline std::int32_t reduce_max_s(const int32x8& s) noexcept
+        {
+            const __m256i x = s;
+            return reduce_max_s(max_ss(
+                int32x4(_mm256_castsi256_si128(x)),
+                int32x4(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline int32x8 mask_ss(
+            const bool32x8& conditions,
+            const int32x8& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline int32x8 select_sss(
+            const bool32x8& conditions,
+            const int32x8& values,
+            const int32x8& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool32x8 less_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_cmpgt_epi32(rhs, lhs);
+        }
+
+        inline bool32x8 less_equal_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi32(lhs, rhs), int32x8(0xFFFFFFFF));
+        }
+
+        inline bool32x8 greater_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_cmpgt_epi32(lhs, rhs);
+        }
+
+        inline bool32x8 greater_equal_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi32(rhs, lhs), int32x8(0xFFFFFFFF));
+        }
+
+        inline bool32x8 equal_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi32(lhs, rhs);
+        }
+
+        inline bool32x8 not_equal_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi32(lhs, rhs), int32x8(0xFFFFFFFF));
+        }
+
+        template<int... I>
+        inline int32x8 shuffle_s(
+            const int32x8& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return _mm256_permutevar8x32_epi32(s, _mm256_setr_epi32(I...));
+        }
+
+        template<int... I>
+        inline int32x8 shuffle_ss(
+            const int32x8& lhs,
+            const int32x8& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            constexpr int from_rhs =
+                tue::detail_::second_source_lanes<8, I...>();
+            return _mm256_blend_epi32(
+                tue::detail_::shuffle_s(
+                    lhs, std::integer_sequence<int, (I % 8)...>()),
+                tue::detail_::shuffle_s(
+                    rhs, std::integer_sequence<int, (I % 8)...>()),
+                from_rhs);
+        }
+
+        template<int I>
+        inline std::int32_t extract_s(
+            const int32x8& s, std::integral_constant<int, I>) noexcept
+        {
+            return static_cast<std::int32_t>(_mm256_extract_epi32(s, I));
+        }
+
+        template<int I>
+        inline int32x8 insert_s(
+            const int32x8& s,
+            std::int32_t x,
+            std::integral_constant<int, I>) noexcept
+        {
+            return _mm256_blend_epi32(s, int32x8(x), 1 << I);
+        }
+
+        inline int32x8 interleave_lo_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            // The unpack instructions interleave within each 128-bit half,
+            // so put the halves back in order afterwards.
+            const __m256i lo = _mm256_unpacklo_epi32(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi32(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x20);
+        }
+
+        inline int32x8 interleave_hi_ss(
+            const int32x8& lhs, const int32x8& rhs) noexcept
+        {
+            const __m256i lo = _mm256_unpacklo_epi32(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi32(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x31);
+        }
+
+        inline int32x8 round_to_int32_s(const float32x8& s) noexcept
+        {
+            return _mm256_cvtps_epi32(s);
+        }
+
+        inline int32x8 trunc_to_int32_s(const float32x8& s) noexcept
+        {
+            return _mm256_cvttps_epi32(s);
+        }
+
+        inline int16x16 packs_ss(
+            const int32x8& lo, const int32x8& hi) noexcept
+        {
+            return _mm256_permute4x64_epi64(
+                _mm256_packs_epi32(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+        }
+
+        inline uint16x16 packus_ss(
+            const int32x8& lo, const int32x8& hi) noexcept
+        {
+            return _mm256_permute4x64_epi64(
+                _mm256_packus_epi32(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+        }
+
+        inline int32x8 widen_lo_s(const int16x16& s) noexcept
+        {
+            return _mm256_cvtepi16_epi32(_mm256_castsi256_si128(s));
+        }
+
+        inline int32x8 widen_hi_s(const int16x16& s) noexcept
+        {
+            return _mm256_cvtepi16_epi32(_mm256_extracti128_si256(s, 1));
+        }
+
+        inline uint32x8 widen_lo_s(const uint16x16& s) noexcept
+        {
+            return _mm256_cvtepu16_epi32(_mm256_castsi256_si128(s));
+        }
+
+        inline uint32x8 widen_hi_s(const uint16x16& s) noexcept
+        {
+            return _mm256_cvtepu16_epi32(_mm256_extracti128_si256(s, 1));
+        }
+    }
+}
@@ -0,0 +1,656 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<std::int64_t, 4>())
+    simd<std::int64_t, 4>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static int64x4 explicit_cast(const simd<U, 4>& s) noexcept
+        {
+            return {
+                std::int64_t(s.data()[0]),
+                std::int64_t(s.data()[1]),
+                std::int64_t(s.data()[2]),
+                std::int64_t(s.data()[3]),
+            };
+        }
+
+        inline static int64x4 explicit_cast(const bool64x4& s) noexcept;
+
+        inline static int64x4 explicit_cast(const uint64x4& s) noexcept;
+
+    public:
+        using component_type = std::int64_t;
+
+        static constexpr int component_count = 4;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(std::int64_t x) noexcept
+        :
+            underlying_(_mm256_set1_epi64x(x))
+        {
+        }
+
+        template<int M = 4, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            std::int64_t x, std::int64_t y) noexcept;
+
+        template<int M = 4, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            std::int64_t x, std::int64_t y,
+            std::int64_t z, std::int64_t w) noexcept
+        :
+            underlying_(_mm256_setr_epi64x(x, y, z, w))
+        {
+        }
+
+        template<int M = 4, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            std::int64_t s0, std::int64_t s1,
+            std::int64_t s2, std::int64_t s3,
+            std::int64_t s4, std::int64_t s5,
+            std::int64_t s6, std::int64_t s7) noexcept;
+
+        template<int M = 4, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            std::int64_t  s0, std::int64_t  s1,
+            std::int64_t  s2, std::int64_t  s3,
+            std::int64_t  s4, std::int64_t  s5,
+            std::int64_t  s6, std::int64_t  s7,
+            std::int64_t  s8, std::int64_t  s9,
+            std::int64_t s10, std::int64_t s11,
+            std::int64_t s12, std::int64_t s13,
+            std::int64_t s14, std::int64_t s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 4>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static int64x4 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static int64x4 load(const std::int64_t* data) noexcept
+        {
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        static int64x4 loadu(const std::int64_t* data) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int64x4 gather(
+            const std::int64_t* base, const simd<I, 4>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int64x4 gather(
+            const std::int64_t* base,
+            const simd<I, 4>& indices,
+            const bool64x4& conditions) noexcept;
+
+        inline static int64x4 load_partial(
+            const std::int64_t* data, int count) noexcept;
+
+        inline static int64x4 maskload(
+            const std::int64_t* data, const bool64x4& conditions) noexcept;
+
+        void store(std::int64_t* data) const noexcept
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(std::int64_t* data) const noexcept
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void stream(std::int64_t* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int64_t* base, const simd<I, 4>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int64_t* base,
+            const simd<I, 4>& indices,
+            const bool64x4& conditions) const noexcept;
+
+        inline void store_partial(
+            std::int64_t* data, int count) const noexcept;
+
+        inline void maskstore(
+            std::int64_t* data, const bool64x4& conditions) const noexcept;
+
+        const std::int64_t* data() const noexcept
+        {
+            return reinterpret_cast<const std::int64_t*>(&underlying_);
+        }
+
+        std::int64_t* data() noexcept
+        {
+            return reinterpret_cast<std::int64_t*>(&underlying_);
+        }
+    };
+}
+
+#include "../avx/bool64x4.avx.hpp"
+#include "uint64x4.avx2.hpp"
+#include "../sse2/int64x2.sse2.hpp"
+#include "int32x8.avx2.hpp"
+#include "uint32x8.avx2.hpp"
+
+namespace tue
+{
+    inline int64x4 int64x4::explicit_cast(const bool64x4& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline int64x4 int64x4::explicit_cast(const uint64x4& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    template<typename I, typename>
+    inline int64x4 int64x4::gather(
+        const std::int64_t* base, const simd<I, 4>& indices) noexcept
+    {
+        return _mm256_i32gather_epi64(
+            reinterpret_cast<const long long*>(base), indices, 8);
+    }
+
+    template<typename I, typename>
+    inline int64x4 int64x4::gather(
+        const std::int64_t* base,
+        const simd<I, 4>& indices,
+        const bool64x4& conditions) noexcept
+    {
+        return _mm256_mask_i32gather_epi64(
+            _mm256_setzero_si256(),
+            reinterpret_cast<const long long*>(base),
+            indices,
+            _mm256_castpd_si256(conditions),
+            8);
+    }
+
+    template<typename I, typename>
+    inline void int64x4::scatter(
+        std::int64_t* base, const simd<I, 4>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void int64x4::scatter(
+        std::int64_t* base,
+        const simd<I, 4>& indices,
+        const bool64x4& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline int64x4 int64x4::load_partial(
+        const std::int64_t* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm256_cmp_pd(
+                _mm256_setr_pd(0.0, 1.0, 2.0, 3.0),
+                _mm256_set1_pd(count),
+                _CMP_LT_OQ));
+    }
+
+    inline int64x4 int64x4::maskload(
+        const std::int64_t* data, const bool64x4& conditions) noexcept
+    {
+        return _mm256_maskload_epi64(
+            reinterpret_cast<const long long*>(data),
+            _mm256_castpd_si256(conditions));
+    }
+
+    inline void int64x4::store_partial(
+        std::int64_t* data, int count) const noexcept
+    {
+        maskstore(
+            data,
+            _mm256_cmp_pd(
+                _mm256_setr_pd(0.0, 1.0, 2.0, 3.0),
+                _mm256_set1_pd(count),
+                _CMP_LT_OQ));
+    }
+
+    inline void int64x4::maskstore(
+        std::int64_t* data, const bool64x4& conditions) const noexcept
+    {
+        _mm256_maskstore_epi64(
+            reinterpret_cast<long long*>(data),
+            _mm256_castpd_si256(conditions), underlying_);
+    }
+
+    namespace detail_
+    {
+        inline int64x4 unary_plus_operator_s(const int64x4& s) noexcept
+        {
+            return s;
+        }
+
+        inline int64x4& pre_increment_operator_s(int64x4& s) noexcept
+        {
+            return s = _mm256_add_epi64(s, int64x4(1));
+        }
+
+        inline int64x4 post_increment_operator_s(int64x4& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_epi64(s, int64x4(1));
+            return result;
+        }
+
+        inline int64x4 unary_minus_operator_s(const int64x4& s) noexcept
+        {
+            return _mm256_sub_epi64(_mm256_setzero_si256(), s);
+        }
+
+        inline int64x4& pre_decrement_operator_s(int64x4& s) noexcept
+        {
+            return s = _mm256_sub_epi64(s, int64x4(1));
+        }
+
+        inline int64x4 post_decrement_operator_s(int64x4& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_epi64(s, int64x4(1));
+            return result;
+        }
+
+        inline int64x4 bitwise_not_operator_s(const int64x4& s) noexcept
+        {
+            return _mm256_xor_si256(s, int64x4(~0ull));
+        }
+
+        inline int64x4 addition_operator_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_add_epi64(lhs, rhs);
+        }
+
+        inline int64x4 subtraction_operator_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_sub_epi64(lhs, rhs);
+        }
+
+        inline int64x4 multiplication_operator_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            // There's no 64-bit multiply, so assemble the low 64 bits of
+            // each product from 32x32-bit partial products.
+            const auto lo = _mm256_mul_epu32(lhs, rhs);
+            const auto cross = _mm256_add_epi64(
+                _mm256_mul_epu32(_mm256_srli_epi64(lhs, 32), rhs),
+                _mm256_mul_epu32(lhs, _mm256_srli_epi64(rhs, 32)));
+            return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+        }
+
+        inline int64x4 bitwise_and_operator_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline int64x4 bitwise_or_operator_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline int64x4 bitwise_xor_operator_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline int64x4 bitwise_shift_left_operator_si(
+            const int64x4& lhs, int rhs) noexcept
+        {
+            return _mm256_slli_epi64(lhs, rhs);
+        }
+
+        inline int64x4 bitwise_shift_right_operator_si(
+            const int64x4& lhs, int rhs) noexcept
+        {
+            // There's no 64-bit arithmetic shift, so shift in the sign
+            // bits by hand.
+            const auto sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), lhs);
+            return _mm256_or_si256(
+                _mm256_srli_epi64(lhs, rhs),
+                _mm256_slli_epi64(sign, 64 - rhs));
+        }
+
+        inline int64x4 bitwise_shift_left_operator_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_sllv_epi64(lhs, rhs);
+        }
+
+        inline int64x4 bitwise_shift_right_operator_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            const auto sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), lhs);
+            return _mm256_or_si256(
+                _mm256_srlv_epi64(lhs, rhs),
+                _mm256_sllv_epi64(sign, _mm256_sub_epi64(int64x4(64), rhs)));
+        }
+
+        inline int64x4& addition_assignment_operator_ss(
+            int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return lhs = _mm256_add_epi64(lhs, rhs);
+        }
+
+        inline int64x4& subtraction_assignment_operator_ss(
+            int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return lhs = _mm256_sub_epi64(lhs, rhs);
+        }
+
+        inline int64x4& multiplication_assignment_operator_ss(
+            int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return lhs = multiplication_operator_ss(lhs, rhs);
+        }
+
+        inline int64x4& bitwise_and_assignment_operator_ss(
+            int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline int64x4& bitwise_or_assignment_operator_ss(
+            int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline int64x4& bitwise_xor_assignment_operator_ss(
+            int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline int64x4& bitwise_shift_left_assignment_operator_si(
+            int64x4& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_si(lhs, rhs);
+        }
+
+        inline int64x4& bitwise_shift_right_assignment_operator_si(
+            int64x4& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
+        }
+
+        inline int64x4& bitwise_shift_left_assignment_operator_ss(
+            int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_ss(lhs, rhs);
+        }
+
+        inline int64x4& bitwise_shift_right_assignment_operator_ss(
+            int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_ss(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline int64x4 abs_s(const int64x4& s) noexcept
+        {
+            const auto nmask = _mm256_cmpgt_epi64(_mm256_setzero_si256(), s);
+            return _mm256_blendv_epi8(s, unary_minus_operator_s(s), nmask);
+        }
+
+        inline int64x4 min_ss(
+            const int64x4& s1, const int64x4& s2) noexcept
+        {
+            const auto gt = _mm256_cmpgt_epi64(s1, s2);
+            return _mm256_blendv_epi8(s1, s2, gt);
+        }
+
+        inline int64x4 max_ss(
+            const int64x4& s1, const int64x4& s2) noexcept
+        {
+            const auto gt = _mm256_cmpgt_epi64(s1, s2);
+            return _mm256_blendv_epi8(s2, s1, gt);
+        }
+
+        inline std::int64_t reduce_add_s(const int64x4& s) noexcept
+        {
+            // Fold the upper 128 bits onto the lower ones first.
+            const __m256i x = s;
+            return reduce_add_s(addition_operator_ss(
+                int64x2(_mm256_castsi256_si128(x)),
+                int64x2(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline std::int64_t reduce_min_s(const int64x4& s) noexcept
+        {
+            const __m256i x = s;
+            return reduce_min_s(min_ss(
+                int64x2(_mm256_castsi256_si128(x)),
+                int64x2(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline std::int64_t reduce_max_s(const int64x4& s) noexcept
+        {
+            const __m256i x = s;
+            return reduce_max_s(max_ss(
+                int64x2(_mm256_castsi256_si128(x)),
+                int64x2(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline int64x4 mask_ss(
+            const bool64x4& conditions,
+            const int64x4& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline int64x4 select_sss(
+            const bool64x4& conditions,
+            const int64x4& values,
+            const int64x4& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool64x4 less_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_cmpgt_epi64(rhs, lhs);
+        }
+
+        inline bool64x4 less_equal_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi64(lhs, rhs), int64x4(~0ull));
+        }
+
+        inline bool64x4 greater_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_cmpgt_epi64(lhs, rhs);
+        }
+
+        inline bool64x4 greater_equal_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi64(rhs, lhs), int64x4(~0ull));
+        }
+
+        inline bool64x4 equal_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi64(lhs, rhs);
+        }
+
+        inline bool64x4 not_equal_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi64(lhs, rhs), int64x4(~0ull));
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline int64x4 shuffle_s(
+            const int64x4& s,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+            return _mm256_permute4x64_epi64(s, _MM_SHUFFLE(I3, I2, I1, I0));
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline int64x4 shuffle_ss(
+            const int64x4& lhs,
+            const int64x4& rhs,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+            constexpr int from_rhs =
+                tue::detail_::second_source_lanes<4, I0, I1, I2, I3>();
+            const __m256i x = tue::detail_::shuffle_s(lhs,
+                std::integer_sequence<int, I0 % 4, I1 % 4, I2 % 4, I3 % 4>());
+            const __m256i y = tue::detail_::shuffle_s(rhs,
+                std::integer_sequence<int, I0 % 4, I1 % 4, I2 % 4, I3 % 4>());
+            return _mm256_castpd_si256(_mm256_blend_pd(
+                _mm256_castsi256_pd(x), _mm256_castsi256_pd(y), from_rhs));
+        }
+
+        template<int I>
+        inline std::int64_t extract_s(
+            const int64x4& s, std::integral_constant<int, I>) noexcept
+        {
+            const __m128i half = _mm256_extracti128_si256(s, I / 2);
+            std::int64_t result;
+            _mm_storel_epi64(
+                reinterpret_cast<__m128i*>(&result),
+                _mm_srli_si128(half, I % 2 * 8));
+            return result;
+        }
+
+        template<int I>
+        inline int64x4 insert_s(
+            const int64x4& s,
+            std::int64_t x,
+            std::integral_constant<int, I>) noexcept
+        {
+            return _mm256_castpd_si256(_mm256_blend_pd(
+                _mm256_castsi256_pd(s),
+                _mm256_castsi256_pd(int64x4(x)),
+                1 << I));
+        }
+
+        inline int64x4 interleave_lo_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            // The unpack instructions interleave within each 128-bit half,
+            // so put the halves back in order afterwards.
+            const __m256i lo = _mm256_unpacklo_epi64(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi64(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x20);
+        }
+
+        inline int64x4 interleave_hi_ss(
+            const int64x4& lhs, const int64x4& rhs) noexcept
+        {
+            const __m256i lo = _mm256_unpacklo_epi64(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi64(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x31);
+        }
+
+        inline int64x4 widen_lo_s(const int32x8& s) noexcept
+        {
+            return _mm256_cvtepi32_epi64(_mm256_castsi256_si128(s));
+        }
+
+        inline int64x4 widen_hi_s(const int32x8& s) noexcept
+        {
+            return _mm256_cvtepi32_epi64(_mm256_extracti128_si256(s, 1));
+        }
+
+        inline uint64x4 widen_lo_s(const uint32x8& s) noexcept
+        {
+            return _mm256_cvtepu32_epi64(_mm256_castsi256_si128(s));
+        }
+
+        inline uint64x4 widen_hi_s(const uint32x8& s) noexcept
+        {
+            return _mm256_cvtepu32_epi64(_mm256_extracti128_si256(s, 1));
+        }
+    }
+}
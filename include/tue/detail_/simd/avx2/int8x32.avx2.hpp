@@ -0,0 +1,641 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<std::int8_t, 32>())
+    simd<std::int8_t, 32>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static int8x32 explicit_cast(const simd<U, 32>& s) noexcept
+        {
+            int8x32 result;
+            for (int i = 0; i < 32; ++i)
+            {
+                result.data()[i] = std::int8_t(s.data()[i]);
+            }
+            return result;
+        }
+
+        inline static int8x32 explicit_cast(const bool8x32& s) noexcept;
+
+        inline static int8x32 explicit_cast(const uint8x32& s) noexcept;
+
+    public:
+        using component_type = std::int8_t;
+
+        static constexpr int component_count = 32;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(std::int8_t x) noexcept
+        :
+            underlying_(_mm256_set1_epi8(x))
+        {
+        }
+
+        template<int M = 32, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            std::int8_t x, std::int8_t y) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            std::int8_t x, std::int8_t y,
+            std::int8_t z, std::int8_t w) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            std::int8_t s0, std::int8_t s1,
+            std::int8_t s2, std::int8_t s3,
+            std::int8_t s4, std::int8_t s5,
+            std::int8_t s6, std::int8_t s7) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            std::int8_t  s0, std::int8_t  s1,
+            std::int8_t  s2, std::int8_t  s3,
+            std::int8_t  s4, std::int8_t  s5,
+            std::int8_t  s6, std::int8_t  s7,
+            std::int8_t  s8, std::int8_t  s9,
+            std::int8_t s10, std::int8_t s11,
+            std::int8_t s12, std::int8_t s13,
+            std::int8_t s14, std::int8_t s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 32>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static int8x32 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static int8x32 load(const std::int8_t* data) noexcept
+        {
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        static int8x32 loadu(const std::int8_t* data) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int8x32 gather(
+            const std::int8_t* base, const simd<I, 32>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int8x32 gather(
+            const std::int8_t* base,
+            const simd<I, 32>& indices,
+            const bool8x32& conditions) noexcept;
+
+        inline static int8x32 load_partial(
+            const std::int8_t* data, int count) noexcept;
+
+        inline static int8x32 maskload(
+            const std::int8_t* data, const bool8x32& conditions) noexcept;
+
+        void store(std::int8_t* data) const noexcept
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(std::int8_t* data) const noexcept
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void stream(std::int8_t* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int8_t* base, const simd<I, 32>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int8_t* base,
+            const simd<I, 32>& indices,
+            const bool8x32& conditions) const noexcept;
+
+        inline void store_partial(std::int8_t* data, int count) const noexcept;
+
+        inline void maskstore(
+            std::int8_t* data, const bool8x32& conditions) const noexcept;
+
+        const std::int8_t* data() const noexcept
+        {
+            return reinterpret_cast<const std::int8_t*>(&underlying_);
+        }
+
+        std::int8_t* data() noexcept
+        {
+            return reinterpret_cast<std::int8_t*>(&underlying_);
+        }
+    };
+}
+
+#include "bool8x32.avx2.hpp"
+#include "uint8x32.avx2.hpp"
+#include "../sse2/int8x16.sse2.hpp"
+
+namespace tue
+{
+    inline int8x32 int8x32::explicit_cast(const bool8x32& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline int8x32 int8x32::explicit_cast(const uint8x32& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    template<typename I, typename>
+    inline int8x32 int8x32::gather(
+        const std::int8_t* base, const simd<I, 32>& indices) noexcept
+    {
+        return tue::detail_::gather_components<int8x32>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline int8x32 int8x32::gather(
+        const std::int8_t* base,
+        const simd<I, 32>& indices,
+        const bool8x32& conditions) noexcept
+    {
+        return tue::detail_::gather_components<int8x32>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void int8x32::scatter(
+        std::int8_t* base, const simd<I, 32>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void int8x32::scatter(
+        std::int8_t* base,
+        const simd<I, 32>& indices,
+        const bool8x32& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline int8x32 int8x32::load_partial(
+        const std::int8_t* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm256_cmpgt_epi8(
+                _mm256_set1_epi8(static_cast<char>(count)),
+                _mm256_setr_epi8(
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+                    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+                    31)));
+    }
+
+    inline int8x32 int8x32::maskload(
+        const std::int8_t* data, const bool8x32& conditions) noexcept
+    {
+        if (_mm256_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(int8x32)))
+        {
+            return _mm256_and_si256(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<int8x32>(data, conditions);
+    }
+
+    inline void int8x32::store_partial(
+        std::int8_t* data, int count) const noexcept
+    {
+        const int size = count * 1;
+        tue::detail_::storeu_partial_si128(
+            data, _mm256_castsi256_si128(underlying_), size);
+        if (size > 16)
+        {
+            tue::detail_::storeu_partial_si128(
+                reinterpret_cast<char*>(data) + 16,
+                _mm256_extracti128_si256(underlying_, 1),
+                size - 16);
+        }
+    }
+
+    inline void int8x32::maskstore(
+        std::int8_t* data, const bool8x32& conditions) const noexcept
+    {
+        const auto c = reinterpret_cast<char*>(data);
+        _mm_maskmoveu_si128(
+            _mm256_castsi256_si128(underlying_),
+            _mm256_castsi256_si128(conditions),
+            c);
+        _mm_maskmoveu_si128(
+            _mm256_extracti128_si256(underlying_, 1),
+            _mm256_extracti128_si256(conditions, 1),
+            c + 16);
+    }
+
+    namespace detail_
+    {
+        inline int8x32 unary_plus_operator_s(const int8x32& s) noexcept
+        {
+            return s;
+        }
+
+        inline int8x32& pre_increment_operator_s(int8x32& s) noexcept
+        {
+            return s = _mm256_add_epi8(s, int8x32(1));
+        }
+
+        inline int8x32 post_increment_operator_s(int8x32& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_epi8(s, int8x32(1));
+            return result;
+        }
+
+        inline int8x32 unary_minus_operator_s(const int8x32& s) noexcept
+        {
+            return _mm256_sub_epi8(_mm256_setzero_si256(), s);
+        }
+
+        inline int8x32& pre_decrement_operator_s(int8x32& s) noexcept
+        {
+            return s = _mm256_sub_epi8(s, int8x32(1));
+        }
+
+        inline int8x32 post_decrement_operator_s(int8x32& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_epi8(s, int8x32(1));
+            return result;
+        }
+
+        inline int8x32 bitwise_not_operator_s(const int8x32& s) noexcept
+        {
+            return _mm256_xor_si256(s, int8x32(0xFF));
+        }
+
+        inline int8x32 addition_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_add_epi8(lhs, rhs);
+        }
+
+        inline int8x32 subtraction_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_sub_epi8(lhs, rhs);
+        }
+
+        inline int8x32 multiplication_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            // There's no 8-bit multiply, so multiply the even and odd
+            // bytes as 16-bit lanes and merge the low bytes of each product.
+            const auto even = _mm256_mullo_epi16(lhs, rhs);
+            const auto odd = _mm256_mullo_epi16(
+                _mm256_srli_epi16(lhs, 8), _mm256_srli_epi16(rhs, 8));
+            return _mm256_or_si256(
+                _mm256_slli_epi16(odd, 8),
+                _mm256_and_si256(even, _mm256_set1_epi16(0x00FF)));
+        }
+
+        inline int8x32 bitwise_and_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline int8x32 bitwise_or_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline int8x32 bitwise_xor_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline int8x32 bitwise_shift_left_operator_si(
+            const int8x32& lhs, int rhs) noexcept
+        {
+            return _mm256_and_si256(
+                _mm256_slli_epi16(lhs, rhs),
+                _mm256_set1_epi8(static_cast<char>(0xFF << rhs)));
+        }
+
+        inline int8x32 bitwise_shift_right_operator_si(
+            const int8x32& lhs, int rhs) noexcept
+        {
+            // There's no 8-bit shift, so shift the odd bytes in place and
+            // the even bytes from the top of each 16-bit lane.
+            const auto odd = _mm256_and_si256(
+                _mm256_srai_epi16(lhs, rhs), _mm256_set1_epi16(
+                    static_cast<short>(0xFF00)));
+            const auto even = _mm256_srli_epi16(
+                _mm256_srai_epi16(_mm256_slli_epi16(lhs, 8), rhs), 8);
+            return _mm256_or_si256(odd, even);
+        }
+
+        inline int8x32& addition_assignment_operator_ss(
+            int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return lhs = _mm256_add_epi8(lhs, rhs);
+        }
+
+        inline int8x32& subtraction_assignment_operator_ss(
+            int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return lhs = _mm256_sub_epi8(lhs, rhs);
+        }
+
+        inline int8x32& multiplication_assignment_operator_ss(
+            int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return lhs = multiplication_operator_ss(lhs, rhs);
+        }
+
+        inline int8x32& bitwise_and_assignment_operator_ss(
+            int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline int8x32& bitwise_or_assignment_operator_ss(
+            int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline int8x32& bitwise_xor_assignment_operator_ss(
+            int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline int8x32& bitwise_shift_left_assignment_operator_si(
+            int8x32& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_si(lhs, rhs);
+        }
+
+        inline int8x32& bitwise_shift_right_assignment_operator_si(
+            int8x32& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline int8x32 abs_s(const int8x32& s) noexcept
+        {
+            return _mm256_abs_epi8(s);
+        }
+
+        inline int8x32 min_ss(
+            const int8x32& s1, const int8x32& s2) noexcept
+        {
+            return _mm256_min_epi8(s1, s2);
+        }
+
+        inline int8x32 max_ss(
+            const int8x32& s1, const int8x32& s2) noexcept
+        {
+            return _mm256_max_epi8(s1, s2);
+        }
+
+        inline std::int8_t reduce_add_s(const int8x32& s) noexcept
+        {
+            // Fold the upper 128 bits onto the lower ones first.
+            const __m256i x = s;
+            return reduce_add_s(addition_operator_ss(
+                int8x16(_mm256_castsi256_si128(x)),
+                int8x16(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline std::int8_t reduce_min_s(const int8x32& s) noexcept
+        {
+            const __m256i x = s;
+            return reduce_min_s(min_ss(
+                int8x16(_mm256_castsi256_si128(x)),
+                int8x16(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline std::int8_t reduce_max_s(const int8x32& s) noexcept
+        {
+            const __m256i x = s;
+            return reduce_max_s(max_ss(
+                int8x16(_mm256_castsi256_si128(x)),
+                int8x16(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline int8x32 adds_ss(
+            const int8x32& s1, const int8x32& s2) noexcept
+        {
+            return _mm256_adds_epi8(s1, s2);
+        }
+
+        inline int8x32 subs_ss(
+            const int8x32& s1, const int8x32& s2) noexcept
+        {
+            return _mm256_subs_epi8(s1, s2);
+        }
+
+        inline int8x32 avg_ss(
+            const int8x32& s1, const int8x32& s2) noexcept
+        {
+            const auto bias = _mm256_set1_epi8(-0x80);
+            return _mm256_xor_si256(
+                _mm256_avg_epu8(
+                    _mm256_xor_si256(s1, bias), _mm256_xor_si256(s2, bias)),
+                bias);
+        }
+
+        inline int8x32 mask_ss(
+            const bool8x32& conditions,
+            const int8x32& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline int8x32 select_sss(
+            const bool8x32& conditions,
+            const int8x32& values,
+            const int8x32& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool8x32 less_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_cmpgt_epi8(rhs, lhs);
+        }
+
+        inline bool8x32 less_equal_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi8(lhs, rhs), int8x32(0xFF));
+        }
+
+        inline bool8x32 greater_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_cmpgt_epi8(lhs, rhs);
+        }
+
+        inline bool8x32 greater_equal_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi8(rhs, lhs), int8x32(0xFF));
+        }
+
+        inline bool8x32 equal_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi8(lhs, rhs);
+        }
+
+        inline bool8x32 not_equal_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi8(lhs, rhs), int8x32(0xFF));
+        }
+
+        template<int... I>
+        inline int8x32 shuffle_s(
+            const int8x32& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            // vpshufb only shuffles within each 128-bit half, so shuffle
+            // both s and s with its halves swapped, then blend in the
+            // components that cross over. Bit 4 of each
+            // control byte picks the half, so comparing it against the half
+            // each byte lands in and moving it up to bit 7 gives the blend
+            // mask.
+            const __m256i indices = _mm256_setr_epi8(static_cast<char>(I)...);
+            const __m256i halves = _mm256_setr_epi64x(
+                0, 0, 0x1010101010101010, 0x1010101010101010);
+            const __m256i swapped = _mm256_permute2x128_si256(s, s, 0x01);
+            const __m256i crossing =
+                _mm256_slli_epi16(_mm256_xor_si256(indices, halves), 3);
+            return _mm256_blendv_epi8(
+                _mm256_shuffle_epi8(s, indices),
+                _mm256_shuffle_epi8(swapped, indices),
+                crossing);
+        }
+
+        template<int... I>
+        inline int8x32 shuffle_ss(
+            const int8x32& lhs,
+            const int8x32& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return _mm256_blendv_epi8(
+                tue::detail_::shuffle_s(
+                    lhs, std::integer_sequence<int, (I % 32)...>()),
+                tue::detail_::shuffle_s(
+                    rhs, std::integer_sequence<int, (I % 32)...>()),
+                _mm256_setr_epi8(static_cast<char>(I < 32 ? 0 : -1)...));
+        }
+
+        template<int I>
+        inline std::int8_t extract_s(
+            const int8x32& s, std::integral_constant<int, I>) noexcept
+        {
+            return static_cast<std::int8_t>(_mm256_extract_epi8(s, I));
+        }
+
+        template<int I>
+        inline int8x32 insert_s(
+            const int8x32& s,
+            std::int8_t x,
+            std::integral_constant<int, I>) noexcept
+        {
+            return _mm256_insert_epi8(s, static_cast<char>(x), I);
+        }
+
+        inline int8x32 interleave_lo_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            // The unpack instructions interleave within each 128-bit half,
+            // so put the halves back in order afterwards.
+            const __m256i lo = _mm256_unpacklo_epi8(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi8(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x20);
+        }
+
+        inline int8x32 interleave_hi_ss(
+            const int8x32& lhs, const int8x32& rhs) noexcept
+        {
+            const __m256i lo = _mm256_unpacklo_epi8(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi8(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x31);
+        }
+    }
+}
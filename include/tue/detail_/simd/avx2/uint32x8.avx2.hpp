@@ -0,0 +1,672 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<std::uint32_t, 8>())
+    simd<std::uint32_t, 8>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static uint32x8 explicit_cast(const simd<U, 8>& s) noexcept
+        {
+            return {
+                std::uint32_t(s.data()[0]),
+                std::uint32_t(s.data()[1]),
+                std::uint32_t(s.data()[2]),
+                std::uint32_t(s.data()[3]),
+                std::uint32_t(s.data()[4]),
+                std::uint32_t(s.data()[5]),
+                std::uint32_t(s.data()[6]),
+                std::uint32_t(s.data()[7]),
+            };
+        }
+
+        inline static uint32x8 explicit_cast(const bool32x8& s) noexcept;
+
+        inline static uint32x8 explicit_cast(const float32x8& s) noexcept;
+
+        inline static uint32x8 explicit_cast(const int32x8& s) noexcept;
+
+    public:
+        using component_type = std::uint32_t;
+
+        static constexpr int component_count = 8;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(std::uint32_t x) noexcept
+        :
+            underlying_(_mm256_set1_epi32(x))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            std::uint32_t x, std::uint32_t y) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            std::uint32_t x, std::uint32_t y,
+            std::uint32_t z, std::uint32_t w) noexcept;
+
+        template<int M = 8, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            std::uint32_t s0, std::uint32_t s1,
+            std::uint32_t s2, std::uint32_t s3,
+            std::uint32_t s4, std::uint32_t s5,
+            std::uint32_t s6, std::uint32_t s7) noexcept
+        :
+            underlying_(_mm256_setr_epi32(
+                s0, s1, s2, s3, s4, s5, s6, s7))
+        {
+        }
+
+        template<int M = 8, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            std::uint32_t  s0, std::uint32_t  s1,
+            std::uint32_t  s2, std::uint32_t  s3,
+            std::uint32_t  s4, std::uint32_t  s5,
+            std::uint32_t  s6, std::uint32_t  s7,
+            std::uint32_t  s8, std::uint32_t  s9,
+            std::uint32_t s10, std::uint32_t s11,
+            std::uint32_t s12, std::uint32_t s13,
+            std::uint32_t s14, std::uint32_t s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 8>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static uint32x8 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static uint32x8 load(const std::uint32_t* data) noexcept
+        {
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        static uint32x8 loadu(const std::uint32_t* data) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static uint32x8 gather(
+            const std::uint32_t* base, const simd<I, 8>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static uint32x8 gather(
+            const std::uint32_t* base,
+            const simd<I, 8>& indices,
+            const bool32x8& conditions) noexcept;
+
+        inline static uint32x8 load_partial(
+            const std::uint32_t* data, int count) noexcept;
+
+        inline static uint32x8 maskload(
+            const std::uint32_t* data, const bool32x8& conditions) noexcept;
+
+        void store(std::uint32_t* data) const noexcept
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(std::uint32_t* data) const noexcept
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void stream(std::uint32_t* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::uint32_t* base, const simd<I, 8>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::uint32_t* base,
+            const simd<I, 8>& indices,
+            const bool32x8& conditions) const noexcept;
+
+        inline void store_partial(
+            std::uint32_t* data, int count) const noexcept;
+
+        inline void maskstore(
+            std::uint32_t* data, const bool32x8& conditions) const noexcept;
+
+        const std::uint32_t* data() const noexcept
+        {
+            return reinterpret_cast<const std::uint32_t*>(&underlying_);
+        }
+
+        std::uint32_t* data() noexcept
+        {
+            return reinterpret_cast<std::uint32_t*>(&underlying_);
+        }
+    };
+}
+
+#include "../avx/bool32x8.avx.hpp"
+#include "../avx/float32x8.avx.hpp"
+#include "int32x8.avx2.hpp"
+#include "../sse2/uint32x4.sse2.hpp"
+
+namespace tue
+{
+    inline uint32x8 uint32x8::explicit_cast(const bool32x8& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline uint32x8 uint32x8::explicit_cast(const float32x8& s) noexcept
+    {
+        return _mm256_cvttps_epi32(s);
+    }
+
+    inline uint32x8 uint32x8::explicit_cast(const int32x8& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    template<typename I, typename>
+    inline uint32x8 uint32x8::gather(
+        const std::uint32_t* base, const simd<I, 8>& indices) noexcept
+    {
+        return _mm256_i32gather_epi32(
+            reinterpret_cast<const int*>(base), indices, 4);
+    }
+
+    template<typename I, typename>
+    inline uint32x8 uint32x8::gather(
+        const std::uint32_t* base,
+        const simd<I, 8>& indices,
+        const bool32x8& conditions) noexcept
+    {
+        return _mm256_mask_i32gather_epi32(
+            _mm256_setzero_si256(),
+            reinterpret_cast<const int*>(base),
+            indices,
+            _mm256_castps_si256(conditions),
+            4);
+    }
+
+    template<typename I, typename>
+    inline void uint32x8::scatter(
+        std::uint32_t* base, const simd<I, 8>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void uint32x8::scatter(
+        std::uint32_t* base,
+        const simd<I, 8>& indices,
+        const bool32x8& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline uint32x8 uint32x8::load_partial(
+        const std::uint32_t* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm256_cmp_ps(
+                _mm256_setr_ps(
+                    0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f),
+                _mm256_set1_ps(static_cast<float>(count)),
+                _CMP_LT_OQ));
+    }
+
+    inline uint32x8 uint32x8::maskload(
+        const std::uint32_t* data, const bool32x8& conditions) noexcept
+    {
+        return _mm256_maskload_epi32(
+            reinterpret_cast<const int*>(data),
+            _mm256_castps_si256(conditions));
+    }
+
+    inline void uint32x8::store_partial(
+        std::uint32_t* data, int count) const noexcept
+    {
+        maskstore(
+            data,
+            _mm256_cmp_ps(
+                _mm256_setr_ps(
+                    0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f),
+                _mm256_set1_ps(static_cast<float>(count)),
+                _CMP_LT_OQ));
+    }
+
+    inline void uint32x8::maskstore(
+        std::uint32_t* data, const bool32x8& conditions) const noexcept
+    {
+        _mm256_maskstore_epi32(
+            reinterpret_cast<int*>(data), _mm256_castps_si256(conditions),
+            underlying_);
+    }
+
+    namespace detail_
+    {
+        inline uint32x8& pre_increment_operator_s(uint32x8& s) noexcept
+        {
+            return s = _mm256_add_epi32(s, uint32x8(1));
+        }
+
+        inline uint32x8 post_increment_operator_s(uint32x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_epi32(s, uint32x8(1));
+            return result;
+        }
+
+        inline uint32x8& pre_decrement_operator_s(uint32x8& s) noexcept
+        {
+            return s = _mm256_sub_epi32(s, uint32x8(1));
+        }
+
+        inline uint32x8 post_decrement_operator_s(uint32x8& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_epi32(s, uint32x8(1));
+            return result;
+        }
+
+        inline uint32x8 bitwise_not_operator_s(const uint32x8& s) noexcept
+        {
+            return _mm256_xor_si256(s, uint32x8(0xFFFFFFFF));
+        }
+
+        inline uint32x8 addition_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_add_epi32(lhs, rhs);
+        }
+
+        inline uint32x8 subtraction_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_sub_epi32(lhs, rhs);
+        }
+
+        inline uint32x8 multiplication_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_mullo_epi32(lhs, rhs);
+        }
+
+        inline uint32x8 division_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            // As with int32x8, but the conversions are signed, so the
+            // operands are biased by -2^31 on the way in and the quotient on
+            // the way out. The quotient is floored first since truncating
+            // its biased value would round fractions the wrong way.
+            const auto bias = uint32x8(0x80000000);
+            const auto bias_pd = _mm256_set1_pd(2147483648.0);
+            const auto l = _mm256_xor_si256(lhs, bias);
+            const auto r = _mm256_xor_si256(rhs, bias);
+            const auto q_lo = _mm256_floor_pd(_mm256_div_pd(
+                _mm256_add_pd(_mm256_cvtepi32_pd(
+                    _mm256_castsi256_si128(l)), bias_pd),
+                _mm256_add_pd(_mm256_cvtepi32_pd(
+                    _mm256_castsi256_si128(r)), bias_pd)));
+            const auto q_hi = _mm256_floor_pd(_mm256_div_pd(
+                _mm256_add_pd(_mm256_cvtepi32_pd(
+                    _mm256_extracti128_si256(l, 1)), bias_pd),
+                _mm256_add_pd(_mm256_cvtepi32_pd(
+                    _mm256_extracti128_si256(r, 1)), bias_pd)));
+            const auto lo = _mm256_cvttpd_epi32(_mm256_sub_pd(q_lo, bias_pd));
+            const auto hi = _mm256_cvttpd_epi32(_mm256_sub_pd(q_hi, bias_pd));
+            return _mm256_xor_si256(bias, _mm256_inserti128_si256(
+                _mm256_castsi128_si256(lo), hi, 1));
+        }
+
+        inline uint32x8 modulo_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_sub_epi32(lhs, _mm256_mullo_epi32(
+                division_operator_ss(lhs, rhs), rhs));
+        }
+
+        inline uint32x8 bitwise_and_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline uint32x8 bitwise_or_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline uint32x8 bitwise_xor_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline uint32x8 bitwise_shift_left_operator_si(
+            const uint32x8& lhs, int rhs) noexcept
+        {
+            return _mm256_slli_epi32(lhs, rhs);
+        }
+
+        inline uint32x8 bitwise_shift_right_operator_si(
+            const uint32x8& lhs, int rhs) noexcept
+        {
+            return _mm256_srli_epi32(lhs, rhs);
+        }
+
+        inline uint32x8 bitwise_shift_left_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_sllv_epi32(lhs, rhs);
+        }
+
+        inline uint32x8 bitwise_shift_right_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_srlv_epi32(lhs, rhs);
+        }
+
+        inline uint32x8& addition_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = _mm256_add_epi32(lhs, rhs);
+        }
+
+        inline uint32x8& subtraction_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = _mm256_sub_epi32(lhs, rhs);
+        }
+
+        inline uint32x8& multiplication_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = multiplication_operator_ss(lhs, rhs);
+        }
+
+        inline uint32x8& division_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = division_operator_ss(lhs, rhs);
+        }
+
+        inline uint32x8& modulo_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = modulo_operator_ss(lhs, rhs);
+        }
+
+        inline uint32x8& bitwise_and_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline uint32x8& bitwise_or_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline uint32x8& bitwise_xor_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline uint32x8& bitwise_shift_left_assignment_operator_si(
+            uint32x8& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_si(lhs, rhs);
+        }
+
+        inline uint32x8& bitwise_shift_right_assignment_operator_si(
+            uint32x8& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
+        }
+
+        inline uint32x8& bitwise_shift_left_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_ss(lhs, rhs);
+        }
+
+        inline uint32x8& bitwise_shift_right_assignment_operator_ss(
+            uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_ss(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline uint32x8 abs_s(const uint32x8& s) noexcept
+        {
+            return s;
+        }
+
+        inline uint32x8 min_ss(
+            const uint32x8& s1, const uint32x8& s2) noexcept
+        {
+            return _mm256_min_epu32(s1, s2);
+        }
+
+        inline uint32x8 max_ss(
+            const uint32x8& s1, const uint32x8& s2) noexcept
+        {
+            return _mm256_max_epu32(s1, s2);
+        }
+
+        inline std::uint32_t reduce_add_s(const uint32x8& s) noexcept
+        {
+            // Fold the upper 128 bits onto the lower ones first.
+            const __m256i x = s;
+            return reduce_add_s(addition_operator_ss(
+                uint32x4(_mm256_castsi256_si128(x)),
+                uint32x4(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline std::uint32_t reduce_min_s(const uint32x8& s) noexcept
+        {
+            const __m256i x = s;
+            return reduce_min_s(min_ss(
+                uint32x4(_mm256_castsi256_si128(x)),
+                uint32x4(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline std::uint32_t reduce_max_s(const uint32x8& s) noexcept
+        {
+            const __m256i x = s;
+            return reduce_max_s(max_ss(
+                uint32x4(_mm256_castsi256_si128(x)),
+                uint32x4(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline uint32x8 mask_ss(
+            const bool32x8& conditions,
+            const uint32x8& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline uint32x8 select_sss(
+            const bool32x8& conditions,
+            const uint32x8& values,
+            const uint32x8& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool32x8 less_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            const auto bias = uint32x8(0x80000000);
+            const auto l = _mm256_xor_si256(lhs, bias);
+            const auto r = _mm256_xor_si256(rhs, bias);
+            return _mm256_cmpgt_epi32(r, l);
+        }
+
+        inline bool32x8 less_equal_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            const auto bias = uint32x8(0x80000000);
+            const auto l = _mm256_xor_si256(lhs, bias);
+            const auto r = _mm256_xor_si256(rhs, bias);
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi32(l, r), uint32x8(0xFFFFFFFF));
+        }
+
+        inline bool32x8 greater_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            const auto bias = uint32x8(0x80000000);
+            const auto l = _mm256_xor_si256(lhs, bias);
+            const auto r = _mm256_xor_si256(rhs, bias);
+            return _mm256_cmpgt_epi32(l, r);
+        }
+
+        inline bool32x8 greater_equal_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            const auto bias = uint32x8(0x80000000);
+            const auto l = _mm256_xor_si256(lhs, bias);
+            const auto r = _mm256_xor_si256(rhs, bias);
+            return _mm256_xor_si256(
+                _mm256_cmpgt_epi32(r, l), uint32x8(0xFFFFFFFF));
+        }
+
+        inline bool32x8 equal_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi32(lhs, rhs);
+        }
+
+        inline bool32x8 not_equal_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi32(lhs, rhs), uint32x8(0xFFFFFFFF));
+        }
+
+        template<int... I>
+        inline uint32x8 shuffle_s(
+            const uint32x8& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return _mm256_permutevar8x32_epi32(s, _mm256_setr_epi32(I...));
+        }
+
+        template<int... I>
+        inline uint32x8 shuffle_ss(
+            const uint32x8& lhs,
+            const uint32x8& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            constexpr int from_rhs =
+                tue::detail_::second_source_lanes<8, I...>();
+            return _mm256_blend_epi32(
+                tue::detail_::shuffle_s(
+                    lhs, std::integer_sequence<int, (I % 8)...>()),
+                tue::detail_::shuffle_s(
+                    rhs, std::integer_sequence<int, (I % 8)...>()),
+                from_rhs);
+        }
+
+        template<int I>
+        inline std::uint32_t extract_s(
+            const uint32x8& s, std::integral_constant<int, I>) noexcept
+        {
+            return static_cast<std::uint32_t>(_mm256_extract_epi32(s, I));
+        }
+
+        template<int I>
+        inline uint32x8 insert_s(
+            const uint32x8& s,
+            std::uint32_t x,
+            std::integral_constant<int, I>) noexcept
+        {
+            return _mm256_blend_epi32(s, uint32x8(x), 1 << I);
+        }
+
+        inline uint32x8 interleave_lo_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            // The unpack instructions interleave within each 128-bit half,
+            // so put the halves back in order afterwards.
+            const __m256i lo = _mm256_unpacklo_epi32(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi32(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x20);
+        }
+
+        inline uint32x8 interleave_hi_ss(
+            const uint32x8& lhs, const uint32x8& rhs) noexcept
+        {
+            const __m256i lo = _mm256_unpacklo_epi32(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi32(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x31);
+        }
+    }
+}
@@ -0,0 +1,633 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../../../simd.hpp"
+
+namespace tue
+{
+    template<>
+    class alignas(tue::detail_::alignof_simd<std::uint8_t, 32>())
+    simd<std::uint8_t, 32>
+    {
+        __m256i underlying_;
+
+    private:
+        template<typename U>
+        static uint8x32 explicit_cast(const simd<U, 32>& s) noexcept
+        {
+            uint8x32 result;
+            for (int i = 0; i < 32; ++i)
+            {
+                result.data()[i] = std::uint8_t(s.data()[i]);
+            }
+            return result;
+        }
+
+        inline static uint8x32 explicit_cast(const bool8x32& s) noexcept;
+
+        inline static uint8x32 explicit_cast(const int8x32& s) noexcept;
+
+    public:
+        using component_type = std::uint8_t;
+
+        static constexpr int component_count = 32;
+
+        static constexpr bool is_accelerated = true;
+
+        simd() noexcept = default;
+
+        explicit simd(std::uint8_t x) noexcept
+        :
+            underlying_(_mm256_set1_epi8(x))
+        {
+        }
+
+        template<int M = 32, typename = std::enable_if_t<M == 2>>
+        inline simd(
+            std::uint8_t x, std::uint8_t y) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 4>>
+        inline simd(
+            std::uint8_t x, std::uint8_t y,
+            std::uint8_t z, std::uint8_t w) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 8>>
+        inline simd(
+            std::uint8_t s0, std::uint8_t s1,
+            std::uint8_t s2, std::uint8_t s3,
+            std::uint8_t s4, std::uint8_t s5,
+            std::uint8_t s6, std::uint8_t s7) noexcept;
+
+        template<int M = 32, typename = std::enable_if_t<M == 16>>
+        inline simd(
+            std::uint8_t  s0, std::uint8_t  s1,
+            std::uint8_t  s2, std::uint8_t  s3,
+            std::uint8_t  s4, std::uint8_t  s5,
+            std::uint8_t  s6, std::uint8_t  s7,
+            std::uint8_t  s8, std::uint8_t  s9,
+            std::uint8_t s10, std::uint8_t s11,
+            std::uint8_t s12, std::uint8_t s13,
+            std::uint8_t s14, std::uint8_t s15) noexcept;
+
+        template<typename U>
+        explicit simd(const simd<U, 32>& s) noexcept
+        {
+            *this = explicit_cast(s);
+        }
+
+        simd(__m256i underlying) noexcept
+        :
+            underlying_(underlying)
+        {
+        }
+
+        operator __m256i() const noexcept
+        {
+            return underlying_;
+        }
+
+        static uint8x32 zero() noexcept
+        {
+            return _mm256_setzero_si256();
+        }
+
+        static uint8x32 load(const std::uint8_t* data) noexcept
+        {
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        static uint8x32 loadu(const std::uint8_t* data) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static uint8x32 gather(
+            const std::uint8_t* base, const simd<I, 32>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static uint8x32 gather(
+            const std::uint8_t* base,
+            const simd<I, 32>& indices,
+            const bool8x32& conditions) noexcept;
+
+        inline static uint8x32 load_partial(
+            const std::uint8_t* data, int count) noexcept;
+
+        inline static uint8x32 maskload(
+            const std::uint8_t* data, const bool8x32& conditions) noexcept;
+
+        void store(std::uint8_t* data) const noexcept
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void storeu(std::uint8_t* data) const noexcept
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        void stream(std::uint8_t* data) const noexcept
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::uint8_t* base, const simd<I, 32>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::uint8_t* base,
+            const simd<I, 32>& indices,
+            const bool8x32& conditions) const noexcept;
+
+        inline void store_partial(
+            std::uint8_t* data, int count) const noexcept;
+
+        inline void maskstore(
+            std::uint8_t* data, const bool8x32& conditions) const noexcept;
+
+        const std::uint8_t* data() const noexcept
+        {
+            return reinterpret_cast<const std::uint8_t*>(&underlying_);
+        }
+
+        std::uint8_t* data() noexcept
+        {
+            return reinterpret_cast<std::uint8_t*>(&underlying_);
+        }
+    };
+}
+
+#include "bool8x32.avx2.hpp"
+#include "int8x32.avx2.hpp"
+#include "../sse2/uint8x16.sse2.hpp"
+
+namespace tue
+{
+    inline uint8x32 uint8x32::explicit_cast(const bool8x32& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    inline uint8x32 uint8x32::explicit_cast(const int8x32& s) noexcept
+    {
+        return __m256i(s);
+    }
+
+    template<typename I, typename>
+    inline uint8x32 uint8x32::gather(
+        const std::uint8_t* base, const simd<I, 32>& indices) noexcept
+    {
+        return tue::detail_::gather_components<uint8x32>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline uint8x32 uint8x32::gather(
+        const std::uint8_t* base,
+        const simd<I, 32>& indices,
+        const bool8x32& conditions) noexcept
+    {
+        return tue::detail_::gather_components<uint8x32>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void uint8x32::scatter(
+        std::uint8_t* base, const simd<I, 32>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void uint8x32::scatter(
+        std::uint8_t* base,
+        const simd<I, 32>& indices,
+        const bool8x32& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline uint8x32 uint8x32::load_partial(
+        const std::uint8_t* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm256_cmpgt_epi8(
+                _mm256_set1_epi8(static_cast<char>(count)),
+                _mm256_setr_epi8(
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+                    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+                    31)));
+    }
+
+    inline uint8x32 uint8x32::maskload(
+        const std::uint8_t* data, const bool8x32& conditions) noexcept
+    {
+        if (_mm256_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(uint8x32)))
+        {
+            return _mm256_and_si256(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<uint8x32>(data, conditions);
+    }
+
+    inline void uint8x32::store_partial(
+        std::uint8_t* data, int count) const noexcept
+    {
+        const int size = count * 1;
+        tue::detail_::storeu_partial_si128(
+            data, _mm256_castsi256_si128(underlying_), size);
+        if (size > 16)
+        {
+            tue::detail_::storeu_partial_si128(
+                reinterpret_cast<char*>(data) + 16,
+                _mm256_extracti128_si256(underlying_, 1),
+                size - 16);
+        }
+    }
+
+    inline void uint8x32::maskstore(
+        std::uint8_t* data, const bool8x32& conditions) const noexcept
+    {
+        const auto c = reinterpret_cast<char*>(data);
+        _mm_maskmoveu_si128(
+            _mm256_castsi256_si128(underlying_),
+            _mm256_castsi256_si128(conditions),
+            c);
+        _mm_maskmoveu_si128(
+            _mm256_extracti128_si256(underlying_, 1),
+            _mm256_extracti128_si256(conditions, 1),
+            c + 16);
+    }
+
+    namespace detail_
+    {
+        inline uint8x32& pre_increment_operator_s(uint8x32& s) noexcept
+        {
+            return s = _mm256_add_epi8(s, uint8x32(1));
+        }
+
+        inline uint8x32 post_increment_operator_s(uint8x32& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_add_epi8(s, uint8x32(1));
+            return result;
+        }
+
+        inline uint8x32& pre_decrement_operator_s(uint8x32& s) noexcept
+        {
+            return s = _mm256_sub_epi8(s, uint8x32(1));
+        }
+
+        inline uint8x32 post_decrement_operator_s(uint8x32& s) noexcept
+        {
+            const auto result = s;
+            s = _mm256_sub_epi8(s, uint8x32(1));
+            return result;
+        }
+
+        inline uint8x32 bitwise_not_operator_s(const uint8x32& s) noexcept
+        {
+            return _mm256_xor_si256(s, uint8x32(0xFF));
+        }
+
+        inline uint8x32 addition_operator_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return _mm256_add_epi8(lhs, rhs);
+        }
+
+        inline uint8x32 subtraction_operator_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return _mm256_sub_epi8(lhs, rhs);
+        }
+
+        inline uint8x32 multiplication_operator_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            // There's no 8-bit multiply, so multiply the even and odd
+            // bytes as 16-bit lanes and merge the low bytes of each product.
+            const auto even = _mm256_mullo_epi16(lhs, rhs);
+            const auto odd = _mm256_mullo_epi16(
+                _mm256_srli_epi16(lhs, 8), _mm256_srli_epi16(rhs, 8));
+            return _mm256_or_si256(
+                _mm256_slli_epi16(odd, 8),
+                _mm256_and_si256(even, _mm256_set1_epi16(0x00FF)));
+        }
+
+        inline uint8x32 bitwise_and_operator_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        inline uint8x32 bitwise_or_operator_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        inline uint8x32 bitwise_xor_operator_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline uint8x32 bitwise_shift_left_operator_si(
+            const uint8x32& lhs, int rhs) noexcept
+        {
+            return _mm256_and_si256(
+                _mm256_slli_epi16(lhs, rhs),
+                _mm256_set1_epi8(static_cast<char>(0xFF << rhs)));
+        }
+
+        inline uint8x32 bitwise_shift_right_operator_si(
+            const uint8x32& lhs, int rhs) noexcept
+        {
+            return _mm256_and_si256(
+                _mm256_srli_epi16(lhs, rhs),
+                _mm256_set1_epi8(static_cast<char>(0xFF >> rhs)));
+        }
+
+        inline uint8x32& addition_assignment_operator_ss(
+            uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return lhs = _mm256_add_epi8(lhs, rhs);
+        }
+
+        inline uint8x32& subtraction_assignment_operator_ss(
+            uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return lhs = _mm256_sub_epi8(lhs, rhs);
+        }
+
+        inline uint8x32& multiplication_assignment_operator_ss(
+            uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return lhs = multiplication_operator_ss(lhs, rhs);
+        }
+
+        inline uint8x32& bitwise_and_assignment_operator_ss(
+            uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return lhs = _mm256_and_si256(lhs, rhs);
+        }
+
+        inline uint8x32& bitwise_or_assignment_operator_ss(
+            uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return lhs = _mm256_or_si256(lhs, rhs);
+        }
+
+        inline uint8x32& bitwise_xor_assignment_operator_ss(
+            uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return lhs = _mm256_xor_si256(lhs, rhs);
+        }
+
+        inline uint8x32& bitwise_shift_left_assignment_operator_si(
+            uint8x32& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_left_operator_si(lhs, rhs);
+        }
+
+        inline uint8x32& bitwise_shift_right_assignment_operator_si(
+            uint8x32& lhs, int rhs) noexcept
+        {
+            return lhs = bitwise_shift_right_operator_si(lhs, rhs);
+        }
+
+        inline bool equality_operator_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) == -1;
+        }
+
+        inline bool inequality_operator_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(lhs, rhs)) != -1;
+        }
+
+        inline uint8x32 abs_s(const uint8x32& s) noexcept
+        {
+            return s;
+        }
+
+        inline uint8x32 min_ss(
+            const uint8x32& s1, const uint8x32& s2) noexcept
+        {
+            return _mm256_min_epu8(s1, s2);
+        }
+
+        inline uint8x32 max_ss(
+            const uint8x32& s1, const uint8x32& s2) noexcept
+        {
+            return _mm256_max_epu8(s1, s2);
+        }
+
+        inline std::uint8_t reduce_add_s(const uint8x32& s) noexcept
+        {
+            // Fold the upper 128 bits onto the lower ones first.
+            const __m256i x = s;
+            return reduce_add_s(addition_operator_ss(
+                uint8x16(_mm256_castsi256_si128(x)),
+                uint8x16(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline std::uint8_t reduce_min_s(const uint8x32& s) noexcept
+        {
+            const __m256i x = s;
+            return reduce_min_s(min_ss(
+                uint8x16(_mm256_castsi256_si128(x)),
+                uint8x16(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline std::uint8_t reduce_max_s(const uint8x32& s) noexcept
+        {
+            const __m256i x = s;
+            return reduce_max_s(max_ss(
+                uint8x16(_mm256_castsi256_si128(x)),
+                uint8x16(_mm256_extracti128_si256(x, 1))));
+        }
+
+        inline uint8x32 adds_ss(
+            const uint8x32& s1, const uint8x32& s2) noexcept
+        {
+            return _mm256_adds_epu8(s1, s2);
+        }
+
+        inline uint8x32 subs_ss(
+            const uint8x32& s1, const uint8x32& s2) noexcept
+        {
+            return _mm256_subs_epu8(s1, s2);
+        }
+
+        inline uint8x32 avg_ss(
+            const uint8x32& s1, const uint8x32& s2) noexcept
+        {
+            return _mm256_avg_epu8(s1, s2);
+        }
+
+        inline uint8x32 mask_ss(
+            const bool8x32& conditions,
+            const uint8x32& values) noexcept
+        {
+            return _mm256_and_si256(conditions, values);
+        }
+
+        inline uint8x32 select_sss(
+            const bool8x32& conditions,
+            const uint8x32& values,
+            const uint8x32& otherwise) noexcept
+        {
+            return _mm256_blendv_epi8(otherwise, values, conditions);
+        }
+
+        inline bool8x32 less_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            const auto bias = uint8x32(0x80);
+            const auto l = _mm256_xor_si256(lhs, bias);
+            const auto r = _mm256_xor_si256(rhs, bias);
+            return _mm256_cmpgt_epi8(r, l);
+        }
+
+        inline bool8x32 less_equal_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            const auto bias = uint8x32(0x80);
+            const auto l = _mm256_xor_si256(lhs, bias);
+            const auto r = _mm256_xor_si256(rhs, bias);
+            return _mm256_xor_si256(_mm256_cmpgt_epi8(l, r), uint8x32(0xFF));
+        }
+
+        inline bool8x32 greater_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            const auto bias = uint8x32(0x80);
+            const auto l = _mm256_xor_si256(lhs, bias);
+            const auto r = _mm256_xor_si256(rhs, bias);
+            return _mm256_cmpgt_epi8(l, r);
+        }
+
+        inline bool8x32 greater_equal_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            const auto bias = uint8x32(0x80);
+            const auto l = _mm256_xor_si256(lhs, bias);
+            const auto r = _mm256_xor_si256(rhs, bias);
+            return _mm256_xor_si256(_mm256_cmpgt_epi8(r, l), uint8x32(0xFF));
+        }
+
+        inline bool8x32 equal_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return _mm256_cmpeq_epi8(lhs, rhs);
+        }
+
+        inline bool8x32 not_equal_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            return _mm256_xor_si256(
+                _mm256_cmpeq_epi8(lhs, rhs), uint8x32(0xFF));
+        }
+
+        template<int... I>
+        inline uint8x32 shuffle_s(
+            const uint8x32& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            // vpshufb only shuffles within each 128-bit half, so shuffle
+            // both s and s with its halves swapped, then blend in the
+            // components that cross over. Bit 4 of each
+            // control byte picks the half, so comparing it against the half
+            // each byte lands in and moving it up to bit 7 gives the blend
+            // mask.
+            const __m256i indices = _mm256_setr_epi8(static_cast<char>(I)...);
+            const __m256i halves = _mm256_setr_epi64x(
+                0, 0, 0x1010101010101010, 0x1010101010101010);
+            const __m256i swapped = _mm256_permute2x128_si256(s, s, 0x01);
+            const __m256i crossing =
+                _mm256_slli_epi16(_mm256_xor_si256(indices, halves), 3);
+            return _mm256_blendv_epi8(
+                _mm256_shuffle_epi8(s, indices),
+                _mm256_shuffle_epi8(swapped, indices),
+                crossing);
+        }
+
+        template<int... I>
+        inline uint8x32 shuffle_ss(
+            const uint8x32& lhs,
+            const uint8x32& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return _mm256_blendv_epi8(
+                tue::detail_::shuffle_s(
+                    lhs, std::integer_sequence<int, (I % 32)...>()),
+                tue::detail_::shuffle_s(
+                    rhs, std::integer_sequence<int, (I % 32)...>()),
+                _mm256_setr_epi8(static_cast<char>(I < 32 ? 0 : -1)...));
+        }
+
+        template<int I>
+        inline std::uint8_t extract_s(
+            const uint8x32& s, std::integral_constant<int, I>) noexcept
+        {
+            return static_cast<std::uint8_t>(_mm256_extract_epi8(s, I));
+        }
+
+        template<int I>
+        inline uint8x32 insert_s(
+            const uint8x32& s,
+            std::uint8_t x,
+            std::integral_constant<int, I>) noexcept
+        {
+            return _mm256_insert_epi8(s, static_cast<char>(x), I);
+        }
+
+        inline uint8x32 interleave_lo_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            // The unpack instructions interleave within each 128-bit half,
+            // so put the halves back in order afterwards.
+            const __m256i lo = _mm256_unpacklo_epi8(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi8(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x20);
+        }
+
+        inline uint8x32 interleave_hi_ss(
+            const uint8x32& lhs, const uint8x32& rhs) noexcept
+        {
+            const __m256i lo = _mm256_unpacklo_epi8(lhs, rhs);
+            const __m256i hi = _mm256_unpackhi_epi8(lhs, rhs);
+            return _mm256_permute2x128_si256(lo, hi, 0x31);
+        }
+    }
+}
@@ -10,6 +10,7 @@
 
 #include <xmmintrin.h>
 
+#include <cstdint>
 #include <type_traits>
 
 #include "../../../simd.hpp"
@@ -19,6 +20,14 @@
 #include <emmintrin.h>
 #endif
 
+#ifdef TUE_SSE4_1
+#include <smmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
 namespace tue
 {
     template<>
@@ -127,6 +136,26 @@ namespace tue
             return _mm_loadu_ps(reinterpret_cast<const float*>(data));
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool32x4 gather(
+            const bool32* base, const simd<I, 4>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool32x4 gather(
+            const bool32* base,
+            const simd<I, 4>& indices,
+            const bool32x4& conditions) noexcept;
+
+        inline static bool32x4 load_partial(
+            const bool32* data, int count) noexcept;
+
+        inline static bool32x4 maskload(
+            const bool32* data, const bool32x4& conditions) noexcept;
+
         void store(bool32* data) const noexcept
         {
             _mm_store_ps(reinterpret_cast<float*>(data), underlying_);
@@ -137,6 +166,30 @@ namespace tue
             _mm_storeu_ps(reinterpret_cast<float*>(data), underlying_);
         }
 
+        void stream(bool32* data) const noexcept
+        {
+            _mm_stream_ps(reinterpret_cast<float*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool32* base, const simd<I, 4>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool32* base,
+            const simd<I, 4>& indices,
+            const bool32x4& conditions) const noexcept;
+
+        inline void store_partial(bool32* data, int count) const noexcept;
+
+        inline void maskstore(
+            bool32* data, const bool32x4& conditions) const noexcept;
+
         const bool32* data() const noexcept
         {
             return reinterpret_cast<const bool32*>(&underlying_);
@@ -151,6 +204,114 @@ namespace tue
 
 namespace tue
 {
+    template<typename I, typename>
+    inline bool32x4 bool32x4::gather(
+        const bool32* base, const simd<I, 4>& indices) noexcept
+    {
+        return tue::detail_::gather_components<bool32x4>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline bool32x4 bool32x4::gather(
+        const bool32* base,
+        const simd<I, 4>& indices,
+        const bool32x4& conditions) noexcept
+    {
+        return tue::detail_::gather_components<bool32x4>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void bool32x4::scatter(
+        bool32* base, const simd<I, 4>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void bool32x4::scatter(
+        bool32* base,
+        const simd<I, 4>& indices,
+        const bool32x4& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline bool32x4 bool32x4::load_partial(
+        const bool32* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm_cmplt_ps(
+                _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f),
+                _mm_set1_ps(static_cast<float>(count))));
+    }
+
+    inline bool32x4 bool32x4::maskload(
+        const bool32* data, const bool32x4& conditions) noexcept
+    {
+#ifdef TUE_AVX
+        return _mm_maskload_ps(
+            reinterpret_cast<const float*>(data),
+            _mm_castps_si128(conditions));
+#else
+        if (_mm_movemask_ps(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(bool32x4)))
+        {
+            return _mm_and_ps(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<bool32x4>(data, conditions);
+#endif
+    }
+
+    inline void bool32x4::store_partial(bool32* data, int count) const noexcept
+    {
+#ifdef TUE_AVX
+        maskstore(
+            data,
+            _mm_cmplt_ps(
+                _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f),
+                _mm_set1_ps(static_cast<float>(count))));
+#else
+        if (count >= 4)
+        {
+            storeu(data);
+            return;
+        }
+        auto s = underlying_;
+        auto p = reinterpret_cast<float*>(data);
+        if (count & 2)
+        {
+            _mm_storel_pi(reinterpret_cast<__m64*>(p), s);
+            s = _mm_movehl_ps(s, s);
+            p += 2;
+        }
+        if (count & 1)
+        {
+            _mm_store_ss(p, s);
+        }
+#endif
+    }
+
+    inline void bool32x4::maskstore(
+        bool32* data, const bool32x4& conditions) const noexcept
+    {
+#ifdef TUE_AVX
+        _mm_maskstore_ps(
+            reinterpret_cast<float*>(data), _mm_castps_si128(conditions),
+            underlying_);
+#else
+#ifdef TUE_SSE2
+        _mm_maskmoveu_si128(
+            _mm_castps_si128(underlying_),
+            _mm_castps_si128(conditions),
+            reinterpret_cast<char*>(data));
+#else
+        tue::detail_::maskstore_components(*this, data, conditions);
+#endif
+#endif
+    }
+
     namespace detail_
     {
         inline bool32x4 bitwise_not_operator_s(
@@ -221,9 +382,13 @@ namespace tue
             const bool32x4& values,
             const bool32x4& otherwise) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_blendv_ps(otherwise, values, conditions);
+#else
             return _mm_or_ps(
                 _mm_and_ps(conditions, values),
                 _mm_andnot_ps(conditions, otherwise));
+#endif
         }
 
 #ifdef TUE_SSE2
@@ -239,5 +404,25 @@ namespace tue
             return _mm_xor_si128(_mm_cmpeq_epi32(lhs, rhs), bool32x4(true32));
         }
 #endif
+
+        inline std::uint64_t movemask_s(const bool32x4& s) noexcept
+        {
+            return static_cast<std::uint64_t>(_mm_movemask_ps(s));
+        }
+
+        inline bool any_s(const bool32x4& s) noexcept
+        {
+            return _mm_movemask_ps(s) != 0;
+        }
+
+        inline bool all_s(const bool32x4& s) noexcept
+        {
+            return _mm_movemask_ps(s) == 0xF;
+        }
+
+        inline bool none_s(const bool32x4& s) noexcept
+        {
+            return _mm_movemask_ps(s) == 0;
+        }
     }
 }
@@ -34,7 +34,10 @@
 
 #include <xmmintrin.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "../../../simd.hpp"
 
@@ -44,6 +47,14 @@
 #include <mmintrin.h>
 #endif
 
+#ifdef TUE_SSE4_1
+#include <smmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
 namespace tue
 {
     template<>
@@ -135,6 +146,26 @@ namespace tue
             return _mm_loadu_ps(data);
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static float32x4 gather(
+            const float* base, const simd<I, 4>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static float32x4 gather(
+            const float* base,
+            const simd<I, 4>& indices,
+            const bool32x4& conditions) noexcept;
+
+        inline static float32x4 load_partial(
+            const float* data, int count) noexcept;
+
+        inline static float32x4 maskload(
+            const float* data, const bool32x4& conditions) noexcept;
+
         void store(float* data) const noexcept
         {
             _mm_store_ps(data, underlying_);
@@ -145,6 +176,30 @@ namespace tue
             _mm_storeu_ps(data, underlying_);
         }
 
+        void stream(float* data) const noexcept
+        {
+            _mm_stream_ps(data, underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            float* base, const simd<I, 4>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            float* base,
+            const simd<I, 4>& indices,
+            const bool32x4& conditions) const noexcept;
+
+        inline void store_partial(float* data, int count) const noexcept;
+
+        inline void maskstore(
+            float* data, const bool32x4& conditions) const noexcept;
+
         const float* data() const noexcept
         {
             return reinterpret_cast<const float*>(&underlying_);
@@ -161,6 +216,128 @@ namespace tue
 
 namespace tue
 {
+    template<typename I, typename>
+    inline float32x4 float32x4::gather(
+        const float* base, const simd<I, 4>& indices) noexcept
+    {
+#ifdef TUE_SSE2
+#ifdef TUE_AVX2
+        return _mm_i32gather_ps(base, indices, 4);
+#else
+        const __m128i i = indices;
+        return _mm_setr_ps(
+            base[_mm_cvtsi128_si32(i)],
+            base[_mm_cvtsi128_si32(_mm_shuffle_epi32(i, 1))],
+            base[_mm_cvtsi128_si32(_mm_shuffle_epi32(i, 2))],
+            base[_mm_cvtsi128_si32(_mm_shuffle_epi32(i, 3))]);
+#endif
+#else
+        return tue::detail_::gather_components<float32x4>(base, indices);
+#endif
+    }
+
+    template<typename I, typename>
+    inline float32x4 float32x4::gather(
+        const float* base,
+        const simd<I, 4>& indices,
+        const bool32x4& conditions) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm_mask_i32gather_ps(
+            _mm_setzero_ps(), base, indices, conditions, 4);
+#else
+        return tue::detail_::gather_components<float32x4>(
+            base, indices, conditions);
+#endif
+    }
+
+    template<typename I, typename>
+    inline void float32x4::scatter(
+        float* base, const simd<I, 4>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void float32x4::scatter(
+        float* base,
+        const simd<I, 4>& indices,
+        const bool32x4& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline float32x4 float32x4::load_partial(
+        const float* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm_cmplt_ps(
+                _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f),
+                _mm_set1_ps(static_cast<float>(count))));
+    }
+
+    inline float32x4 float32x4::maskload(
+        const float* data, const bool32x4& conditions) noexcept
+    {
+#ifdef TUE_AVX
+        return _mm_maskload_ps(data, _mm_castps_si128(conditions));
+#else
+        if (_mm_movemask_ps(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(float32x4)))
+        {
+            return _mm_and_ps(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<float32x4>(data, conditions);
+#endif
+    }
+
+    inline void float32x4::store_partial(float* data, int count) const noexcept
+    {
+#ifdef TUE_AVX
+        maskstore(
+            data,
+            _mm_cmplt_ps(
+                _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f),
+                _mm_set1_ps(static_cast<float>(count))));
+#else
+        if (count >= 4)
+        {
+            storeu(data);
+            return;
+        }
+        auto s = underlying_;
+        auto p = data;
+        if (count & 2)
+        {
+            _mm_storel_pi(reinterpret_cast<__m64*>(p), s);
+            s = _mm_movehl_ps(s, s);
+            p += 2;
+        }
+        if (count & 1)
+        {
+            _mm_store_ss(p, s);
+        }
+#endif
+    }
+
+    inline void float32x4::maskstore(
+        float* data, const bool32x4& conditions) const noexcept
+    {
+#ifdef TUE_AVX
+        _mm_maskstore_ps(data, _mm_castps_si128(conditions), underlying_);
+#else
+#ifdef TUE_SSE2
+        _mm_maskmoveu_si128(
+            _mm_castps_si128(underlying_),
+            _mm_castps_si128(conditions),
+            reinterpret_cast<char*>(data));
+#else
+        tue::detail_::maskstore_components(*this, data, conditions);
+#endif
+#endif
+    }
+
     namespace detail_
     {
         inline float32x4 unary_plus_operator_s(const float32x4& s) noexcept
@@ -458,6 +635,133 @@ namespace tue
             return cos;
         }
 
+        inline float32x4 tan_s(const float32x4& s) noexcept
+        {
+            float32x4 sin, cos;
+            sincos_s(s, sin, cos);
+            return _mm_div_ps(sin, cos);
+        }
+
+        inline float32x4 atan_s(const float32x4& s) noexcept
+        {
+            // This function's implementation is based on atanf() from the
+            // cephes library.
+            __m128 x = s;
+
+            const __m128 sign_mask = _mm_set1_ps(binary_float(0x80000000));
+            const __m128 one = _mm_set1_ps(1.0f);
+
+            /* extract the sign bit and take the absolute value */
+            __m128 sign_bit = _mm_and_ps(x, sign_mask);
+            x = _mm_andnot_ps(sign_mask, x);
+
+            /* range reduction:
+               if (x > tan(3*pi/8)) { y = pi/2; x = -1/x; }
+               else if (x > tan(pi/8)) { y = pi/4; x = (x-1)/(x+1); }
+               else { y = 0; } */
+            __m128 big = _mm_cmpgt_ps(x, _mm_set1_ps(2.414213562373095f));
+            __m128 mid = _mm_andnot_ps(
+                big, _mm_cmpgt_ps(x, _mm_set1_ps(0.4142135623730950f)));
+            __m128 small = _mm_andnot_ps(_mm_or_ps(big, mid), x);
+
+            __m128 num = _mm_or_ps(
+                _mm_or_ps(
+                    _mm_and_ps(big, _mm_set1_ps(-1.0f)),
+                    _mm_and_ps(mid, _mm_sub_ps(x, one))),
+                small);
+            __m128 den = _mm_or_ps(
+                _mm_or_ps(
+                    _mm_and_ps(big, x),
+                    _mm_and_ps(mid, _mm_add_ps(x, one))),
+                _mm_andnot_ps(_mm_or_ps(big, mid), one));
+            x = _mm_div_ps(num, den);
+
+            __m128 y = _mm_or_ps(
+                _mm_and_ps(big, _mm_set1_ps(1.57079632679489661923f)),
+                _mm_and_ps(mid, _mm_set1_ps(0.78539816339744830962f)));
+
+            __m128 z = _mm_mul_ps(x, x);
+
+            __m128 p = _mm_set1_ps(8.05374449538e-2f);
+            p = _mm_mul_ps(p, z);
+            p = _mm_add_ps(p, _mm_set1_ps(-1.38776856032e-1f));
+            p = _mm_mul_ps(p, z);
+            p = _mm_add_ps(p, _mm_set1_ps(1.99777106478e-1f));
+            p = _mm_mul_ps(p, z);
+            p = _mm_add_ps(p, _mm_set1_ps(-3.33329491539e-1f));
+            p = _mm_mul_ps(p, z);
+            p = _mm_mul_ps(p, x);
+            p = _mm_add_ps(p, x);
+            y = _mm_add_ps(y, p);
+
+            /* update the sign */
+            return _mm_xor_ps(y, sign_bit);
+        }
+
+        inline float32x4 asin_s(const float32x4& s) noexcept
+        {
+            // asin(x) = atan(x / sqrt((1 - x) * (1 + x)))
+            const __m128 one = _mm_set1_ps(1.0f);
+            __m128 x = _mm_mul_ps(_mm_sub_ps(one, s), _mm_add_ps(one, s));
+            x = _mm_div_ps(s, _mm_sqrt_ps(x));
+            return atan_s(x);
+        }
+
+        inline float32x4 acos_s(const float32x4& s) noexcept
+        {
+            // acos(x) = 2 * atan(sqrt((1 - x) / (1 + x)))
+            const __m128 one = _mm_set1_ps(1.0f);
+            __m128 x = _mm_div_ps(_mm_sub_ps(one, s), _mm_add_ps(one, s));
+            x = atan_s(_mm_sqrt_ps(x));
+            return _mm_add_ps(x, x);
+        }
+
+        inline float32x4 atan2_ss(
+            const float32x4& y, const float32x4& x) noexcept
+        {
+            // The arc tangent is computed for min(|x|, |y|) / max(|x|, |y|)
+            // in [0, 1] and then reflected into the right octant.
+            const __m128 sign_mask = _mm_set1_ps(binary_float(0x80000000));
+            const __m128 ax = _mm_andnot_ps(sign_mask, x);
+            const __m128 ay = _mm_andnot_ps(sign_mask, y);
+
+            __m128 num = _mm_min_ps(ax, ay);
+            __m128 den = _mm_max_ps(ax, ay);
+            __m128 r = _mm_div_ps(num, den);
+
+            /* atan2(0, 0) is 0 and atan2(inf, inf) is pi/4 before the
+               reflections */
+            const __m128 inf = _mm_set1_ps(binary_float(0x7F800000));
+            __m128 mask = _mm_and_ps(
+                _mm_cmpeq_ps(ax, inf), _mm_cmpeq_ps(ay, inf));
+            r = _mm_and_ps(r, _mm_cmpneq_ps(den, _mm_setzero_ps()));
+            r = _mm_or_ps(
+                _mm_and_ps(mask, _mm_set1_ps(1.0f)), _mm_andnot_ps(mask, r));
+            r = atan_s(r);
+
+            /* if (|y| > |x|) r = pi/2 - r; */
+            mask = _mm_cmpgt_ps(ay, ax);
+            r = _mm_or_ps(
+                _mm_and_ps(
+                    mask,
+                    _mm_sub_ps(_mm_set1_ps(1.57079632679489661923f), r)),
+                _mm_andnot_ps(mask, r));
+
+            /* if (x has its sign bit set) r = pi - r; */
+            mask = _mm_cmplt_ps(
+                _mm_or_ps(_mm_and_ps(x, sign_mask), _mm_set1_ps(1.0f)),
+                _mm_setzero_ps());
+            r = _mm_or_ps(
+                _mm_and_ps(
+                    mask,
+                    _mm_sub_ps(_mm_set1_ps(3.14159265358979323846f), r)),
+                _mm_andnot_ps(mask, r));
+
+            /* take the sign of y, and NaN in, NaN out */
+            r = _mm_or_ps(r, _mm_and_ps(y, sign_mask));
+            return _mm_or_ps(r, _mm_cmpunord_ps(x, y));
+        }
+
         inline float32x4 exp_s(const float32x4& s) noexcept
         {
             // This function's implementation is based on Julien Pommier's
@@ -543,6 +847,41 @@ namespace tue
             return y;
         }
 
+#ifdef TUE_SSE2
+        inline __m128 scalbn_ps(__m128 x, __m128i n) noexcept
+        {
+            // Computes x * 2^n. 2^n is applied as two factors with
+            // n1 + n2 = n so that n can span the whole exponent range,
+            // subnormal results included.
+            __m128i n1 = _mm_srai_epi32(n, 1);
+            __m128i n2 = _mm_sub_epi32(n, n1);
+            n1 = _mm_slli_epi32(_mm_add_epi32(n1, _mm_set1_epi32(0x7F)), 23);
+            n2 = _mm_slli_epi32(_mm_add_epi32(n2, _mm_set1_epi32(0x7F)), 23);
+            return _mm_mul_ps(
+                _mm_mul_ps(x, _mm_castsi128_ps(n1)), _mm_castsi128_ps(n2));
+        }
+
+        inline float32x4 exp2_s(const float32x4& s) noexcept
+        {
+            // 2^x = 2^n * exp(f * log(2)) with n = round(x) and f = x - n,
+            // which is exact, so the only rounding in the argument of exp()
+            // is that of the small product f * log(2).
+            __m128 x = s;
+
+            __m128 nan_mask = _mm_cmpunord_ps(x, x);
+
+            x = _mm_min_ps(x, _mm_set1_ps(129.0f));
+            x = _mm_max_ps(x, _mm_set1_ps(-151.0f));
+
+            __m128i emm0 = _mm_cvtps_epi32(x);
+            x = _mm_sub_ps(x, _mm_cvtepi32_ps(emm0));
+            x = _mm_mul_ps(x, _mm_set1_ps(6.93147180559945309417e-1f));
+
+            __m128 y = scalbn_ps(exp_s(x), emm0);
+            return _mm_or_ps(y, nan_mask);
+        }
+#endif
+
         inline float32x4 log_s(const float32x4& s) noexcept
         {
             // This function's implementation is based on Julien Pommier's
@@ -632,6 +971,111 @@ namespace tue
             return x;
         }
 
+#ifdef TUE_SSE2
+        inline __m128 frexp_ps(__m128 x, __m128& e) noexcept
+        {
+            // Splits a finite positive x into m * 2^e with m in
+            // [sqrt(2)/2, sqrt(2)) and returns m. Subnormals are scaled by
+            // 2^24 before the exponent is extracted.
+            const __m128 one = _mm_set1_ps(1.0f);
+
+            /* scale up subnormals */
+            const __m128 min = _mm_set1_ps(binary_float(0x00800000));
+            __m128 mask = _mm_cmplt_ps(x, min);
+            __m128 scaled = _mm_mul_ps(x, _mm_set1_ps(16777216.0f));
+            x = _mm_or_ps(_mm_and_ps(mask, scaled), _mm_andnot_ps(mask, x));
+            e = _mm_and_ps(mask, _mm_set1_ps(-24.0f));
+
+            /* x = frexpf(x, &e) with the mantissa in [1, 2) */
+            __m128i emm0 = _mm_srli_epi32(_mm_castps_si128(x), 23);
+            emm0 = _mm_sub_epi32(emm0, _mm_set1_epi32(0x7F));
+            e = _mm_add_ps(e, _mm_cvtepi32_ps(emm0));
+
+            x = _mm_and_ps(x, _mm_set1_ps(binary_float(0x007FFFFF)));
+            x = _mm_or_ps(x, one);
+
+            /* if (x > SQRT2) { e += 1; x *= 0.5; } */
+            mask = _mm_cmpgt_ps(x, _mm_set1_ps(1.41421356237309504880f));
+            x = _mm_or_ps(
+                _mm_and_ps(mask, _mm_mul_ps(x, _mm_set1_ps(0.5f))),
+                _mm_andnot_ps(mask, x));
+            e = _mm_add_ps(e, _mm_and_ps(mask, one));
+            return x;
+        }
+
+        inline __m128 log1p_ps(__m128 x) noexcept
+        {
+            // Computes log(1 + x) for x in [sqrt(2)/2 - 1, sqrt(2) - 1] with
+            // the polynomial from Julien Pommier's log_ps().
+            __m128 z = _mm_mul_ps(x, x);
+
+            __m128 y = _mm_set1_ps(7.0376836292e-2f);
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(-1.1514610310e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(1.1676998740e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(-1.2420140846e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(1.4249322787e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(-1.6668057665e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(2.0000714765e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(-2.4999993993e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(3.3333331174e-1f));
+            y = _mm_mul_ps(y, x);
+
+            y = _mm_mul_ps(y, z);
+            y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+            return _mm_add_ps(x, y);
+        }
+
+        inline __m128 log_special_ps(__m128 x, __m128 result) noexcept
+        {
+            // Applies log(inf) = inf, log(0) = -inf and log(x < 0) = NaN to
+            // a logarithm of x computed for finite positive x.
+            const __m128 inf = _mm_set1_ps(binary_float(0x7F800000));
+            __m128 mask = _mm_cmpeq_ps(x, inf);
+            result = _mm_or_ps(
+                _mm_and_ps(mask, x), _mm_andnot_ps(mask, result));
+            mask = _mm_cmpeq_ps(x, _mm_setzero_ps());
+            result = _mm_or_ps(
+                _mm_and_ps(mask, _mm_set1_ps(binary_float(0xFF800000))),
+                _mm_andnot_ps(mask, result));
+            return _mm_or_ps(result, _mm_cmpnge_ps(x, _mm_setzero_ps()));
+        }
+
+        inline float32x4 log2_s(const float32x4& s) noexcept
+        {
+            // log2(x) = e + log(m) / log(2) with x = m * 2^e, so powers of
+            // two give exact results.
+            __m128 e;
+            __m128 x = frexp_ps(s, e);
+            x = log1p_ps(_mm_sub_ps(x, _mm_set1_ps(1.0f)));
+            x = _mm_mul_ps(x, _mm_set1_ps(1.44269504088896340736f));
+            x = _mm_add_ps(x, e);
+            return log_special_ps(s, x);
+        }
+
+        inline float32x4 log10_s(const float32x4& s) noexcept
+        {
+            // log10(x) = e * log10(2) + log(m) / log(10) with x = m * 2^e,
+            // where log10(2) is split in two so that e * log10(2) is exact in
+            // the high part.
+            __m128 e;
+            __m128 x = frexp_ps(s, e);
+            x = log1p_ps(_mm_sub_ps(x, _mm_set1_ps(1.0f)));
+            x = _mm_mul_ps(x, _mm_set1_ps(4.34294481903251827651e-1f));
+            x = _mm_add_ps(
+                x, _mm_mul_ps(e, _mm_set1_ps(4.60503898119521373889e-6f)));
+            x = _mm_add_ps(x, _mm_mul_ps(e, _mm_set1_ps(3.01025390625e-1f)));
+            return log_special_ps(s, x);
+        }
+#endif
+
         inline float32x4 abs_s(const float32x4& s) noexcept
         {
             return _mm_and_ps(s, float32x4(binary_float(0x7FFFFFFF)));
@@ -640,24 +1084,401 @@ namespace tue
         inline float32x4 pow_ss(
             const float32x4& bases, const float32x4& exponents) noexcept
         {
-            return exp_s(float32x4(_mm_mul_ps(log_s(bases), exponents)));
+            // x^0 and 1^y are 1 even where exp(y * log(x)) is NaN, as with
+            // std::pow.
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 ones = _mm_or_ps(
+                _mm_cmpeq_ps(exponents, _mm_setzero_ps()),
+                _mm_cmpeq_ps(bases, one));
+            const __m128 x =
+                exp_s(float32x4(_mm_mul_ps(log_s(bases), exponents)));
+            return _mm_or_ps(_mm_and_ps(ones, one), _mm_andnot_ps(ones, x));
         }
 
-        inline float32x4 recip_s(const float32x4& s) noexcept
+#ifdef TUE_SSE2
+        inline void fast_sincos_s(
+            const float32x4& s,
+            float32x4& sin_out,
+            float32x4& cos_out) noexcept
+        {
+            // The same octant reduction as sincos_s(), but with a two-part
+            // Cody-Waite constant and degree 5 and 6 minimax polynomials.
+            // The relative error is about 2e-6 for |x| up to a few hundred,
+            // and infinities and NaNs aren't handled.
+            __m128 x = s;
+
+            const __m128 sign_mask = _mm_set1_ps(binary_float(0x80000000));
+            __m128 sign_bit_sin = _mm_and_ps(x, sign_mask);
+            x = _mm_andnot_ps(sign_mask, x);
+
+            /* j = ((int)(x * 4 / pi) + 1) & ~1 */
+            __m128i emm2 = _mm_cvttps_epi32(
+                _mm_mul_ps(x, _mm_set1_ps(1.27323954473516f)));
+            emm2 = _mm_add_epi32(emm2, _mm_set1_epi32(1));
+            emm2 = _mm_and_si128(emm2, _mm_set1_epi32(~1));
+            __m128 y = _mm_cvtepi32_ps(emm2);
+
+            __m128 swap_sign_bit_sin = _mm_castsi128_ps(_mm_slli_epi32(
+                _mm_and_si128(emm2, _mm_set1_epi32(4)), 29));
+            __m128 poly_mask = _mm_castsi128_ps(_mm_cmpeq_epi32(
+                _mm_and_si128(emm2, _mm_set1_epi32(2)),
+                _mm_setzero_si128()));
+            __m128 sign_bit_cos = _mm_castsi128_ps(_mm_slli_epi32(
+                _mm_andnot_si128(
+                    _mm_sub_epi32(emm2, _mm_set1_epi32(2)),
+                    _mm_set1_epi32(4)),
+                29));
+            sign_bit_sin = _mm_xor_ps(sign_bit_sin, swap_sign_bit_sin);
+
+            /* x = (x - y * DP1) - y * DP2 */
+            x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(0.78515625f)));
+            x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(2.4191339e-4f)));
+
+            __m128 z = _mm_mul_ps(x, x);
+
+            /* cos(x) = 1 - z / 2 + z^2 * (c0 + c1 * z) */
+            y = _mm_mul_ps(z, _mm_set1_ps(-1.3648714e-3f));
+            y = _mm_add_ps(y, _mm_set1_ps(4.1661071e-2f));
+            y = _mm_mul_ps(y, _mm_mul_ps(z, z));
+            y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+            y = _mm_add_ps(y, _mm_set1_ps(1.0f));
+
+            /* sin(x) = x + x * z * (s0 + s1 * z) */
+            __m128 y2 = _mm_mul_ps(z, _mm_set1_ps(8.1632819e-3f));
+            y2 = _mm_add_ps(y2, _mm_set1_ps(-1.6663390e-1f));
+            y2 = _mm_mul_ps(y2, _mm_mul_ps(z, x));
+            y2 = _mm_add_ps(y2, x);
+
+            /* select the correct result from the two polynoms */
+            __m128 ysin = _mm_or_ps(
+                _mm_and_ps(poly_mask, y2), _mm_andnot_ps(poly_mask, y));
+            __m128 ycos = _mm_or_ps(
+                _mm_and_ps(poly_mask, y), _mm_andnot_ps(poly_mask, y2));
+
+            sin_out = _mm_xor_ps(ysin, sign_bit_sin);
+            cos_out = _mm_xor_ps(ycos, sign_bit_cos);
+        }
+
+        inline float32x4 fast_exp_s(const float32x4& s) noexcept
+        {
+            // exp(x) = 2^n * exp(r) with a degree 4 minimax polynomial for
+            // exp(r). The relative error is about 6e-6. Inputs are clamped
+            // to [-104, 89], so NaNs aren't propagated.
+            __m128 x = s;
+
+            x = _mm_min_ps(x, _mm_set1_ps(89.0f));
+            x = _mm_max_ps(x, _mm_set1_ps(-104.0f));
+
+            __m128i emm0 = _mm_cvtps_epi32(
+                _mm_mul_ps(x, _mm_set1_ps(1.44269504088896341f)));
+            __m128 fx = _mm_cvtepi32_ps(emm0);
+
+            x = _mm_sub_ps(x, _mm_mul_ps(fx, _mm_set1_ps(0.693359375f)));
+            x = _mm_sub_ps(x, _mm_mul_ps(fx, _mm_set1_ps(-2.12194440e-4f)));
+
+            /* 1 + r + r^2 * (q0 + q1 * r + q2 * r^2) */
+            __m128 y = _mm_mul_ps(x, _mm_set1_ps(4.1277747e-2f));
+            y = _mm_add_ps(y, _mm_set1_ps(1.6753514e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(5.0005116e-1f));
+            y = _mm_mul_ps(y, _mm_mul_ps(x, x));
+            y = _mm_add_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(1.0f));
+
+            return scalbn_ps(y, emm0);
+        }
+
+        inline float32x4 fast_log_s(const float32x4& s) noexcept
+        {
+            // log(x) = e * log(2) + log(m) with a degree 6 minimax polynomial
+            // for log(m). The relative error is about 2e-5. x must be
+            // positive and normal.
+            __m128 x = s;
+            const __m128 one = _mm_set1_ps(1.0f);
+
+            __m128i emm0 = _mm_srli_epi32(_mm_castps_si128(x), 23);
+            emm0 = _mm_sub_epi32(emm0, _mm_set1_epi32(0x7F));
+            __m128 e = _mm_cvtepi32_ps(emm0);
+
+            x = _mm_and_ps(x, _mm_set1_ps(binary_float(0x007FFFFF)));
+            x = _mm_or_ps(x, one);
+
+            /* if (x > SQRT2) { e += 1; x *= 0.5; } */
+            const __m128 sqrt2 = _mm_set1_ps(1.41421356237309504880f);
+            __m128 mask = _mm_cmpgt_ps(x, sqrt2);
+            x = _mm_sub_ps(
+                x, _mm_and_ps(mask, _mm_mul_ps(x, _mm_set1_ps(0.5f))));
+            e = _mm_add_ps(e, _mm_and_ps(mask, one));
+            x = _mm_sub_ps(x, one);
+
+            /* x - x^2 / 2 + x^3 * (q0 + q1 * x + q2 * x^2 + q3 * x^3) */
+            __m128 z = _mm_mul_ps(x, x);
+            __m128 y = _mm_mul_ps(x, _mm_set1_ps(-1.4592515e-1f));
+            y = _mm_add_ps(y, _mm_set1_ps(2.1776510e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(-2.5244998e-1f));
+            y = _mm_mul_ps(y, x);
+            y = _mm_add_ps(y, _mm_set1_ps(3.3285471e-1f));
+            y = _mm_mul_ps(y, _mm_mul_ps(z, x));
+            y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+            y = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));
+            x = _mm_add_ps(x, y);
+            return _mm_add_ps(x, _mm_mul_ps(e, _mm_set1_ps(0.693359375f)));
+        }
+#else
+        inline void fast_sincos_s(
+            const float32x4& s,
+            float32x4& sin_out,
+            float32x4& cos_out) noexcept
+        {
+            sincos_s(s, sin_out, cos_out);
+        }
+
+        inline float32x4 fast_exp_s(const float32x4& s) noexcept
+        {
+            return exp_s(s);
+        }
+
+        inline float32x4 fast_log_s(const float32x4& s) noexcept
+        {
+            return log_s(s);
+        }
+#endif
+
+        inline float32x4 fast_sin_s(const float32x4& s) noexcept
+        {
+            float32x4 sin, cos;
+            fast_sincos_s(s, sin, cos);
+            return sin;
+        }
+
+        inline float32x4 fast_cos_s(const float32x4& s) noexcept
+        {
+            float32x4 sin, cos;
+            fast_sincos_s(s, sin, cos);
+            return cos;
+        }
+
+        inline float32x4 fast_pow_ss(
+            const float32x4& bases, const float32x4& exponents) noexcept
+        {
+            return fast_exp_s(
+                float32x4(_mm_mul_ps(fast_log_s(bases), exponents)));
+        }
+
+        inline float32x4 fast_recip_s(const float32x4& s) noexcept
         {
             return _mm_rcp_ps(s);
         }
 
+        inline float32x4 recip_s(const float32x4& s) noexcept
+        {
+            // One Newton-Raphson step, r' = r + r * (1 - x * r), roughly
+            // doubles the 12 bits of the estimate. The step gives NaN where
+            // the estimate is zero or infinite, so those are kept as is.
+            // The FMA version is written out so that it doesn't depend on
+            // whether the compiler contracts the plain one.
+            const __m128 x = s;
+            const __m128 r = _mm_rcp_ps(x);
+#ifdef TUE_FMA
+            const __m128 e = _mm_fnmadd_ps(x, r, _mm_set1_ps(1.0f));
+            const __m128 y = _mm_fmadd_ps(r, e, r);
+#else
+            const __m128 e = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(x, r));
+            const __m128 y = _mm_add_ps(r, _mm_mul_ps(r, e));
+#endif
+            const __m128 mask = _mm_cmpord_ps(y, y);
+            return _mm_or_ps(_mm_and_ps(mask, y), _mm_andnot_ps(mask, r));
+        }
+
+        inline float32x4 precise_recip_s(const float32x4& s) noexcept
+        {
+            return _mm_div_ps(_mm_set1_ps(1.0f), s);
+        }
+
         inline float32x4 sqrt_s(const float32x4& s) noexcept
         {
             return _mm_sqrt_ps(s);
         }
 
-        inline float32x4 rsqrt_s(const float32x4& s) noexcept
+#ifdef TUE_SSE2
+        inline float32x4 cbrt_s(const float32x4& s) noexcept
+        {
+            // An initial estimate from dividing the exponent bits by three,
+            // as in fdlibm's cbrtf(), is refined with Newton's method.
+            const __m128 sign_mask = _mm_set1_ps(binary_float(0x80000000));
+            __m128 x = _mm_andnot_ps(sign_mask, s);
+
+            /* scale up subnormals by 2^24 and the result down by 2^-8 */
+            const __m128 min = _mm_set1_ps(binary_float(0x00800000));
+            __m128 mask = _mm_cmplt_ps(x, min);
+            __m128 scaled = _mm_mul_ps(x, _mm_set1_ps(16777216.0f));
+            x = _mm_or_ps(_mm_and_ps(mask, scaled), _mm_andnot_ps(mask, x));
+            __m128 scale = _mm_or_ps(
+                _mm_and_ps(mask, _mm_set1_ps(0.00390625f)),
+                _mm_andnot_ps(mask, _mm_set1_ps(1.0f)));
+
+            /* the estimate is hx / 3 + B1 */
+            __m128 hx = _mm_mul_ps(
+                _mm_cvtepi32_ps(_mm_castps_si128(x)),
+                _mm_set1_ps(1.0f / 3.0f));
+            __m128 y = _mm_castsi128_ps(_mm_add_epi32(
+                _mm_cvttps_epi32(hx), _mm_set1_epi32(709958130)));
+
+            /* y -= (y - x / y^2) / 3 */
+            const __m128 third = _mm_set1_ps(1.0f / 3.0f);
+            for (int i = 0; i < 3; ++i)
+            {
+                __m128 d = _mm_div_ps(x, _mm_mul_ps(y, y));
+                d = _mm_mul_ps(_mm_sub_ps(y, d), third);
+                y = _mm_sub_ps(y, d);
+            }
+
+            y = _mm_mul_ps(y, scale);
+
+            /* cbrt(0) = 0 and cbrt(inf) = inf */
+            mask = _mm_or_ps(
+                _mm_cmpeq_ps(x, _mm_setzero_ps()),
+                _mm_cmpeq_ps(x, _mm_set1_ps(binary_float(0x7F800000))));
+            y = _mm_or_ps(_mm_and_ps(mask, x), _mm_andnot_ps(mask, y));
+
+            /* restore the sign, and NaN in, NaN out */
+            y = _mm_or_ps(y, _mm_and_ps(s, sign_mask));
+            return _mm_or_ps(y, _mm_cmpunord_ps(s, s));
+        }
+#endif
+
+        inline float32x4 fast_rsqrt_s(const float32x4& s) noexcept
         {
             return _mm_rsqrt_ps(s);
         }
 
+        inline float32x4 rsqrt_s(const float32x4& s) noexcept
+        {
+            // One Newton-Raphson step, r' = r * (1.5 - x / 2 * r^2), with
+            // the same handling of zero and infinite estimates as recip_s().
+            // With FMA it's r' = r + r / 2 * (1 - x * r * r) instead, which
+            // keeps the residual to a single rounding.
+            const __m128 x = s;
+            const __m128 r = _mm_rsqrt_ps(x);
+#ifdef TUE_FMA
+            const __m128 e = _mm_fnmadd_ps(
+                _mm_mul_ps(x, r), r, _mm_set1_ps(1.0f));
+            const __m128 y = _mm_fmadd_ps(
+                _mm_mul_ps(r, _mm_set1_ps(0.5f)), e, r);
+#else
+            const __m128 e = _mm_mul_ps(
+                _mm_mul_ps(x, _mm_set1_ps(0.5f)), _mm_mul_ps(r, r));
+            const __m128 y = _mm_mul_ps(
+                r, _mm_sub_ps(_mm_set1_ps(1.5f), e));
+#endif
+            const __m128 mask = _mm_cmpord_ps(y, y);
+            return _mm_or_ps(_mm_and_ps(mask, y), _mm_andnot_ps(mask, r));
+        }
+
+        inline float32x4 precise_rsqrt_s(const float32x4& s) noexcept
+        {
+            return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(s));
+        }
+
+#ifdef TUE_SSE4_1
+        inline float32x4 floor_s(const float32x4& s) noexcept
+        {
+            return _mm_round_ps(s, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+
+        inline float32x4 ceil_s(const float32x4& s) noexcept
+        {
+            return _mm_round_ps(s, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        }
+
+        inline float32x4 round_s(const float32x4& s) noexcept
+        {
+            // _MM_FROUND_TO_NEAREST_INT rounds halfway cases to even, so add
+            // the largest value below 0.5 with the sign of s and truncate.
+            const auto half = _mm_or_ps(
+                _mm_and_ps(s, float32x4(binary_float(0x80000000))),
+                float32x4(binary_float(0x3EFFFFFF)));
+            return _mm_round_ps(
+                _mm_add_ps(s, half), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+        inline float32x4 trunc_s(const float32x4& s) noexcept
+        {
+            return _mm_round_ps(s, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+#else
+        // Rounds each component of s to the nearest integer, halfway cases
+        // to even, by adding and subtracting 2^23 to its magnitude so
+        // the fraction falls off the end of the significand. Magnitudes at
+        // least that large are already integers and are left alone.
+        inline float32x4 round_even_s(const float32x4& s) noexcept
+        {
+            const auto sign_mask = _mm_set1_ps(-0.0f);
+            const auto magic = _mm_set1_ps(8388608.0f);
+            const auto a = _mm_andnot_ps(sign_mask, s);
+            const auto small = _mm_cmplt_ps(a, magic);
+            const auto r = _mm_sub_ps(_mm_add_ps(a, magic), magic);
+            return _mm_or_ps(
+                _mm_or_ps(_mm_and_ps(small, r), _mm_andnot_ps(small, a)),
+                _mm_and_ps(s, sign_mask));
+        }
+
+        inline float32x4 floor_s(const float32x4& s) noexcept
+        {
+            const auto r = round_even_s(s);
+            const auto one = _mm_set1_ps(1.0f);
+            return _mm_or_ps(
+                _mm_sub_ps(r, _mm_and_ps(_mm_cmpgt_ps(r, s), one)),
+                _mm_and_ps(s, _mm_set1_ps(-0.0f)));
+        }
+
+        inline float32x4 ceil_s(const float32x4& s) noexcept
+        {
+            const auto r = round_even_s(s);
+            const auto one = _mm_set1_ps(1.0f);
+            return _mm_or_ps(
+                _mm_add_ps(r, _mm_and_ps(_mm_cmplt_ps(r, s), one)),
+                _mm_and_ps(s, _mm_set1_ps(-0.0f)));
+        }
+
+        inline float32x4 round_s(const float32x4& s) noexcept
+        {
+            // a - r is exact, so it's exactly 0.5 only in halfway cases.
+            const auto sign_mask = _mm_set1_ps(-0.0f);
+            const auto a = _mm_andnot_ps(sign_mask, s);
+            const auto r = round_even_s(a);
+            const auto up = _mm_cmpeq_ps(
+                _mm_sub_ps(a, r), _mm_set1_ps(0.5f));
+            return _mm_or_ps(
+                _mm_add_ps(r, _mm_and_ps(up, _mm_set1_ps(1.0f))),
+                _mm_and_ps(s, sign_mask));
+        }
+
+        inline float32x4 trunc_s(const float32x4& s) noexcept
+        {
+            const auto sign_mask = _mm_set1_ps(-0.0f);
+            const auto a = _mm_andnot_ps(sign_mask, s);
+            const auto r = round_even_s(a);
+            const auto down = _mm_cmpgt_ps(r, a);
+            return _mm_or_ps(
+                _mm_sub_ps(r, _mm_and_ps(down, _mm_set1_ps(1.0f))),
+                _mm_and_ps(s, sign_mask));
+        }
+#endif
+
+        inline float32x4 fma_sss(
+            const float32x4& s1,
+            const float32x4& s2,
+            const float32x4& s3) noexcept
+        {
+#ifdef TUE_FMA
+            return _mm_fmadd_ps(s1, s2, s3);
+#else
+            return _mm_add_ps(_mm_mul_ps(s1, s2), s3);
+#endif
+        }
+
         inline float32x4 min_ss(
             const float32x4& s1, const float32x4& s2) noexcept
         {
@@ -670,6 +1491,30 @@ namespace tue
             return _mm_max_ps(s1, s2);
         }
 
+        inline float reduce_add_s(const float32x4& s) noexcept
+        {
+            const __m128 x = s;
+            const __m128 y = _mm_add_ps(x, _mm_movehl_ps(x, x));
+            return _mm_cvtss_f32(_mm_add_ss(
+                y, _mm_shuffle_ps(y, y, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+
+        inline float reduce_min_s(const float32x4& s) noexcept
+        {
+            const __m128 x = s;
+            const __m128 y = _mm_min_ps(x, _mm_movehl_ps(x, x));
+            return _mm_cvtss_f32(_mm_min_ss(
+                y, _mm_shuffle_ps(y, y, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+
+        inline float reduce_max_s(const float32x4& s) noexcept
+        {
+            const __m128 x = s;
+            const __m128 y = _mm_max_ps(x, _mm_movehl_ps(x, x));
+            return _mm_cvtss_f32(_mm_max_ss(
+                y, _mm_shuffle_ps(y, y, _MM_SHUFFLE(1, 1, 1, 1))));
+        }
+
         inline float32x4 mask_ss(
             const bool32x4& conditions,
             const float32x4& values) noexcept
@@ -682,9 +1527,13 @@ namespace tue
             const float32x4& values,
             const float32x4& otherwise) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_blendv_ps(otherwise, values, conditions);
+#else
             return _mm_or_ps(
                 _mm_and_ps(conditions, values),
                 _mm_andnot_ps(conditions, otherwise));
+#endif
         }
 
         inline bool32x4 less_ss(
@@ -722,5 +1571,225 @@ namespace tue
         {
             return _mm_cmpneq_ps(lhs, rhs);
         }
+
+        template<int I0, int I1, int I2, int I3>
+        inline float32x4 shuffle_s(
+            const float32x4& s,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+            return _mm_shuffle_ps(s, s, _MM_SHUFFLE(I3, I2, I1, I0));
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline float32x4 shuffle_ss(
+            const float32x4& lhs,
+            const float32x4& rhs,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+            // shufps takes its lower two components from one source and
+            // its upper two from another, so anything else gathers each
+            // pair first.
+            if ((I0 < 4) == (I1 < 4) && (I2 < 4) == (I3 < 4))
+            {
+                return _mm_shuffle_ps(
+                    I0 < 4 ? lhs : rhs,
+                    I2 < 4 ? lhs : rhs,
+                    _MM_SHUFFLE(I3 % 4, I2 % 4, I1 % 4, I0 % 4));
+            }
+
+            const __m128 lo = _mm_shuffle_ps(
+                I0 < 4 ? lhs : rhs,
+                I1 < 4 ? lhs : rhs,
+                _MM_SHUFFLE(I1 % 4, I1 % 4, I0 % 4, I0 % 4));
+            const __m128 hi = _mm_shuffle_ps(
+                I2 < 4 ? lhs : rhs,
+                I3 < 4 ? lhs : rhs,
+                _MM_SHUFFLE(I3 % 4, I3 % 4, I2 % 4, I2 % 4));
+            return _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+        }
+
+        template<int I>
+        inline float extract_s(
+            const float32x4& s, std::integral_constant<int, I>) noexcept
+        {
+            return _mm_cvtss_f32(_mm_shuffle_ps(s, s, I));
+        }
+
+        template<int I>
+        inline float32x4 insert_s(
+            const float32x4& s,
+            float x,
+            std::integral_constant<int, I>) noexcept
+        {
+#ifdef TUE_SSE4_1
+            return _mm_insert_ps(s, _mm_set_ss(x), I << 4);
+#else
+            // Swap component I into component 0, replace it, then swap it
+            // back.
+            constexpr int swap = _MM_SHUFFLE(
+                I == 3 ? 0 : 3, I == 2 ? 0 : 2, I == 1 ? 0 : 1, I);
+            const __m128 t = _mm_move_ss(
+                _mm_shuffle_ps(s, s, swap), _mm_set_ss(x));
+            return _mm_shuffle_ps(t, t, swap);
+#endif
+        }
+
+        inline float32x4 interleave_lo_ss(
+            const float32x4& lhs, const float32x4& rhs) noexcept
+        {
+            return _mm_unpacklo_ps(lhs, rhs);
+        }
+
+        inline float32x4 interleave_hi_ss(
+            const float32x4& lhs, const float32x4& rhs) noexcept
+        {
+            return _mm_unpackhi_ps(lhs, rhs);
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline bool32x4 shuffle_s(
+            const bool32x4& s,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+            return _mm_shuffle_ps(s, s, _MM_SHUFFLE(I3, I2, I1, I0));
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline bool32x4 shuffle_ss(
+            const bool32x4& lhs,
+            const bool32x4& rhs,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+            return __m128(tue::detail_::shuffle_ss(
+                float32x4(__m128(lhs)),
+                float32x4(__m128(rhs)),
+                std::integer_sequence<int, I0, I1, I2, I3>()));
+        }
+
+        inline bool32x4 interleave_lo_ss(
+            const bool32x4& lhs, const bool32x4& rhs) noexcept
+        {
+            return _mm_unpacklo_ps(lhs, rhs);
+        }
+
+        inline bool32x4 interleave_hi_ss(
+            const bool32x4& lhs, const bool32x4& rhs) noexcept
+        {
+            return _mm_unpackhi_ps(lhs, rhs);
+        }
+
+        // Deinterleaves `{ x0, y0, x1, y1, ... }` with two shuffles.
+        inline void load_soa2(
+            const float* aos, float32x4& x, float32x4& y) noexcept
+        {
+            const __m128 a = _mm_loadu_ps(aos);
+            const __m128 b = _mm_loadu_ps(aos + 4);
+            x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        }
+
+        // a = { x0, y0, z0, x1 }, b = { y1, z1, x2, y2 }, and
+        // c = { z2, x3, y3, z3 }. Each output takes two components from
+        // each of two registers per shuffle.
+        inline void load_soa3(
+            const float* aos,
+            float32x4& x, float32x4& y, float32x4& z) noexcept
+        {
+            const __m128 a = _mm_loadu_ps(aos);
+            const __m128 b = _mm_loadu_ps(aos + 4);
+            const __m128 c = _mm_loadu_ps(aos + 8);
+
+            const __m128 b2c1 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2));
+            x = _mm_shuffle_ps(a, b2c1, _MM_SHUFFLE(3, 0, 3, 0));
+
+            const __m128 a1b0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+            const __m128 b3c2 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+            y = _mm_shuffle_ps(a1b0, b3c2, _MM_SHUFFLE(2, 0, 2, 0));
+
+            const __m128 a2b1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+            z = _mm_shuffle_ps(a2b1, c, _MM_SHUFFLE(3, 0, 2, 0));
+        }
+
+        // The same network as _MM_TRANSPOSE4_PS.
+        inline void transpose4x4(
+            __m128& r0, __m128& r1, __m128& r2, __m128& r3) noexcept
+        {
+            const __m128 t0 = _mm_unpacklo_ps(r0, r1);
+            const __m128 t1 = _mm_unpacklo_ps(r2, r3);
+            const __m128 t2 = _mm_unpackhi_ps(r0, r1);
+            const __m128 t3 = _mm_unpackhi_ps(r2, r3);
+            r0 = _mm_movelh_ps(t0, t1);
+            r1 = _mm_movehl_ps(t1, t0);
+            r2 = _mm_movelh_ps(t2, t3);
+            r3 = _mm_movehl_ps(t3, t2);
+        }
+
+        inline void load_soa4(
+            const float* aos,
+            std::size_t stride,
+            float32x4& x, float32x4& y, float32x4& z, float32x4& w) noexcept
+        {
+            __m128 r0 = _mm_loadu_ps(aos);
+            __m128 r1 = _mm_loadu_ps(aos + stride);
+            __m128 r2 = _mm_loadu_ps(aos + stride * 2);
+            __m128 r3 = _mm_loadu_ps(aos + stride * 3);
+            tue::detail_::transpose4x4(r0, r1, r2, r3);
+            x = r0;
+            y = r1;
+            z = r2;
+            w = r3;
+        }
+
+        inline void store_aos2(
+            float* aos, const float32x4& x, const float32x4& y) noexcept
+        {
+            _mm_storeu_ps(aos, _mm_unpacklo_ps(x, y));
+            _mm_storeu_ps(aos + 4, _mm_unpackhi_ps(x, y));
+        }
+
+        // The inverse of load_soa3(): each output register gathers its
+        // pairs of components, then picks one of each pair.
+        inline void store_aos3(
+            float* aos,
+            const float32x4& x,
+            const float32x4& y,
+            const float32x4& z) noexcept
+        {
+            const __m128 x0y0 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0));
+            const __m128 z0x1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+            _mm_storeu_ps(
+                aos, _mm_shuffle_ps(x0y0, z0x1, _MM_SHUFFLE(2, 0, 2, 0)));
+
+            const __m128 y1z1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+            const __m128 x2y2 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));
+            _mm_storeu_ps(
+                aos + 4,
+                _mm_shuffle_ps(y1z1, x2y2, _MM_SHUFFLE(2, 0, 2, 0)));
+
+            const __m128 z2x3 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+            const __m128 y3z3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+            _mm_storeu_ps(
+                aos + 8,
+                _mm_shuffle_ps(z2x3, y3z3, _MM_SHUFFLE(2, 0, 2, 0)));
+        }
+
+        inline void store_aos4(
+            float* aos,
+            std::size_t stride,
+            const float32x4& x,
+            const float32x4& y,
+            const float32x4& z,
+            const float32x4& w) noexcept
+        {
+            __m128 r0 = x;
+            __m128 r1 = y;
+            __m128 r2 = z;
+            __m128 r3 = w;
+            tue::detail_::transpose4x4(r0, r1, r2, r3);
+            _mm_storeu_ps(aos, r0);
+            _mm_storeu_ps(aos + stride, r1);
+            _mm_storeu_ps(aos + stride * 2, r2);
+            _mm_storeu_ps(aos + stride * 3, r3);
+        }
     }
 }
@@ -10,9 +10,15 @@
 
 #include <emmintrin.h>
 
+#include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "../../../simd.hpp"
+
+#ifdef TUE_SSE4_1
+#include <smmintrin.h>
+#endif
 #include "../../../sized_bool.hpp"
 
 namespace tue
@@ -115,6 +121,26 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool16x8 gather(
+            const bool16* base, const simd<I, 8>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool16x8 gather(
+            const bool16* base,
+            const simd<I, 8>& indices,
+            const bool16x8& conditions) noexcept;
+
+        inline static bool16x8 load_partial(
+            const bool16* data, int count) noexcept;
+
+        inline static bool16x8 maskload(
+            const bool16* data, const bool16x8& conditions) noexcept;
+
         void store(bool16* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -125,6 +151,30 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void stream(bool16* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool16* base, const simd<I, 8>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool16* base,
+            const simd<I, 8>& indices,
+            const bool16x8& conditions) const noexcept;
+
+        inline void store_partial(bool16* data, int count) const noexcept;
+
+        inline void maskstore(
+            bool16* data, const bool16x8& conditions) const noexcept;
+
         const bool16* data() const noexcept
         {
             return reinterpret_cast<const bool16*>(&underlying_);
@@ -152,6 +202,74 @@ namespace tue
         return __m128i(s);
     }
 
+    template<typename I, typename>
+    inline bool16x8 bool16x8::gather(
+        const bool16* base, const simd<I, 8>& indices) noexcept
+    {
+        return tue::detail_::gather_components<bool16x8>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline bool16x8 bool16x8::gather(
+        const bool16* base,
+        const simd<I, 8>& indices,
+        const bool16x8& conditions) noexcept
+    {
+        return tue::detail_::gather_components<bool16x8>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void bool16x8::scatter(
+        bool16* base, const simd<I, 8>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void bool16x8::scatter(
+        bool16* base,
+        const simd<I, 8>& indices,
+        const bool16x8& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline bool16x8 bool16x8::load_partial(
+        const bool16* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm_cmplt_epi16(
+                _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7),
+                _mm_set1_epi16(static_cast<short>(count))));
+    }
+
+    inline bool16x8 bool16x8::maskload(
+        const bool16* data, const bool16x8& conditions) noexcept
+    {
+        if (_mm_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(bool16x8)))
+        {
+            return _mm_and_si128(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<bool16x8>(data, conditions);
+    }
+
+    inline void bool16x8::store_partial(bool16* data, int count) const noexcept
+    {
+        tue::detail_::storeu_partial_si128(data, underlying_, count * 2);
+    }
+
+    inline void bool16x8::maskstore(
+        bool16* data, const bool16x8& conditions) const noexcept
+    {
+        _mm_maskmoveu_si128(
+            underlying_,
+            conditions,
+            reinterpret_cast<char*>(data));
+    }
+
     namespace detail_
     {
         inline bool16x8 bitwise_not_operator_s(
@@ -220,9 +338,13 @@ namespace tue
             const bool16x8& values,
             const bool16x8& otherwise) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
         inline bool16x8 equal_ss(
@@ -236,5 +358,66 @@ namespace tue
         {
             return _mm_xor_si128(_mm_cmpeq_epi16(lhs, rhs), bool16x8(true16));
         }
+
+        inline std::uint64_t movemask_s(const bool16x8& s) noexcept
+        {
+            // Narrow each component to a byte first, so there's one bit per
+            // component.
+            return static_cast<std::uint64_t>(
+                _mm_movemask_epi8(_mm_packs_epi16(s, _mm_setzero_si128())));
+        }
+
+        inline bool any_s(const bool16x8& s) noexcept
+        {
+            return _mm_movemask_epi8(s) != 0;
+        }
+
+        inline bool all_s(const bool16x8& s) noexcept
+        {
+            return _mm_movemask_epi8(s) == 0xFFFF;
+        }
+
+        inline bool none_s(const bool16x8& s) noexcept
+        {
+            return _mm_movemask_epi8(s) == 0;
+        }
+
+#ifdef TUE_SSE4_1
+        template<int... I>
+        inline bool16x8 shuffle_s(
+            const bool16x8& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return _mm_shuffle_epi8(s, _mm_setr_epi16(
+                static_cast<short>(I * 0x0202 + 0x0100)...));
+        }
+
+        template<int... I>
+        inline bool16x8 shuffle_ss(
+            const bool16x8& lhs,
+            const bool16x8& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            // pshufb zeroes each component whose control byte has its
+            // top bit set, so each source only fills in its own components.
+            return _mm_or_si128(
+                _mm_shuffle_epi8(lhs, _mm_setr_epi16(static_cast<short>(
+                    I < 8 ? I * 0x0202 + 0x0100 : 0x8080)...)),
+                _mm_shuffle_epi8(rhs, _mm_setr_epi16(static_cast<short>(
+                    I < 8 ? 0x8080 : (I - 8) * 0x0202 + 0x0100)...)));
+        }
+#endif
+
+        inline bool16x8 interleave_lo_ss(
+            const bool16x8& lhs, const bool16x8& rhs) noexcept
+        {
+            return _mm_unpacklo_epi16(lhs, rhs);
+        }
+
+        inline bool16x8 interleave_hi_ss(
+            const bool16x8& lhs, const bool16x8& rhs) noexcept
+        {
+            return _mm_unpackhi_epi16(lhs, rhs);
+        }
     }
 }
@@ -10,11 +10,21 @@
 
 #include <emmintrin.h>
 
+#include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "../../../simd.hpp"
+
+#ifdef TUE_SSE4_1
+#include <smmintrin.h>
+#endif
 #include "../../../sized_bool.hpp"
 
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
 namespace tue
 {
     template<>
@@ -115,6 +125,26 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool64x2 gather(
+            const bool64* base, const simd<I, 2>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool64x2 gather(
+            const bool64* base,
+            const simd<I, 2>& indices,
+            const bool64x2& conditions) noexcept;
+
+        inline static bool64x2 load_partial(
+            const bool64* data, int count) noexcept;
+
+        inline static bool64x2 maskload(
+            const bool64* data, const bool64x2& conditions) noexcept;
+
         void store(bool64* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -125,6 +155,30 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void stream(bool64* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool64* base, const simd<I, 2>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool64* base,
+            const simd<I, 2>& indices,
+            const bool64x2& conditions) const noexcept;
+
+        inline void store_partial(bool64* data, int count) const noexcept;
+
+        inline void maskstore(
+            bool64* data, const bool64x2& conditions) const noexcept;
+
         const bool64* data() const noexcept
         {
             return reinterpret_cast<const bool64*>(&underlying_);
@@ -139,6 +193,92 @@ namespace tue
 
 namespace tue
 {
+    template<typename I, typename>
+    inline bool64x2 bool64x2::gather(
+        const bool64* base, const simd<I, 2>& indices) noexcept
+    {
+        return tue::detail_::gather_components<bool64x2>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline bool64x2 bool64x2::gather(
+        const bool64* base,
+        const simd<I, 2>& indices,
+        const bool64x2& conditions) noexcept
+    {
+        return tue::detail_::gather_components<bool64x2>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void bool64x2::scatter(
+        bool64* base, const simd<I, 2>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void bool64x2::scatter(
+        bool64* base,
+        const simd<I, 2>& indices,
+        const bool64x2& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline bool64x2 bool64x2::load_partial(
+        const bool64* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm_cmplt_epi32(
+                _mm_setr_epi32(0, 0, 1, 1),
+                _mm_set1_epi32(count)));
+    }
+
+    inline bool64x2 bool64x2::maskload(
+        const bool64* data, const bool64x2& conditions) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm_maskload_epi64(
+            reinterpret_cast<const long long*>(data), conditions);
+#else
+        if (_mm_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(bool64x2)))
+        {
+            return _mm_and_si128(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<bool64x2>(data, conditions);
+#endif
+    }
+
+    inline void bool64x2::store_partial(bool64* data, int count) const noexcept
+    {
+#ifdef TUE_AVX2
+        maskstore(
+            data,
+            _mm_cmplt_epi32(
+                _mm_setr_epi32(0, 0, 1, 1),
+                _mm_set1_epi32(count)));
+#else
+        tue::detail_::storeu_partial_si128(data, underlying_, count * 8);
+#endif
+    }
+
+    inline void bool64x2::maskstore(
+        bool64* data, const bool64x2& conditions) const noexcept
+    {
+#ifdef TUE_AVX2
+        _mm_maskstore_epi64(
+            reinterpret_cast<long long*>(data), conditions, underlying_);
+#else
+        _mm_maskmoveu_si128(
+            underlying_,
+            conditions,
+            reinterpret_cast<char*>(data));
+#endif
+    }
+
     namespace detail_
     {
         inline bool64x2 bitwise_not_operator_s(
@@ -207,18 +347,26 @@ namespace tue
             const bool64x2& values,
             const bool64x2& otherwise) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
         inline bool64x2 equal_ss(
             const bool64x2& lhs, const bool64x2& rhs) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_cmpeq_epi64(lhs, rhs);
+#else
             const auto cmp = _mm_cmpeq_epi32(lhs, rhs);
             const auto hi = _mm_shuffle_epi32(cmp, _MM_SHUFFLE(3, 3, 1, 1));
             const auto lo = _mm_shuffle_epi32(cmp, _MM_SHUFFLE(2, 2, 0, 0));
             return _mm_and_si128(hi, lo);
+#endif
         }
 
         inline bool64x2 not_equal_ss(
@@ -226,5 +374,58 @@ namespace tue
         {
             return _mm_xor_si128(equal_ss(lhs, rhs), bool64x2(true64));
         }
+
+        inline std::uint64_t movemask_s(const bool64x2& s) noexcept
+        {
+            return static_cast<std::uint64_t>(_mm_movemask_pd(s));
+        }
+
+        inline bool any_s(const bool64x2& s) noexcept
+        {
+            return _mm_movemask_pd(s) != 0;
+        }
+
+        inline bool all_s(const bool64x2& s) noexcept
+        {
+            return _mm_movemask_pd(s) == 0x3;
+        }
+
+        inline bool none_s(const bool64x2& s) noexcept
+        {
+            return _mm_movemask_pd(s) == 0;
+        }
+
+        template<int I0, int I1>
+        inline bool64x2 shuffle_s(
+            const bool64x2& s,
+            std::integer_sequence<int, I0, I1>) noexcept
+        {
+            return _mm_shuffle_epi32(
+                s, _MM_SHUFFLE(2*I1 + 1, 2*I1, 2*I0 + 1, 2*I0));
+        }
+
+        template<int I0, int I1>
+        inline bool64x2 shuffle_ss(
+            const bool64x2& lhs,
+            const bool64x2& rhs,
+            std::integer_sequence<int, I0, I1>) noexcept
+        {
+            return _mm_castpd_si128(_mm_shuffle_pd(
+                _mm_castsi128_pd(I0 < 2 ? lhs : rhs),
+                _mm_castsi128_pd(I1 < 2 ? lhs : rhs),
+                (I0 % 2) | ((I1 % 2) << 1)));
+        }
+
+        inline bool64x2 interleave_lo_ss(
+            const bool64x2& lhs, const bool64x2& rhs) noexcept
+        {
+            return _mm_unpacklo_epi64(lhs, rhs);
+        }
+
+        inline bool64x2 interleave_hi_ss(
+            const bool64x2& lhs, const bool64x2& rhs) noexcept
+        {
+            return _mm_unpackhi_epi64(lhs, rhs);
+        }
     }
 }
@@ -10,9 +10,15 @@
 
 #include <emmintrin.h>
 
+#include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "../../../simd.hpp"
+
+#ifdef TUE_SSE4_1
+#include <smmintrin.h>
+#endif
 #include "../../../sized_bool.hpp"
 
 namespace tue
@@ -124,6 +130,26 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool8x16 gather(
+            const bool8* base, const simd<I, 16>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static bool8x16 gather(
+            const bool8* base,
+            const simd<I, 16>& indices,
+            const bool8x16& conditions) noexcept;
+
+        inline static bool8x16 load_partial(
+            const bool8* data, int count) noexcept;
+
+        inline static bool8x16 maskload(
+            const bool8* data, const bool8x16& conditions) noexcept;
+
         void store(bool8* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -134,6 +160,30 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void stream(bool8* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool8* base, const simd<I, 16>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            bool8* base,
+            const simd<I, 16>& indices,
+            const bool8x16& conditions) const noexcept;
+
+        inline void store_partial(bool8* data, int count) const noexcept;
+
+        inline void maskstore(
+            bool8* data, const bool8x16& conditions) const noexcept;
+
         const bool8* data() const noexcept
         {
             return reinterpret_cast<const bool8*>(&underlying_);
@@ -161,6 +211,75 @@ namespace tue
         return __m128i(s);
     }
 
+    template<typename I, typename>
+    inline bool8x16 bool8x16::gather(
+        const bool8* base, const simd<I, 16>& indices) noexcept
+    {
+        return tue::detail_::gather_components<bool8x16>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline bool8x16 bool8x16::gather(
+        const bool8* base,
+        const simd<I, 16>& indices,
+        const bool8x16& conditions) noexcept
+    {
+        return tue::detail_::gather_components<bool8x16>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void bool8x16::scatter(
+        bool8* base, const simd<I, 16>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void bool8x16::scatter(
+        bool8* base,
+        const simd<I, 16>& indices,
+        const bool8x16& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline bool8x16 bool8x16::load_partial(
+        const bool8* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm_cmplt_epi8(
+                _mm_setr_epi8(
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                _mm_set1_epi8(static_cast<char>(count))));
+    }
+
+    inline bool8x16 bool8x16::maskload(
+        const bool8* data, const bool8x16& conditions) noexcept
+    {
+        if (_mm_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(bool8x16)))
+        {
+            return _mm_and_si128(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<bool8x16>(data, conditions);
+    }
+
+    inline void bool8x16::store_partial(bool8* data, int count) const noexcept
+    {
+        tue::detail_::storeu_partial_si128(data, underlying_, count);
+    }
+
+    inline void bool8x16::maskstore(
+        bool8* data, const bool8x16& conditions) const noexcept
+    {
+        _mm_maskmoveu_si128(
+            underlying_,
+            conditions,
+            reinterpret_cast<char*>(data));
+    }
+
     namespace detail_
     {
         inline bool8x16 bitwise_not_operator_s(
@@ -229,9 +348,13 @@ namespace tue
             const bool8x16& values,
             const bool8x16& otherwise) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
         inline bool8x16 equal_ss(
@@ -245,5 +368,62 @@ namespace tue
         {
             return _mm_xor_si128(_mm_cmpeq_epi8(lhs, rhs), bool8x16(true8));
         }
+
+        inline std::uint64_t movemask_s(const bool8x16& s) noexcept
+        {
+            return static_cast<std::uint64_t>(_mm_movemask_epi8(s));
+        }
+
+        inline bool any_s(const bool8x16& s) noexcept
+        {
+            return _mm_movemask_epi8(s) != 0;
+        }
+
+        inline bool all_s(const bool8x16& s) noexcept
+        {
+            return _mm_movemask_epi8(s) == 0xFFFF;
+        }
+
+        inline bool none_s(const bool8x16& s) noexcept
+        {
+            return _mm_movemask_epi8(s) == 0;
+        }
+
+#ifdef TUE_SSE4_1
+        template<int... I>
+        inline bool8x16 shuffle_s(
+            const bool8x16& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return _mm_shuffle_epi8(s, _mm_setr_epi8(static_cast<char>(I)...));
+        }
+
+        template<int... I>
+        inline bool8x16 shuffle_ss(
+            const bool8x16& lhs,
+            const bool8x16& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            // pshufb zeroes each component whose control byte has its
+            // top bit set, so each source only fills in its own components.
+            return _mm_or_si128(
+                _mm_shuffle_epi8(lhs, _mm_setr_epi8(
+                    static_cast<char>(I < 16 ? I : -128)...)),
+                _mm_shuffle_epi8(rhs, _mm_setr_epi8(
+                    static_cast<char>(I < 16 ? -128 : I - 16)...)));
+        }
+#endif
+
+        inline bool8x16 interleave_lo_ss(
+            const bool8x16& lhs, const bool8x16& rhs) noexcept
+        {
+            return _mm_unpacklo_epi8(lhs, rhs);
+        }
+
+        inline bool8x16 interleave_hi_ss(
+            const bool8x16& lhs, const bool8x16& rhs) noexcept
+        {
+            return _mm_unpackhi_epi8(lhs, rhs);
+        }
     }
 }
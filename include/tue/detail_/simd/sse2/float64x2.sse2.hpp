@@ -35,10 +35,20 @@
 #include <xmmintrin.h>
 #include <emmintrin.h>
 
+#include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "../../../simd.hpp"
 
+#ifdef TUE_SSE4_1
+#include <smmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
 namespace tue
 {
     template<>
@@ -128,6 +138,26 @@ namespace tue
             return _mm_loadu_pd(data);
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static float64x2 gather(
+            const double* base, const simd<I, 2>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static float64x2 gather(
+            const double* base,
+            const simd<I, 2>& indices,
+            const bool64x2& conditions) noexcept;
+
+        inline static float64x2 load_partial(
+            const double* data, int count) noexcept;
+
+        inline static float64x2 maskload(
+            const double* data, const bool64x2& conditions) noexcept;
+
         void store(double* data) const noexcept
         {
             _mm_store_pd(data, underlying_);
@@ -138,6 +168,30 @@ namespace tue
             _mm_storeu_pd(data, underlying_);
         }
 
+        void stream(double* data) const noexcept
+        {
+            _mm_stream_pd(data, underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            double* base, const simd<I, 2>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            double* base,
+            const simd<I, 2>& indices,
+            const bool64x2& conditions) const noexcept;
+
+        inline void store_partial(double* data, int count) const noexcept;
+
+        inline void maskstore(
+            double* data, const bool64x2& conditions) const noexcept;
+
         const double* data() const noexcept
         {
             return reinterpret_cast<const double*>(&underlying_);
@@ -151,9 +205,107 @@ namespace tue
 }
 
 #include "bool64x2.sse2.hpp"
+#include "../sse/float32x4.sse.hpp"
 
 namespace tue
 {
+    template<typename I, typename>
+    inline float64x2 float64x2::gather(
+        const double* base, const simd<I, 2>& indices) noexcept
+    {
+        // Two scalar loads are at least as fast as a gather instruction.
+        const auto idata = reinterpret_cast<const I*>(&indices);
+        return _mm_setr_pd(base[idata[0]], base[idata[1]]);
+    }
+
+    template<typename I, typename>
+    inline float64x2 float64x2::gather(
+        const double* base,
+        const simd<I, 2>& indices,
+        const bool64x2& conditions) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm_mask_i32gather_pd(
+            _mm_setzero_pd(),
+            base,
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&indices)),
+            _mm_castsi128_pd(conditions),
+            8);
+#else
+        return tue::detail_::gather_components<float64x2>(
+            base, indices, conditions);
+#endif
+    }
+
+    template<typename I, typename>
+    inline void float64x2::scatter(
+        double* base, const simd<I, 2>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void float64x2::scatter(
+        double* base,
+        const simd<I, 2>& indices,
+        const bool64x2& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline float64x2 float64x2::load_partial(
+        const double* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm_cmplt_epi32(
+                _mm_setr_epi32(0, 0, 1, 1),
+                _mm_set1_epi32(count)));
+    }
+
+    inline float64x2 float64x2::maskload(
+        const double* data, const bool64x2& conditions) noexcept
+    {
+#ifdef TUE_AVX
+        return _mm_maskload_pd(data, conditions);
+#else
+        if (_mm_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(float64x2)))
+        {
+            return _mm_and_pd(loadu(data), _mm_castsi128_pd(conditions));
+        }
+        return tue::detail_::maskload_components<float64x2>(data, conditions);
+#endif
+    }
+
+    inline void float64x2::store_partial(
+        double* data, int count) const noexcept
+    {
+#ifdef TUE_AVX
+        maskstore(
+            data,
+            _mm_cmplt_epi32(
+                _mm_setr_epi32(0, 0, 1, 1),
+                _mm_set1_epi32(count)));
+#else
+        tue::detail_::storeu_partial_si128(
+            data, _mm_castpd_si128(underlying_), count * 8);
+#endif
+    }
+
+    inline void float64x2::maskstore(
+        double* data, const bool64x2& conditions) const noexcept
+    {
+#ifdef TUE_AVX
+        _mm_maskstore_pd(data, conditions, underlying_);
+#else
+        _mm_maskmoveu_si128(
+            _mm_castpd_si128(underlying_),
+            conditions,
+            reinterpret_cast<char*>(data));
+#endif
+    }
+
     namespace detail_
     {
         inline float64x2 unary_plus_operator_s(const float64x2& s) noexcept
@@ -176,7 +328,7 @@ namespace tue
         inline float64x2 unary_minus_operator_s(const float64x2& s) noexcept
         {
             return _mm_xor_pd(
-                s, float64x2(binary_double(0x8000000000000000ull)));
+                s, _mm_set1_pd(-0.0));
         }
 
         inline float64x2& pre_decrement_operator_s(float64x2& s) noexcept
@@ -251,13 +403,42 @@ namespace tue
             return _mm_movemask_pd(_mm_cmpneq_pd(lhs, rhs)) != 0;
         }
 
+        // Recomputes the lanes of `sin_out` and `cos_out` whose bits are
+        // set in `lanes` with the C library, for arguments too big for the
+        // vector kernels' range reduction.
+        inline void sincos_large_pd(
+            const float64x2& s,
+            int lanes,
+            float64x2& sin_out,
+            float64x2& cos_out) noexcept
+        {
+            alignas(16) double x[2], sin[2], cos[2];
+            _mm_store_pd(x, s);
+            _mm_store_pd(sin, sin_out);
+            _mm_store_pd(cos, cos_out);
+            for (int i = 0; i < 2; ++i)
+            {
+                if (lanes & (1 << i))
+                {
+                    sin[i] = tue::math::sin(x[i]);
+                    cos[i] = tue::math::cos(x[i]);
+                }
+            }
+            sin_out = _mm_load_pd(sin);
+            cos_out = _mm_load_pd(cos);
+        }
+
         inline void sincos_s(
             const float64x2& s,
             float64x2& sin_out,
             float64x2& cos_out) noexcept
         {
             // This function's implementation is based on Julien Pommier's
-            // sincos_ps(). See the top of this file for details.
+            // sincos_ps(), with the reduction constants and polynomials
+            // replaced by the double precision ones from the cephes sin.c
+            // sources. The reduction is accurate for |x| up to 2^30, and
+            // j below fits in 32 bits there, so bigger finite arguments go
+            // through sincos_large_pd() instead.
             __m128d x = s;
 
             __m128d xmm1, xmm2, xmm3 = _mm_setzero_pd(), sign_bit_sin, y;
@@ -274,8 +455,14 @@ namespace tue
                 sign_bit_sin,
                 _mm_set1_pd(binary_double(0x8000000000000000ull)));
 
+            __m128d invalid_mask = _mm_cmpnlt_pd(
+                x, _mm_set1_pd(binary_double(0x7FF0000000000000ull)));
+
+            const int large_lanes = _mm_movemask_pd(_mm_andnot_pd(
+                invalid_mask, _mm_cmpgt_pd(x, _mm_set1_pd(1073741824.0))));
+
             /* scale by 4/Pi */
-            y = _mm_mul_pd(x, _mm_set1_pd(1.27323954473516));
+            y = _mm_mul_pd(x, _mm_set1_pd(1.27323954473516268615));
 
             /* store the integer part of y in emm2 */
             emm2 = _mm_cvttpd_epi32(y);
@@ -303,9 +490,9 @@ namespace tue
 
             /* The magic pass: "Extended precision modular arithmetic"
                x = ((x - y * DP1) - y * DP2) - y * DP3; */
-            xmm1 = _mm_set1_pd(-0.78515625);
-            xmm2 = _mm_set1_pd(-2.4187564849853515625e-4);
-            xmm3 = _mm_set1_pd(-3.77489497744594108e-8);
+            xmm1 = _mm_set1_pd(-7.85398125648498535156e-1);
+            xmm2 = _mm_set1_pd(-3.77489470793079817668e-8);
+            xmm3 = _mm_set1_pd(-2.69515142907905952645e-15);
             xmm1 = _mm_mul_pd(y, xmm1);
             xmm2 = _mm_mul_pd(y, xmm2);
             xmm3 = _mm_mul_pd(y, xmm3);
@@ -323,12 +510,18 @@ namespace tue
 
             /* Evaluate the first polynom  (0 <= x <= Pi/4) */
             __m128d z = _mm_mul_pd(x,x);
-            y = _mm_set1_pd(2.443315711809948e-5);
+            y = _mm_set1_pd(-1.13585365213876817300e-11);
 
             y = _mm_mul_pd(y, z);
-            y = _mm_add_pd(y, _mm_set1_pd(-1.388731625493765e-3));
+            y = _mm_add_pd(y, _mm_set1_pd(2.08757008419747316778e-9));
             y = _mm_mul_pd(y, z);
-            y = _mm_add_pd(y, _mm_set1_pd(4.166664568298827e-2));
+            y = _mm_add_pd(y, _mm_set1_pd(-2.75573141792967388112e-7));
+            y = _mm_mul_pd(y, z);
+            y = _mm_add_pd(y, _mm_set1_pd(2.48015872888517045348e-5));
+            y = _mm_mul_pd(y, z);
+            y = _mm_add_pd(y, _mm_set1_pd(-1.38888888888730564116e-3));
+            y = _mm_mul_pd(y, z);
+            y = _mm_add_pd(y, _mm_set1_pd(4.16666666666665929218e-2));
             y = _mm_mul_pd(y, z);
             y = _mm_mul_pd(y, z);
             __m128d tmp = _mm_mul_pd(z, _mm_set1_pd(0.5));
@@ -336,11 +529,17 @@ namespace tue
             y = _mm_add_pd(y, _mm_set1_pd(1.0));
 
             /* Evaluate the second polynom  (Pi/4 <= x <= 0) */
-            __m128d y2 = _mm_set1_pd(-1.9515295891e-4);
+            __m128d y2 = _mm_set1_pd(1.58962301576546568060e-10);
             y2 = _mm_mul_pd(y2, z);
-            y2 = _mm_add_pd(y2, _mm_set1_pd(8.3321608736e-3));
+            y2 = _mm_add_pd(y2, _mm_set1_pd(-2.50507477628578072866e-8));
             y2 = _mm_mul_pd(y2, z);
-            y2 = _mm_add_pd(y2, _mm_set1_pd(-1.6666654611e-1));
+            y2 = _mm_add_pd(y2, _mm_set1_pd(2.75573136213857245213e-6));
+            y2 = _mm_mul_pd(y2, z);
+            y2 = _mm_add_pd(y2, _mm_set1_pd(-1.98412698295895385996e-4));
+            y2 = _mm_mul_pd(y2, z);
+            y2 = _mm_add_pd(y2, _mm_set1_pd(8.33333333332211858878e-3));
+            y2 = _mm_mul_pd(y2, z);
+            y2 = _mm_add_pd(y2, _mm_set1_pd(-1.66666666666666307295e-1));
             y2 = _mm_mul_pd(y2, z);
             y2 = _mm_mul_pd(y2, x);
             y2 = _mm_add_pd(y2, x);
@@ -356,8 +555,17 @@ namespace tue
             xmm2 = _mm_add_pd(y,y2);
 
             /* update the sign */
-            sin_out = _mm_xor_pd(xmm1, sign_bit_sin);
-            cos_out = _mm_xor_pd(xmm2, sign_bit_cos);
+            xmm1 = _mm_xor_pd(xmm1, sign_bit_sin);
+            xmm2 = _mm_xor_pd(xmm2, sign_bit_cos);
+
+            /* sin(inf) and cos(inf) are NaN */
+            sin_out = _mm_or_pd(xmm1, invalid_mask);
+            cos_out = _mm_or_pd(xmm2, invalid_mask);
+
+            if (large_lanes != 0)
+            {
+                sincos_large_pd(s, large_lanes, sin_out, cos_out);
+            }
         }
 
         inline float64x2 sin_s(const float64x2& s) noexcept
@@ -374,152 +582,628 @@ namespace tue
             return cos;
         }
 
-        inline float64x2 exp_s(const float64x2& s) noexcept
+        inline float64x2 tan_s(const float64x2& s) noexcept
         {
-            // This function's implementation is based on Julien Pommier's
-            // exp_ps(). See the top of this file for details.
+            float64x2 sin, cos;
+            sincos_s(s, sin, cos);
+            return _mm_div_pd(sin, cos);
+        }
+
+        inline float64x2 atan_s(const float64x2& s) noexcept
+        {
+            // This function's implementation is based on atan() from the
+            // cephes library.
             __m128d x = s;
 
-            __m128d tmp = _mm_setzero_pd(), fx;
-            __m128i emm0;
+            const __m128d sign_mask = _mm_set1_pd(
+                binary_double(0x8000000000000000ull));
+            const __m128d one = _mm_set1_pd(1.0);
+
+            /* extract the sign bit and take the absolute value */
+            __m128d sign_bit = _mm_and_pd(x, sign_mask);
+            x = _mm_andnot_pd(sign_mask, x);
+
+            /* range reduction:
+               if (x > tan(3*pi/8)) { y = pi/2; x = -1/x; }
+               else if (x > 0.66) { y = pi/4; x = (x-1)/(x+1); }
+               else { y = 0; } */
+            __m128d big = _mm_cmpgt_pd(x, _mm_set1_pd(2.41421356237309504880));
+            __m128d mid = _mm_andnot_pd(
+                big, _mm_cmpgt_pd(x, _mm_set1_pd(0.66)));
+            __m128d small = _mm_andnot_pd(_mm_or_pd(big, mid), x);
+
+            __m128d num = _mm_or_pd(
+                _mm_or_pd(
+                    _mm_and_pd(big, _mm_set1_pd(-1.0)),
+                    _mm_and_pd(mid, _mm_sub_pd(x, one))),
+                small);
+            __m128d den = _mm_or_pd(
+                _mm_or_pd(
+                    _mm_and_pd(big, x),
+                    _mm_and_pd(mid, _mm_add_pd(x, one))),
+                _mm_andnot_pd(_mm_or_pd(big, mid), one));
+            x = _mm_div_pd(num, den);
+
+            __m128d y = _mm_or_pd(
+                _mm_and_pd(big, _mm_set1_pd(1.57079632679489661923)),
+                _mm_and_pd(mid, _mm_set1_pd(0.78539816339744830962)));
+            __m128d morebits = _mm_or_pd(
+                _mm_and_pd(big, _mm_set1_pd(6.123233995736765886130e-17)),
+                _mm_and_pd(mid, _mm_set1_pd(3.061616997868382943065e-17)));
 
-            __m128d one = _mm_set1_pd(1.0);
+            __m128d z = _mm_mul_pd(x, x);
 
-            x = _mm_min_pd(x, _mm_set1_pd(88.3762626647949));
-            x = _mm_max_pd(x, _mm_set1_pd(-88.3762626647949));
+            __m128d p = _mm_set1_pd(-8.750608600031904122785e-1);
+            p = _mm_mul_pd(p, z);
+            p = _mm_add_pd(p, _mm_set1_pd(-1.615753718733365076637e1));
+            p = _mm_mul_pd(p, z);
+            p = _mm_add_pd(p, _mm_set1_pd(-7.500855792314704667340e1));
+            p = _mm_mul_pd(p, z);
+            p = _mm_add_pd(p, _mm_set1_pd(-1.228866684490136173410e2));
+            p = _mm_mul_pd(p, z);
+            p = _mm_add_pd(p, _mm_set1_pd(-6.485021904942025371773e1));
+
+            __m128d q = _mm_add_pd(z, _mm_set1_pd(2.485846490142306297962e1));
+            q = _mm_mul_pd(q, z);
+            q = _mm_add_pd(q, _mm_set1_pd(1.650270098316988542046e2));
+            q = _mm_mul_pd(q, z);
+            q = _mm_add_pd(q, _mm_set1_pd(4.328810604912902668951e2));
+            q = _mm_mul_pd(q, z);
+            q = _mm_add_pd(q, _mm_set1_pd(4.853903996359136964868e2));
+            q = _mm_mul_pd(q, z);
+            q = _mm_add_pd(q, _mm_set1_pd(1.945506571482613964425e2));
+
+            z = _mm_div_pd(_mm_mul_pd(z, p), q);
+            z = _mm_add_pd(_mm_mul_pd(x, z), x);
+            z = _mm_add_pd(z, morebits);
+            y = _mm_add_pd(y, z);
 
-            /* express exp(x) as exp(g + n*log(2)) */
-            fx = _mm_mul_pd(x, _mm_set1_pd(1.44269504088896341));
-            fx = _mm_add_pd(fx, _mm_set1_pd(0.5));
+            /* update the sign */
+            return _mm_xor_pd(y, sign_bit);
+        }
 
-            /* how to perform a floorf with SSE: just below */
-            emm0 = _mm_cvttpd_epi32(fx);
-            tmp = _mm_cvtepi32_pd(emm0);
+        inline float64x2 asin_s(const float64x2& s) noexcept
+        {
+            // asin(x) = atan(x / sqrt((1 - x) * (1 + x)))
+            const __m128d one = _mm_set1_pd(1.0);
+            __m128d x = _mm_mul_pd(_mm_sub_pd(one, s), _mm_add_pd(one, s));
+            x = _mm_div_pd(s, _mm_sqrt_pd(x));
+            return atan_s(x);
+        }
 
-            /* if greater, substract 1 */
-            __m128d mask = _mm_cmpgt_pd(tmp, fx);
-            mask = _mm_and_pd(mask, one);
-            fx = _mm_sub_pd(tmp, mask);
+        inline float64x2 acos_s(const float64x2& s) noexcept
+        {
+            // acos(x) = 2 * atan(sqrt((1 - x) / (1 + x)))
+            const __m128d one = _mm_set1_pd(1.0);
+            __m128d x = _mm_div_pd(_mm_sub_pd(one, s), _mm_add_pd(one, s));
+            x = atan_s(_mm_sqrt_pd(x));
+            return _mm_add_pd(x, x);
+        }
 
-            tmp = _mm_mul_pd(fx, _mm_set1_pd(0.693359375));
-            __m128d z = _mm_mul_pd(fx, _mm_set1_pd(-2.12194440e-4));
-            x = _mm_sub_pd(x, tmp);
-            x = _mm_sub_pd(x, z);
+        inline float64x2 atan2_ss(
+            const float64x2& y, const float64x2& x) noexcept
+        {
+            // The arc tangent is computed for min(|x|, |y|) / max(|x|, |y|)
+            // in [0, 1] and then reflected into the right octant.
+            const __m128d sign_mask = _mm_set1_pd(
+                binary_double(0x8000000000000000ull));
+            const __m128d ax = _mm_andnot_pd(sign_mask, x);
+            const __m128d ay = _mm_andnot_pd(sign_mask, y);
+
+            __m128d num = _mm_min_pd(ax, ay);
+            __m128d den = _mm_max_pd(ax, ay);
+            __m128d r = _mm_div_pd(num, den);
+
+            /* atan2(0, 0) is 0 and atan2(inf, inf) is pi/4 before the
+               reflections */
+            const __m128d inf = _mm_set1_pd(
+                binary_double(0x7FF0000000000000ull));
+            __m128d mask = _mm_and_pd(
+                _mm_cmpeq_pd(ax, inf), _mm_cmpeq_pd(ay, inf));
+            r = _mm_and_pd(r, _mm_cmpneq_pd(den, _mm_setzero_pd()));
+            r = _mm_or_pd(
+                _mm_and_pd(mask, _mm_set1_pd(1.0)), _mm_andnot_pd(mask, r));
+            r = atan_s(r);
+
+            /* if (|y| > |x|) r = pi/2 - r; */
+            mask = _mm_cmpgt_pd(ay, ax);
+            r = _mm_or_pd(
+                _mm_and_pd(
+                    mask,
+                    _mm_sub_pd(_mm_set1_pd(1.57079632679489661923), r)),
+                _mm_andnot_pd(mask, r));
+
+            /* if (x has its sign bit set) r = pi - r; */
+            mask = _mm_cmplt_pd(
+                _mm_or_pd(_mm_and_pd(x, sign_mask), _mm_set1_pd(1.0)),
+                _mm_setzero_pd());
+            r = _mm_or_pd(
+                _mm_and_pd(
+                    mask,
+                    _mm_sub_pd(_mm_set1_pd(3.14159265358979323846), r)),
+                _mm_andnot_pd(mask, r));
+
+            /* take the sign of y, and NaN in, NaN out */
+            r = _mm_or_pd(r, _mm_and_pd(y, sign_mask));
+            return _mm_or_pd(r, _mm_cmpunord_pd(x, y));
+        }
 
-            z = _mm_mul_pd(x, x);
+        inline __m128d scalbn_pd(__m128d x, __m128i n) noexcept
+        {
+            // Computes x * 2^n for the two 32-bit integers in the low half of
+            // n. 2^n is applied as two factors with n1 + n2 = n so that n can
+            // span the whole exponent range, subnormal results included.
+            // The high dword of each factor is (n + 1023) << 20.
+            __m128i n1 = _mm_srai_epi32(n, 1);
+            __m128i n2 = _mm_sub_epi32(n, n1);
+            n1 = _mm_slli_epi32(_mm_add_epi32(n1, _mm_set1_epi32(0x3FF)), 20);
+            n2 = _mm_slli_epi32(_mm_add_epi32(n2, _mm_set1_epi32(0x3FF)), 20);
+            const __m128d pow2n1 = _mm_castsi128_pd(
+                _mm_unpacklo_epi32(_mm_setzero_si128(), n1));
+            const __m128d pow2n2 = _mm_castsi128_pd(
+                _mm_unpacklo_epi32(_mm_setzero_si128(), n2));
+            return _mm_mul_pd(_mm_mul_pd(x, pow2n1), pow2n2);
+        }
 
-            __m128d y = _mm_set1_pd(1.9875691500e-4);
-            y = _mm_mul_pd(y, x);
-            y = _mm_add_pd(y, _mm_set1_pd(1.3981999507e-3));
-            y = _mm_mul_pd(y, x);
-            y = _mm_add_pd(y, _mm_set1_pd(8.3334519073e-3));
-            y = _mm_mul_pd(y, x);
-            y = _mm_add_pd(y, _mm_set1_pd(4.1665795894e-2));
-            y = _mm_mul_pd(y, x);
-            y = _mm_add_pd(y, _mm_set1_pd(1.6666665459e-1));
-            y = _mm_mul_pd(y, x);
-            y = _mm_add_pd(y, _mm_set1_pd(5.0000001201e-1));
+        inline float64x2 exp_s(const float64x2& s) noexcept
+        {
+            // exp(x) = 2^n * exp(r) with n = round(x / log(2)) and
+            // r = x - n * log(2), where log(2) is split in two (Cody-Waite)
+            // so that r is exact. exp(r) is evaluated with its degree 13
+            // Taylor polynomial, which is accurate to below one ulp for
+            // |r| <= log(2) / 2.
+            __m128d x = s;
+
+            __m128d nan_mask = _mm_cmpunord_pd(x, x);
+
+            x = _mm_min_pd(x, _mm_set1_pd(710.0));
+            x = _mm_max_pd(x, _mm_set1_pd(-746.0));
+
+            /* n = round(x / log(2)) */
+            __m128d fx = _mm_mul_pd(x, _mm_set1_pd(1.44269504088896340736));
+            __m128i emm0 = _mm_cvtpd_epi32(fx);
+            fx = _mm_cvtepi32_pd(emm0);
+
+            /* r = x - n * log(2) */
+            x = _mm_sub_pd(
+                x, _mm_mul_pd(fx, _mm_set1_pd(6.93147180369123816490e-1)));
+            x = _mm_sub_pd(
+                x, _mm_mul_pd(fx, _mm_set1_pd(1.90821492927058770002e-10)));
+
+            __m128d z = _mm_mul_pd(x, x);
+
+            /* 1 + r + r^2 * P(r), with P evaluated in Estrin's scheme */
+            __m128d z2 = _mm_mul_pd(z, z);
+            __m128d p0 = _mm_add_pd(_mm_set1_pd(0.5),
+                _mm_mul_pd(x, _mm_set1_pd(1.0 / 6.0)));
+            __m128d p1 = _mm_add_pd(_mm_set1_pd(1.0 / 24.0),
+                _mm_mul_pd(x, _mm_set1_pd(1.0 / 120.0)));
+            __m128d p2 = _mm_add_pd(_mm_set1_pd(1.0 / 720.0),
+                _mm_mul_pd(x, _mm_set1_pd(1.0 / 5040.0)));
+            __m128d p3 = _mm_add_pd(_mm_set1_pd(1.0 / 40320.0),
+                _mm_mul_pd(x, _mm_set1_pd(1.0 / 362880.0)));
+            __m128d p4 = _mm_add_pd(_mm_set1_pd(1.0 / 3628800.0),
+                _mm_mul_pd(x, _mm_set1_pd(1.0 / 39916800.0)));
+            __m128d p5 = _mm_add_pd(_mm_set1_pd(1.0 / 479001600.0),
+                _mm_mul_pd(x, _mm_set1_pd(1.0 / 6227020800.0)));
+            p0 = _mm_add_pd(p0, _mm_mul_pd(p1, z));
+            p2 = _mm_add_pd(p2, _mm_mul_pd(p3, z));
+            p4 = _mm_add_pd(p4, _mm_mul_pd(p5, z));
+            p2 = _mm_add_pd(p2, _mm_mul_pd(p4, z2));
+            __m128d y = _mm_add_pd(p0, _mm_mul_pd(p2, z2));
             y = _mm_mul_pd(y, z);
             y = _mm_add_pd(y, x);
-            y = _mm_add_pd(y, one);
+            y = _mm_add_pd(y, _mm_set1_pd(1.0));
+
+            y = scalbn_pd(y, emm0);
+
+            /* NaN in, NaN out */
+            return _mm_or_pd(y, nan_mask);
+        }
+
+        inline float64x2 exp2_s(const float64x2& s) noexcept
+        {
+            // 2^x = 2^n * exp(f * log(2)) with n = round(x) and f = x - n,
+            // which is exact, so the only rounding in the argument of exp()
+            // is that of the small product f * log(2).
+            __m128d x = s;
+
+            __m128d nan_mask = _mm_cmpunord_pd(x, x);
+
+            x = _mm_min_pd(x, _mm_set1_pd(1025.0));
+            x = _mm_max_pd(x, _mm_set1_pd(-1076.0));
 
-            /* build 2^n */
-            emm0 = _mm_cvttpd_epi32(fx);
+            __m128i emm0 = _mm_cvtpd_epi32(x);
+            x = _mm_sub_pd(x, _mm_cvtepi32_pd(emm0));
+            x = _mm_mul_pd(x, _mm_set1_pd(6.93147180559945309417e-1));
+
+            __m128d y = scalbn_pd(exp_s(x), emm0);
+            return _mm_or_pd(y, nan_mask);
+        }
+
+        inline __m128d frexp_pd(__m128d x, __m128d& e) noexcept
+        {
+            // Splits a finite positive x into m * 2^e with m in
+            // [sqrt(2)/2, sqrt(2)) and returns m. Subnormals are scaled by
+            // 2^54 before the exponent is extracted.
+            const __m128d one = _mm_set1_pd(1.0);
+
+            /* scale up subnormals */
+            __m128d mask = _mm_cmplt_pd(
+                x, _mm_set1_pd(2.2250738585072014e-308));
+            __m128d scaled = _mm_mul_pd(x, _mm_set1_pd(18014398509481984.0));
+            x = _mm_or_pd(_mm_and_pd(mask, scaled), _mm_andnot_pd(mask, x));
+            e = _mm_and_pd(mask, _mm_set1_pd(-54.0));
+
+            /* x = frexp(x, &e) with the mantissa in [1, 2) */
+            __m128i emm0 = _mm_srli_epi64(_mm_castpd_si128(x), 52);
+            emm0 = _mm_sub_epi64(emm0, _mm_set1_epi64x(0x3FF));
             emm0 = _mm_shuffle_epi32(emm0, _MM_SHUFFLE(3, 1, 2, 0));
-            emm0 = _mm_add_epi64(emm0, _mm_set1_epi64x(0x3FF));
-            emm0 = _mm_slli_epi64(emm0, 52);
-            __m128d pow2n = _mm_castsi128_pd(emm0);
+            e = _mm_add_pd(e, _mm_cvtepi32_pd(emm0));
+
+            x = _mm_and_pd(
+                x, _mm_set1_pd(binary_double(0x000FFFFFFFFFFFFFull)));
+            x = _mm_or_pd(x, one);
+
+            /* if (x > SQRT2) { e += 1; x *= 0.5; } */
+            mask = _mm_cmpgt_pd(x, _mm_set1_pd(1.41421356237309504880));
+            x = _mm_or_pd(
+                _mm_and_pd(mask, _mm_mul_pd(x, _mm_set1_pd(0.5))),
+                _mm_andnot_pd(mask, x));
+            e = _mm_add_pd(e, _mm_and_pd(mask, one));
+            return x;
+        }
+
+        inline __m128d log1p_pd(__m128d f) noexcept
+        {
+            // Computes log(1 + f) for f in [sqrt(2)/2 - 1, sqrt(2) - 1] as
+            // 2 * atanh(f / (2 + f)) with fdlibm's degree 14 minimax
+            // polynomial, arranged as in fdlibm's log() so that the largest
+            // terms are added last.
+            __m128d hfsq = _mm_mul_pd(_mm_mul_pd(f, f), _mm_set1_pd(0.5));
+            __m128d r = _mm_div_pd(f, _mm_add_pd(f, _mm_set1_pd(2.0)));
+            __m128d z = _mm_mul_pd(r, r);
+            __m128d w = _mm_mul_pd(z, z);
+
+            /* fdlibm's minimax approximation of (atanh(r) / r - 1) * 2,
+               split into even and odd terms */
+            __m128d t1 = _mm_set1_pd(1.531383769920937332e-1);
+            t1 = _mm_mul_pd(t1, w);
+            t1 = _mm_add_pd(t1, _mm_set1_pd(2.222219843214978396e-1));
+            t1 = _mm_mul_pd(t1, w);
+            t1 = _mm_add_pd(t1, _mm_set1_pd(3.999999999940941908e-1));
+            t1 = _mm_mul_pd(t1, w);
+
+            __m128d t2 = _mm_set1_pd(1.479819860511658591e-1);
+            t2 = _mm_mul_pd(t2, w);
+            t2 = _mm_add_pd(t2, _mm_set1_pd(1.818357216161805012e-1));
+            t2 = _mm_mul_pd(t2, w);
+            t2 = _mm_add_pd(t2, _mm_set1_pd(2.857142874366239149e-1));
+            t2 = _mm_mul_pd(t2, w);
+            t2 = _mm_add_pd(t2, _mm_set1_pd(6.666666666666735130e-1));
+            t2 = _mm_mul_pd(t2, z);
+
+            __m128d y = _mm_add_pd(t1, t2);
+
+            /* f - (hfsq - r*(hfsq+y)) */
+            y = _mm_mul_pd(r, _mm_add_pd(hfsq, y));
+            y = _mm_sub_pd(hfsq, y);
+            return _mm_sub_pd(f, y);
+        }
 
-            y = _mm_mul_pd(y, pow2n);
-            return y;
+        inline __m128d log_special_pd(__m128d x, __m128d result) noexcept
+        {
+            // Applies log(inf) = inf, log(0) = -inf and log(x < 0) = NaN to
+            // a logarithm of x computed for finite positive x.
+            __m128d mask = _mm_cmpeq_pd(
+                x, _mm_set1_pd(binary_double(0x7FF0000000000000ull)));
+            result = _mm_or_pd(
+                _mm_and_pd(mask, x), _mm_andnot_pd(mask, result));
+            mask = _mm_cmpeq_pd(x, _mm_setzero_pd());
+            result = _mm_or_pd(
+                _mm_and_pd(
+                    mask, _mm_set1_pd(binary_double(0xFFF0000000000000ull))),
+                _mm_andnot_pd(mask, result));
+            return _mm_or_pd(result, _mm_cmpnge_pd(x, _mm_setzero_pd()));
         }
 
         inline float64x2 log_s(const float64x2& s) noexcept
         {
-            // This function's implementation is based on Julien Pommier's
-            // log_ps(). See the top of this file for details.
-            __m128d x = s;
+            // log(x) = e * log(2) + log(m) with x = m * 2^e, where log(2) is
+            // split in two so that e * log(2) is exact in the high part.
+            __m128d e;
+            __m128d x = frexp_pd(s, e);
+            x = log1p_pd(_mm_sub_pd(x, _mm_set1_pd(1.0)));
+            x = _mm_add_pd(
+                x, _mm_mul_pd(e, _mm_set1_pd(1.90821492927058770002e-10)));
+            x = _mm_add_pd(
+                x, _mm_mul_pd(e, _mm_set1_pd(6.93147180369123816490e-1)));
+            return log_special_pd(s, x);
+        }
+
+        inline float64x2 log2_s(const float64x2& s) noexcept
+        {
+            // log2(x) = e + log(m) / log(2) with x = m * 2^e, so powers of
+            // two give exact results.
+            __m128d e;
+            __m128d x = frexp_pd(s, e);
+            x = log1p_pd(_mm_sub_pd(x, _mm_set1_pd(1.0)));
+            x = _mm_mul_pd(x, _mm_set1_pd(1.44269504088896340736));
+            x = _mm_add_pd(x, e);
+            return log_special_pd(s, x);
+        }
+
+        inline float64x2 log10_s(const float64x2& s) noexcept
+        {
+            // log10(x) = e * log10(2) + log(m) / log(10) with x = m * 2^e,
+            // where log10(2) is split in two as in fdlibm's log10().
+            __m128d e;
+            __m128d x = frexp_pd(s, e);
+            x = log1p_pd(_mm_sub_pd(x, _mm_set1_pd(1.0)));
+            x = _mm_mul_pd(x, _mm_set1_pd(4.34294481903251827651e-1));
+            x = _mm_add_pd(
+                x, _mm_mul_pd(e, _mm_set1_pd(3.69423907715893078616e-13)));
+            x = _mm_add_pd(
+                x, _mm_mul_pd(e, _mm_set1_pd(3.01029995663611771306e-1)));
+            return log_special_pd(s, x);
+        }
 
-            __m128i emm0;
+        inline float64x2 abs_s(const float64x2& s) noexcept
+        {
+            return _mm_and_pd(
+                s, float64x2(binary_double(0x7FFFFFFFFFFFFFFFull)));
+        }
 
-            __m128d one = _mm_set1_pd(1.0);
+        inline float64x2 pow_ss(
+            const float64x2& bases, const float64x2& exponents) noexcept
+        {
+            // The relative error grows with |exponents * log(bases)|, to
+            // roughly 1e-13 near the limits of the exponent range. x^0 and
+            // 1^y are 1 even where exp(y * log(x)) is NaN, as with std::pow.
+            const __m128d one = _mm_set1_pd(1.0);
+            const __m128d ones = _mm_or_pd(
+                _mm_cmpeq_pd(exponents, _mm_setzero_pd()),
+                _mm_cmpeq_pd(bases, one));
+            const __m128d x =
+                exp_s(float64x2(_mm_mul_pd(log_s(bases), exponents)));
+            return _mm_or_pd(_mm_and_pd(ones, one), _mm_andnot_pd(ones, x));
+        }
 
-            __m128d invalid_mask = _mm_cmple_pd(x, _mm_setzero_pd());
+        inline void fast_sincos_s(
+            const float64x2& s,
+            float64x2& sin_out,
+            float64x2& cos_out) noexcept
+        {
+            // The same octant reduction as sincos_s(), but with a two-part
+            // Cody-Waite constant and the single precision polynomials from
+            // the cephes sinf.c sources. The relative error is about 1e-8
+            // near zero and grows with |x|. NaNs aren't handled, and as in
+            // sincos_s(), arguments above 2^30 use sincos_large_pd().
+            __m128d x = s;
 
-            /* cut off denormalized stuff */
-            x = _mm_max_pd(x, _mm_set1_pd(binary_double(1ull << 52ull)));
+            const __m128d sign_mask =
+                _mm_set1_pd(binary_double(0x8000000000000000ull));
+            __m128d sign_bit_sin = _mm_and_pd(x, sign_mask);
+            x = _mm_andnot_pd(sign_mask, x);
 
-            /* part 1: x = frexpf(x, &e); */
-            emm0 = _mm_srli_epi64(_mm_castpd_si128(x), 52);
+            const int large_lanes = _mm_movemask_pd(
+                _mm_cmpgt_pd(x, _mm_set1_pd(1073741824.0)));
 
-            /* keep only the fractional part */
-            x = _mm_and_pd(x, _mm_set1_pd(binary_double(~(0x7FFull << 52ull))));
-            x = _mm_or_pd(x, _mm_set1_pd(0.5));
+            /* j = ((int)(x * 4 / pi) + 1) & ~1 */
+            __m128i emm2 = _mm_cvttpd_epi32(
+                _mm_mul_pd(x, _mm_set1_pd(1.27323954473516268615)));
+            emm2 = _mm_add_epi32(emm2, _mm_set1_epi32(1));
+            emm2 = _mm_and_si128(emm2, _mm_set1_epi32(~1));
+            __m128d y = _mm_cvtepi32_pd(emm2);
 
-            emm0 = _mm_sub_epi64(emm0, _mm_set1_epi64x(0x3FF));
-            emm0 = _mm_shuffle_epi32(emm0, _MM_SHUFFLE(3, 1, 2, 0));
-            __m128d e = _mm_cvtepi32_pd(emm0);
+            /* Convert to epi64 */
+            emm2 = _mm_shuffle_epi32(emm2, _MM_SHUFFLE(3, 1, 2, 0));
 
-            e = _mm_add_pd(e, one);
+            __m128d swap_sign_bit_sin = _mm_castsi128_pd(_mm_slli_epi64(
+                _mm_and_si128(emm2, _mm_set1_epi64x(4)), 61));
+            __m128i emm0 = _mm_cmpeq_epi32(
+                _mm_and_si128(emm2, _mm_set1_epi64x(2)),
+                _mm_setzero_si128());
+            __m128d poly_mask = _mm_castsi128_pd(
+                _mm_shuffle_epi32(emm0, _MM_SHUFFLE(2, 2, 0, 0)));
+            __m128d sign_bit_cos = _mm_castsi128_pd(_mm_slli_epi64(
+                _mm_andnot_si128(
+                    _mm_sub_epi64(emm2, _mm_set1_epi64x(2)),
+                    _mm_set1_epi64x(4)),
+                61));
+            sign_bit_sin = _mm_xor_pd(sign_bit_sin, swap_sign_bit_sin);
 
-            /* part2:
-            if( x < SQRTHF ) {
-            e -= 1;
-            x = x + x - 1.0;
-            } else { x = x - 1.0; }
-            */
-            __m128d mask = _mm_cmplt_pd(x, _mm_set1_pd(0.707106781186547524));
-            __m128d tmp = _mm_and_pd(x, mask);
-            x = _mm_sub_pd(x, one);
-            e = _mm_sub_pd(e, _mm_and_pd(one, mask));
-            x = _mm_add_pd(x, tmp);
+            /* x = (x - y * DP1) - y * DP2 */
+            x = _mm_sub_pd(
+                x, _mm_mul_pd(y, _mm_set1_pd(7.85398125648498535156e-1)));
+            x = _mm_sub_pd(
+                x, _mm_mul_pd(y, _mm_set1_pd(3.77489497744594108e-8)));
 
             __m128d z = _mm_mul_pd(x, x);
 
-            __m128d y = _mm_set1_pd(7.0376836292e-2);
-            y = _mm_mul_pd(y, x);
-            y = _mm_add_pd(y, _mm_set1_pd(-1.1514610310e-1));
-            y = _mm_mul_pd(y, x);
-            y = _mm_add_pd(y, _mm_set1_pd(1.1676998740e-1));
-            y = _mm_mul_pd(y, x);
-            y = _mm_add_pd(y, _mm_set1_pd(-1.2420140846e-1));
-            y = _mm_mul_pd(y, x);
-            y = _mm_add_pd(y, _mm_set1_pd(1.4249322787e-1));
-            y = _mm_mul_pd(y, x);
-            y = _mm_add_pd(y, _mm_set1_pd(-1.6668057665e-1));
-            y = _mm_mul_pd(y, x);
-            y = _mm_add_pd(y, _mm_set1_pd(2.0000714765e-1));
+            /* cos(x) = 1 - z / 2 + z^2 * C(z) */
+            y = _mm_mul_pd(z, _mm_set1_pd(2.443315711809948e-5));
+            y = _mm_add_pd(y, _mm_set1_pd(-1.388731625493765e-3));
+            y = _mm_mul_pd(y, z);
+            y = _mm_add_pd(y, _mm_set1_pd(4.166664568298827e-2));
+            y = _mm_mul_pd(y, _mm_mul_pd(z, z));
+            y = _mm_sub_pd(y, _mm_mul_pd(z, _mm_set1_pd(0.5)));
+            y = _mm_add_pd(y, _mm_set1_pd(1.0));
+
+            /* sin(x) = x + x * z * S(z) */
+            __m128d y2 = _mm_mul_pd(z, _mm_set1_pd(-1.9515295891e-4));
+            y2 = _mm_add_pd(y2, _mm_set1_pd(8.3321608736e-3));
+            y2 = _mm_mul_pd(y2, z);
+            y2 = _mm_add_pd(y2, _mm_set1_pd(-1.6666654611e-1));
+            y2 = _mm_mul_pd(y2, _mm_mul_pd(z, x));
+            y2 = _mm_add_pd(y2, x);
+
+            /* select the correct result from the two polynoms */
+            __m128d ysin = _mm_or_pd(
+                _mm_and_pd(poly_mask, y2), _mm_andnot_pd(poly_mask, y));
+            __m128d ycos = _mm_or_pd(
+                _mm_and_pd(poly_mask, y), _mm_andnot_pd(poly_mask, y2));
+
+            sin_out = _mm_xor_pd(ysin, sign_bit_sin);
+            cos_out = _mm_xor_pd(ycos, sign_bit_cos);
+
+            if (large_lanes != 0)
+            {
+                sincos_large_pd(s, large_lanes, sin_out, cos_out);
+            }
+        }
+
+        inline float64x2 fast_sin_s(const float64x2& s) noexcept
+        {
+            float64x2 sin, cos;
+            fast_sincos_s(s, sin, cos);
+            return sin;
+        }
+
+        inline float64x2 fast_cos_s(const float64x2& s) noexcept
+        {
+            float64x2 sin, cos;
+            fast_sincos_s(s, sin, cos);
+            return cos;
+        }
+
+        inline float64x2 fast_exp_s(const float64x2& s) noexcept
+        {
+            // exp_s() with a degree 6 minimax polynomial for exp(r). The
+            // relative error is about 4e-9, and NaNs aren't propagated.
+            __m128d x = s;
+
+            x = _mm_min_pd(x, _mm_set1_pd(710.0));
+            x = _mm_max_pd(x, _mm_set1_pd(-746.0));
+
+            __m128i emm0 = _mm_cvtpd_epi32(
+                _mm_mul_pd(x, _mm_set1_pd(1.44269504088896340736)));
+            __m128d fx = _mm_cvtepi32_pd(emm0);
+
+            x = _mm_sub_pd(
+                x, _mm_mul_pd(fx, _mm_set1_pd(6.93147180369123816490e-1)));
+            x = _mm_sub_pd(
+                x, _mm_mul_pd(fx, _mm_set1_pd(1.90821492927058770002e-10)));
+
+            /* 1 + r + r^2 * Q(r) */
+            __m128d y = _mm_mul_pd(x, _mm_set1_pd(1.3814612731172797e-3));
+            y = _mm_add_pd(y, _mm_set1_pd(8.368709833187903e-3));
             y = _mm_mul_pd(y, x);
-            y = _mm_add_pd(y, _mm_set1_pd(-2.4999993993e-1));
+            y = _mm_add_pd(y, _mm_set1_pd(4.166838737087698e-2));
             y = _mm_mul_pd(y, x);
-            y = _mm_add_pd(y, _mm_set1_pd(3.3333331174e-1));
+            y = _mm_add_pd(y, _mm_set1_pd(1.6666520689735523e-1));
             y = _mm_mul_pd(y, x);
+            y = _mm_add_pd(y, _mm_set1_pd(4.999999345166768e-1));
+            y = _mm_mul_pd(y, _mm_mul_pd(x, x));
+            y = _mm_add_pd(y, x);
+            y = _mm_add_pd(y, _mm_set1_pd(1.0));
+
+            return scalbn_pd(y, emm0);
+        }
+
+        inline float64x2 fast_log_s(const float64x2& s) noexcept
+        {
+            // log_s() with a degree 7 minimax polynomial for
+            // 2 * atanh(r) and no handling of subnormal or special inputs.
+            // The relative error is about 1e-9. x must be positive and
+            // normal.
+            __m128d x = s;
+            const __m128d one = _mm_set1_pd(1.0);
+
+            __m128i emm0 = _mm_srli_epi64(_mm_castpd_si128(x), 52);
+            emm0 = _mm_sub_epi64(emm0, _mm_set1_epi64x(0x3FF));
+            emm0 = _mm_shuffle_epi32(emm0, _MM_SHUFFLE(3, 1, 2, 0));
+            __m128d e = _mm_cvtepi32_pd(emm0);
 
+            x = _mm_and_pd(
+                x, _mm_set1_pd(binary_double(0x000FFFFFFFFFFFFFull)));
+            x = _mm_or_pd(x, one);
+
+            /* if (x > SQRT2) { e += 1; x *= 0.5; } */
+            __m128d mask = _mm_cmpgt_pd(
+                x, _mm_set1_pd(1.41421356237309504880));
+            x = _mm_sub_pd(
+                x, _mm_and_pd(mask, _mm_mul_pd(x, _mm_set1_pd(0.5))));
+            e = _mm_add_pd(e, _mm_and_pd(mask, one));
+            __m128d f = _mm_sub_pd(x, one);
+
+            __m128d hfsq = _mm_mul_pd(_mm_mul_pd(f, f), _mm_set1_pd(0.5));
+            __m128d r = _mm_div_pd(f, _mm_add_pd(f, _mm_set1_pd(2.0)));
+            __m128d z = _mm_mul_pd(r, r);
+
+            __m128d y = _mm_mul_pd(z, _mm_set1_pd(2.9870937229697037e-1));
+            y = _mm_add_pd(y, _mm_set1_pd(3.9977574016150635e-1));
+            y = _mm_mul_pd(y, z);
+            y = _mm_add_pd(y, _mm_set1_pd(6.666677608549095e-1));
             y = _mm_mul_pd(y, z);
 
-            tmp = _mm_mul_pd(e, _mm_set1_pd(-2.12194440e-4));
-            y = _mm_add_pd(y, tmp);
+            /* f - (hfsq - r*(hfsq+y)) */
+            y = _mm_mul_pd(r, _mm_add_pd(hfsq, y));
+            y = _mm_sub_pd(hfsq, y);
+            x = _mm_sub_pd(f, y);
 
-            tmp = _mm_mul_pd(z, _mm_set1_pd(0.5));
-            y = _mm_sub_pd(y, tmp);
+            x = _mm_add_pd(
+                x, _mm_mul_pd(e, _mm_set1_pd(1.90821492927058770002e-10)));
+            return _mm_add_pd(
+                x, _mm_mul_pd(e, _mm_set1_pd(6.93147180369123816490e-1)));
+        }
 
-            tmp = _mm_mul_pd(e, _mm_set1_pd(0.693359375));
-            x = _mm_add_pd(x, y);
-            x = _mm_add_pd(x, tmp);
-            x = _mm_or_pd(x, invalid_mask); // negative arg will be NAN
-            return x;
+        inline float64x2 fast_pow_ss(
+            const float64x2& bases, const float64x2& exponents) noexcept
+        {
+            return fast_exp_s(
+                float64x2(_mm_mul_pd(fast_log_s(bases), exponents)));
         }
 
-        inline float64x2 abs_s(const float64x2& s) noexcept
+        inline void precise_sincos_s(
+            const float64x2& s,
+            float64x2& sin_out,
+            float64x2& cos_out) noexcept
         {
-            return _mm_and_pd(
-                s, float64x2(binary_double(0x7FFFFFFFFFFFFFFFull)));
+            // sincos_s() is already within 2 ulp over the whole range, as
+            // it hands arguments its reduction can't handle to the C
+            // library.
+            sincos_s(s, sin_out, cos_out);
         }
 
-        inline float64x2 pow_ss(
+        inline float64x2 precise_sin_s(const float64x2& s) noexcept
+        {
+            return sin_s(s);
+        }
+
+        inline float64x2 precise_cos_s(const float64x2& s) noexcept
+        {
+            return cos_s(s);
+        }
+
+        inline float64x2 precise_exp_s(const float64x2& s) noexcept
+        {
+            return exp_s(s);
+        }
+
+        inline float64x2 precise_log_s(const float64x2& s) noexcept
+        {
+            return log_s(s);
+        }
+
+        inline float64x2 precise_pow_ss(
             const float64x2& bases, const float64x2& exponents) noexcept
         {
-            return exp_s(float64x2(_mm_mul_pd(log_s(bases), exponents)));
+            // exp(y * log(x)) can't be made accurate to within an ulp
+            // without extra precision in log(x), so use the C library.
+            alignas(16) double b[2], e[2];
+            _mm_store_pd(b, bases);
+            _mm_store_pd(e, exponents);
+            return _mm_setr_pd(
+                tue::math::pow(b[0], e[0]),
+                tue::math::pow(b[1], e[1]));
+        }
+
+        inline float64x2 fast_recip_s(const float64x2& s) noexcept
+        {
+            // SSE2 has no double precision estimate, so all three tiers
+            // divide.
+            return _mm_div_pd(_mm_set1_pd(1.0), s);
         }
 
         inline float64x2 recip_s(const float64x2& s) noexcept
@@ -527,16 +1211,179 @@ namespace tue
             return _mm_div_pd(_mm_set1_pd(1.0), s);
         }
 
+        inline float64x2 precise_recip_s(const float64x2& s) noexcept
+        {
+            return _mm_div_pd(_mm_set1_pd(1.0), s);
+        }
+
         inline float64x2 sqrt_s(const float64x2& s) noexcept
         {
             return _mm_sqrt_pd(s);
         }
 
+        inline float64x2 cbrt_s(const float64x2& s) noexcept
+        {
+            // An initial estimate from dividing the exponent bits by three,
+            // as in fdlibm's cbrt(), is refined with Newton's method.
+            const __m128d sign_mask = _mm_set1_pd(
+                binary_double(0x8000000000000000ull));
+            __m128d x = _mm_andnot_pd(sign_mask, s);
+
+            /* scale up subnormals by 2^54 and the result down by 2^-18 */
+            __m128d mask = _mm_cmplt_pd(
+                x, _mm_set1_pd(2.2250738585072014e-308));
+            __m128d scaled = _mm_mul_pd(x, _mm_set1_pd(18014398509481984.0));
+            x = _mm_or_pd(_mm_and_pd(mask, scaled), _mm_andnot_pd(mask, x));
+            __m128d scale = _mm_or_pd(
+                _mm_and_pd(mask, _mm_set1_pd(3.814697265625e-6)),
+                _mm_andnot_pd(mask, _mm_set1_pd(1.0)));
+
+            /* the high dword of the estimate is hx / 3 + B1 */
+            __m128i emm0 = _mm_shuffle_epi32(
+                _mm_castpd_si128(x), _MM_SHUFFLE(3, 1, 3, 1));
+            __m128d hx = _mm_mul_pd(
+                _mm_cvtepi32_pd(emm0), _mm_set1_pd(1.0 / 3.0));
+            emm0 = _mm_add_epi32(
+                _mm_cvttpd_epi32(hx), _mm_set1_epi32(715094163));
+            __m128d y = _mm_castsi128_pd(
+                _mm_unpacklo_epi32(_mm_setzero_si128(), emm0));
+
+            /* y -= (y - x / y^2) / 3 */
+            const __m128d third = _mm_set1_pd(1.0 / 3.0);
+            for (int i = 0; i < 4; ++i)
+            {
+                __m128d d = _mm_div_pd(x, _mm_mul_pd(y, y));
+                d = _mm_mul_pd(_mm_sub_pd(y, d), third);
+                y = _mm_sub_pd(y, d);
+            }
+
+            y = _mm_mul_pd(y, scale);
+
+            /* cbrt(0) = 0 and cbrt(inf) = inf */
+            mask = _mm_or_pd(
+                _mm_cmpeq_pd(x, _mm_setzero_pd()),
+                _mm_cmpeq_pd(
+                    x, _mm_set1_pd(binary_double(0x7FF0000000000000ull))));
+            y = _mm_or_pd(_mm_and_pd(mask, x), _mm_andnot_pd(mask, y));
+
+            /* restore the sign, and NaN in, NaN out */
+            y = _mm_or_pd(y, _mm_and_pd(s, sign_mask));
+            return _mm_or_pd(y, _mm_cmpunord_pd(s, s));
+        }
+
+        inline float64x2 fast_rsqrt_s(const float64x2& s) noexcept
+        {
+            return _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(s));
+        }
+
         inline float64x2 rsqrt_s(const float64x2& s) noexcept
         {
             return _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(s));
         }
 
+        inline float64x2 precise_rsqrt_s(const float64x2& s) noexcept
+        {
+            return _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(s));
+        }
+
+#ifdef TUE_SSE4_1
+        inline float64x2 floor_s(const float64x2& s) noexcept
+        {
+            return _mm_round_pd(s, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+
+        inline float64x2 ceil_s(const float64x2& s) noexcept
+        {
+            return _mm_round_pd(s, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+        }
+
+        inline float64x2 round_s(const float64x2& s) noexcept
+        {
+            // _MM_FROUND_TO_NEAREST_INT rounds halfway cases to even, so add
+            // the largest value below 0.5 with the sign of s and truncate.
+            const auto half = _mm_or_pd(
+                _mm_and_pd(s, _mm_set1_pd(-0.0)),
+                float64x2(binary_double(0x3FDFFFFFFFFFFFFFull)));
+            return _mm_round_pd(
+                _mm_add_pd(s, half), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+        inline float64x2 trunc_s(const float64x2& s) noexcept
+        {
+            return _mm_round_pd(s, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+#else
+        // Rounds each component of s to the nearest integer, halfway cases
+        // to even, by adding and subtracting 2^52 to its magnitude so
+        // the fraction falls off the end of the significand. Magnitudes at
+        // least that large are already integers and are left alone.
+        inline float64x2 round_even_s(const float64x2& s) noexcept
+        {
+            const auto sign_mask = _mm_set1_pd(-0.0);
+            const auto magic = _mm_set1_pd(4503599627370496.0);
+            const auto a = _mm_andnot_pd(sign_mask, s);
+            const auto small = _mm_cmplt_pd(a, magic);
+            const auto r = _mm_sub_pd(_mm_add_pd(a, magic), magic);
+            return _mm_or_pd(
+                _mm_or_pd(_mm_and_pd(small, r), _mm_andnot_pd(small, a)),
+                _mm_and_pd(s, sign_mask));
+        }
+
+        inline float64x2 floor_s(const float64x2& s) noexcept
+        {
+            const auto r = round_even_s(s);
+            const auto one = _mm_set1_pd(1.0);
+            return _mm_or_pd(
+                _mm_sub_pd(r, _mm_and_pd(_mm_cmpgt_pd(r, s), one)),
+                _mm_and_pd(s, _mm_set1_pd(-0.0)));
+        }
+
+        inline float64x2 ceil_s(const float64x2& s) noexcept
+        {
+            const auto r = round_even_s(s);
+            const auto one = _mm_set1_pd(1.0);
+            return _mm_or_pd(
+                _mm_add_pd(r, _mm_and_pd(_mm_cmplt_pd(r, s), one)),
+                _mm_and_pd(s, _mm_set1_pd(-0.0)));
+        }
+
+        inline float64x2 round_s(const float64x2& s) noexcept
+        {
+            // a - r is exact, so it's exactly 0.5 only in halfway cases.
+            const auto sign_mask = _mm_set1_pd(-0.0);
+            const auto a = _mm_andnot_pd(sign_mask, s);
+            const auto r = round_even_s(a);
+            const auto up = _mm_cmpeq_pd(
+                _mm_sub_pd(a, r), _mm_set1_pd(0.5));
+            return _mm_or_pd(
+                _mm_add_pd(r, _mm_and_pd(up, _mm_set1_pd(1.0))),
+                _mm_and_pd(s, sign_mask));
+        }
+
+        inline float64x2 trunc_s(const float64x2& s) noexcept
+        {
+            const auto sign_mask = _mm_set1_pd(-0.0);
+            const auto a = _mm_andnot_pd(sign_mask, s);
+            const auto r = round_even_s(a);
+            const auto down = _mm_cmpgt_pd(r, a);
+            return _mm_or_pd(
+                _mm_sub_pd(r, _mm_and_pd(down, _mm_set1_pd(1.0))),
+                _mm_and_pd(s, sign_mask));
+        }
+#endif
+
+        inline float64x2 fma_sss(
+            const float64x2& s1,
+            const float64x2& s2,
+            const float64x2& s3) noexcept
+        {
+#ifdef TUE_FMA
+            return _mm_fmadd_pd(s1, s2, s3);
+#else
+            return _mm_add_pd(_mm_mul_pd(s1, s2), s3);
+#endif
+        }
+
         inline float64x2 min_ss(
             const float64x2& s1, const float64x2& s2) noexcept
         {
@@ -549,6 +1396,24 @@ namespace tue
             return _mm_max_pd(s1, s2);
         }
 
+        inline double reduce_add_s(const float64x2& s) noexcept
+        {
+            const __m128d x = s;
+            return _mm_cvtsd_f64(_mm_add_sd(x, _mm_unpackhi_pd(x, x)));
+        }
+
+        inline double reduce_min_s(const float64x2& s) noexcept
+        {
+            const __m128d x = s;
+            return _mm_cvtsd_f64(_mm_min_sd(x, _mm_unpackhi_pd(x, x)));
+        }
+
+        inline double reduce_max_s(const float64x2& s) noexcept
+        {
+            const __m128d x = s;
+            return _mm_cvtsd_f64(_mm_max_sd(x, _mm_unpackhi_pd(x, x)));
+        }
+
         inline float64x2 mask_ss(
             const bool64x2& conditions,
             const float64x2& values) noexcept
@@ -561,9 +1426,13 @@ namespace tue
             const float64x2& values,
             const float64x2& otherwise) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_blendv_pd(otherwise, values, conditions);
+#else
             return _mm_or_pd(
                 _mm_and_pd(conditions, values),
                 _mm_andnot_pd(conditions, otherwise));
+#endif
         }
 
         inline bool64x2 less_ss(
@@ -601,5 +1470,118 @@ namespace tue
         {
             return _mm_cmpneq_pd(lhs, rhs);
         }
+
+        // The precise float32x4 kernels run the float64x2 ones on each half,
+        // so their results are only rounded once, to float.
+        inline void precise_sincos_s(
+            const float32x4& s,
+            float32x4& sin_out,
+            float32x4& cos_out) noexcept
+        {
+            const __m128 x = s;
+            float64x2 lo_sin, lo_cos, hi_sin, hi_cos;
+            sincos_s(float64x2(_mm_cvtps_pd(x)), lo_sin, lo_cos);
+            sincos_s(
+                float64x2(_mm_cvtps_pd(_mm_movehl_ps(x, x))), hi_sin, hi_cos);
+            sin_out = _mm_movelh_ps(
+                _mm_cvtpd_ps(lo_sin), _mm_cvtpd_ps(hi_sin));
+            cos_out = _mm_movelh_ps(
+                _mm_cvtpd_ps(lo_cos), _mm_cvtpd_ps(hi_cos));
+        }
+
+        inline float32x4 precise_sin_s(const float32x4& s) noexcept
+        {
+            float32x4 sin, cos;
+            precise_sincos_s(s, sin, cos);
+            return sin;
+        }
+
+        inline float32x4 precise_cos_s(const float32x4& s) noexcept
+        {
+            float32x4 sin, cos;
+            precise_sincos_s(s, sin, cos);
+            return cos;
+        }
+
+        inline float32x4 precise_exp_s(const float32x4& s) noexcept
+        {
+            const __m128 x = s;
+            const float64x2 lo = _mm_cvtps_pd(x);
+            const float64x2 hi = _mm_cvtps_pd(_mm_movehl_ps(x, x));
+            return _mm_movelh_ps(
+                _mm_cvtpd_ps(exp_s(lo)), _mm_cvtpd_ps(exp_s(hi)));
+        }
+
+        inline float32x4 precise_log_s(const float32x4& s) noexcept
+        {
+            const __m128 x = s;
+            const float64x2 lo = _mm_cvtps_pd(x);
+            const float64x2 hi = _mm_cvtps_pd(_mm_movehl_ps(x, x));
+            return _mm_movelh_ps(
+                _mm_cvtpd_ps(log_s(lo)), _mm_cvtpd_ps(log_s(hi)));
+        }
+
+        inline float32x4 precise_pow_ss(
+            const float32x4& bases, const float32x4& exponents) noexcept
+        {
+            const __m128 b = bases;
+            const __m128 e = exponents;
+            const float64x2 lo = _mm_mul_pd(
+                log_s(float64x2(_mm_cvtps_pd(b))), _mm_cvtps_pd(e));
+            const float64x2 hi = _mm_mul_pd(
+                log_s(float64x2(_mm_cvtps_pd(_mm_movehl_ps(b, b)))),
+                _mm_cvtps_pd(_mm_movehl_ps(e, e)));
+            return _mm_movelh_ps(
+                _mm_cvtpd_ps(exp_s(lo)), _mm_cvtpd_ps(exp_s(hi)));
+        }
+
+        template<int I0, int I1>
+        inline float64x2 shuffle_s(
+            const float64x2& s,
+            std::integer_sequence<int, I0, I1>) noexcept
+        {
+            return _mm_shuffle_pd(s, s, I0 | (I1 << 1));
+        }
+
+        template<int I0, int I1>
+        inline float64x2 shuffle_ss(
+            const float64x2& lhs,
+            const float64x2& rhs,
+            std::integer_sequence<int, I0, I1>) noexcept
+        {
+            return _mm_shuffle_pd(
+                I0 < 2 ? lhs : rhs,
+                I1 < 2 ? lhs : rhs,
+                (I0 % 2) | ((I1 % 2) << 1));
+        }
+
+        template<int I>
+        inline double extract_s(
+            const float64x2& s, std::integral_constant<int, I>) noexcept
+        {
+            return _mm_cvtsd_f64(_mm_shuffle_pd(s, s, I));
+        }
+
+        template<int I>
+        inline float64x2 insert_s(
+            const float64x2& s,
+            double x,
+            std::integral_constant<int, I>) noexcept
+        {
+            const __m128d t = _mm_set_sd(x);
+            return I == 0 ? _mm_move_sd(s, t) : _mm_unpacklo_pd(s, t);
+        }
+
+        inline float64x2 interleave_lo_ss(
+            const float64x2& lhs, const float64x2& rhs) noexcept
+        {
+            return _mm_unpacklo_pd(lhs, rhs);
+        }
+
+        inline float64x2 interleave_hi_ss(
+            const float64x2& lhs, const float64x2& rhs) noexcept
+        {
+            return _mm_unpackhi_pd(lhs, rhs);
+        }
     }
 }
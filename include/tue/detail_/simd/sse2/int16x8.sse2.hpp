@@ -12,9 +12,14 @@
 
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "../../../simd.hpp"
 
+#ifdef TUE_SSE4_1
+#include <smmintrin.h>
+#endif
+
 namespace tue
 {
     template<>
@@ -122,6 +127,26 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int16x8 gather(
+            const std::int16_t* base, const simd<I, 8>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int16x8 gather(
+            const std::int16_t* base,
+            const simd<I, 8>& indices,
+            const bool16x8& conditions) noexcept;
+
+        inline static int16x8 load_partial(
+            const std::int16_t* data, int count) noexcept;
+
+        inline static int16x8 maskload(
+            const std::int16_t* data, const bool16x8& conditions) noexcept;
+
         void store(std::int16_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -132,6 +157,31 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void stream(std::int16_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int16_t* base, const simd<I, 8>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int16_t* base,
+            const simd<I, 8>& indices,
+            const bool16x8& conditions) const noexcept;
+
+        inline void store_partial(
+            std::int16_t* data, int count) const noexcept;
+
+        inline void maskstore(
+            std::int16_t* data, const bool16x8& conditions) const noexcept;
+
         const std::int16_t* data() const noexcept
         {
             return reinterpret_cast<const std::int16_t*>(&underlying_);
@@ -146,6 +196,8 @@ namespace tue
 
 #include "bool16x8.sse2.hpp"
 #include "uint16x8.sse2.hpp"
+#include "int8x16.sse2.hpp"
+#include "uint8x16.sse2.hpp"
 
 namespace tue
 {
@@ -159,6 +211,75 @@ namespace tue
         return __m128i(s);
     }
 
+    template<typename I, typename>
+    inline int16x8 int16x8::gather(
+        const std::int16_t* base, const simd<I, 8>& indices) noexcept
+    {
+        return tue::detail_::gather_components<int16x8>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline int16x8 int16x8::gather(
+        const std::int16_t* base,
+        const simd<I, 8>& indices,
+        const bool16x8& conditions) noexcept
+    {
+        return tue::detail_::gather_components<int16x8>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void int16x8::scatter(
+        std::int16_t* base, const simd<I, 8>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void int16x8::scatter(
+        std::int16_t* base,
+        const simd<I, 8>& indices,
+        const bool16x8& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline int16x8 int16x8::load_partial(
+        const std::int16_t* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm_cmplt_epi16(
+                _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7),
+                _mm_set1_epi16(static_cast<short>(count))));
+    }
+
+    inline int16x8 int16x8::maskload(
+        const std::int16_t* data, const bool16x8& conditions) noexcept
+    {
+        if (_mm_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(int16x8)))
+        {
+            return _mm_and_si128(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<int16x8>(data, conditions);
+    }
+
+    inline void int16x8::store_partial(
+        std::int16_t* data, int count) const noexcept
+    {
+        tue::detail_::storeu_partial_si128(data, underlying_, count * 2);
+    }
+
+    inline void int16x8::maskstore(
+        std::int16_t* data, const bool16x8& conditions) const noexcept
+    {
+        _mm_maskmoveu_si128(
+            underlying_,
+            conditions,
+            reinterpret_cast<char*>(data));
+    }
+
     namespace detail_
     {
         inline int16x8 unary_plus_operator_s(const int16x8& s) noexcept
@@ -257,7 +378,7 @@ namespace tue
         inline int16x8 bitwise_shift_right_operator_si(
             const int16x8& lhs, int rhs) noexcept
         {
-            return _mm_srli_epi16(lhs, rhs);
+            return _mm_srai_epi16(lhs, rhs);
         }
 
         inline int16x8& addition_assignment_operator_ss(
@@ -317,7 +438,7 @@ namespace tue
         inline int16x8& bitwise_shift_right_assignment_operator_si(
             int16x8& lhs, int rhs) noexcept
         {
-            return lhs = _mm_srli_epi16(lhs, rhs);
+            return lhs = _mm_srai_epi16(lhs, rhs);
         }
 
         inline bool equality_operator_ss(
@@ -352,6 +473,57 @@ namespace tue
             return _mm_max_epi16(s1, s2);
         }
 
+        inline std::int16_t reduce_add_s(const int16x8& s) noexcept
+        {
+            // Fold the upper half onto the lower half until only the
+            // first component is left.
+            int16x8 x = s;
+            x = addition_operator_ss(x, int16x8(_mm_srli_si128(x, 8)));
+            x = addition_operator_ss(x, int16x8(_mm_srli_si128(x, 4)));
+            x = addition_operator_ss(x, int16x8(_mm_srli_si128(x, 2)));
+            return static_cast<std::int16_t>(_mm_cvtsi128_si32(x));
+        }
+
+        inline std::int16_t reduce_min_s(const int16x8& s) noexcept
+        {
+            int16x8 x = s;
+            x = min_ss(x, int16x8(_mm_srli_si128(x, 8)));
+            x = min_ss(x, int16x8(_mm_srli_si128(x, 4)));
+            x = min_ss(x, int16x8(_mm_srli_si128(x, 2)));
+            return static_cast<std::int16_t>(_mm_cvtsi128_si32(x));
+        }
+
+        inline std::int16_t reduce_max_s(const int16x8& s) noexcept
+        {
+            int16x8 x = s;
+            x = max_ss(x, int16x8(_mm_srli_si128(x, 8)));
+            x = max_ss(x, int16x8(_mm_srli_si128(x, 4)));
+            x = max_ss(x, int16x8(_mm_srli_si128(x, 2)));
+            return static_cast<std::int16_t>(_mm_cvtsi128_si32(x));
+        }
+
+        inline int16x8 adds_ss(
+            const int16x8& s1, const int16x8& s2) noexcept
+        {
+            return _mm_adds_epi16(s1, s2);
+        }
+
+        inline int16x8 subs_ss(
+            const int16x8& s1, const int16x8& s2) noexcept
+        {
+            return _mm_subs_epi16(s1, s2);
+        }
+
+        inline int16x8 avg_ss(
+            const int16x8& s1, const int16x8& s2) noexcept
+        {
+            const auto bias = _mm_set1_epi16(-0x8000);
+            return _mm_xor_si128(
+                _mm_avg_epu16(
+                    _mm_xor_si128(s1, bias), _mm_xor_si128(s2, bias)),
+                bias);
+        }
+
         inline int16x8 mask_ss(
             const bool16x8& conditions,
             const int16x8& values) noexcept
@@ -364,9 +536,13 @@ namespace tue
             const int16x8& values,
             const int16x8& otherwise) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
         inline bool16x8 less_ss(
@@ -404,5 +580,91 @@ namespace tue
         {
             return _mm_xor_si128(_mm_cmpeq_epi16(lhs, rhs), int16x8(0xFFFFu));
         }
+
+#ifdef TUE_SSE4_1
+        template<int... I>
+        inline int16x8 shuffle_s(
+            const int16x8& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return _mm_shuffle_epi8(s, _mm_setr_epi16(
+                static_cast<short>(I * 0x0202 + 0x0100)...));
+        }
+
+        template<int... I>
+        inline int16x8 shuffle_ss(
+            const int16x8& lhs,
+            const int16x8& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            // pshufb zeroes each component whose control byte has its
+            // top bit set, so each source only fills in its own components.
+            return _mm_or_si128(
+                _mm_shuffle_epi8(lhs, _mm_setr_epi16(static_cast<short>(
+                    I < 8 ? I * 0x0202 + 0x0100 : 0x8080)...)),
+                _mm_shuffle_epi8(rhs, _mm_setr_epi16(static_cast<short>(
+                    I < 8 ? 0x8080 : (I - 8) * 0x0202 + 0x0100)...)));
+        }
+#endif
+
+        template<int I>
+        inline std::int16_t extract_s(
+            const int16x8& s, std::integral_constant<int, I>) noexcept
+        {
+            return static_cast<std::int16_t>(_mm_extract_epi16(s, I));
+        }
+
+        template<int I>
+        inline int16x8 insert_s(
+            const int16x8& s,
+            std::int16_t x,
+            std::integral_constant<int, I>) noexcept
+        {
+            return _mm_insert_epi16(s, static_cast<int>(x), I);
+        }
+
+        inline int16x8 interleave_lo_ss(
+            const int16x8& lhs, const int16x8& rhs) noexcept
+        {
+            return _mm_unpacklo_epi16(lhs, rhs);
+        }
+
+        inline int16x8 interleave_hi_ss(
+            const int16x8& lhs, const int16x8& rhs) noexcept
+        {
+            return _mm_unpackhi_epi16(lhs, rhs);
+        }
+
+        inline int8x16 packs_ss(
+            const int16x8& lo, const int16x8& hi) noexcept
+        {
+            return _mm_packs_epi16(lo, hi);
+        }
+
+        inline uint8x16 packus_ss(
+            const int16x8& lo, const int16x8& hi) noexcept
+        {
+            return _mm_packus_epi16(lo, hi);
+        }
+
+        inline int16x8 widen_lo_s(const int8x16& s) noexcept
+        {
+            return _mm_srai_epi16(_mm_unpacklo_epi8(s, s), 8);
+        }
+
+        inline int16x8 widen_hi_s(const int8x16& s) noexcept
+        {
+            return _mm_srai_epi16(_mm_unpackhi_epi8(s, s), 8);
+        }
+
+        inline uint16x8 widen_lo_s(const uint8x16& s) noexcept
+        {
+            return _mm_unpacklo_epi8(s, _mm_setzero_si128());
+        }
+
+        inline uint16x8 widen_hi_s(const uint8x16& s) noexcept
+        {
+            return _mm_unpackhi_epi8(s, _mm_setzero_si128());
+        }
     }
 }
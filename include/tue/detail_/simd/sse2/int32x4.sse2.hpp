@@ -12,9 +12,18 @@
 
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "../../../simd.hpp"
 
+#ifdef TUE_SSE4_1
+#include <smmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
 namespace tue
 {
     template<>
@@ -119,6 +128,26 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int32x4 gather(
+            const std::int32_t* base, const simd<I, 4>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int32x4 gather(
+            const std::int32_t* base,
+            const simd<I, 4>& indices,
+            const bool32x4& conditions) noexcept;
+
+        inline static int32x4 load_partial(
+            const std::int32_t* data, int count) noexcept;
+
+        inline static int32x4 maskload(
+            const std::int32_t* data, const bool32x4& conditions) noexcept;
+
         void store(std::int32_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -129,6 +158,31 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void stream(std::int32_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int32_t* base, const simd<I, 4>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int32_t* base,
+            const simd<I, 4>& indices,
+            const bool32x4& conditions) const noexcept;
+
+        inline void store_partial(
+            std::int32_t* data, int count) const noexcept;
+
+        inline void maskstore(
+            std::int32_t* data, const bool32x4& conditions) const noexcept;
+
         const std::int32_t* data() const noexcept
         {
             return reinterpret_cast<const std::int32_t*>(&underlying_);
@@ -144,6 +198,8 @@ namespace tue
 #include "../sse/bool32x4.sse.hpp"
 #include "../sse/float32x4.sse.hpp"
 #include "uint32x4.sse2.hpp"
+#include "int16x8.sse2.hpp"
+#include "uint16x8.sse2.hpp"
 
 namespace tue
 {
@@ -162,6 +218,113 @@ namespace tue
         return __m128i(s);
     }
 
+    template<typename I, typename>
+    inline int32x4 int32x4::gather(
+        const std::int32_t* base, const simd<I, 4>& indices) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm_i32gather_epi32(
+            reinterpret_cast<const int*>(base), indices, 4);
+#else
+        const __m128i i = indices;
+        return _mm_setr_epi32(
+            base[_mm_cvtsi128_si32(i)],
+            base[_mm_cvtsi128_si32(_mm_shuffle_epi32(i, 1))],
+            base[_mm_cvtsi128_si32(_mm_shuffle_epi32(i, 2))],
+            base[_mm_cvtsi128_si32(_mm_shuffle_epi32(i, 3))]);
+#endif
+    }
+
+    template<typename I, typename>
+    inline int32x4 int32x4::gather(
+        const std::int32_t* base,
+        const simd<I, 4>& indices,
+        const bool32x4& conditions) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm_mask_i32gather_epi32(
+            _mm_setzero_si128(),
+            reinterpret_cast<const int*>(base),
+            indices,
+            _mm_castps_si128(conditions),
+            4);
+#else
+        return tue::detail_::gather_components<int32x4>(
+            base, indices, conditions);
+#endif
+    }
+
+    template<typename I, typename>
+    inline void int32x4::scatter(
+        std::int32_t* base, const simd<I, 4>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void int32x4::scatter(
+        std::int32_t* base,
+        const simd<I, 4>& indices,
+        const bool32x4& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline int32x4 int32x4::load_partial(
+        const std::int32_t* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm_castsi128_ps(_mm_cmplt_epi32(
+                _mm_setr_epi32(0, 1, 2, 3),
+                _mm_set1_epi32(count))));
+    }
+
+    inline int32x4 int32x4::maskload(
+        const std::int32_t* data, const bool32x4& conditions) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm_maskload_epi32(
+            reinterpret_cast<const int*>(data), _mm_castps_si128(conditions));
+#else
+        if (_mm_movemask_ps(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(int32x4)))
+        {
+            return _mm_and_si128(loadu(data), _mm_castps_si128(conditions));
+        }
+        return tue::detail_::maskload_components<int32x4>(data, conditions);
+#endif
+    }
+
+    inline void int32x4::store_partial(
+        std::int32_t* data, int count) const noexcept
+    {
+#ifdef TUE_AVX2
+        maskstore(
+            data,
+            _mm_castsi128_ps(_mm_cmplt_epi32(
+                _mm_setr_epi32(0, 1, 2, 3),
+                _mm_set1_epi32(count))));
+#else
+        tue::detail_::storeu_partial_si128(data, underlying_, count * 4);
+#endif
+    }
+
+    inline void int32x4::maskstore(
+        std::int32_t* data, const bool32x4& conditions) const noexcept
+    {
+#ifdef TUE_AVX2
+        _mm_maskstore_epi32(
+            reinterpret_cast<int*>(data), _mm_castps_si128(conditions),
+            underlying_);
+#else
+        _mm_maskmoveu_si128(
+            underlying_,
+            _mm_castps_si128(conditions),
+            reinterpret_cast<char*>(data));
+#endif
+    }
+
     namespace detail_
     {
         inline int32x4 unary_plus_operator_s(const int32x4& s) noexcept
@@ -215,23 +378,45 @@ namespace tue
             return _mm_sub_epi32(lhs, rhs);
         }
 
-        /*inline int32x4 multiplication_operator_ss(
+        inline int32x4 multiplication_operator_ss(
             const int32x4& lhs, const int32x4& rhs) noexcept
         {
-            // TODO
+#ifdef TUE_SSE4_1
+            return _mm_mullo_epi32(lhs, rhs);
+#else
+            // _mm_mul_epu32 only multiplies the even lanes, so multiply the
+            // odd lanes separately and interleave the low halves. The low 32
+            // bits of the product are the same whether signed or not.
+            const auto even = _mm_mul_epu32(lhs, rhs);
+            const auto odd = _mm_mul_epu32(
+                _mm_srli_epi64(lhs, 32), _mm_srli_epi64(rhs, 32));
+            return _mm_unpacklo_epi32(
+                _mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
         }
 
         inline int32x4 division_operator_ss(
             const int32x4& lhs, const int32x4& rhs) noexcept
         {
-            // TODO
+            // Every int32 is exactly representable as a double, and the
+            // double quotient is never rounded across an integer boundary,
+            // so truncating it gives the same result as integer division.
+            const auto lhs_hi = _mm_shuffle_epi32(lhs, _MM_SHUFFLE(1, 0, 3, 2));
+            const auto rhs_hi = _mm_shuffle_epi32(rhs, _MM_SHUFFLE(1, 0, 3, 2));
+            const auto lo = _mm_cvttpd_epi32(_mm_div_pd(
+                _mm_cvtepi32_pd(lhs), _mm_cvtepi32_pd(rhs)));
+            const auto hi = _mm_cvttpd_epi32(_mm_div_pd(
+                _mm_cvtepi32_pd(lhs_hi), _mm_cvtepi32_pd(rhs_hi)));
+            return _mm_unpacklo_epi64(lo, hi);
         }
 
         inline int32x4 modulo_operator_ss(
             const int32x4& lhs, const int32x4& rhs) noexcept
         {
-            // TODO
-        }*/
+            return _mm_sub_epi32(lhs, multiplication_operator_ss(
+                division_operator_ss(lhs, rhs), rhs));
+        }
 
         inline int32x4 bitwise_and_operator_ss(
             const int32x4& lhs, const int32x4& rhs) noexcept
@@ -260,7 +445,7 @@ namespace tue
         inline int32x4 bitwise_shift_right_operator_si(
             const int32x4& lhs, int rhs) noexcept
         {
-            return _mm_srli_epi32(lhs, rhs);
+            return _mm_srai_epi32(lhs, rhs);
         }
 
         inline int32x4& addition_assignment_operator_ss(
@@ -275,23 +460,23 @@ namespace tue
             return lhs = _mm_sub_epi32(lhs, rhs);
         }
 
-        /*inline int32x4& multiplication_assignment_operator_ss(
+        inline int32x4& multiplication_assignment_operator_ss(
             int32x4& lhs, const int32x4& rhs) noexcept
         {
-            // TODO
+            return lhs = multiplication_operator_ss(lhs, rhs);
         }
 
         inline int32x4& division_assignment_operator_ss(
             int32x4& lhs, const int32x4& rhs) noexcept
         {
-            // TODO
+            return lhs = division_operator_ss(lhs, rhs);
         }
 
         inline int32x4& modulo_assignment_operator_ss(
             int32x4& lhs, const int32x4& rhs) noexcept
         {
-            // TODO
-        }*/
+            return lhs = modulo_operator_ss(lhs, rhs);
+        }
 
         inline int32x4& bitwise_and_assignment_operator_ss(
             int32x4& lhs, const int32x4& rhs) noexcept
@@ -320,7 +505,7 @@ namespace tue
         inline int32x4& bitwise_shift_right_assignment_operator_si(
             int32x4& lhs, int rhs) noexcept
         {
-            return lhs = _mm_srli_epi32(lhs, rhs);
+            return lhs = _mm_srai_epi32(lhs, rhs);
         }
 
         inline bool equality_operator_ss(
@@ -343,17 +528,57 @@ namespace tue
                 _mm_andnot_si128(nmask, s));
         }
 
-        /*inline int32x4 min_ss(
+        inline int32x4 min_ss(
             const int32x4& s1, const int32x4& s2) noexcept
         {
-            // TODO
+#ifdef TUE_SSE4_1
+            return _mm_min_epi32(s1, s2);
+#else
+            const auto mask = _mm_cmplt_epi32(s1, s2);
+            return _mm_or_si128(
+                _mm_and_si128(mask, s1),
+                _mm_andnot_si128(mask, s2));
+#endif
         }
 
         inline int32x4 max_ss(
             const int32x4& s1, const int32x4& s2) noexcept
         {
-            // TODO
-        }*/
+#ifdef TUE_SSE4_1
+            return _mm_max_epi32(s1, s2);
+#else
+            const auto mask = _mm_cmpgt_epi32(s1, s2);
+            return _mm_or_si128(
+                _mm_and_si128(mask, s1),
+                _mm_andnot_si128(mask, s2));
+#endif
+        }
+
+        inline std::int32_t reduce_add_s(const int32x4& s) noexcept
+        {
+            // Fold the upper half onto the lower half until only the
+            // first component is left.
+            int32x4 x = s;
+            x = addition_operator_ss(x, int32x4(_mm_srli_si128(x, 8)));
+            x = addition_operator_ss(x, int32x4(_mm_srli_si128(x, 4)));
+            return static_cast<std::int32_t>(_mm_cvtsi128_si32(x));
+        }
+
+        inline std::int32_t reduce_min_s(const int32x4& s) noexcept
+        {
+            int32x4 x = s;
+            x = min_ss(x, int32x4(_mm_srli_si128(x, 8)));
+            x = min_ss(x, int32x4(_mm_srli_si128(x, 4)));
+            return static_cast<std::int32_t>(_mm_cvtsi128_si32(x));
+        }
+
+        inline std::int32_t reduce_max_s(const int32x4& s) noexcept
+        {
+            int32x4 x = s;
+            x = max_ss(x, int32x4(_mm_srli_si128(x, 8)));
+            x = max_ss(x, int32x4(_mm_srli_si128(x, 4)));
+            return static_cast<std::int32_t>(_mm_cvtsi128_si32(x));
+        }
 
         inline int32x4 mask_ss(
             const bool32x4& conditions,
@@ -367,9 +592,13 @@ namespace tue
             const int32x4& values,
             const int32x4& otherwise) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
         inline bool32x4 less_ss(
@@ -410,5 +639,120 @@ namespace tue
             return _mm_xor_si128(
                 _mm_cmpeq_epi32(lhs, rhs), int32x4(0xFFFFFFFF));
         }
+
+        template<int I0, int I1, int I2, int I3>
+        inline int32x4 shuffle_s(
+            const int32x4& s,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+            return _mm_shuffle_epi32(s, _MM_SHUFFLE(I3, I2, I1, I0));
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline int32x4 shuffle_ss(
+            const int32x4& lhs,
+            const int32x4& rhs,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+            return _mm_castps_si128(tue::detail_::shuffle_ss(
+                float32x4(_mm_castsi128_ps(lhs)),
+                float32x4(_mm_castsi128_ps(rhs)),
+                std::integer_sequence<int, I0, I1, I2, I3>()));
+        }
+
+        template<int I>
+        inline std::int32_t extract_s(
+            const int32x4& s, std::integral_constant<int, I>) noexcept
+        {
+#ifdef TUE_SSE4_1
+            return static_cast<std::int32_t>(_mm_extract_epi32(s, I));
+#else
+            return static_cast<std::int32_t>(
+                _mm_cvtsi128_si32(_mm_shuffle_epi32(s, I)));
+#endif
+        }
+
+        template<int I>
+        inline int32x4 insert_s(
+            const int32x4& s,
+            std::int32_t x,
+            std::integral_constant<int, I>) noexcept
+        {
+#ifdef TUE_SSE4_1
+            return _mm_insert_epi32(s, static_cast<int>(x), I);
+#else
+            return _mm_insert_epi16(
+                _mm_insert_epi16(s, static_cast<int>(x), 2*I),
+                static_cast<int>(x >> 16),
+                2*I + 1);
+#endif
+        }
+
+        inline int32x4 interleave_lo_ss(
+            const int32x4& lhs, const int32x4& rhs) noexcept
+        {
+            return _mm_unpacklo_epi32(lhs, rhs);
+        }
+
+        inline int32x4 interleave_hi_ss(
+            const int32x4& lhs, const int32x4& rhs) noexcept
+        {
+            return _mm_unpackhi_epi32(lhs, rhs);
+        }
+
+        inline int32x4 round_to_int32_s(const float32x4& s) noexcept
+        {
+            return _mm_cvtps_epi32(s);
+        }
+
+        inline int32x4 trunc_to_int32_s(const float32x4& s) noexcept
+        {
+            return _mm_cvttps_epi32(s);
+        }
+
+        inline int16x8 packs_ss(
+            const int32x4& lo, const int32x4& hi) noexcept
+        {
+            return _mm_packs_epi32(lo, hi);
+        }
+
+        inline uint16x8 packus_ss(
+            const int32x4& lo, const int32x4& hi) noexcept
+        {
+#ifdef TUE_SSE4_1
+            return _mm_packus_epi32(lo, hi);
+#else
+            // Clamp to [0, 0xFFFF] and sign-extend the low 16 bits so that
+            // the signed saturation of _mm_packs_epi32 leaves them alone.
+            const auto max = _mm_set1_epi32(0xFFFF);
+            auto l = _mm_andnot_si128(_mm_srai_epi32(lo, 31), lo);
+            auto h = _mm_andnot_si128(_mm_srai_epi32(hi, 31), hi);
+            l = _mm_or_si128(l, _mm_cmpgt_epi32(l, max));
+            h = _mm_or_si128(h, _mm_cmpgt_epi32(h, max));
+            return _mm_packs_epi32(
+                _mm_srai_epi32(_mm_slli_epi32(l, 16), 16),
+                _mm_srai_epi32(_mm_slli_epi32(h, 16), 16));
+#endif
+        }
+
+        inline int32x4 widen_lo_s(const int16x8& s) noexcept
+        {
+            return _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16);
+        }
+
+        inline int32x4 widen_hi_s(const int16x8& s) noexcept
+        {
+            return _mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16);
+        }
+
+        inline uint32x4 widen_lo_s(const uint16x8& s) noexcept
+        {
+            return _mm_unpacklo_epi16(s, _mm_setzero_si128());
+        }
+
+        inline uint32x4 widen_hi_s(const uint16x8& s) noexcept
+        {
+            return _mm_unpackhi_epi16(s, _mm_setzero_si128());
+        }
     }
 }
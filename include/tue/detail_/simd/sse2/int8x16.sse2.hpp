@@ -12,9 +12,14 @@
 
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "../../../simd.hpp"
 
+#ifdef TUE_SSE4_1
+#include <smmintrin.h>
+#endif
+
 namespace tue
 {
     template<>
@@ -131,6 +136,26 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int8x16 gather(
+            const std::int8_t* base, const simd<I, 16>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static int8x16 gather(
+            const std::int8_t* base,
+            const simd<I, 16>& indices,
+            const bool8x16& conditions) noexcept;
+
+        inline static int8x16 load_partial(
+            const std::int8_t* data, int count) noexcept;
+
+        inline static int8x16 maskload(
+            const std::int8_t* data, const bool8x16& conditions) noexcept;
+
         void store(std::int8_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -141,6 +166,30 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void stream(std::int8_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int8_t* base, const simd<I, 16>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::int8_t* base,
+            const simd<I, 16>& indices,
+            const bool8x16& conditions) const noexcept;
+
+        inline void store_partial(std::int8_t* data, int count) const noexcept;
+
+        inline void maskstore(
+            std::int8_t* data, const bool8x16& conditions) const noexcept;
+
         const std::int8_t* data() const noexcept
         {
             return reinterpret_cast<const std::int8_t*>(&underlying_);
@@ -168,6 +217,76 @@ namespace tue
         return __m128i(s);
     }
 
+    template<typename I, typename>
+    inline int8x16 int8x16::gather(
+        const std::int8_t* base, const simd<I, 16>& indices) noexcept
+    {
+        return tue::detail_::gather_components<int8x16>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline int8x16 int8x16::gather(
+        const std::int8_t* base,
+        const simd<I, 16>& indices,
+        const bool8x16& conditions) noexcept
+    {
+        return tue::detail_::gather_components<int8x16>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void int8x16::scatter(
+        std::int8_t* base, const simd<I, 16>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void int8x16::scatter(
+        std::int8_t* base,
+        const simd<I, 16>& indices,
+        const bool8x16& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline int8x16 int8x16::load_partial(
+        const std::int8_t* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm_cmplt_epi8(
+                _mm_setr_epi8(
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                _mm_set1_epi8(static_cast<char>(count))));
+    }
+
+    inline int8x16 int8x16::maskload(
+        const std::int8_t* data, const bool8x16& conditions) noexcept
+    {
+        if (_mm_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(int8x16)))
+        {
+            return _mm_and_si128(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<int8x16>(data, conditions);
+    }
+
+    inline void int8x16::store_partial(
+        std::int8_t* data, int count) const noexcept
+    {
+        tue::detail_::storeu_partial_si128(data, underlying_, count);
+    }
+
+    inline void int8x16::maskstore(
+        std::int8_t* data, const bool8x16& conditions) const noexcept
+    {
+        _mm_maskmoveu_si128(
+            underlying_,
+            conditions,
+            reinterpret_cast<char*>(data));
+    }
+
     namespace detail_
     {
         inline int8x16 unary_plus_operator_s(const int8x16& s) noexcept
@@ -221,13 +340,20 @@ namespace tue
             return _mm_sub_epi8(lhs, rhs);
         }
 
-        /*inline int8x16 multiplication_operator_ss(
+        inline int8x16 multiplication_operator_ss(
             const int8x16& lhs, const int8x16& rhs) noexcept
         {
-            // TODO
+            // There's no 8-bit multiply, so multiply the even and odd bytes
+            // as 16-bit lanes and merge the low byte of each product.
+            const auto even = _mm_mullo_epi16(lhs, rhs);
+            const auto odd = _mm_mullo_epi16(
+                _mm_srli_epi16(lhs, 8), _mm_srli_epi16(rhs, 8));
+            return _mm_or_si128(
+                _mm_slli_epi16(odd, 8),
+                _mm_and_si128(even, _mm_set1_epi16(0x00FF)));
         }
 
-        inline int8x16 division_operator_ss(
+        /*inline int8x16 division_operator_ss(
             const int8x16& lhs, const int8x16& rhs) noexcept
         {
             // TODO
@@ -281,13 +407,13 @@ namespace tue
             return lhs = _mm_sub_epi8(lhs, rhs);
         }
 
-        /*inline int8x16& multiplication_assignment_operator_ss(
+        inline int8x16& multiplication_assignment_operator_ss(
             int8x16& lhs, const int8x16& rhs) noexcept
         {
-            // TODO
+            return lhs = multiplication_operator_ss(lhs, rhs);
         }
 
-        inline int8x16& division_assignment_operator_ss(
+        /*inline int8x16& division_assignment_operator_ss(
             int8x16& lhs, const int8x16& rhs) noexcept
         {
             // TODO
@@ -349,17 +475,74 @@ namespace tue
                 _mm_andnot_si128(nmask, s));
         }
 
-        /*inline int8x16 min_ss(
+#ifdef TUE_SSE4_1
+        inline int8x16 min_ss(
             const int8x16& s1, const int8x16& s2) noexcept
         {
-            // TODO
+            return _mm_min_epi8(s1, s2);
         }
 
         inline int8x16 max_ss(
             const int8x16& s1, const int8x16& s2) noexcept
         {
-            // TODO
-        }*/
+            return _mm_max_epi8(s1, s2);
+        }
+
+        inline std::int8_t reduce_add_s(const int8x16& s) noexcept
+        {
+            // Sum the bytes of each half with psadbw. Only the low byte of
+            // the total matters, and it's the same for signed components.
+            const __m128i sums = _mm_sad_epu8(s, _mm_setzero_si128());
+            return static_cast<std::int8_t>(_mm_cvtsi128_si32(
+                _mm_add_epi32(sums, _mm_srli_si128(sums, 8))));
+        }
+
+        inline std::int8_t reduce_min_s(const int8x16& s) noexcept
+        {
+            // Fold the upper half onto the lower half until only the
+            // first component is left.
+            int8x16 x = s;
+            x = min_ss(x, int8x16(_mm_srli_si128(x, 8)));
+            x = min_ss(x, int8x16(_mm_srli_si128(x, 4)));
+            x = min_ss(x, int8x16(_mm_srli_si128(x, 2)));
+            x = min_ss(x, int8x16(_mm_srli_si128(x, 1)));
+            return static_cast<std::int8_t>(_mm_cvtsi128_si32(x));
+        }
+
+        inline std::int8_t reduce_max_s(const int8x16& s) noexcept
+        {
+            int8x16 x = s;
+            x = max_ss(x, int8x16(_mm_srli_si128(x, 8)));
+            x = max_ss(x, int8x16(_mm_srli_si128(x, 4)));
+            x = max_ss(x, int8x16(_mm_srli_si128(x, 2)));
+            x = max_ss(x, int8x16(_mm_srli_si128(x, 1)));
+            return static_cast<std::int8_t>(_mm_cvtsi128_si32(x));
+        }
+#endif
+
+        inline int8x16 adds_ss(
+            const int8x16& s1, const int8x16& s2) noexcept
+        {
+            return _mm_adds_epi8(s1, s2);
+        }
+
+        inline int8x16 subs_ss(
+            const int8x16& s1, const int8x16& s2) noexcept
+        {
+            return _mm_subs_epi8(s1, s2);
+        }
+
+        inline int8x16 avg_ss(
+            const int8x16& s1, const int8x16& s2) noexcept
+        {
+            // Bias into the unsigned range and back, which preserves the
+            // rounding of the unsigned average.
+            const auto bias = _mm_set1_epi8(-0x80);
+            return _mm_xor_si128(
+                _mm_avg_epu8(
+                    _mm_xor_si128(s1, bias), _mm_xor_si128(s2, bias)),
+                bias);
+        }
 
         inline int8x16 mask_ss(
             const bool8x16& conditions,
@@ -373,9 +556,13 @@ namespace tue
             const int8x16& values,
             const int8x16& otherwise) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
         inline bool8x16 less_ss(
@@ -413,5 +600,74 @@ namespace tue
         {
             return _mm_xor_si128(_mm_cmpeq_epi8(lhs, rhs), int8x16(0xFFu));
         }
+
+#ifdef TUE_SSE4_1
+        template<int... I>
+        inline int8x16 shuffle_s(
+            const int8x16& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return _mm_shuffle_epi8(s, _mm_setr_epi8(static_cast<char>(I)...));
+        }
+
+        template<int... I>
+        inline int8x16 shuffle_ss(
+            const int8x16& lhs,
+            const int8x16& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            // pshufb zeroes each component whose control byte has its
+            // top bit set, so each source only fills in its own components.
+            return _mm_or_si128(
+                _mm_shuffle_epi8(lhs, _mm_setr_epi8(
+                    static_cast<char>(I < 16 ? I : -128)...)),
+                _mm_shuffle_epi8(rhs, _mm_setr_epi8(
+                    static_cast<char>(I < 16 ? -128 : I - 16)...)));
+        }
+#endif
+
+        template<int I>
+        inline std::int8_t extract_s(
+            const int8x16& s, std::integral_constant<int, I>) noexcept
+        {
+#ifdef TUE_SSE4_1
+            return static_cast<std::int8_t>(_mm_extract_epi8(s, I));
+#else
+            return static_cast<std::int8_t>(
+                _mm_extract_epi16(s, I / 2) >> (I % 2 * 8));
+#endif
+        }
+
+        template<int I>
+        inline int8x16 insert_s(
+            const int8x16& s,
+            std::int8_t x,
+            std::integral_constant<int, I>) noexcept
+        {
+#ifdef TUE_SSE4_1
+            return _mm_insert_epi8(s, static_cast<int>(x), I);
+#else
+            // SSE2 can only insert 16-bit words, so merge x into the word it
+            // lands in.
+            const int word = _mm_extract_epi16(s, I / 2);
+            const int byte = static_cast<std::uint8_t>(x);
+            const int merged = I % 2 == 0
+                ? (word & 0xFF00) | byte
+                : (word & 0x00FF) | (byte << 8);
+            return _mm_insert_epi16(s, merged, I / 2);
+#endif
+        }
+
+        inline int8x16 interleave_lo_ss(
+            const int8x16& lhs, const int8x16& rhs) noexcept
+        {
+            return _mm_unpacklo_epi8(lhs, rhs);
+        }
+
+        inline int8x16 interleave_hi_ss(
+            const int8x16& lhs, const int8x16& rhs) noexcept
+        {
+            return _mm_unpackhi_epi8(lhs, rhs);
+        }
     }
 }
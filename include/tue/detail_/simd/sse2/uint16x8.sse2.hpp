@@ -12,9 +12,14 @@
 
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "../../../simd.hpp"
 
+#ifdef TUE_SSE4_1
+#include <smmintrin.h>
+#endif
+
 namespace tue
 {
     template<>
@@ -122,6 +127,26 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static uint16x8 gather(
+            const std::uint16_t* base, const simd<I, 8>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static uint16x8 gather(
+            const std::uint16_t* base,
+            const simd<I, 8>& indices,
+            const bool16x8& conditions) noexcept;
+
+        inline static uint16x8 load_partial(
+            const std::uint16_t* data, int count) noexcept;
+
+        inline static uint16x8 maskload(
+            const std::uint16_t* data, const bool16x8& conditions) noexcept;
+
         void store(std::uint16_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -132,6 +157,31 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void stream(std::uint16_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::uint16_t* base, const simd<I, 8>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::uint16_t* base,
+            const simd<I, 8>& indices,
+            const bool16x8& conditions) const noexcept;
+
+        inline void store_partial(
+            std::uint16_t* data, int count) const noexcept;
+
+        inline void maskstore(
+            std::uint16_t* data, const bool16x8& conditions) const noexcept;
+
         const std::uint16_t* data() const noexcept
         {
             return reinterpret_cast<const std::uint16_t*>(&underlying_);
@@ -159,6 +209,75 @@ namespace tue
         return __m128i(s);
     }
 
+    template<typename I, typename>
+    inline uint16x8 uint16x8::gather(
+        const std::uint16_t* base, const simd<I, 8>& indices) noexcept
+    {
+        return tue::detail_::gather_components<uint16x8>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline uint16x8 uint16x8::gather(
+        const std::uint16_t* base,
+        const simd<I, 8>& indices,
+        const bool16x8& conditions) noexcept
+    {
+        return tue::detail_::gather_components<uint16x8>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void uint16x8::scatter(
+        std::uint16_t* base, const simd<I, 8>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void uint16x8::scatter(
+        std::uint16_t* base,
+        const simd<I, 8>& indices,
+        const bool16x8& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline uint16x8 uint16x8::load_partial(
+        const std::uint16_t* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm_cmplt_epi16(
+                _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7),
+                _mm_set1_epi16(static_cast<short>(count))));
+    }
+
+    inline uint16x8 uint16x8::maskload(
+        const std::uint16_t* data, const bool16x8& conditions) noexcept
+    {
+        if (_mm_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(uint16x8)))
+        {
+            return _mm_and_si128(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<uint16x8>(data, conditions);
+    }
+
+    inline void uint16x8::store_partial(
+        std::uint16_t* data, int count) const noexcept
+    {
+        tue::detail_::storeu_partial_si128(data, underlying_, count * 2);
+    }
+
+    inline void uint16x8::maskstore(
+        std::uint16_t* data, const bool16x8& conditions) const noexcept
+    {
+        _mm_maskmoveu_si128(
+            underlying_,
+            conditions,
+            reinterpret_cast<char*>(data));
+    }
+
     namespace detail_
     {
         inline uint16x8& pre_increment_operator_s(uint16x8& s) noexcept
@@ -327,17 +446,66 @@ namespace tue
             return s;
         }
 
-        /*inline uint16x8 min_ss(
+#ifdef TUE_SSE4_1
+        inline uint16x8 min_ss(
             const uint16x8& s1, const uint16x8& s2) noexcept
         {
-            // TODO
+            return _mm_min_epu16(s1, s2);
         }
 
         inline uint16x8 max_ss(
             const uint16x8& s1, const uint16x8& s2) noexcept
         {
-            // TODO
-        }*/
+            return _mm_max_epu16(s1, s2);
+        }
+
+        inline std::uint16_t reduce_add_s(const uint16x8& s) noexcept
+        {
+            // Fold the upper half onto the lower half until only the
+            // first component is left.
+            uint16x8 x = s;
+            x = addition_operator_ss(x, uint16x8(_mm_srli_si128(x, 8)));
+            x = addition_operator_ss(x, uint16x8(_mm_srli_si128(x, 4)));
+            x = addition_operator_ss(x, uint16x8(_mm_srli_si128(x, 2)));
+            return static_cast<std::uint16_t>(_mm_cvtsi128_si32(x));
+        }
+
+        inline std::uint16_t reduce_min_s(const uint16x8& s) noexcept
+        {
+            uint16x8 x = s;
+            x = min_ss(x, uint16x8(_mm_srli_si128(x, 8)));
+            x = min_ss(x, uint16x8(_mm_srli_si128(x, 4)));
+            x = min_ss(x, uint16x8(_mm_srli_si128(x, 2)));
+            return static_cast<std::uint16_t>(_mm_cvtsi128_si32(x));
+        }
+
+        inline std::uint16_t reduce_max_s(const uint16x8& s) noexcept
+        {
+            uint16x8 x = s;
+            x = max_ss(x, uint16x8(_mm_srli_si128(x, 8)));
+            x = max_ss(x, uint16x8(_mm_srli_si128(x, 4)));
+            x = max_ss(x, uint16x8(_mm_srli_si128(x, 2)));
+            return static_cast<std::uint16_t>(_mm_cvtsi128_si32(x));
+        }
+#endif
+
+        inline uint16x8 adds_ss(
+            const uint16x8& s1, const uint16x8& s2) noexcept
+        {
+            return _mm_adds_epu16(s1, s2);
+        }
+
+        inline uint16x8 subs_ss(
+            const uint16x8& s1, const uint16x8& s2) noexcept
+        {
+            return _mm_subs_epu16(s1, s2);
+        }
+
+        inline uint16x8 avg_ss(
+            const uint16x8& s1, const uint16x8& s2) noexcept
+        {
+            return _mm_avg_epu16(s1, s2);
+        }
 
         inline uint16x8 mask_ss(
             const bool16x8& conditions,
@@ -351,34 +519,44 @@ namespace tue
             const uint16x8& values,
             const uint16x8& otherwise) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
-        /*inline bool16x8 less_ss(
+#ifdef TUE_SSE4_1
+        inline bool16x8 less_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
+            return _mm_xor_si128(
+                _mm_cmpeq_epi16(_mm_max_epu16(lhs, rhs), lhs),
+                uint16x8(0xFFFF));
         }
 
         inline bool16x8 less_equal_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
+            return _mm_cmpeq_epi16(_mm_max_epu16(lhs, rhs), rhs);
         }
 
         inline bool16x8 greater_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
+            return _mm_xor_si128(
+                _mm_cmpeq_epi16(_mm_min_epu16(lhs, rhs), lhs),
+                uint16x8(0xFFFF));
         }
 
         inline bool16x8 greater_equal_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
         {
-            // TODO
-        }*/
+            return _mm_cmpeq_epi16(_mm_min_epu16(lhs, rhs), rhs);
+        }
+#endif
 
         inline bool16x8 equal_ss(
             const uint16x8& lhs, const uint16x8& rhs) noexcept
@@ -391,5 +569,59 @@ namespace tue
         {
             return _mm_xor_si128(_mm_cmpeq_epi16(lhs, rhs), uint16x8(0xFFFF));
         }
+
+#ifdef TUE_SSE4_1
+        template<int... I>
+        inline uint16x8 shuffle_s(
+            const uint16x8& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return _mm_shuffle_epi8(s, _mm_setr_epi16(
+                static_cast<short>(I * 0x0202 + 0x0100)...));
+        }
+
+        template<int... I>
+        inline uint16x8 shuffle_ss(
+            const uint16x8& lhs,
+            const uint16x8& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            // pshufb zeroes each component whose control byte has its
+            // top bit set, so each source only fills in its own components.
+            return _mm_or_si128(
+                _mm_shuffle_epi8(lhs, _mm_setr_epi16(static_cast<short>(
+                    I < 8 ? I * 0x0202 + 0x0100 : 0x8080)...)),
+                _mm_shuffle_epi8(rhs, _mm_setr_epi16(static_cast<short>(
+                    I < 8 ? 0x8080 : (I - 8) * 0x0202 + 0x0100)...)));
+        }
+#endif
+
+        template<int I>
+        inline std::uint16_t extract_s(
+            const uint16x8& s, std::integral_constant<int, I>) noexcept
+        {
+            return static_cast<std::uint16_t>(_mm_extract_epi16(s, I));
+        }
+
+        template<int I>
+        inline uint16x8 insert_s(
+            const uint16x8& s,
+            std::uint16_t x,
+            std::integral_constant<int, I>) noexcept
+        {
+            return _mm_insert_epi16(s, static_cast<int>(x), I);
+        }
+
+        inline uint16x8 interleave_lo_ss(
+            const uint16x8& lhs, const uint16x8& rhs) noexcept
+        {
+            return _mm_unpacklo_epi16(lhs, rhs);
+        }
+
+        inline uint16x8 interleave_hi_ss(
+            const uint16x8& lhs, const uint16x8& rhs) noexcept
+        {
+            return _mm_unpackhi_epi16(lhs, rhs);
+        }
     }
 }
@@ -12,9 +12,18 @@
 
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "../../../simd.hpp"
 
+#ifdef TUE_SSE4_1
+#include <smmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
 namespace tue
 {
     template<>
@@ -119,6 +128,26 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static uint32x4 gather(
+            const std::uint32_t* base, const simd<I, 4>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static uint32x4 gather(
+            const std::uint32_t* base,
+            const simd<I, 4>& indices,
+            const bool32x4& conditions) noexcept;
+
+        inline static uint32x4 load_partial(
+            const std::uint32_t* data, int count) noexcept;
+
+        inline static uint32x4 maskload(
+            const std::uint32_t* data, const bool32x4& conditions) noexcept;
+
         void store(std::uint32_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -129,6 +158,31 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void stream(std::uint32_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::uint32_t* base, const simd<I, 4>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::uint32_t* base,
+            const simd<I, 4>& indices,
+            const bool32x4& conditions) const noexcept;
+
+        inline void store_partial(
+            std::uint32_t* data, int count) const noexcept;
+
+        inline void maskstore(
+            std::uint32_t* data, const bool32x4& conditions) const noexcept;
+
         const std::uint32_t* data() const noexcept
         {
             return reinterpret_cast<const std::uint32_t*>(&underlying_);
@@ -162,6 +216,116 @@ namespace tue
         return __m128i(s);
     }
 
+    template<typename I, typename>
+    inline uint32x4 uint32x4::gather(
+        const std::uint32_t* base, const simd<I, 4>& indices) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm_i32gather_epi32(
+            reinterpret_cast<const int*>(base), indices, 4);
+#else
+        const __m128i i = indices;
+        const auto i1 = _mm_shuffle_epi32(i, 1);
+        const auto i2 = _mm_shuffle_epi32(i, 2);
+        const auto i3 = _mm_shuffle_epi32(i, 3);
+        return _mm_setr_epi32(
+            static_cast<int>(base[_mm_cvtsi128_si32(i)]),
+            static_cast<int>(base[_mm_cvtsi128_si32(i1)]),
+            static_cast<int>(base[_mm_cvtsi128_si32(i2)]),
+            static_cast<int>(base[_mm_cvtsi128_si32(i3)]));
+#endif
+    }
+
+    template<typename I, typename>
+    inline uint32x4 uint32x4::gather(
+        const std::uint32_t* base,
+        const simd<I, 4>& indices,
+        const bool32x4& conditions) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm_mask_i32gather_epi32(
+            _mm_setzero_si128(),
+            reinterpret_cast<const int*>(base),
+            indices,
+            _mm_castps_si128(conditions),
+            4);
+#else
+        return tue::detail_::gather_components<uint32x4>(
+            base, indices, conditions);
+#endif
+    }
+
+    template<typename I, typename>
+    inline void uint32x4::scatter(
+        std::uint32_t* base, const simd<I, 4>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void uint32x4::scatter(
+        std::uint32_t* base,
+        const simd<I, 4>& indices,
+        const bool32x4& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline uint32x4 uint32x4::load_partial(
+        const std::uint32_t* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm_castsi128_ps(_mm_cmplt_epi32(
+                _mm_setr_epi32(0, 1, 2, 3),
+                _mm_set1_epi32(count))));
+    }
+
+    inline uint32x4 uint32x4::maskload(
+        const std::uint32_t* data, const bool32x4& conditions) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm_maskload_epi32(
+            reinterpret_cast<const int*>(data), _mm_castps_si128(conditions));
+#else
+        if (_mm_movemask_ps(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(uint32x4)))
+        {
+            return _mm_and_si128(loadu(data), _mm_castps_si128(conditions));
+        }
+        return tue::detail_::maskload_components<uint32x4>(data, conditions);
+#endif
+    }
+
+    inline void uint32x4::store_partial(
+        std::uint32_t* data, int count) const noexcept
+    {
+#ifdef TUE_AVX2
+        maskstore(
+            data,
+            _mm_castsi128_ps(_mm_cmplt_epi32(
+                _mm_setr_epi32(0, 1, 2, 3),
+                _mm_set1_epi32(count))));
+#else
+        tue::detail_::storeu_partial_si128(data, underlying_, count * 4);
+#endif
+    }
+
+    inline void uint32x4::maskstore(
+        std::uint32_t* data, const bool32x4& conditions) const noexcept
+    {
+#ifdef TUE_AVX2
+        _mm_maskstore_epi32(
+            reinterpret_cast<int*>(data), _mm_castps_si128(conditions),
+            underlying_);
+#else
+        _mm_maskmoveu_si128(
+            underlying_,
+            _mm_castps_si128(conditions),
+            reinterpret_cast<char*>(data));
+#endif
+    }
+
     namespace detail_
     {
         inline uint32x4& pre_increment_operator_s(uint32x4& s) noexcept
@@ -205,13 +369,15 @@ namespace tue
             return _mm_sub_epi32(lhs, rhs);
         }
 
-        /*inline uint32x4 multiplication_operator_ss(
+#ifdef TUE_SSE4_1
+        inline uint32x4 multiplication_operator_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
+            return _mm_mullo_epi32(lhs, rhs);
         }
+#endif
 
-        inline uint32x4 division_operator_ss(
+        /*inline uint32x4 division_operator_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
         {
             // TODO
@@ -265,13 +431,15 @@ namespace tue
             return lhs = _mm_sub_epi32(lhs, rhs);
         }
 
-        /*inline uint32x4& multiplication_assignment_operator_ss(
+#ifdef TUE_SSE4_1
+        inline uint32x4& multiplication_assignment_operator_ss(
             uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
+            return lhs = _mm_mullo_epi32(lhs, rhs);
         }
+#endif
 
-        inline uint32x4& division_assignment_operator_ss(
+        /*inline uint32x4& division_assignment_operator_ss(
             uint32x4& lhs, const uint32x4& rhs) noexcept
         {
             // TODO
@@ -330,17 +498,45 @@ namespace tue
             return s;
         }
 
-        /*inline uint32x4 min_ss(
+#ifdef TUE_SSE4_1
+        inline uint32x4 min_ss(
             const uint32x4& s1, const uint32x4& s2) noexcept
         {
-            // TODO
+            return _mm_min_epu32(s1, s2);
         }
 
         inline uint32x4 max_ss(
             const uint32x4& s1, const uint32x4& s2) noexcept
         {
-            // TODO
-        }*/
+            return _mm_max_epu32(s1, s2);
+        }
+
+        inline std::uint32_t reduce_add_s(const uint32x4& s) noexcept
+        {
+            // Fold the upper half onto the lower half until only the
+            // first component is left.
+            uint32x4 x = s;
+            x = addition_operator_ss(x, uint32x4(_mm_srli_si128(x, 8)));
+            x = addition_operator_ss(x, uint32x4(_mm_srli_si128(x, 4)));
+            return static_cast<std::uint32_t>(_mm_cvtsi128_si32(x));
+        }
+
+        inline std::uint32_t reduce_min_s(const uint32x4& s) noexcept
+        {
+            uint32x4 x = s;
+            x = min_ss(x, uint32x4(_mm_srli_si128(x, 8)));
+            x = min_ss(x, uint32x4(_mm_srli_si128(x, 4)));
+            return static_cast<std::uint32_t>(_mm_cvtsi128_si32(x));
+        }
+
+        inline std::uint32_t reduce_max_s(const uint32x4& s) noexcept
+        {
+            uint32x4 x = s;
+            x = max_ss(x, uint32x4(_mm_srli_si128(x, 8)));
+            x = max_ss(x, uint32x4(_mm_srli_si128(x, 4)));
+            return static_cast<std::uint32_t>(_mm_cvtsi128_si32(x));
+        }
+#endif
 
         inline uint32x4 mask_ss(
             const bool32x4& conditions,
@@ -354,34 +550,44 @@ namespace tue
             const uint32x4& values,
             const uint32x4& otherwise) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
-        /*inline bool32x4 less_ss(
+#ifdef TUE_SSE4_1
+        inline bool32x4 less_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
+            return _mm_xor_si128(
+                _mm_cmpeq_epi32(_mm_max_epu32(lhs, rhs), lhs),
+                uint32x4(0xFFFFFFFF));
         }
 
         inline bool32x4 less_equal_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
+            return _mm_cmpeq_epi32(_mm_max_epu32(lhs, rhs), rhs);
         }
 
         inline bool32x4 greater_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
+            return _mm_xor_si128(
+                _mm_cmpeq_epi32(_mm_min_epu32(lhs, rhs), lhs),
+                uint32x4(0xFFFFFFFF));
         }
 
         inline bool32x4 greater_equal_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
         {
-            // TODO
-        }*/
+            return _mm_cmpeq_epi32(_mm_min_epu32(lhs, rhs), rhs);
+        }
+#endif
 
         inline bool32x4 equal_ss(
             const uint32x4& lhs, const uint32x4& rhs) noexcept
@@ -395,5 +601,65 @@ namespace tue
             return _mm_xor_si128(
                 _mm_cmpeq_epi32(lhs, rhs), uint32x4(0xFFFFFFFF));
         }
+
+        template<int I0, int I1, int I2, int I3>
+        inline uint32x4 shuffle_s(
+            const uint32x4& s,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+            return _mm_shuffle_epi32(s, _MM_SHUFFLE(I3, I2, I1, I0));
+        }
+
+        template<int I0, int I1, int I2, int I3>
+        inline uint32x4 shuffle_ss(
+            const uint32x4& lhs,
+            const uint32x4& rhs,
+            std::integer_sequence<int, I0, I1, I2, I3>) noexcept
+        {
+            return _mm_castps_si128(tue::detail_::shuffle_ss(
+                float32x4(_mm_castsi128_ps(lhs)),
+                float32x4(_mm_castsi128_ps(rhs)),
+                std::integer_sequence<int, I0, I1, I2, I3>()));
+        }
+
+        template<int I>
+        inline std::uint32_t extract_s(
+            const uint32x4& s, std::integral_constant<int, I>) noexcept
+        {
+#ifdef TUE_SSE4_1
+            return static_cast<std::uint32_t>(_mm_extract_epi32(s, I));
+#else
+            return static_cast<std::uint32_t>(
+                _mm_cvtsi128_si32(_mm_shuffle_epi32(s, I)));
+#endif
+        }
+
+        template<int I>
+        inline uint32x4 insert_s(
+            const uint32x4& s,
+            std::uint32_t x,
+            std::integral_constant<int, I>) noexcept
+        {
+#ifdef TUE_SSE4_1
+            return _mm_insert_epi32(s, static_cast<int>(x), I);
+#else
+            return _mm_insert_epi16(
+                _mm_insert_epi16(s, static_cast<int>(x), 2*I),
+                static_cast<int>(x >> 16),
+                2*I + 1);
+#endif
+        }
+
+        inline uint32x4 interleave_lo_ss(
+            const uint32x4& lhs, const uint32x4& rhs) noexcept
+        {
+            return _mm_unpacklo_epi32(lhs, rhs);
+        }
+
+        inline uint32x4 interleave_hi_ss(
+            const uint32x4& lhs, const uint32x4& rhs) noexcept
+        {
+            return _mm_unpackhi_epi32(lhs, rhs);
+        }
     }
 }
@@ -12,9 +12,18 @@
 
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "../../../simd.hpp"
 
+#ifdef TUE_SSE4_1
+#include <smmintrin.h>
+#endif
+
+#ifdef TUE_AVX
+#include <immintrin.h>
+#endif
+
 namespace tue
 {
     template<>
@@ -115,6 +124,26 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static uint64x2 gather(
+            const std::uint64_t* base, const simd<I, 2>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static uint64x2 gather(
+            const std::uint64_t* base,
+            const simd<I, 2>& indices,
+            const bool64x2& conditions) noexcept;
+
+        inline static uint64x2 load_partial(
+            const std::uint64_t* data, int count) noexcept;
+
+        inline static uint64x2 maskload(
+            const std::uint64_t* data, const bool64x2& conditions) noexcept;
+
         void store(std::uint64_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -125,6 +154,31 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void stream(std::uint64_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::uint64_t* base, const simd<I, 2>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::uint64_t* base,
+            const simd<I, 2>& indices,
+            const bool64x2& conditions) const noexcept;
+
+        inline void store_partial(
+            std::uint64_t* data, int count) const noexcept;
+
+        inline void maskstore(
+            std::uint64_t* data, const bool64x2& conditions) const noexcept;
+
         const std::uint64_t* data() const noexcept
         {
             return reinterpret_cast<const std::uint64_t*>(&underlying_);
@@ -152,6 +206,106 @@ namespace tue
         return __m128i(s);
     }
 
+    template<typename I, typename>
+    inline uint64x2 uint64x2::gather(
+        const std::uint64_t* base, const simd<I, 2>& indices) noexcept
+    {
+        // Two scalar loads are at least as fast as a gather instruction.
+        const auto idata = reinterpret_cast<const I*>(&indices);
+        return _mm_set_epi64x(
+            static_cast<long long>(base[idata[1]]),
+            static_cast<long long>(base[idata[0]]));
+    }
+
+    template<typename I, typename>
+    inline uint64x2 uint64x2::gather(
+        const std::uint64_t* base,
+        const simd<I, 2>& indices,
+        const bool64x2& conditions) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm_mask_i32gather_epi64(
+            _mm_setzero_si128(),
+            reinterpret_cast<const long long*>(base),
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&indices)),
+            conditions,
+            8);
+#else
+        return tue::detail_::gather_components<uint64x2>(
+            base, indices, conditions);
+#endif
+    }
+
+    template<typename I, typename>
+    inline void uint64x2::scatter(
+        std::uint64_t* base, const simd<I, 2>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void uint64x2::scatter(
+        std::uint64_t* base,
+        const simd<I, 2>& indices,
+        const bool64x2& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline uint64x2 uint64x2::load_partial(
+        const std::uint64_t* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm_cmplt_epi32(
+                _mm_setr_epi32(0, 0, 1, 1),
+                _mm_set1_epi32(count)));
+    }
+
+    inline uint64x2 uint64x2::maskload(
+        const std::uint64_t* data, const bool64x2& conditions) noexcept
+    {
+#ifdef TUE_AVX2
+        return _mm_maskload_epi64(
+            reinterpret_cast<const long long*>(data), conditions);
+#else
+        if (_mm_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(uint64x2)))
+        {
+            return _mm_and_si128(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<uint64x2>(data, conditions);
+#endif
+    }
+
+    inline void uint64x2::store_partial(
+        std::uint64_t* data, int count) const noexcept
+    {
+#ifdef TUE_AVX2
+        maskstore(
+            data,
+            _mm_cmplt_epi32(
+                _mm_setr_epi32(0, 0, 1, 1),
+                _mm_set1_epi32(count)));
+#else
+        tue::detail_::storeu_partial_si128(data, underlying_, count * 8);
+#endif
+    }
+
+    inline void uint64x2::maskstore(
+        std::uint64_t* data, const bool64x2& conditions) const noexcept
+    {
+#ifdef TUE_AVX2
+        _mm_maskstore_epi64(
+            reinterpret_cast<long long*>(data), conditions, underlying_);
+#else
+        _mm_maskmoveu_si128(
+            underlying_,
+            conditions,
+            reinterpret_cast<char*>(data));
+#endif
+    }
+
     namespace detail_
     {
         inline uint64x2& pre_increment_operator_s(uint64x2& s) noexcept
@@ -195,13 +349,19 @@ namespace tue
             return _mm_sub_epi64(lhs, rhs);
         }
 
-        /*inline uint64x2 multiplication_operator_ss(
+        inline uint64x2 multiplication_operator_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
-            // TODO
+            // There's no 64-bit multiply, so assemble the low 64 bits of
+            // each product from 32x32-bit partial products.
+            const auto lo = _mm_mul_epu32(lhs, rhs);
+            const auto cross = _mm_add_epi64(
+                _mm_mul_epu32(_mm_srli_epi64(lhs, 32), rhs),
+                _mm_mul_epu32(lhs, _mm_srli_epi64(rhs, 32)));
+            return _mm_add_epi64(lo, _mm_slli_epi64(cross, 32));
         }
 
-        inline uint64x2 division_operator_ss(
+        /*inline uint64x2 division_operator_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
             // TODO
@@ -255,13 +415,13 @@ namespace tue
             return lhs = _mm_sub_epi64(lhs, rhs);
         }
 
-        /*inline uint64x2& multiplication_assignment_operator_ss(
+        inline uint64x2& multiplication_assignment_operator_ss(
             uint64x2& lhs, const uint64x2& rhs) noexcept
         {
-            // TODO
+            return lhs = multiplication_operator_ss(lhs, rhs);
         }
 
-        inline uint64x2& division_assignment_operator_ss(
+        /*inline uint64x2& division_assignment_operator_ss(
             uint64x2& lhs, const uint64x2& rhs) noexcept
         {
             // TODO
@@ -320,17 +480,54 @@ namespace tue
             return s;
         }
 
-        /*inline uint64x2 min_ss(
+        inline uint64x2 min_ss(
             const uint64x2& s1, const uint64x2& s2) noexcept
         {
-            // TODO
+            const auto bias = uint64x2(1ull << 63);
+            const auto gt = cmpgt_epi64(
+                _mm_xor_si128(s1, bias), _mm_xor_si128(s2, bias));
+            return _mm_or_si128(
+                _mm_and_si128(gt, s2), _mm_andnot_si128(gt, s1));
         }
 
         inline uint64x2 max_ss(
             const uint64x2& s1, const uint64x2& s2) noexcept
         {
-            // TODO
-        }*/
+            const auto bias = uint64x2(1ull << 63);
+            const auto gt = cmpgt_epi64(
+                _mm_xor_si128(s1, bias), _mm_xor_si128(s2, bias));
+            return _mm_or_si128(
+                _mm_and_si128(gt, s1), _mm_andnot_si128(gt, s2));
+        }
+
+        inline std::uint64_t reduce_add_s(const uint64x2& s) noexcept
+        {
+            // Fold the upper half onto the lower half until only the
+            // first component is left.
+            uint64x2 x = s;
+            x = addition_operator_ss(x, uint64x2(_mm_srli_si128(x, 8)));
+            std::uint64_t result;
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(&result), x);
+            return result;
+        }
+
+        inline std::uint64_t reduce_min_s(const uint64x2& s) noexcept
+        {
+            uint64x2 x = s;
+            x = min_ss(x, uint64x2(_mm_srli_si128(x, 8)));
+            std::uint64_t result;
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(&result), x);
+            return result;
+        }
+
+        inline std::uint64_t reduce_max_s(const uint64x2& s) noexcept
+        {
+            uint64x2 x = s;
+            x = max_ss(x, uint64x2(_mm_srli_si128(x, 8)));
+            std::uint64_t result;
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(&result), x);
+            return result;
+        }
 
         inline uint64x2 mask_ss(
             const bool64x2& conditions,
@@ -344,42 +541,62 @@ namespace tue
             const uint64x2& values,
             const uint64x2& otherwise) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
-        /*inline bool64x2 less_ss(
+        inline bool64x2 less_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
-            // TODO
+            const auto bias = uint64x2(1ull << 63);
+            return cmpgt_epi64(
+                _mm_xor_si128(rhs, bias), _mm_xor_si128(lhs, bias));
         }
 
         inline bool64x2 less_equal_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
-            // TODO
+            const auto bias = uint64x2(1ull << 63);
+            return _mm_xor_si128(
+                cmpgt_epi64(
+                    _mm_xor_si128(lhs, bias), _mm_xor_si128(rhs, bias)),
+                uint64x2(~0ull));
         }
 
         inline bool64x2 greater_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
-            // TODO
+            const auto bias = uint64x2(1ull << 63);
+            return cmpgt_epi64(
+                _mm_xor_si128(lhs, bias), _mm_xor_si128(rhs, bias));
         }
 
         inline bool64x2 greater_equal_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
-            // TODO
-        }*/
+            const auto bias = uint64x2(1ull << 63);
+            return _mm_xor_si128(
+                cmpgt_epi64(
+                    _mm_xor_si128(rhs, bias), _mm_xor_si128(lhs, bias)),
+                uint64x2(~0ull));
+        }
 
         inline bool64x2 equal_ss(
             const uint64x2& lhs, const uint64x2& rhs) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_cmpeq_epi64(lhs, rhs);
+#else
             const auto cmp = _mm_cmpeq_epi32(lhs, rhs);
             const auto hi = _mm_shuffle_epi32(cmp, _MM_SHUFFLE(3, 3, 1, 1));
             const auto lo = _mm_shuffle_epi32(cmp, _MM_SHUFFLE(2, 2, 0, 0));
             return _mm_and_si128(hi, lo);
+#endif
         }
 
         inline bool64x2 not_equal_ss(
@@ -387,5 +604,62 @@ namespace tue
         {
             return _mm_xor_si128(equal_ss(lhs, rhs), uint64x2(~0ull));
         }
+
+        template<int I0, int I1>
+        inline uint64x2 shuffle_s(
+            const uint64x2& s,
+            std::integer_sequence<int, I0, I1>) noexcept
+        {
+            return _mm_shuffle_epi32(
+                s, _MM_SHUFFLE(2*I1 + 1, 2*I1, 2*I0 + 1, 2*I0));
+        }
+
+        template<int I0, int I1>
+        inline uint64x2 shuffle_ss(
+            const uint64x2& lhs,
+            const uint64x2& rhs,
+            std::integer_sequence<int, I0, I1>) noexcept
+        {
+            return _mm_castpd_si128(_mm_shuffle_pd(
+                _mm_castsi128_pd(I0 < 2 ? lhs : rhs),
+                _mm_castsi128_pd(I1 < 2 ? lhs : rhs),
+                (I0 % 2) | ((I1 % 2) << 1)));
+        }
+
+        template<int I>
+        inline std::uint64_t extract_s(
+            const uint64x2& s, std::integral_constant<int, I>) noexcept
+        {
+            std::uint64_t result;
+            _mm_storel_epi64(
+                reinterpret_cast<__m128i*>(&result),
+                _mm_srli_si128(s, I * 8));
+            return result;
+        }
+
+        template<int I>
+        inline uint64x2 insert_s(
+            const uint64x2& s,
+            std::uint64_t x,
+            std::integral_constant<int, I>) noexcept
+        {
+            const __m128i t = uint64x2(x);
+            return I == 0
+                ? _mm_castpd_si128(_mm_move_sd(
+                    _mm_castsi128_pd(s), _mm_castsi128_pd(t)))
+                : _mm_unpacklo_epi64(s, t);
+        }
+
+        inline uint64x2 interleave_lo_ss(
+            const uint64x2& lhs, const uint64x2& rhs) noexcept
+        {
+            return _mm_unpacklo_epi64(lhs, rhs);
+        }
+
+        inline uint64x2 interleave_hi_ss(
+            const uint64x2& lhs, const uint64x2& rhs) noexcept
+        {
+            return _mm_unpackhi_epi64(lhs, rhs);
+        }
     }
 }
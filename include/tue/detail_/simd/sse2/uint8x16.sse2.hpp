@@ -12,9 +12,14 @@
 
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "../../../simd.hpp"
 
+#ifdef TUE_SSE4_1
+#include <smmintrin.h>
+#endif
+
 namespace tue
 {
     template<>
@@ -131,6 +136,26 @@ namespace tue
             return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static uint8x16 gather(
+            const std::uint8_t* base, const simd<I, 16>& indices) noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline static uint8x16 gather(
+            const std::uint8_t* base,
+            const simd<I, 16>& indices,
+            const bool8x16& conditions) noexcept;
+
+        inline static uint8x16 load_partial(
+            const std::uint8_t* data, int count) noexcept;
+
+        inline static uint8x16 maskload(
+            const std::uint8_t* data, const bool8x16& conditions) noexcept;
+
         void store(std::uint8_t* data) const noexcept
         {
             _mm_store_si128(reinterpret_cast<__m128i*>(data), underlying_);
@@ -141,6 +166,31 @@ namespace tue
             _mm_storeu_si128(reinterpret_cast<__m128i*>(data), underlying_);
         }
 
+        void stream(std::uint8_t* data) const noexcept
+        {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data), underlying_);
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::uint8_t* base, const simd<I, 16>& indices) const noexcept;
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        inline void scatter(
+            std::uint8_t* base,
+            const simd<I, 16>& indices,
+            const bool8x16& conditions) const noexcept;
+
+        inline void store_partial(
+            std::uint8_t* data, int count) const noexcept;
+
+        inline void maskstore(
+            std::uint8_t* data, const bool8x16& conditions) const noexcept;
+
         const std::uint8_t* data() const noexcept
         {
             return reinterpret_cast<const std::uint8_t*>(&underlying_);
@@ -168,6 +218,76 @@ namespace tue
         return __m128i(s);
     }
 
+    template<typename I, typename>
+    inline uint8x16 uint8x16::gather(
+        const std::uint8_t* base, const simd<I, 16>& indices) noexcept
+    {
+        return tue::detail_::gather_components<uint8x16>(base, indices);
+    }
+
+    template<typename I, typename>
+    inline uint8x16 uint8x16::gather(
+        const std::uint8_t* base,
+        const simd<I, 16>& indices,
+        const bool8x16& conditions) noexcept
+    {
+        return tue::detail_::gather_components<uint8x16>(
+            base, indices, conditions);
+    }
+
+    template<typename I, typename>
+    inline void uint8x16::scatter(
+        std::uint8_t* base, const simd<I, 16>& indices) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices);
+    }
+
+    template<typename I, typename>
+    inline void uint8x16::scatter(
+        std::uint8_t* base,
+        const simd<I, 16>& indices,
+        const bool8x16& conditions) const noexcept
+    {
+        tue::detail_::scatter_components(*this, base, indices, conditions);
+    }
+
+    inline uint8x16 uint8x16::load_partial(
+        const std::uint8_t* data, int count) noexcept
+    {
+        return maskload(
+            data,
+            _mm_cmplt_epi8(
+                _mm_setr_epi8(
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                _mm_set1_epi8(static_cast<char>(count))));
+    }
+
+    inline uint8x16 uint8x16::maskload(
+        const std::uint8_t* data, const bool8x16& conditions) noexcept
+    {
+        if (_mm_movemask_epi8(conditions) != 0
+            && tue::detail_::within_page(data, sizeof(uint8x16)))
+        {
+            return _mm_and_si128(loadu(data), conditions);
+        }
+        return tue::detail_::maskload_components<uint8x16>(data, conditions);
+    }
+
+    inline void uint8x16::store_partial(
+        std::uint8_t* data, int count) const noexcept
+    {
+        tue::detail_::storeu_partial_si128(data, underlying_, count);
+    }
+
+    inline void uint8x16::maskstore(
+        std::uint8_t* data, const bool8x16& conditions) const noexcept
+    {
+        _mm_maskmoveu_si128(
+            underlying_,
+            conditions,
+            reinterpret_cast<char*>(data));
+    }
+
     namespace detail_
     {
         inline uint8x16& pre_increment_operator_s(uint8x16& s) noexcept
@@ -211,13 +331,20 @@ namespace tue
             return _mm_sub_epi8(lhs, rhs);
         }
 
-        /*inline uint8x16 multiplication_operator_ss(
+        inline uint8x16 multiplication_operator_ss(
             const uint8x16& lhs, const uint8x16& rhs) noexcept
         {
-            // TODO
+            // There's no 8-bit multiply, so multiply the even and odd bytes
+            // as 16-bit lanes and merge the low byte of each product.
+            const auto even = _mm_mullo_epi16(lhs, rhs);
+            const auto odd = _mm_mullo_epi16(
+                _mm_srli_epi16(lhs, 8), _mm_srli_epi16(rhs, 8));
+            return _mm_or_si128(
+                _mm_slli_epi16(odd, 8),
+                _mm_and_si128(even, _mm_set1_epi16(0x00FF)));
         }
 
-        inline uint8x16 division_operator_ss(
+        /*inline uint8x16 division_operator_ss(
             const uint8x16& lhs, const uint8x16& rhs) noexcept
         {
             // TODO
@@ -271,13 +398,13 @@ namespace tue
             return lhs = _mm_sub_epi8(lhs, rhs);
         }
 
-        /*inline uint8x16& multiplication_assignment_operator_ss(
+        inline uint8x16& multiplication_assignment_operator_ss(
             uint8x16& lhs, const uint8x16& rhs) noexcept
         {
-            // TODO
+            return lhs = multiplication_operator_ss(lhs, rhs);
         }
 
-        inline uint8x16& division_assignment_operator_ss(
+        /*inline uint8x16& division_assignment_operator_ss(
             uint8x16& lhs, const uint8x16& rhs) noexcept
         {
             // TODO
@@ -348,6 +475,55 @@ namespace tue
             return _mm_max_epu8(s1, s2);
         }
 
+        inline std::uint8_t reduce_add_s(const uint8x16& s) noexcept
+        {
+            // Sum the bytes of each half with psadbw. Only the low byte of
+            // the total matters, and it's the same for signed components.
+            const __m128i sums = _mm_sad_epu8(s, _mm_setzero_si128());
+            return static_cast<std::uint8_t>(_mm_cvtsi128_si32(
+                _mm_add_epi32(sums, _mm_srli_si128(sums, 8))));
+        }
+
+        inline std::uint8_t reduce_min_s(const uint8x16& s) noexcept
+        {
+            // Fold the upper half onto the lower half until only the
+            // first component is left.
+            uint8x16 x = s;
+            x = min_ss(x, uint8x16(_mm_srli_si128(x, 8)));
+            x = min_ss(x, uint8x16(_mm_srli_si128(x, 4)));
+            x = min_ss(x, uint8x16(_mm_srli_si128(x, 2)));
+            x = min_ss(x, uint8x16(_mm_srli_si128(x, 1)));
+            return static_cast<std::uint8_t>(_mm_cvtsi128_si32(x));
+        }
+
+        inline std::uint8_t reduce_max_s(const uint8x16& s) noexcept
+        {
+            uint8x16 x = s;
+            x = max_ss(x, uint8x16(_mm_srli_si128(x, 8)));
+            x = max_ss(x, uint8x16(_mm_srli_si128(x, 4)));
+            x = max_ss(x, uint8x16(_mm_srli_si128(x, 2)));
+            x = max_ss(x, uint8x16(_mm_srli_si128(x, 1)));
+            return static_cast<std::uint8_t>(_mm_cvtsi128_si32(x));
+        }
+
+        inline uint8x16 adds_ss(
+            const uint8x16& s1, const uint8x16& s2) noexcept
+        {
+            return _mm_adds_epu8(s1, s2);
+        }
+
+        inline uint8x16 subs_ss(
+            const uint8x16& s1, const uint8x16& s2) noexcept
+        {
+            return _mm_subs_epu8(s1, s2);
+        }
+
+        inline uint8x16 avg_ss(
+            const uint8x16& s1, const uint8x16& s2) noexcept
+        {
+            return _mm_avg_epu8(s1, s2);
+        }
+
         inline uint8x16 mask_ss(
             const bool8x16& conditions,
             const uint8x16& values) noexcept
@@ -360,9 +536,13 @@ namespace tue
             const uint8x16& values,
             const uint8x16& otherwise) noexcept
         {
+#ifdef TUE_SSE4_1
+            return _mm_blendv_epi8(otherwise, values, conditions);
+#else
             return _mm_or_si128(
                 _mm_and_si128(conditions, values),
                 _mm_andnot_si128(conditions, otherwise));
+#endif
         }
 
         /*inline bool8x16 less_ss(
@@ -400,5 +580,74 @@ namespace tue
         {
             return _mm_xor_si128(_mm_cmpeq_epi8(lhs, rhs), uint8x16(0xFF));
         }
+
+#ifdef TUE_SSE4_1
+        template<int... I>
+        inline uint8x16 shuffle_s(
+            const uint8x16& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            return _mm_shuffle_epi8(s, _mm_setr_epi8(static_cast<char>(I)...));
+        }
+
+        template<int... I>
+        inline uint8x16 shuffle_ss(
+            const uint8x16& lhs,
+            const uint8x16& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            // pshufb zeroes each component whose control byte has its
+            // top bit set, so each source only fills in its own components.
+            return _mm_or_si128(
+                _mm_shuffle_epi8(lhs, _mm_setr_epi8(
+                    static_cast<char>(I < 16 ? I : -128)...)),
+                _mm_shuffle_epi8(rhs, _mm_setr_epi8(
+                    static_cast<char>(I < 16 ? -128 : I - 16)...)));
+        }
+#endif
+
+        template<int I>
+        inline std::uint8_t extract_s(
+            const uint8x16& s, std::integral_constant<int, I>) noexcept
+        {
+#ifdef TUE_SSE4_1
+            return static_cast<std::uint8_t>(_mm_extract_epi8(s, I));
+#else
+            return static_cast<std::uint8_t>(
+                _mm_extract_epi16(s, I / 2) >> (I % 2 * 8));
+#endif
+        }
+
+        template<int I>
+        inline uint8x16 insert_s(
+            const uint8x16& s,
+            std::uint8_t x,
+            std::integral_constant<int, I>) noexcept
+        {
+#ifdef TUE_SSE4_1
+            return _mm_insert_epi8(s, static_cast<int>(x), I);
+#else
+            // SSE2 can only insert 16-bit words, so merge x into the word it
+            // lands in.
+            const int word = _mm_extract_epi16(s, I / 2);
+            const int byte = static_cast<std::uint8_t>(x);
+            const int merged = I % 2 == 0
+                ? (word & 0xFF00) | byte
+                : (word & 0x00FF) | (byte << 8);
+            return _mm_insert_epi16(s, merged, I / 2);
+#endif
+        }
+
+        inline uint8x16 interleave_lo_ss(
+            const uint8x16& lhs, const uint8x16& rhs) noexcept
+        {
+            return _mm_unpacklo_epi8(lhs, rhs);
+        }
+
+        inline uint8x16 interleave_hi_ss(
+            const uint8x16& lhs, const uint8x16& rhs) noexcept
+        {
+            return _mm_unpackhi_epi8(lhs, rhs);
+        }
     }
 }
@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "../math.hpp"
 #include "../simd.hpp"
@@ -86,6 +88,56 @@ namespace tue
             return s;
         }
 
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        static simd<T, 2> gather(
+            const T* base, const simd<I, 2>& indices) noexcept
+        {
+            const auto idata = reinterpret_cast<const I*>(&indices);
+            simd<T, 2> s;
+            s.data_[0] = base[idata[0]];
+            s.data_[1] = base[idata[1]];
+            return s;
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        static simd<T, 2> gather(
+            const T* base,
+            const simd<I, 2>& indices,
+            const simd<sized_bool_t<sizeof(T)>, 2>& conditions) noexcept
+        {
+            const auto idata = reinterpret_cast<const I*>(&indices);
+            const auto cdata = reinterpret_cast<
+                const sized_bool_t<sizeof(T)>*>(&conditions);
+            simd<T, 2> s;
+            s.data_[0] = cdata[0] ? base[idata[0]] : static_cast<T>(0);
+            s.data_[1] = cdata[1] ? base[idata[1]] : static_cast<T>(0);
+            return s;
+        }
+
+        static simd<T, 2> load_partial(const T* data, int count) noexcept
+        {
+            simd<T, 2> s;
+            s.data_[0] = count > 0 ? data[0] : static_cast<T>(0);
+            s.data_[1] = count > 1 ? data[1] : static_cast<T>(0);
+            return s;
+        }
+
+        static simd<T, 2> maskload(
+            const T* data,
+            const simd<sized_bool_t<sizeof(T)>, 2>& conditions) noexcept
+        {
+            const auto cdata = reinterpret_cast<
+                const sized_bool_t<sizeof(T)>*>(&conditions);
+            simd<T, 2> s;
+            s.data_[0] = cdata[0] ? data[0] : static_cast<T>(0);
+            s.data_[1] = cdata[1] ? data[1] : static_cast<T>(0);
+            return s;
+        }
+
         void store(T* data) const noexcept
         {
             data[0] = this->data_[0];
@@ -98,6 +150,53 @@ namespace tue
             data[1] = this->data_[1];
         }
 
+        void stream(T* data) const noexcept
+        {
+            data[0] = this->data_[0];
+            data[1] = this->data_[1];
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        void scatter(T* base, const simd<I, 2>& indices) const noexcept
+        {
+            const auto idata = reinterpret_cast<const I*>(&indices);
+            base[idata[0]] = this->data_[0];
+            base[idata[1]] = this->data_[1];
+        }
+
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        void scatter(
+            T* base,
+            const simd<I, 2>& indices,
+            const simd<sized_bool_t<sizeof(T)>, 2>& conditions) const noexcept
+        {
+            const auto idata = reinterpret_cast<const I*>(&indices);
+            const auto cdata = reinterpret_cast<
+                const sized_bool_t<sizeof(T)>*>(&conditions);
+            if (cdata[0]) base[idata[0]] = this->data_[0];
+            if (cdata[1]) base[idata[1]] = this->data_[1];
+        }
+
+        void store_partial(T* data, int count) const noexcept
+        {
+            if (count > 0) data[0] = this->data_[0];
+            if (count > 1) data[1] = this->data_[1];
+        }
+
+        void maskstore(
+            T* data,
+            const simd<sized_bool_t<sizeof(T)>, 2>& conditions) const noexcept
+        {
+            const auto cdata = reinterpret_cast<
+                const sized_bool_t<sizeof(T)>*>(&conditions);
+            if (cdata[0]) data[0] = this->data_[0];
+            if (cdata[1]) data[1] = this->data_[1];
+        }
+
         const T* data() const noexcept
         {
             return this->data_;
@@ -142,6 +241,7 @@ namespace tue
             return result;
         }
 
+#ifndef TUE_VECTOR_EXT
         template<typename T>
         inline simd<T, 2> unary_minus_operator_s(const simd<T, 2>& s) noexcept
         {
@@ -152,6 +252,7 @@ namespace tue
             rdata[1] = -sdata[1];
             return result;
         }
+#endif
 
         template<typename T>
         inline simd<T, 2>& pre_decrement_operator_s(simd<T, 2>& s) noexcept
@@ -173,6 +274,7 @@ namespace tue
             return result;
         }
 
+#ifndef TUE_VECTOR_EXT
         template<typename T>
         inline simd<T, 2> bitwise_not_operator_s(const simd<T, 2>& s) noexcept
         {
@@ -222,6 +324,7 @@ namespace tue
             sdata[1] = ldata[1] * rdata[1];
             return s;
         }
+#endif
 
         template<typename T>
         inline simd<T, 2> division_operator_ss(
@@ -249,6 +352,7 @@ namespace tue
             return s;
         }
 
+#ifndef TUE_VECTOR_EXT
         template<typename T>
         inline simd<T, 2> bitwise_and_operator_ss(
             const simd<T, 2>& lhs, const simd<T, 2>& rhs) noexcept
@@ -312,6 +416,32 @@ namespace tue
             return s;
         }
 
+        template<typename T>
+        inline simd<T, 2> bitwise_shift_left_operator_ss(
+            const simd<T, 2>& lhs, const simd<T, 2>& rhs) noexcept
+        {
+            simd<T, 2> s;
+            const auto sdata = s.data();
+            const auto ldata = lhs.data();
+            const auto rdata = rhs.data();
+            sdata[0] = ldata[0] << rdata[0];
+            sdata[1] = ldata[1] << rdata[1];
+            return s;
+        }
+
+        template<typename T>
+        inline simd<T, 2> bitwise_shift_right_operator_ss(
+            const simd<T, 2>& lhs, const simd<T, 2>& rhs) noexcept
+        {
+            simd<T, 2> s;
+            const auto sdata = s.data();
+            const auto ldata = lhs.data();
+            const auto rdata = rhs.data();
+            sdata[0] = ldata[0] >> rdata[0];
+            sdata[1] = ldata[1] >> rdata[1];
+            return s;
+        }
+
         template<typename T>
         inline simd<T, 2>& addition_assignment_operator_ss(
             simd<T, 2>& lhs, const simd<T, 2>& rhs) noexcept
@@ -344,6 +474,7 @@ namespace tue
             ldata[1] *= rdata[1];
             return lhs;
         }
+#endif
 
         template<typename T>
         inline simd<T, 2>& division_assignment_operator_ss(
@@ -367,6 +498,7 @@ namespace tue
             return lhs;
         }
 
+#ifndef TUE_VECTOR_EXT
         template<typename T>
         inline simd<T, 2>& bitwise_and_assignment_operator_ss(
             simd<T, 2>& lhs, const simd<T, 2>& rhs) noexcept
@@ -420,6 +552,29 @@ namespace tue
             return lhs;
         }
 
+        template<typename T>
+        inline simd<T, 2>& bitwise_shift_left_assignment_operator_ss(
+            simd<T, 2>& lhs, const simd<T, 2>& rhs) noexcept
+        {
+            const auto ldata = lhs.data();
+            const auto rdata = rhs.data();
+            ldata[0] <<= rdata[0];
+            ldata[1] <<= rdata[1];
+            return lhs;
+        }
+
+        template<typename T>
+        inline simd<T, 2>& bitwise_shift_right_assignment_operator_ss(
+            simd<T, 2>& lhs, const simd<T, 2>& rhs) noexcept
+        {
+            const auto ldata = lhs.data();
+            const auto rdata = rhs.data();
+            ldata[0] >>= rdata[0];
+            ldata[1] >>= rdata[1];
+            return lhs;
+        }
+#endif
+
         template<typename T>
         inline bool equality_operator_ss(
             const simd<T, 2>& lhs, const simd<T, 2>& rhs) noexcept
@@ -473,6 +628,63 @@ namespace tue
             tue::math::sincos(sdata[1], sout[1], cout[1]);
         }
 
+        template<typename T>
+        inline simd<T, 2> tan_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::tan(sdata[0]);
+            rdata[1] = tue::math::tan(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> asin_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::asin(sdata[0]);
+            rdata[1] = tue::math::asin(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> acos_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::acos(sdata[0]);
+            rdata[1] = tue::math::acos(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> atan_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::atan(sdata[0]);
+            rdata[1] = tue::math::atan(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> atan2_ss(
+            const simd<T, 2>& y, const simd<T, 2>& x) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto ydata = y.data();
+            const auto xdata = x.data();
+            rdata[0] = tue::math::atan2(ydata[0], xdata[0]);
+            rdata[1] = tue::math::atan2(ydata[1], xdata[1]);
+            return result;
+        }
+
         template<typename T>
         inline simd<T, 2> exp_s(const simd<T, 2>& s) noexcept
         {
@@ -484,6 +696,17 @@ namespace tue
             return result;
         }
 
+        template<typename T>
+        inline simd<T, 2> exp2_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::exp2(sdata[0]);
+            rdata[1] = tue::math::exp2(sdata[1]);
+            return result;
+        }
+
         template<typename T>
         inline simd<T, 2> log_s(const simd<T, 2>& s) noexcept
         {
@@ -495,6 +718,28 @@ namespace tue
             return result;
         }
 
+        template<typename T>
+        inline simd<T, 2> log2_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::log2(sdata[0]);
+            rdata[1] = tue::math::log2(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> log10_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::log10(sdata[0]);
+            rdata[1] = tue::math::log10(sdata[1]);
+            return result;
+        }
+
         template<typename T>
         inline simd<T, 2> abs_s(const simd<T, 2>& s) noexcept
         {
@@ -541,6 +786,17 @@ namespace tue
             return result;
         }
 
+        template<typename T>
+        inline simd<T, 2> cbrt_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::cbrt(sdata[0]);
+            rdata[1] = tue::math::cbrt(sdata[1]);
+            return result;
+        }
+
         template<typename T>
         inline simd<T, 2> rsqrt_s(const simd<T, 2>& s) noexcept
         {
@@ -552,6 +808,235 @@ namespace tue
             return result;
         }
 
+        template<typename T>
+        inline simd<T, 2> fast_sin_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::fast::sin(sdata[0]);
+            rdata[1] = tue::math::fast::sin(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> fast_cos_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::fast::cos(sdata[0]);
+            rdata[1] = tue::math::fast::cos(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline void fast_sincos_s(
+            const simd<T, 2>& s,
+            simd<T, 2>& sin_out,
+            simd<T, 2>& cos_out) noexcept
+        {
+            const auto sdata = s.data();
+            const auto sout = sin_out.data();
+            const auto cout = cos_out.data();
+            tue::math::fast::sincos(sdata[0], sout[0], cout[0]);
+            tue::math::fast::sincos(sdata[1], sout[1], cout[1]);
+        }
+
+        template<typename T>
+        inline simd<T, 2> fast_exp_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::fast::exp(sdata[0]);
+            rdata[1] = tue::math::fast::exp(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> fast_log_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::fast::log(sdata[0]);
+            rdata[1] = tue::math::fast::log(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> fast_pow_ss(
+            const simd<T, 2>& bases, const simd<T, 2>& exponents) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto bdata = bases.data();
+            const auto edata = exponents.data();
+            rdata[0] = tue::math::fast::pow(bdata[0], edata[0]);
+            rdata[1] = tue::math::fast::pow(bdata[1], edata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> fast_recip_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::fast::recip(sdata[0]);
+            rdata[1] = tue::math::fast::recip(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> fast_rsqrt_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::fast::rsqrt(sdata[0]);
+            rdata[1] = tue::math::fast::rsqrt(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> precise_sin_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::precise::sin(sdata[0]);
+            rdata[1] = tue::math::precise::sin(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> precise_cos_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::precise::cos(sdata[0]);
+            rdata[1] = tue::math::precise::cos(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline void precise_sincos_s(
+            const simd<T, 2>& s,
+            simd<T, 2>& sin_out,
+            simd<T, 2>& cos_out) noexcept
+        {
+            const auto sdata = s.data();
+            const auto sout = sin_out.data();
+            const auto cout = cos_out.data();
+            tue::math::precise::sincos(sdata[0], sout[0], cout[0]);
+            tue::math::precise::sincos(sdata[1], sout[1], cout[1]);
+        }
+
+        template<typename T>
+        inline simd<T, 2> precise_exp_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::precise::exp(sdata[0]);
+            rdata[1] = tue::math::precise::exp(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> precise_log_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::precise::log(sdata[0]);
+            rdata[1] = tue::math::precise::log(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> precise_pow_ss(
+            const simd<T, 2>& bases, const simd<T, 2>& exponents) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto bdata = bases.data();
+            const auto edata = exponents.data();
+            rdata[0] = tue::math::precise::pow(bdata[0], edata[0]);
+            rdata[1] = tue::math::precise::pow(bdata[1], edata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> precise_recip_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::precise::recip(sdata[0]);
+            rdata[1] = tue::math::precise::recip(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> precise_rsqrt_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::precise::rsqrt(sdata[0]);
+            rdata[1] = tue::math::precise::rsqrt(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> floor_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::floor(sdata[0]);
+            rdata[1] = tue::math::floor(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> ceil_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::ceil(sdata[0]);
+            rdata[1] = tue::math::ceil(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> round_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::round(sdata[0]);
+            rdata[1] = tue::math::round(sdata[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> trunc_s(const simd<T, 2>& s) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = tue::math::trunc(sdata[0]);
+            rdata[1] = tue::math::trunc(sdata[1]);
+            return result;
+        }
+
+#ifndef TUE_VECTOR_EXT
         template<typename T>
         inline simd<T, 2> min_ss(
             const simd<T, 2>& s1, const simd<T, 2>& s2) noexcept
@@ -577,6 +1062,83 @@ namespace tue
             rdata[1] = tue::math::max(sdata1[1], sdata2[1]);
             return result;
         }
+#endif
+
+        template<typename T>
+        inline simd<T, 2> adds_ss(
+            const simd<T, 2>& s1, const simd<T, 2>& s2) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata1 = s1.data();
+            const auto sdata2 = s2.data();
+            rdata[0] = tue::math::adds(sdata1[0], sdata2[0]);
+            rdata[1] = tue::math::adds(sdata1[1], sdata2[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> subs_ss(
+            const simd<T, 2>& s1, const simd<T, 2>& s2) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata1 = s1.data();
+            const auto sdata2 = s2.data();
+            rdata[0] = tue::math::subs(sdata1[0], sdata2[0]);
+            rdata[1] = tue::math::subs(sdata1[1], sdata2[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> avg_ss(
+            const simd<T, 2>& s1, const simd<T, 2>& s2) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata1 = s1.data();
+            const auto sdata2 = s2.data();
+            rdata[0] = tue::math::avg(sdata1[0], sdata2[0]);
+            rdata[1] = tue::math::avg(sdata1[1], sdata2[1]);
+            return result;
+        }
+
+        template<typename T>
+        inline T reduce_add_s(const simd<T, 2>& s) noexcept
+        {
+            const auto sdata = s.data();
+            return static_cast<T>(sdata[0] + sdata[1]);
+        }
+
+        template<typename T>
+        inline T reduce_min_s(const simd<T, 2>& s) noexcept
+        {
+            const auto sdata = s.data();
+            return tue::math::min(sdata[0], sdata[1]);
+        }
+
+        template<typename T>
+        inline T reduce_max_s(const simd<T, 2>& s) noexcept
+        {
+            const auto sdata = s.data();
+            return tue::math::max(sdata[0], sdata[1]);
+        }
+
+        template<typename T>
+        inline simd<T, 2> fma_sss(
+            const simd<T, 2>& s1,
+            const simd<T, 2>& s2,
+            const simd<T, 2>& s3) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto data1 = s1.data();
+            const auto data2 = s2.data();
+            const auto data3 = s3.data();
+            rdata[0] = data1[0] * data2[0] + data3[0];
+            rdata[1] = data1[1] * data2[1] + data3[1];
+            return result;
+        }
 
         template<typename T, typename U>
         inline simd<U, 2> mask_ss(
@@ -608,6 +1170,7 @@ namespace tue
             return result;
         }
 
+#ifndef TUE_VECTOR_EXT
         template<typename T>
         inline simd<sized_bool_t<sizeof(T)>, 2> less_ss(
             const simd<T, 2>& lhs, const simd<T, 2>& rhs) noexcept
@@ -691,5 +1254,102 @@ namespace tue
             sdata[1] = ldata[1] != rdata[1] ? U(~0LL) : U(0LL);
             return s;
         }
+#endif
+
+        template<typename T>
+        inline std::uint64_t movemask_s(const simd<T, 2>& s) noexcept
+        {
+            const auto sdata = s.data();
+            return (sdata[0] ? 1u : 0u) | (sdata[1] ? 2u : 0u);
+        }
+
+        template<typename T>
+        inline bool any_s(const simd<T, 2>& s) noexcept
+        {
+            const auto sdata = s.data();
+            return sdata[0] || sdata[1];
+        }
+
+        template<typename T>
+        inline bool all_s(const simd<T, 2>& s) noexcept
+        {
+            const auto sdata = s.data();
+            return sdata[0] && sdata[1];
+        }
+
+        template<typename T>
+        inline bool none_s(const simd<T, 2>& s) noexcept
+        {
+            const auto sdata = s.data();
+            return !sdata[0] && !sdata[1];
+        }
+
+        template<typename T, int I0, int I1>
+        inline simd<T, 2> shuffle_s(
+            const simd<T, 2>& s,
+            std::integer_sequence<int, I0, I1>) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            rdata[0] = sdata[I0];
+            rdata[1] = sdata[I1];
+            return result;
+        }
+
+        template<typename T, int I0, int I1>
+        inline simd<T, 2> shuffle_ss(
+            const simd<T, 2>& s1,
+            const simd<T, 2>& s2,
+            std::integer_sequence<int, I0, I1>) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            const auto sdata1 = s1.data();
+            const auto sdata2 = s2.data();
+            rdata[0] = I0 < 2 ? sdata1[I0 % 2] : sdata2[I0 % 2];
+            rdata[1] = I1 < 2 ? sdata1[I1 % 2] : sdata2[I1 % 2];
+            return result;
+        }
+
+        template<typename T, int I>
+        inline T extract_s(
+            const simd<T, 2>& s, std::integral_constant<int, I>) noexcept
+        {
+            return s.data()[I];
+        }
+
+        template<typename T, int I>
+        inline simd<T, 2> insert_s(
+            const simd<T, 2>& s,
+            T x,
+            std::integral_constant<int, I>) noexcept
+        {
+            simd<T, 2> result = s;
+            result.data()[I] = x;
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> interleave_lo_ss(
+            const simd<T, 2>& s1, const simd<T, 2>& s2) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            rdata[0] = s1.data()[0];
+            rdata[1] = s2.data()[0];
+            return result;
+        }
+
+        template<typename T>
+        inline simd<T, 2> interleave_hi_ss(
+            const simd<T, 2>& s1, const simd<T, 2>& s2) noexcept
+        {
+            simd<T, 2> result;
+            const auto rdata = result.data();
+            rdata[0] = s1.data()[1];
+            rdata[1] = s2.data()[1];
+            return result;
+        }
     }
 }
@@ -8,6 +8,13 @@
 
 #pragma once
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "../math.hpp"
 #include "../simd.hpp"
 #include "../sized_bool.hpp"
 
@@ -18,73 +25,97 @@ namespace tue
         template<typename T, int N>
         inline simd<T, N> unary_plus_operator_s(const simd<T, N>& s) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
-            rimpl[0] = tue::detail_::unary_plus_operator_s(simpl[0]);
-            rimpl[1] = tue::detail_::unary_plus_operator_s(simpl[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::unary_plus_operator_s(simpl[i]);
+            });
             return result;
         }
 
         template<typename T, int N>
         inline simd<T, N>& pre_increment_operator_s(simd<T, N>& s) noexcept
         {
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            tue::detail_::pre_increment_operator_s(simpl[0]);
-            tue::detail_::pre_increment_operator_s(simpl[1]);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::pre_increment_operator_s(simpl[i]);
+            });
             return s;
         }
 
         template<typename T, int N>
         inline simd<T, N> post_increment_operator_s(simd<T, N>& s) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            rimpl[0] = tue::detail_::post_increment_operator_s(simpl[0]);
-            rimpl[1] = tue::detail_::post_increment_operator_s(simpl[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::post_increment_operator_s(simpl[i]);
+            });
             return result;
         }
 
+#ifndef TUE_VECTOR_EXT
         template<typename T, int N>
         inline simd<T, N> unary_minus_operator_s(const simd<T, N>& s) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
-            rimpl[0] = tue::detail_::unary_minus_operator_s(simpl[0]);
-            rimpl[1] = tue::detail_::unary_minus_operator_s(simpl[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::unary_minus_operator_s(simpl[i]);
+            });
             return result;
         }
+#endif
 
         template<typename T, int N>
         inline simd<T, N>& pre_decrement_operator_s(simd<T, N>& s) noexcept
         {
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            tue::detail_::pre_decrement_operator_s(simpl[0]);
-            tue::detail_::pre_decrement_operator_s(simpl[1]);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::pre_decrement_operator_s(simpl[i]);
+            });
             return s;
         }
 
         template<typename T, int N>
         inline simd<T, N> post_decrement_operator_s(simd<T, N>& s) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            rimpl[0] = tue::detail_::post_decrement_operator_s(simpl[0]);
-            rimpl[1] = tue::detail_::post_decrement_operator_s(simpl[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::post_decrement_operator_s(simpl[i]);
+            });
             return result;
         }
 
+#ifndef TUE_VECTOR_EXT
         template<typename T, int N>
         inline simd<T, N> bitwise_not_operator_s(const simd<T, N>& s) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
-            rimpl[0] = tue::detail_::bitwise_not_operator_s(simpl[0]);
-            rimpl[1] = tue::detail_::bitwise_not_operator_s(simpl[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::bitwise_not_operator_s(simpl[i]);
+            });
             return result;
         }
 
@@ -92,15 +123,17 @@ namespace tue
         inline simd<T, N> addition_operator_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> s;
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-
-            simpl[0] = tue::detail_::addition_operator_ss(
-                limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::addition_operator_ss(
-                limpl[1], rimpl[1]);
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::addition_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return s;
         }
 
@@ -108,15 +141,17 @@ namespace tue
         inline simd<T, N> subtraction_operator_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> s;
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-
-            simpl[0] = tue::detail_::subtraction_operator_ss(
-                limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::subtraction_operator_ss(
-                limpl[1], rimpl[1]);
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::subtraction_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return s;
         }
 
@@ -124,31 +159,36 @@ namespace tue
         inline simd<T, N> multiplication_operator_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> s;
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-
-            simpl[0] = tue::detail_::multiplication_operator_ss(
-                limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::multiplication_operator_ss(
-                limpl[1], rimpl[1]);
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::multiplication_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return s;
         }
+#endif
 
         template<typename T, int N>
         inline simd<T, N> division_operator_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> s;
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-
-            simpl[0] = tue::detail_::division_operator_ss(
-                limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::division_operator_ss(
-                limpl[1], rimpl[1]);
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::division_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return s;
         }
 
@@ -156,31 +196,36 @@ namespace tue
         inline simd<T, N> modulo_operator_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> s;
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-
-            simpl[0] = tue::detail_::modulo_operator_ss(
-                limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::modulo_operator_ss(
-                limpl[1], rimpl[1]);
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::modulo_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return s;
         }
 
+#ifndef TUE_VECTOR_EXT
         template<typename T, int N>
         inline simd<T, N> bitwise_and_operator_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> s;
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-
-            simpl[0] = tue::detail_::bitwise_and_operator_ss(
-                limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::bitwise_and_operator_ss(
-                limpl[1], rimpl[1]);
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::bitwise_and_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return s;
         }
 
@@ -188,15 +233,17 @@ namespace tue
         inline simd<T, N> bitwise_or_operator_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> s;
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-
-            simpl[0] = tue::detail_::bitwise_or_operator_ss(
-                limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::bitwise_or_operator_ss(
-                limpl[1], rimpl[1]);
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::bitwise_or_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return s;
         }
 
@@ -204,15 +251,17 @@ namespace tue
         inline simd<T, N> bitwise_xor_operator_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> s;
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-
-            simpl[0] = tue::detail_::bitwise_xor_operator_ss(
-                limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::bitwise_xor_operator_ss(
-                limpl[1], rimpl[1]);
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::bitwise_xor_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return s;
         }
 
@@ -220,14 +269,16 @@ namespace tue
         inline simd<T, N> bitwise_shift_left_operator_si(
             const simd<T, N>& lhs, int rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> s;
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-
-            simpl[0] = tue::detail_::bitwise_shift_left_operator_si(
-                limpl[0], rhs);
-            simpl[1] = tue::detail_::bitwise_shift_left_operator_si(
-                limpl[1], rhs);
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::bitwise_shift_left_operator_si(
+                    limpl[i], rhs);
+            });
             return s;
         }
 
@@ -235,14 +286,52 @@ namespace tue
         inline simd<T, N> bitwise_shift_right_operator_si(
             const simd<T, N>& lhs, int rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> s;
-            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::bitwise_shift_right_operator_si(
+                    limpl[i], rhs);
+            });
+            return s;
+        }
 
-            simpl[0] = tue::detail_::bitwise_shift_right_operator_si(
-                limpl[0], rhs);
-            simpl[1] = tue::detail_::bitwise_shift_right_operator_si(
-                limpl[1], rhs);
+        template<typename T, int N>
+        inline simd<T, N> bitwise_shift_left_operator_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> s;
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::bitwise_shift_left_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
+            return s;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> bitwise_shift_right_operator_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> s;
+            const auto simpl = reinterpret_cast<simd<T, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::bitwise_shift_right_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return s;
         }
 
@@ -250,12 +339,14 @@ namespace tue
         inline simd<T, N>& addition_assignment_operator_ss(
             simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
-            const auto limpl = reinterpret_cast<simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            tue::detail_::addition_assignment_operator_ss(
-                limpl[0], rimpl[0]);
-            tue::detail_::addition_assignment_operator_ss(
-                limpl[1], rimpl[1]);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::addition_assignment_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return lhs;
         }
 
@@ -263,12 +354,14 @@ namespace tue
         inline simd<T, N>& subtraction_assignment_operator_ss(
             simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
-            const auto limpl = reinterpret_cast<simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            tue::detail_::subtraction_assignment_operator_ss(
-                limpl[0], rimpl[0]);
-            tue::detail_::subtraction_assignment_operator_ss(
-                limpl[1], rimpl[1]);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::subtraction_assignment_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return lhs;
         }
 
@@ -276,25 +369,30 @@ namespace tue
         inline simd<T, N>& multiplication_assignment_operator_ss(
             simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
-            const auto limpl = reinterpret_cast<simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            tue::detail_::multiplication_assignment_operator_ss(
-                limpl[0], rimpl[0]);
-            tue::detail_::multiplication_assignment_operator_ss(
-                limpl[1], rimpl[1]);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::multiplication_assignment_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return lhs;
         }
+#endif
 
         template<typename T, int N>
         inline simd<T, N>& division_assignment_operator_ss(
             simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
-            const auto limpl = reinterpret_cast<simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            tue::detail_::division_assignment_operator_ss(
-                limpl[0], rimpl[0]);
-            tue::detail_::division_assignment_operator_ss(
-                limpl[1], rimpl[1]);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::division_assignment_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return lhs;
         }
 
@@ -302,25 +400,30 @@ namespace tue
         inline simd<T, N>& modulo_assignment_operator_ss(
             simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
-            const auto limpl = reinterpret_cast<simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            tue::detail_::modulo_assignment_operator_ss(
-                limpl[0], rimpl[0]);
-            tue::detail_::modulo_assignment_operator_ss(
-                limpl[1], rimpl[1]);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::modulo_assignment_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return lhs;
         }
 
+#ifndef TUE_VECTOR_EXT
         template<typename T, int N>
         inline simd<T, N>& bitwise_and_assignment_operator_ss(
             simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
-            const auto limpl = reinterpret_cast<simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            tue::detail_::bitwise_and_assignment_operator_ss(
-                limpl[0], rimpl[0]);
-            tue::detail_::bitwise_and_assignment_operator_ss(
-                limpl[1], rimpl[1]);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::bitwise_and_assignment_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return lhs;
         }
 
@@ -328,12 +431,14 @@ namespace tue
         inline simd<T, N>& bitwise_or_assignment_operator_ss(
             simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
-            const auto limpl = reinterpret_cast<simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            tue::detail_::bitwise_or_assignment_operator_ss(
-                limpl[0], rimpl[0]);
-            tue::detail_::bitwise_or_assignment_operator_ss(
-                limpl[1], rimpl[1]);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::bitwise_or_assignment_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return lhs;
         }
 
@@ -341,12 +446,14 @@ namespace tue
         inline simd<T, N>& bitwise_xor_assignment_operator_ss(
             simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
-            const auto limpl = reinterpret_cast<simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            tue::detail_::bitwise_xor_assignment_operator_ss(
-                limpl[0], rimpl[0]);
-            tue::detail_::bitwise_xor_assignment_operator_ss(
-                limpl[1], rimpl[1]);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::bitwise_xor_assignment_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
             return lhs;
         }
 
@@ -354,11 +461,13 @@ namespace tue
         inline simd<T, N>& bitwise_shift_left_assignment_operator_si(
             simd<T, N>& lhs, int rhs) noexcept
         {
-            const auto limpl = reinterpret_cast<simd<T, N/2>*>(&lhs);
-            tue::detail_::bitwise_shift_left_assignment_operator_si(
-                limpl[0], rhs);
-            tue::detail_::bitwise_shift_left_assignment_operator_si(
-                limpl[1], rhs);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<simd<T, W>*>(&lhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::bitwise_shift_left_assignment_operator_si(
+                    limpl[i], rhs);
+            });
             return lhs;
         }
 
@@ -366,53 +475,104 @@ namespace tue
         inline simd<T, N>& bitwise_shift_right_assignment_operator_si(
             simd<T, N>& lhs, int rhs) noexcept
         {
-            const auto limpl = reinterpret_cast<simd<T, N/2>*>(&lhs);
-            tue::detail_::bitwise_shift_right_assignment_operator_si(
-                limpl[0], rhs);
-            tue::detail_::bitwise_shift_right_assignment_operator_si(
-                limpl[1], rhs);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<simd<T, W>*>(&lhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::bitwise_shift_right_assignment_operator_si(
+                    limpl[i], rhs);
+            });
             return lhs;
         }
 
+        template<typename T, int N>
+        inline simd<T, N>& bitwise_shift_left_assignment_operator_ss(
+            simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::bitwise_shift_left_assignment_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
+            return lhs;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N>& bitwise_shift_right_assignment_operator_ss(
+            simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::bitwise_shift_right_assignment_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
+            return lhs;
+        }
+#endif
+
         template<typename T, int N>
         inline bool equality_operator_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            return tue::detail_::equality_operator_ss(limpl[0], rimpl[0])
-                && tue::detail_::equality_operator_ss(limpl[1], rimpl[1]);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            bool result = true;
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                result = result && tue::detail_::equality_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
+            return result;
         }
 
         template<typename T, int N>
         inline bool inequality_operator_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            return tue::detail_::inequality_operator_ss(limpl[0], rimpl[0])
-                || tue::detail_::inequality_operator_ss(limpl[1], rimpl[1]);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            bool result = false;
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                result = result || tue::detail_::inequality_operator_ss(
+                    limpl[i], rimpl[i]);
+            });
+            return result;
         }
 
         template<typename T, int N>
         inline simd<T, N> sin_s(const simd<T, N>& s) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
-            rimpl[0] = tue::detail_::sin_s(simpl[0]);
-            rimpl[1] = tue::detail_::sin_s(simpl[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::sin_s(simpl[i]);
+            });
             return result;
         }
 
         template<typename T, int N>
         inline simd<T, N> cos_s(const simd<T, N>& s) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
-            rimpl[0] = tue::detail_::cos_s(simpl[0]);
-            rimpl[1] = tue::detail_::cos_s(simpl[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::cos_s(simpl[i]);
+            });
             return result;
         }
 
@@ -422,43 +582,173 @@ namespace tue
             simd<T, N>& sin_out,
             simd<T, N>& cos_out) noexcept
         {
-            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
-            const auto sout = reinterpret_cast<simd<T, N/2>*>(&sin_out);
-            const auto cout = reinterpret_cast<simd<T, N/2>*>(&cos_out);
-            tue::detail_::sincos_s(simpl[0], sout[0], cout[0]);
-            tue::detail_::sincos_s(simpl[1], sout[1], cout[1]);
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            const auto sout = reinterpret_cast<simd<T, W>*>(&sin_out);
+            const auto cout = reinterpret_cast<simd<T, W>*>(&cos_out);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::sincos_s(simpl[i], sout[i], cout[i]);
+            });
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> tan_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::tan_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> asin_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::asin_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> acos_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::acos_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> atan_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::atan_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> atan2_ss(
+            const simd<T, N>& y, const simd<T, N>& x) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(
+                &result);
+            const auto yimpl = reinterpret_cast<const simd<T, W>*>(
+                &y);
+            const auto ximpl = reinterpret_cast<const simd<T, W>*>(
+                &x);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::atan2_ss(yimpl[i], ximpl[i]);
+            });
+            return result;
         }
 
         template<typename T, int N>
         inline simd<T, N> exp_s(const simd<T, N>& s) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::exp_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> exp2_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
-            rimpl[0] = tue::detail_::exp_s(simpl[0]);
-            rimpl[1] = tue::detail_::exp_s(simpl[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::exp2_s(simpl[i]);
+            });
             return result;
         }
 
         template<typename T, int N>
         inline simd<T, N> log_s(const simd<T, N>& s) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
-            rimpl[0] = tue::detail_::log_s(simpl[0]);
-            rimpl[1] = tue::detail_::log_s(simpl[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::log_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> log2_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::log2_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> log10_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::log10_s(simpl[i]);
+            });
             return result;
         }
 
         template<typename T, int N>
         inline simd<T, N> abs_s(const simd<T, N>& s) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
-            rimpl[0] = tue::detail_::abs_s(simpl[0]);
-            rimpl[1] = tue::detail_::abs_s(simpl[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::abs_s(simpl[i]);
+            });
             return result;
         }
 
@@ -466,62 +756,388 @@ namespace tue
         inline simd<T, N> pow_ss(
             const simd<T, N>& bases, const simd<T, N>& exponents) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(
                 &result);
-            const auto bimpl = reinterpret_cast<const simd<T, N/2>*>(
+            const auto bimpl = reinterpret_cast<const simd<T, W>*>(
                 &bases);
-            const auto eimpl = reinterpret_cast<const simd<T, N/2>*>(
+            const auto eimpl = reinterpret_cast<const simd<T, W>*>(
                 &exponents);
 
-            rimpl[0] = tue::detail_::pow_ss(bimpl[0], eimpl[0]);
-            rimpl[1] = tue::detail_::pow_ss(bimpl[1], eimpl[1]);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::pow_ss(bimpl[i], eimpl[i]);
+            });
             return result;
         }
 
         template<typename T, int N>
         inline simd<T, N> recip_s(const simd<T, N>& s) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
-            rimpl[0] = tue::detail_::recip_s(simpl[0]);
-            rimpl[1] = tue::detail_::recip_s(simpl[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::recip_s(simpl[i]);
+            });
             return result;
         }
 
         template<typename T, int N>
         inline simd<T, N> sqrt_s(const simd<T, N>& s) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::sqrt_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> cbrt_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
-            rimpl[0] = tue::detail_::sqrt_s(simpl[0]);
-            rimpl[1] = tue::detail_::sqrt_s(simpl[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::cbrt_s(simpl[i]);
+            });
             return result;
         }
 
         template<typename T, int N>
         inline simd<T, N> rsqrt_s(const simd<T, N>& s) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::rsqrt_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> fast_sin_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::fast_sin_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> fast_cos_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::fast_cos_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline void fast_sincos_s(
+            const simd<T, N>& s,
+            simd<T, N>& sin_out,
+            simd<T, N>& cos_out) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            const auto sout = reinterpret_cast<simd<T, W>*>(&sin_out);
+            const auto cout = reinterpret_cast<simd<T, W>*>(&cos_out);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::fast_sincos_s(simpl[i], sout[i], cout[i]);
+            });
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> fast_exp_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl = reinterpret_cast<const simd<T, N/2>*>(&s);
-            rimpl[0] = tue::detail_::rsqrt_s(simpl[0]);
-            rimpl[1] = tue::detail_::rsqrt_s(simpl[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::fast_exp_s(simpl[i]);
+            });
             return result;
         }
 
+        template<typename T, int N>
+        inline simd<T, N> fast_log_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::fast_log_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> fast_pow_ss(
+            const simd<T, N>& bases, const simd<T, N>& exponents) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(
+                &result);
+            const auto bimpl = reinterpret_cast<const simd<T, W>*>(
+                &bases);
+            const auto eimpl = reinterpret_cast<const simd<T, W>*>(
+                &exponents);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::fast_pow_ss(bimpl[i], eimpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> fast_recip_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::fast_recip_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> fast_rsqrt_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::fast_rsqrt_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> precise_sin_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::precise_sin_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> precise_cos_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::precise_cos_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline void precise_sincos_s(
+            const simd<T, N>& s,
+            simd<T, N>& sin_out,
+            simd<T, N>& cos_out) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            const auto sout = reinterpret_cast<simd<T, W>*>(&sin_out);
+            const auto cout = reinterpret_cast<simd<T, W>*>(&cos_out);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                tue::detail_::precise_sincos_s(simpl[i], sout[i], cout[i]);
+            });
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> precise_exp_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::precise_exp_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> precise_log_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::precise_log_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> precise_pow_ss(
+            const simd<T, N>& bases, const simd<T, N>& exponents) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(
+                &result);
+            const auto bimpl = reinterpret_cast<const simd<T, W>*>(
+                &bases);
+            const auto eimpl = reinterpret_cast<const simd<T, W>*>(
+                &exponents);
+
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::precise_pow_ss(bimpl[i], eimpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> precise_recip_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::precise_recip_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> precise_rsqrt_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::precise_rsqrt_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> floor_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::floor_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> ceil_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::ceil_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> round_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::round_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> trunc_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::trunc_s(simpl[i]);
+            });
+            return result;
+        }
+
+#ifndef TUE_VECTOR_EXT
         template<typename T, int N>
         inline simd<T, N> min_ss(
             const simd<T, N>& s1, const simd<T, N>& s2) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl1 = reinterpret_cast<const simd<T, N/2>*>(&s1);
-            const auto simpl2 = reinterpret_cast<const simd<T, N/2>*>(&s2);
-            rimpl[0] = tue::detail_::min_ss(simpl1[0], simpl2[0]);
-            rimpl[1] = tue::detail_::min_ss(simpl1[1], simpl2[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl1 = reinterpret_cast<const simd<T, W>*>(&s1);
+            const auto simpl2 = reinterpret_cast<const simd<T, W>*>(&s2);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::min_ss(simpl1[i], simpl2[i]);
+            });
             return result;
         }
 
@@ -529,12 +1145,123 @@ namespace tue
         inline simd<T, N> max_ss(
             const simd<T, N>& s1, const simd<T, N>& s2) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             simd<T, N> result;
-            const auto rimpl = reinterpret_cast<simd<T, N/2>*>(&result);
-            const auto simpl1 = reinterpret_cast<const simd<T, N/2>*>(&s1);
-            const auto simpl2 = reinterpret_cast<const simd<T, N/2>*>(&s2);
-            rimpl[0] = tue::detail_::max_ss(simpl1[0], simpl2[0]);
-            rimpl[1] = tue::detail_::max_ss(simpl1[1], simpl2[1]);
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl1 = reinterpret_cast<const simd<T, W>*>(&s1);
+            const auto simpl2 = reinterpret_cast<const simd<T, W>*>(&s2);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::max_ss(simpl1[i], simpl2[i]);
+            });
+            return result;
+        }
+#endif
+
+        template<typename T, int N>
+        inline simd<T, N> adds_ss(
+            const simd<T, N>& s1, const simd<T, N>& s2) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl1 = reinterpret_cast<const simd<T, W>*>(&s1);
+            const auto simpl2 = reinterpret_cast<const simd<T, W>*>(&s2);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::adds_ss(simpl1[i], simpl2[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> subs_ss(
+            const simd<T, N>& s1, const simd<T, N>& s2) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl1 = reinterpret_cast<const simd<T, W>*>(&s1);
+            const auto simpl2 = reinterpret_cast<const simd<T, W>*>(&s2);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::subs_ss(simpl1[i], simpl2[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> avg_ss(
+            const simd<T, N>& s1, const simd<T, N>& s2) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto simpl1 = reinterpret_cast<const simd<T, W>*>(&s1);
+            const auto simpl2 = reinterpret_cast<const simd<T, W>*>(&s2);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::avg_ss(simpl1[i], simpl2[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline T reduce_add_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            simd<T, W> result = simpl[0];
+            tue::detail_::unroll<N/W - 1>([&](int i)
+            {
+                result = tue::detail_::addition_operator_ss(
+                    result, simpl[i + 1]);
+            });
+            return tue::detail_::reduce_add_s(result);
+        }
+
+        template<typename T, int N>
+        inline T reduce_min_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            simd<T, W> result = simpl[0];
+            tue::detail_::unroll<N/W - 1>([&](int i)
+            {
+                result = tue::detail_::min_ss(result, simpl[i + 1]);
+            });
+            return tue::detail_::reduce_min_s(result);
+        }
+
+        template<typename T, int N>
+        inline T reduce_max_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            simd<T, W> result = simpl[0];
+            tue::detail_::unroll<N/W - 1>([&](int i)
+            {
+                result = tue::detail_::max_ss(result, simpl[i + 1]);
+            });
+            return tue::detail_::reduce_max_s(result);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> fma_sss(
+            const simd<T, N>& s1,
+            const simd<T, N>& s2,
+            const simd<T, N>& s3) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            const auto impl1 = reinterpret_cast<const simd<T, W>*>(&s1);
+            const auto impl2 = reinterpret_cast<const simd<T, W>*>(&s2);
+            const auto impl3 = reinterpret_cast<const simd<T, W>*>(&s3);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::fma_sss(impl1[i], impl2[i], impl3[i]);
+            });
             return result;
         }
 
@@ -543,16 +1270,19 @@ namespace tue
             const simd<T, N>& conditions,
             const simd<U, N>& values) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<U, N>();
             simd<U, N> result;
-            const auto rimpl = reinterpret_cast<simd<U, N/2>*>(
+            const auto rimpl = reinterpret_cast<simd<U, W>*>(
                 &result);
-            const auto cimpl = reinterpret_cast<const simd<T, N/2>*>(
+            const auto cimpl = reinterpret_cast<const simd<T, W>*>(
                 &conditions);
-            const auto vimpl = reinterpret_cast<const simd<U, N/2>*>(
+            const auto vimpl = reinterpret_cast<const simd<U, W>*>(
                 &values);
 
-            rimpl[0] = tue::detail_::mask_ss(cimpl[0], vimpl[0]);
-            rimpl[1] = tue::detail_::mask_ss(cimpl[1], vimpl[1]);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::mask_ss(cimpl[i], vimpl[i]);
+            });
             return result;
         }
 
@@ -562,32 +1292,40 @@ namespace tue
             const simd<U, N>& values,
             const simd<U, N>& otherwise) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<U, N>();
             simd<U, N> result;
-            const auto rimpl = reinterpret_cast<simd<U, N/2>*>(
+            const auto rimpl = reinterpret_cast<simd<U, W>*>(
                 &result);
-            const auto cimpl = reinterpret_cast<const simd<T, N/2>*>(
+            const auto cimpl = reinterpret_cast<const simd<T, W>*>(
                 &conditions);
-            const auto vimpl = reinterpret_cast<const simd<U, N/2>*>(
+            const auto vimpl = reinterpret_cast<const simd<U, W>*>(
                 &values);
-            const auto oimpl = reinterpret_cast<const simd<U, N/2>*>(
+            const auto oimpl = reinterpret_cast<const simd<U, W>*>(
                 &otherwise);
 
-            rimpl[0] = tue::detail_::select_sss(cimpl[0], vimpl[0], oimpl[0]);
-            rimpl[1] = tue::detail_::select_sss(cimpl[1], vimpl[1], oimpl[1]);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::select_sss(
+                    cimpl[i], vimpl[i], oimpl[i]);
+            });
             return result;
         }
 
+#ifndef TUE_VECTOR_EXT
         template<typename T, int N>
         inline simd<sized_bool_t<sizeof(T)>, N> less_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             using U = sized_bool_t<sizeof(T)>;
             simd<U, N> s;
-            const auto simpl = reinterpret_cast<simd<U, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            simpl[0] = tue::detail_::less_ss(limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::less_ss(limpl[1], rimpl[1]);
+            const auto simpl = reinterpret_cast<simd<U, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::less_ss(limpl[i], rimpl[i]);
+            });
             return s;
         }
 
@@ -595,13 +1333,16 @@ namespace tue
         inline simd<sized_bool_t<sizeof(T)>, N> less_equal_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             using U = sized_bool_t<sizeof(T)>;
             simd<U, N> s;
-            const auto simpl = reinterpret_cast<simd<U, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            simpl[0] = tue::detail_::less_equal_ss(limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::less_equal_ss(limpl[1], rimpl[1]);
+            const auto simpl = reinterpret_cast<simd<U, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::less_equal_ss(limpl[i], rimpl[i]);
+            });
             return s;
         }
 
@@ -609,13 +1350,16 @@ namespace tue
         inline simd<sized_bool_t<sizeof(T)>, N> greater_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             using U = sized_bool_t<sizeof(T)>;
             simd<U, N> s;
-            const auto simpl = reinterpret_cast<simd<U, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            simpl[0] = tue::detail_::greater_ss(limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::greater_ss(limpl[1], rimpl[1]);
+            const auto simpl = reinterpret_cast<simd<U, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::greater_ss(limpl[i], rimpl[i]);
+            });
             return s;
         }
 
@@ -623,13 +1367,16 @@ namespace tue
         inline simd<sized_bool_t<sizeof(T)>, N> greater_equal_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             using U = sized_bool_t<sizeof(T)>;
             simd<U, N> s;
-            const auto simpl = reinterpret_cast<simd<U, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            simpl[0] = tue::detail_::greater_equal_ss(limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::greater_equal_ss(limpl[1], rimpl[1]);
+            const auto simpl = reinterpret_cast<simd<U, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::greater_equal_ss(limpl[i], rimpl[i]);
+            });
             return s;
         }
 
@@ -637,13 +1384,16 @@ namespace tue
         inline simd<sized_bool_t<sizeof(T)>, N> equal_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             using U = sized_bool_t<sizeof(T)>;
             simd<U, N> s;
-            const auto simpl = reinterpret_cast<simd<U, N/2>*>(&s);
-            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
-            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            simpl[0] = tue::detail_::equal_ss(limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::equal_ss(limpl[1], rimpl[1]);
+            const auto simpl = reinterpret_cast<simd<U, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::equal_ss(limpl[i], rimpl[i]);
+            });
             return s;
         }
 
@@ -651,14 +1401,323 @@ namespace tue
         inline simd<sized_bool_t<sizeof(T)>, N> not_equal_ss(
             const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
         {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
             using U = sized_bool_t<sizeof(T)>;
             simd<U, N> s;
-            const auto simpl = reinterpret_cast<simd<U, N/2>*>(&s);
+            const auto simpl = reinterpret_cast<simd<U, W>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, W>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, W>*>(&rhs);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                simpl[i] = tue::detail_::not_equal_ss(limpl[i], rimpl[i]);
+            });
+            return s;
+        }
+#endif
+
+        template<typename T, int N>
+        inline std::uint64_t movemask_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            std::uint64_t result = 0;
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                result |= tue::detail_::movemask_s(simpl[i]) << (i * W);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline bool any_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            bool result = false;
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                result = result || tue::detail_::any_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline bool all_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            bool result = true;
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                result = result && tue::detail_::all_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N>
+        inline bool none_s(const simd<T, N>& s) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            bool result = true;
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                result = result && tue::detail_::none_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<typename T, int N, int... I>
+        inline simd<T, N> shuffle_s(
+            const simd<T, N>& s,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            const int indices[] = { I... };
+            simd<T, N> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            for (int i = 0; i < N; ++i)
+            {
+                rdata[i] = sdata[indices[i]];
+            }
+            return result;
+        }
+
+        template<typename T, int N, int... I>
+        inline simd<T, N> shuffle_ss(
+            const simd<T, N>& lhs,
+            const simd<T, N>& rhs,
+            std::integer_sequence<int, I...>) noexcept
+        {
+            const int indices[] = { I... };
+            simd<T, N> s;
+            const auto sdata = s.data();
+            const auto ldata = lhs.data();
+            const auto rdata = rhs.data();
+            for (int i = 0; i < N; ++i)
+            {
+                sdata[i] = indices[i] < N
+                    ? ldata[indices[i]]
+                    : rdata[indices[i] - N];
+            }
+            return s;
+        }
+
+        template<typename T, int N, int I>
+        inline T extract_s(
+            const simd<T, N>& s, std::integral_constant<int, I>) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto simpl = reinterpret_cast<const simd<T, W>*>(&s);
+            return tue::detail_::extract_s(
+                simpl[I / W], std::integral_constant<int, I % W>());
+        }
+
+        template<typename T, int N, int I>
+        inline simd<T, N> insert_s(
+            const simd<T, N>& s,
+            T x,
+            std::integral_constant<int, I>) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            simd<T, N> result = s;
+            const auto rimpl = reinterpret_cast<simd<T, W>*>(&result);
+            rimpl[I / W] = tue::detail_::insert_s(
+                rimpl[I / W],
+                x,
+                std::integral_constant<int, I % W>());
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> interleave_hi_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept;
+
+        template<typename T, int N>
+        inline simd<T, N> interleave_lo_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            simd<T, N> s;
+            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
+            const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
+            const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
+            simpl[0] = tue::detail_::interleave_lo_ss(limpl[0], rimpl[0]);
+            simpl[1] = tue::detail_::interleave_hi_ss(limpl[0], rimpl[0]);
+            return s;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> interleave_hi_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            simd<T, N> s;
+            const auto simpl = reinterpret_cast<simd<T, N/2>*>(&s);
             const auto limpl = reinterpret_cast<const simd<T, N/2>*>(&lhs);
             const auto rimpl = reinterpret_cast<const simd<T, N/2>*>(&rhs);
-            simpl[0] = tue::detail_::not_equal_ss(limpl[0], rimpl[0]);
-            simpl[1] = tue::detail_::not_equal_ss(limpl[1], rimpl[1]);
+            simpl[0] = tue::detail_::interleave_lo_ss(limpl[1], rimpl[1]);
+            simpl[1] = tue::detail_::interleave_hi_ss(limpl[1], rimpl[1]);
             return s;
         }
+
+        // Out of range components and NaNs become INT_MIN, as they do in
+        // the SSE2 and AVX2 conversions.
+        inline std::int32_t float_to_int32(float x) noexcept
+        {
+            return x >= -2147483648.0f && x < 2147483648.0f
+                ? static_cast<std::int32_t>(x)
+                : std::numeric_limits<std::int32_t>::min();
+        }
+
+        template<int N>
+        inline simd<std::int32_t, N> round_to_int32_s(
+            const simd<float, N>& s) noexcept;
+
+        template<int N>
+        inline simd<std::int32_t, N> trunc_to_int32_s(
+            const simd<float, N>& s) noexcept;
+
+        // Each `std::int32_t` chunk converts part of a `float` chunk, since
+        // `simd<float, W>` is accelerated wherever `simd<std::int32_t, W>`
+        // is.
+        template<int N>
+        inline simd<std::int32_t, N> round_to_int32_n(
+            const simd<float, N>& s, std::true_type) noexcept
+        {
+            constexpr int W =
+                tue::detail_::simd_chunk_width<std::int32_t, N>();
+            simd<std::int32_t, N> result;
+            const auto rimpl = reinterpret_cast<simd<std::int32_t, W>*>(
+                &result);
+            const auto simpl = reinterpret_cast<const simd<float, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::round_to_int32_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<int N>
+        inline simd<std::int32_t, N> round_to_int32_n(
+            const simd<float, N>& s, std::false_type) noexcept
+        {
+            simd<std::int32_t, N> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            for (int i = 0; i < N; ++i)
+            {
+                rdata[i] = tue::detail_::float_to_int32(
+                    std::nearbyint(sdata[i]));
+            }
+            return result;
+        }
+
+        template<int N>
+        inline simd<std::int32_t, N> round_to_int32_s(
+            const simd<float, N>& s) noexcept
+        {
+            constexpr int W =
+                tue::detail_::simd_chunk_width<std::int32_t, N>();
+            return tue::detail_::round_to_int32_n(s,
+                tue::detail_::is_accelerated_chunk<std::int32_t, W, N>());
+        }
+
+        template<int N>
+        inline simd<std::int32_t, N> trunc_to_int32_n(
+            const simd<float, N>& s, std::true_type) noexcept
+        {
+            constexpr int W =
+                tue::detail_::simd_chunk_width<std::int32_t, N>();
+            simd<std::int32_t, N> result;
+            const auto rimpl = reinterpret_cast<simd<std::int32_t, W>*>(
+                &result);
+            const auto simpl = reinterpret_cast<const simd<float, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                rimpl[i] = tue::detail_::trunc_to_int32_s(simpl[i]);
+            });
+            return result;
+        }
+
+        template<int N>
+        inline simd<std::int32_t, N> trunc_to_int32_n(
+            const simd<float, N>& s, std::false_type) noexcept
+        {
+            simd<std::int32_t, N> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            for (int i = 0; i < N; ++i)
+            {
+                rdata[i] = tue::detail_::float_to_int32(sdata[i]);
+            }
+            return result;
+        }
+
+        template<int N>
+        inline simd<std::int32_t, N> trunc_to_int32_s(
+            const simd<float, N>& s) noexcept
+        {
+            constexpr int W =
+                tue::detail_::simd_chunk_width<std::int32_t, N>();
+            return tue::detail_::trunc_to_int32_n(s,
+                tue::detail_::is_accelerated_chunk<std::int32_t, W, N>());
+        }
+
+        template<typename U, typename T, int N>
+        inline simd<U, N*2> pack_saturate_ss(
+            const simd<T, N>& lo, const simd<T, N>& hi) noexcept
+        {
+            simd<U, N*2> s;
+            const auto sdata = s.data();
+            const auto ldata = lo.data();
+            const auto hdata = hi.data();
+            for (int i = 0; i < N; ++i)
+            {
+                sdata[i] = tue::detail_::saturate_cast<U>(ldata[i]);
+                sdata[N + i] = tue::detail_::saturate_cast<U>(hdata[i]);
+            }
+            return s;
+        }
+
+        template<typename T, int N>
+        inline simd<sized_integral_t<sizeof(T)/2, true>, N*2> packs_ss(
+            const simd<T, N>& lo, const simd<T, N>& hi) noexcept
+        {
+            return tue::detail_::pack_saturate_ss<
+                sized_integral_t<sizeof(T)/2, true>>(lo, hi);
+        }
+
+        template<typename T, int N>
+        inline simd<sized_integral_t<sizeof(T)/2, false>, N*2> packus_ss(
+            const simd<T, N>& lo, const simd<T, N>& hi) noexcept
+        {
+            return tue::detail_::pack_saturate_ss<
+                sized_integral_t<sizeof(T)/2, false>>(lo, hi);
+        }
+
+        template<typename T, int N>
+        inline simd<widened_t<T>, N/2> widen_lo_s(const simd<T, N>& s) noexcept
+        {
+            simd<widened_t<T>, N/2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            for (int i = 0; i < N/2; ++i)
+            {
+                rdata[i] = sdata[i];
+            }
+            return result;
+        }
+
+        template<typename T, int N>
+        inline simd<widened_t<T>, N/2> widen_hi_s(const simd<T, N>& s) noexcept
+        {
+            simd<widened_t<T>, N/2> result;
+            const auto rdata = result.data();
+            const auto sdata = s.data();
+            for (int i = 0; i < N/2; ++i)
+            {
+                rdata[i] = sdata[N/2 + i];
+            }
+            return result;
+        }
     }
 }
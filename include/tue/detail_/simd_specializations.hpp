@@ -29,6 +29,9 @@ namespace tue
 #include "simd/sse/float32x4.sse.hpp"
 
 #ifdef TUE_SSE2
+#include <emmintrin.h>
+
+#include <cstring>
 
 namespace tue
 {
@@ -38,6 +41,58 @@ namespace tue
         {
             return reinterpret_cast<const double&>(x);
         }
+
+        inline __m128i cmpgt_epi64(__m128i lhs, __m128i rhs) noexcept
+        {
+            // SSE2 has no 64-bit compare, so compare the high halves as
+            // signed, the low halves as unsigned (by flipping their sign
+            // bits), and use the low result where the high halves are equal.
+            const auto bias = _mm_set1_epi64x(0x80000000);
+            const auto l = _mm_xor_si128(lhs, bias);
+            const auto r = _mm_xor_si128(rhs, bias);
+            const auto gt = _mm_cmpgt_epi32(l, r);
+            const auto eq = _mm_cmpeq_epi32(l, r);
+            return _mm_shuffle_epi32(
+                _mm_or_si128(gt, _mm_and_si128(eq, _mm_slli_epi64(gt, 32))),
+                _MM_SHUFFLE(3, 3, 1, 1));
+        }
+
+        inline void storeu_partial_si128(
+            void* data, __m128i s, int size) noexcept
+        {
+            // Store the low `size` bytes in pieces of 8, 4, 2 and 1 so that
+            // nothing past them is written.
+            if (size >= 16)
+            {
+                _mm_storeu_si128(static_cast<__m128i*>(data), s);
+                return;
+            }
+            auto p = static_cast<char*>(data);
+            if (size & 8)
+            {
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(p), s);
+                s = _mm_srli_si128(s, 8);
+                p += 8;
+            }
+            if (size & 4)
+            {
+                const std::int32_t x = _mm_cvtsi128_si32(s);
+                std::memcpy(p, &x, 4);
+                s = _mm_srli_si128(s, 4);
+                p += 4;
+            }
+            if (size & 2)
+            {
+                const auto x = static_cast<std::int16_t>(_mm_cvtsi128_si32(s));
+                std::memcpy(p, &x, 2);
+                s = _mm_srli_si128(s, 2);
+                p += 2;
+            }
+            if (size & 1)
+            {
+                *p = static_cast<char>(_mm_cvtsi128_si32(s));
+            }
+        }
     }
 }
 
@@ -56,3 +111,25 @@ namespace tue
 
 #endif
 #endif
+
+// AVX
+#ifdef TUE_AVX
+#include "simd/avx/bool32x8.avx.hpp"
+#include "simd/avx/bool64x4.avx.hpp"
+#include "simd/avx/float32x8.avx.hpp"
+#include "simd/avx/float64x4.avx.hpp"
+#endif
+
+// AVX2
+#ifdef TUE_AVX2
+#include "simd/avx2/bool8x32.avx2.hpp"
+#include "simd/avx2/bool16x16.avx2.hpp"
+#include "simd/avx2/int8x32.avx2.hpp"
+#include "simd/avx2/int16x16.avx2.hpp"
+#include "simd/avx2/int32x8.avx2.hpp"
+#include "simd/avx2/int64x4.avx2.hpp"
+#include "simd/avx2/uint8x32.avx2.hpp"
+#include "simd/avx2/uint16x16.avx2.hpp"
+#include "simd/avx2/uint32x8.avx2.hpp"
+#include "simd/avx2/uint64x4.avx2.hpp"
+#endif
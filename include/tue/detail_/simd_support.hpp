@@ -32,4 +32,48 @@
 #define TUE_SSE2
 #endif
 
+#if defined(__SSE4_1__) || defined(__AVX__)
+/*!
+ * \brief Defined if the current compiler configuration supports SSE4.1
+ *        intrinsics.
+ */
+#define TUE_SSE4_1
+#endif
+
+#if defined(__AVX__)
+/*!
+ * \brief Defined if the current compiler configuration supports AVX
+ *        intrinsics.
+ */
+#define TUE_AVX
+#endif
+
+#if defined(__AVX2__)
+/*!
+ * \brief Defined if the current compiler configuration supports AVX2
+ *        intrinsics.
+ */
+#define TUE_AVX2
+#endif
+
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+/*!
+ * \brief Defined if the current compiler configuration supports FMA3
+ *        intrinsics.
+ */
+#define TUE_FMA
+#endif
+
+// TUE_VECTOR_EXT is never defined here. Users may define it before
+// including any headers to implement the generic `simd` arithmetic,
+// bitwise, shift, comparison, `min()` and `max()` operations with GCC/Clang
+// vector extensions rather than per-component loops. Division and modulo
+// keep the native kernels for each chunk, since vector extensions would
+// divide component by component anyway. The math functions, conversions,
+// saturating arithmetic and the other generic operations still use the
+// per-component versions.
+#if defined(TUE_VECTOR_EXT) && !defined(__GNUC__)
+#error TUE_VECTOR_EXT requires GCC or Clang vector extensions
+#endif
+
 /*!@}*/
@@ -0,0 +1,412 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+
+#include "../simd.hpp"
+#include "../sized_bool.hpp"
+#include "simd_support.hpp"
+
+// Generic `simd` operations written with GCC/Clang vector extensions. These
+// replace the per-component loops in simd2.hpp and the recursion into halves
+// in simdN.hpp, so the compiler can pick native vector instructions for
+// targets without hand-written specializations. Specializations are plain
+// functions, so they still take priority over these templates.
+namespace tue
+{
+    namespace detail_
+    {
+        // The component type the vector extensions operate on. Sized
+        // booleans are enums, so they use their underlying type.
+        template<typename T, bool = std::is_enum<T>::value>
+        struct vector_ext_component
+        {
+            using type = T;
+        };
+
+        template<typename T>
+        struct vector_ext_component<T, true>
+        {
+            using type = std::underlying_type_t<T>;
+        };
+
+        template<typename T, int N>
+        struct vector_ext
+        {
+            using component_type = typename vector_ext_component<T>::type;
+
+            typedef component_type type
+                __attribute__((vector_size(sizeof(T) * N)));
+
+            typedef sized_integral_t<sizeof(T), false> bits_type
+                __attribute__((vector_size(sizeof(T) * N)));
+        };
+
+        template<typename T, int N>
+        using vector_ext_t = typename vector_ext<T, N>::type;
+
+        template<typename T, int N>
+        using vector_ext_bits_t = typename vector_ext<T, N>::bits_type;
+
+        // Vector types are only ever passed by reference here, since
+        // returning them by value warns about ABI changes between targets.
+        template<typename T, int N, typename V>
+        inline void to_vector_ext(const simd<T, N>& s, V& v) noexcept
+        {
+            static_assert(sizeof(V) == sizeof(T) * N, "size mismatch");
+            std::memcpy(&v, s.data(), sizeof(v));
+        }
+
+        template<typename T, int N, typename V>
+        inline simd<T, N> from_vector_ext(const V& v) noexcept
+        {
+            static_assert(sizeof(V) == sizeof(T) * N, "size mismatch");
+            simd<T, N> s;
+            std::memcpy(s.data(), &v, sizeof(v));
+            return s;
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> unary_minus_operator_s(const simd<T, N>& s) noexcept
+        {
+            vector_ext_t<T, N> v;
+            tue::detail_::to_vector_ext(s, v);
+            return tue::detail_::from_vector_ext<T, N>(-v);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> bitwise_not_operator_s(const simd<T, N>& s) noexcept
+        {
+            vector_ext_bits_t<T, N> v;
+            tue::detail_::to_vector_ext(s, v);
+            return tue::detail_::from_vector_ext<T, N>(~v);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> addition_operator_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            vector_ext_t<T, N> l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            return tue::detail_::from_vector_ext<T, N>(l + r);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> subtraction_operator_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            vector_ext_t<T, N> l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            return tue::detail_::from_vector_ext<T, N>(l - r);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> multiplication_operator_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            vector_ext_t<T, N> l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            return tue::detail_::from_vector_ext<T, N>(l * r);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> bitwise_and_operator_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            vector_ext_bits_t<T, N> l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            return tue::detail_::from_vector_ext<T, N>(l & r);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> bitwise_or_operator_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            vector_ext_bits_t<T, N> l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            return tue::detail_::from_vector_ext<T, N>(l | r);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> bitwise_xor_operator_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            vector_ext_bits_t<T, N> l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            return tue::detail_::from_vector_ext<T, N>(l ^ r);
+        }
+
+        // Scalar shifts promote 8- and 16-bit components to `int`, so
+        // shifting them by their width or more is well-defined and gives
+        // zero, or all sign bits when shifting signed components right.
+        // Vector extensions don't promote, so the shifts below give those
+        // results explicitly rather than shifting by such counts.
+        template<typename T, int N>
+        inline simd<T, N> bitwise_shift_left_operator_si(
+            const simd<T, N>& lhs, int rhs) noexcept
+        {
+            constexpr int width = int(sizeof(T)) * 8;
+            if (sizeof(T) < sizeof(int) && rhs >= width)
+            {
+                return simd<T, N>::zero();
+            }
+
+            vector_ext_t<T, N> l;
+            tue::detail_::to_vector_ext(lhs, l);
+            return tue::detail_::from_vector_ext<T, N>(l << rhs);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> bitwise_shift_right_operator_si(
+            const simd<T, N>& lhs, int rhs) noexcept
+        {
+            constexpr int width = int(sizeof(T)) * 8;
+            if (sizeof(T) < sizeof(int) && rhs >= width)
+            {
+                if (!std::is_signed<T>::value)
+                {
+                    return simd<T, N>::zero();
+                }
+                rhs = width - 1;
+            }
+
+            vector_ext_t<T, N> l;
+            tue::detail_::to_vector_ext(lhs, l);
+            return tue::detail_::from_vector_ext<T, N>(l >> rhs);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> bitwise_shift_left_operator_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            using V = vector_ext_t<T, N>;
+            constexpr int width = int(sizeof(T)) * 8;
+            V l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            if (sizeof(T) < sizeof(int))
+            {
+                l &= (V)(r < T(width));
+                r &= T(width - 1);
+            }
+            return tue::detail_::from_vector_ext<T, N>(l << r);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> bitwise_shift_right_operator_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            using V = vector_ext_t<T, N>;
+            constexpr int width = int(sizeof(T)) * 8;
+            V l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            if (sizeof(T) < sizeof(int))
+            {
+                const V in_range = (V)(r < T(width));
+                if (std::is_signed<T>::value)
+                {
+                    r = (r & in_range) | (~in_range & T(width - 1));
+                }
+                else
+                {
+                    l &= in_range;
+                    r &= T(width - 1);
+                }
+            }
+            return tue::detail_::from_vector_ext<T, N>(l >> r);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N>& addition_assignment_operator_ss(
+            simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            return lhs = tue::detail_::addition_operator_ss(lhs, rhs);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N>& subtraction_assignment_operator_ss(
+            simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            return lhs = tue::detail_::subtraction_operator_ss(lhs, rhs);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N>& multiplication_assignment_operator_ss(
+            simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            return lhs = tue::detail_::multiplication_operator_ss(lhs, rhs);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N>& bitwise_and_assignment_operator_ss(
+            simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            return lhs = tue::detail_::bitwise_and_operator_ss(lhs, rhs);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N>& bitwise_or_assignment_operator_ss(
+            simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            return lhs = tue::detail_::bitwise_or_operator_ss(lhs, rhs);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N>& bitwise_xor_assignment_operator_ss(
+            simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            return lhs = tue::detail_::bitwise_xor_operator_ss(lhs, rhs);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N>& bitwise_shift_left_assignment_operator_si(
+            simd<T, N>& lhs, int rhs) noexcept
+        {
+            return lhs =
+                tue::detail_::bitwise_shift_left_operator_si(lhs, rhs);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N>& bitwise_shift_right_assignment_operator_si(
+            simd<T, N>& lhs, int rhs) noexcept
+        {
+            return lhs =
+                tue::detail_::bitwise_shift_right_operator_si(lhs, rhs);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N>& bitwise_shift_left_assignment_operator_ss(
+            simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            return lhs =
+                tue::detail_::bitwise_shift_left_operator_ss(lhs, rhs);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N>& bitwise_shift_right_assignment_operator_ss(
+            simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            return lhs =
+                tue::detail_::bitwise_shift_right_operator_ss(lhs, rhs);
+        }
+
+        // Picks each component from `values` where `mask` is all ones and
+        // from `otherwise` where it's all zeros.
+        template<typename T, int N, typename M>
+        inline simd<T, N> vector_ext_blend(
+            const M& mask,
+            const simd<T, N>& values,
+            const simd<T, N>& otherwise) noexcept
+        {
+            using B = vector_ext_bits_t<T, N>;
+            const B bits = (B)mask;
+            B v, o;
+            tue::detail_::to_vector_ext(values, v);
+            tue::detail_::to_vector_ext(otherwise, o);
+            return tue::detail_::from_vector_ext<T, N>(
+                (bits & v) | (~bits & o));
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> min_ss(
+            const simd<T, N>& s1, const simd<T, N>& s2) noexcept
+        {
+            // Matches std::min(), which returns s1 unless s2 < s1.
+            vector_ext_t<T, N> v1, v2;
+            tue::detail_::to_vector_ext(s1, v1);
+            tue::detail_::to_vector_ext(s2, v2);
+            return tue::detail_::vector_ext_blend(v2 < v1, s2, s1);
+        }
+
+        template<typename T, int N>
+        inline simd<T, N> max_ss(
+            const simd<T, N>& s1, const simd<T, N>& s2) noexcept
+        {
+            vector_ext_t<T, N> v1, v2;
+            tue::detail_::to_vector_ext(s1, v1);
+            tue::detail_::to_vector_ext(s2, v2);
+            return tue::detail_::vector_ext_blend(v1 < v2, s2, s1);
+        }
+
+        template<typename T, int N>
+        inline simd<sized_bool_t<sizeof(T)>, N> less_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            vector_ext_t<T, N> l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            return tue::detail_::from_vector_ext<sized_bool_t<sizeof(T)>, N>(
+                l < r);
+        }
+
+        template<typename T, int N>
+        inline simd<sized_bool_t<sizeof(T)>, N> less_equal_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            vector_ext_t<T, N> l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            return tue::detail_::from_vector_ext<sized_bool_t<sizeof(T)>, N>(
+                l <= r);
+        }
+
+        template<typename T, int N>
+        inline simd<sized_bool_t<sizeof(T)>, N> greater_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            vector_ext_t<T, N> l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            return tue::detail_::from_vector_ext<sized_bool_t<sizeof(T)>, N>(
+                l > r);
+        }
+
+        template<typename T, int N>
+        inline simd<sized_bool_t<sizeof(T)>, N> greater_equal_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            vector_ext_t<T, N> l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            return tue::detail_::from_vector_ext<sized_bool_t<sizeof(T)>, N>(
+                l >= r);
+        }
+
+        template<typename T, int N>
+        inline simd<sized_bool_t<sizeof(T)>, N> equal_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            vector_ext_t<T, N> l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            return tue::detail_::from_vector_ext<sized_bool_t<sizeof(T)>, N>(
+                l == r);
+        }
+
+        template<typename T, int N>
+        inline simd<sized_bool_t<sizeof(T)>, N> not_equal_ss(
+            const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+        {
+            vector_ext_t<T, N> l, r;
+            tue::detail_::to_vector_ext(lhs, l);
+            tue::detail_::to_vector_ext(rhs, r);
+            return tue::detail_::from_vector_ext<sized_bool_t<sizeof(T)>, N>(
+                l != r);
+        }
+    }
+}
@@ -999,6 +999,57 @@ namespace tue
             tue::math::sincos(v[2], sin_out[2], cos_out[2]);
         }
 
+        template<typename T>
+        inline vec<T, 3> tan_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::tan(v[0]),
+                tue::math::tan(v[1]),
+                tue::math::tan(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> asin_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::asin(v[0]),
+                tue::math::asin(v[1]),
+                tue::math::asin(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> acos_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::acos(v[0]),
+                tue::math::acos(v[1]),
+                tue::math::acos(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> atan_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::atan(v[0]),
+                tue::math::atan(v[1]),
+                tue::math::atan(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> atan2_vv(
+            const vec<T, 3>& y, const vec<T, 3>& x) noexcept
+        {
+            return {
+                tue::math::atan2(y[0], x[0]),
+                tue::math::atan2(y[1], x[1]),
+                tue::math::atan2(y[2], x[2]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 3> exp_v(const vec<T, 3>& v) noexcept
         {
@@ -1009,6 +1060,16 @@ namespace tue
             };
         }
 
+        template<typename T>
+        inline vec<T, 3> exp2_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::exp2(v[0]),
+                tue::math::exp2(v[1]),
+                tue::math::exp2(v[2]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 3> log_v(const vec<T, 3>& v) noexcept
         {
@@ -1019,6 +1080,26 @@ namespace tue
             };
         }
 
+        template<typename T>
+        inline vec<T, 3> log2_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::log2(v[0]),
+                tue::math::log2(v[1]),
+                tue::math::log2(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> log10_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::log10(v[0]),
+                tue::math::log10(v[1]),
+                tue::math::log10(v[2]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 3> abs_v(const vec<T, 3>& v) noexcept
         {
@@ -1060,6 +1141,16 @@ namespace tue
             };
         }
 
+        template<typename T>
+        inline vec<T, 3> cbrt_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::cbrt(v[0]),
+                tue::math::cbrt(v[1]),
+                tue::math::cbrt(v[2]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 3> rsqrt_v(const vec<T, 3>& v) noexcept
         {
@@ -1070,6 +1161,223 @@ namespace tue
             };
         }
 
+        template<typename T>
+        inline vec<T, 3> fma_vvv(
+            const vec<T, 3>& v1,
+            const vec<T, 3>& v2,
+            const vec<T, 3>& v3) noexcept
+        {
+            return {
+                tue::math::fma(v1[0], v2[0], v3[0]),
+                tue::math::fma(v1[1], v2[1], v3[1]),
+                tue::math::fma(v1[2], v2[2], v3[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> floor_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::floor(v[0]),
+                tue::math::floor(v[1]),
+                tue::math::floor(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> ceil_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::ceil(v[0]),
+                tue::math::ceil(v[1]),
+                tue::math::ceil(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> round_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::round(v[0]),
+                tue::math::round(v[1]),
+                tue::math::round(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> trunc_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::trunc(v[0]),
+                tue::math::trunc(v[1]),
+                tue::math::trunc(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> fast_sin_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::fast::sin(v[0]),
+                tue::math::fast::sin(v[1]),
+                tue::math::fast::sin(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> fast_cos_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::fast::cos(v[0]),
+                tue::math::fast::cos(v[1]),
+                tue::math::fast::cos(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline void fast_sincos_v(
+            const vec<T, 3>& v,
+            vec<T, 3>& sin_out,
+            vec<T, 3>& cos_out) noexcept
+        {
+            tue::math::fast::sincos(v[0], sin_out[0], cos_out[0]);
+            tue::math::fast::sincos(v[1], sin_out[1], cos_out[1]);
+            tue::math::fast::sincos(v[2], sin_out[2], cos_out[2]);
+        }
+
+        template<typename T>
+        inline vec<T, 3> fast_exp_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::fast::exp(v[0]),
+                tue::math::fast::exp(v[1]),
+                tue::math::fast::exp(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> fast_log_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::fast::log(v[0]),
+                tue::math::fast::log(v[1]),
+                tue::math::fast::log(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> fast_pow_vv(
+            const vec<T, 3>& bases, const vec<T, 3>& exponents) noexcept
+        {
+            return {
+                tue::math::fast::pow(bases[0], exponents[0]),
+                tue::math::fast::pow(bases[1], exponents[1]),
+                tue::math::fast::pow(bases[2], exponents[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> fast_recip_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::fast::recip(v[0]),
+                tue::math::fast::recip(v[1]),
+                tue::math::fast::recip(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> fast_rsqrt_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::fast::rsqrt(v[0]),
+                tue::math::fast::rsqrt(v[1]),
+                tue::math::fast::rsqrt(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> precise_sin_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::precise::sin(v[0]),
+                tue::math::precise::sin(v[1]),
+                tue::math::precise::sin(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> precise_cos_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::precise::cos(v[0]),
+                tue::math::precise::cos(v[1]),
+                tue::math::precise::cos(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline void precise_sincos_v(
+            const vec<T, 3>& v,
+            vec<T, 3>& sin_out,
+            vec<T, 3>& cos_out) noexcept
+        {
+            tue::math::precise::sincos(v[0], sin_out[0], cos_out[0]);
+            tue::math::precise::sincos(v[1], sin_out[1], cos_out[1]);
+            tue::math::precise::sincos(v[2], sin_out[2], cos_out[2]);
+        }
+
+        template<typename T>
+        inline vec<T, 3> precise_exp_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::precise::exp(v[0]),
+                tue::math::precise::exp(v[1]),
+                tue::math::precise::exp(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> precise_log_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::precise::log(v[0]),
+                tue::math::precise::log(v[1]),
+                tue::math::precise::log(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> precise_pow_vv(
+            const vec<T, 3>& bases, const vec<T, 3>& exponents) noexcept
+        {
+            return {
+                tue::math::precise::pow(bases[0], exponents[0]),
+                tue::math::precise::pow(bases[1], exponents[1]),
+                tue::math::precise::pow(bases[2], exponents[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> precise_recip_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::precise::recip(v[0]),
+                tue::math::precise::recip(v[1]),
+                tue::math::precise::recip(v[2]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 3> precise_rsqrt_v(const vec<T, 3>& v) noexcept
+        {
+            return {
+                tue::math::precise::rsqrt(v[0]),
+                tue::math::precise::rsqrt(v[1]),
+                tue::math::precise::rsqrt(v[2]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 3> min_vv(
             const vec<T, 3>& v1, const vec<T, 3>& v2) noexcept
@@ -1212,18 +1520,18 @@ namespace tue
             decltype(std::declval<T>() * std::declval<U>())
         dot_vv(const vec<T, 3>& lhs, const vec<U, 3>& rhs) noexcept
         {
-            return lhs[0] * rhs[0]
-                 + lhs[1] * rhs[1]
-                 + lhs[2] * rhs[2];
+            return tue::detail_::madd(
+                lhs[2], rhs[2], tue::detail_::madd(
+                lhs[1], rhs[1], lhs[0] * rhs[0]));
         }
 
         template<typename T>
         inline constexpr T
         length2_v(const vec<T, 3>& v) noexcept
         {
-            return v[0] * v[0]
-                 + v[1] * v[1]
-                 + v[2] * v[2];
+            return tue::detail_::madd(
+                v[2], v[2], tue::detail_::madd(
+                v[1], v[1], v[0] * v[0]));
         }
 
         template<typename T>
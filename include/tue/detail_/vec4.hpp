@@ -1168,6 +1168,62 @@ namespace tue
             tue::math::sincos(v[3], sin_out[3], cos_out[3]);
         }
 
+        template<typename T>
+        inline vec<T, 4> tan_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::tan(v[0]),
+                tue::math::tan(v[1]),
+                tue::math::tan(v[2]),
+                tue::math::tan(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> asin_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::asin(v[0]),
+                tue::math::asin(v[1]),
+                tue::math::asin(v[2]),
+                tue::math::asin(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> acos_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::acos(v[0]),
+                tue::math::acos(v[1]),
+                tue::math::acos(v[2]),
+                tue::math::acos(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> atan_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::atan(v[0]),
+                tue::math::atan(v[1]),
+                tue::math::atan(v[2]),
+                tue::math::atan(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline  vec<T, 4> atan2_vv(
+            const vec<T, 4>& y, const vec<T, 4>& x) noexcept
+        {
+            return {
+                tue::math::atan2(y[0], x[0]),
+                tue::math::atan2(y[1], x[1]),
+                tue::math::atan2(y[2], x[2]),
+                tue::math::atan2(y[3], x[3]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 4> exp_v(const vec<T, 4>& v) noexcept
         {
@@ -1179,6 +1235,17 @@ namespace tue
             };
         }
 
+        template<typename T>
+        inline vec<T, 4> exp2_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::exp2(v[0]),
+                tue::math::exp2(v[1]),
+                tue::math::exp2(v[2]),
+                tue::math::exp2(v[3]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 4> log_v(const vec<T, 4>& v) noexcept
         {
@@ -1190,6 +1257,28 @@ namespace tue
             };
         }
 
+        template<typename T>
+        inline vec<T, 4> log2_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::log2(v[0]),
+                tue::math::log2(v[1]),
+                tue::math::log2(v[2]),
+                tue::math::log2(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> log10_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::log10(v[0]),
+                tue::math::log10(v[1]),
+                tue::math::log10(v[2]),
+                tue::math::log10(v[3]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 4> abs_v(const vec<T, 4>& v) noexcept
         {
@@ -1235,6 +1324,17 @@ namespace tue
             };
         }
 
+        template<typename T>
+        inline vec<T, 4> cbrt_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::cbrt(v[0]),
+                tue::math::cbrt(v[1]),
+                tue::math::cbrt(v[2]),
+                tue::math::cbrt(v[3]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 4> rsqrt_v(const vec<T, 4>& v) noexcept
         {
@@ -1246,6 +1346,244 @@ namespace tue
             };
         }
 
+        template<typename T>
+        inline vec<T, 4> fma_vvv(
+            const vec<T, 4>& v1,
+            const vec<T, 4>& v2,
+            const vec<T, 4>& v3) noexcept
+        {
+            return {
+                tue::math::fma(v1[0], v2[0], v3[0]),
+                tue::math::fma(v1[1], v2[1], v3[1]),
+                tue::math::fma(v1[2], v2[2], v3[2]),
+                tue::math::fma(v1[3], v2[3], v3[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> floor_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::floor(v[0]),
+                tue::math::floor(v[1]),
+                tue::math::floor(v[2]),
+                tue::math::floor(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> ceil_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::ceil(v[0]),
+                tue::math::ceil(v[1]),
+                tue::math::ceil(v[2]),
+                tue::math::ceil(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> round_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::round(v[0]),
+                tue::math::round(v[1]),
+                tue::math::round(v[2]),
+                tue::math::round(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> trunc_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::trunc(v[0]),
+                tue::math::trunc(v[1]),
+                tue::math::trunc(v[2]),
+                tue::math::trunc(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> fast_sin_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::fast::sin(v[0]),
+                tue::math::fast::sin(v[1]),
+                tue::math::fast::sin(v[2]),
+                tue::math::fast::sin(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> fast_cos_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::fast::cos(v[0]),
+                tue::math::fast::cos(v[1]),
+                tue::math::fast::cos(v[2]),
+                tue::math::fast::cos(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline void fast_sincos_v(
+            const vec<T, 4>& v,
+            vec<T, 4>& sin_out,
+            vec<T, 4>& cos_out) noexcept
+        {
+            tue::math::fast::sincos(v[0], sin_out[0], cos_out[0]);
+            tue::math::fast::sincos(v[1], sin_out[1], cos_out[1]);
+            tue::math::fast::sincos(v[2], sin_out[2], cos_out[2]);
+            tue::math::fast::sincos(v[3], sin_out[3], cos_out[3]);
+        }
+
+        template<typename T>
+        inline vec<T, 4> fast_exp_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::fast::exp(v[0]),
+                tue::math::fast::exp(v[1]),
+                tue::math::fast::exp(v[2]),
+                tue::math::fast::exp(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> fast_log_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::fast::log(v[0]),
+                tue::math::fast::log(v[1]),
+                tue::math::fast::log(v[2]),
+                tue::math::fast::log(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline  vec<T, 4> fast_pow_vv(
+            const vec<T, 4>& bases, const vec<T, 4>& exponents) noexcept
+        {
+            return {
+                tue::math::fast::pow(bases[0], exponents[0]),
+                tue::math::fast::pow(bases[1], exponents[1]),
+                tue::math::fast::pow(bases[2], exponents[2]),
+                tue::math::fast::pow(bases[3], exponents[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> fast_recip_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::fast::recip(v[0]),
+                tue::math::fast::recip(v[1]),
+                tue::math::fast::recip(v[2]),
+                tue::math::fast::recip(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> fast_rsqrt_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::fast::rsqrt(v[0]),
+                tue::math::fast::rsqrt(v[1]),
+                tue::math::fast::rsqrt(v[2]),
+                tue::math::fast::rsqrt(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> precise_sin_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::precise::sin(v[0]),
+                tue::math::precise::sin(v[1]),
+                tue::math::precise::sin(v[2]),
+                tue::math::precise::sin(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> precise_cos_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::precise::cos(v[0]),
+                tue::math::precise::cos(v[1]),
+                tue::math::precise::cos(v[2]),
+                tue::math::precise::cos(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline void precise_sincos_v(
+            const vec<T, 4>& v,
+            vec<T, 4>& sin_out,
+            vec<T, 4>& cos_out) noexcept
+        {
+            tue::math::precise::sincos(v[0], sin_out[0], cos_out[0]);
+            tue::math::precise::sincos(v[1], sin_out[1], cos_out[1]);
+            tue::math::precise::sincos(v[2], sin_out[2], cos_out[2]);
+            tue::math::precise::sincos(v[3], sin_out[3], cos_out[3]);
+        }
+
+        template<typename T>
+        inline vec<T, 4> precise_exp_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::precise::exp(v[0]),
+                tue::math::precise::exp(v[1]),
+                tue::math::precise::exp(v[2]),
+                tue::math::precise::exp(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> precise_log_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::precise::log(v[0]),
+                tue::math::precise::log(v[1]),
+                tue::math::precise::log(v[2]),
+                tue::math::precise::log(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline  vec<T, 4> precise_pow_vv(
+            const vec<T, 4>& bases, const vec<T, 4>& exponents) noexcept
+        {
+            return {
+                tue::math::precise::pow(bases[0], exponents[0]),
+                tue::math::precise::pow(bases[1], exponents[1]),
+                tue::math::precise::pow(bases[2], exponents[2]),
+                tue::math::precise::pow(bases[3], exponents[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> precise_recip_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::precise::recip(v[0]),
+                tue::math::precise::recip(v[1]),
+                tue::math::precise::recip(v[2]),
+                tue::math::precise::recip(v[3]),
+            };
+        }
+
+        template<typename T>
+        inline vec<T, 4> precise_rsqrt_v(const vec<T, 4>& v) noexcept
+        {
+            return {
+                tue::math::precise::rsqrt(v[0]),
+                tue::math::precise::rsqrt(v[1]),
+                tue::math::precise::rsqrt(v[2]),
+                tue::math::precise::rsqrt(v[3]),
+            };
+        }
+
         template<typename T>
         inline vec<T, 4> min_vv(
             const vec<T, 4>& v1, const vec<T, 4>& v2) noexcept
@@ -1398,20 +1736,20 @@ namespace tue
             decltype(std::declval<T>() * std::declval<U>())
         dot_vv(const vec<T, 4>& lhs, const vec<U, 4>& rhs) noexcept
         {
-            return lhs[0] * rhs[0]
-                 + lhs[1] * rhs[1]
-                 + lhs[2] * rhs[2]
-                 + lhs[3] * rhs[3];
+            return tue::detail_::madd(
+                lhs[3], rhs[3], tue::detail_::madd(
+                lhs[2], rhs[2], tue::detail_::madd(
+                lhs[1], rhs[1], lhs[0] * rhs[0])));
         }
 
         template<typename T>
         inline constexpr T
         length2_v(const vec<T, 4>& v) noexcept
         {
-            return v[0] * v[0]
-                 + v[1] * v[1]
-                 + v[2] * v[2]
-                 + v[3] * v[3];
+            return tue::detail_::madd(
+                v[3], v[3], tue::detail_::madd(
+                v[2], v[2], tue::detail_::madd(
+                v[1], v[1], v[0] * v[0])));
         }
 
         template<typename T>
@@ -1724,6 +1724,95 @@ namespace tue
             tue::detail_::sincos_m(m, sin_out, cos_out);
         }
 
+        /*!
+         * \brief     Computes `tue::math::tan()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::tan()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> tan(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::tan_m(m);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::asin()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::asin()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> asin(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::asin_m(m);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::acos()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::acos()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> acos(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::acos_m(m);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::atan()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::atan()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> atan(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::atan_m(m);
+        }
+
+        /*!
+         * \brief            Computes `tue::math::atan2()` for each component of
+         *                   `y` and each corresponding component of `x`.
+         *
+         * \tparam T         The component type of both `y` and `x`.
+         * \tparam C         The column count of both `y` and `x`.
+         * \tparam R         The row count of both `y` and `x`.
+         *
+         * \param y          The y-coordinates.
+         * \param x          The x-coordinates.
+         *
+         * \return           `tue::math::atan2()` for each component of `y`
+         *                   and each corresponding component of `x`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> atan2(
+            const mat<T, C, R>& y, const mat<T, C, R>& x) noexcept
+        {
+            return tue::detail_::atan2_mm(y, x);
+        }
+
         /*!
          * \brief     Computes `tue::math::exp()` for each component of `m`.
          *
@@ -1741,6 +1830,23 @@ namespace tue
             return tue::detail_::exp_m(m);
         }
 
+        /*!
+         * \brief     Computes `tue::math::exp2()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::exp2()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> exp2(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::exp2_m(m);
+        }
+
         /*!
          * \brief     Computes `tue::math::log()` for each component of `m`.
          *
@@ -1758,6 +1864,40 @@ namespace tue
             return tue::detail_::log_m(m);
         }
 
+        /*!
+         * \brief     Computes `tue::math::log2()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::log2()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> log2(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::log2_m(m);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::log10()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::log10()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> log10(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::log10_m(m);
+        }
+
         /*!
          * \brief     Computes `tue::math::abs()` for each component of `m`.
          *
@@ -1831,6 +1971,23 @@ namespace tue
             return tue::detail_::sqrt_m(m);
         }
 
+        /*!
+         * \brief     Computes `tue::math::cbrt()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::cbrt()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> cbrt(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::cbrt_m(m);
+        }
+
         /*!
          * \brief     Computes `tue::math::rsqrt()` for each component of `m`.
          *
@@ -1848,6 +2005,137 @@ namespace tue
             return tue::detail_::rsqrt_m(m);
         }
 
+        /*!
+         * \brief     Computes `tue::math::fma()` for each corresponding trio
+         *            of components from `m1`, `m2`, and `m3`.
+         *
+         * \tparam T  The component type of all three parameters.
+         * \tparam C  The column count of all three parameters.
+         * \tparam R  The row count of all three parameters.
+         *
+         * \param m1  A `mat`.
+         * \param m2  Another `mat`.
+         * \param m3  Another `mat`.
+         *
+         * \return    `tue::math::fma()` for each corresponding trio of
+         *            components from `m1`, `m2`, and `m3`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> fma(
+            const mat<T, C, R>& m1,
+            const mat<T, C, R>& m2,
+            const mat<T, C, R>& m3) noexcept
+        {
+            return tue::detail_::fma_mmm(m1, m2, m3);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::floor()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::floor()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> floor(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::floor_m(m);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::ceil()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::ceil()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> ceil(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::ceil_m(m);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::round()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::round()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> round(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::round_m(m);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::trunc()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::trunc()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> trunc(const mat<T, C, R>& m) noexcept
+        {
+            return tue::detail_::trunc_m(m);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::fract()` for each component of `m`.
+         *
+         * \tparam T  The component type of `m`.
+         * \tparam C  The column count of `m`.
+         * \tparam R  The row count of `m`.
+         *
+         * \param m   A `mat`.
+         *
+         * \return    `tue::math::fract()` for each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> fract(const mat<T, C, R>& m) noexcept
+        {
+            return m - tue::detail_::floor_m(m);
+        }
+
+        /*!
+         * \brief               Computes `tue::math::modf()` for each
+         *                      component of `m`.
+         *
+         * \tparam T            The component type of `m`.
+         * \tparam C            The column count of `m`.
+         * \tparam R            The row count of `m`.
+         *
+         * \param m             A `mat`.
+         * \param integral_out  Where to store `tue::math::trunc()` of `m`.
+         *
+         * \return              The fractional part of each component of `m`.
+         */
+        template<typename T, int C, int R>
+        inline mat<T, C, R> modf(
+            const mat<T, C, R>& m,
+            mat<T, C, R>& integral_out) noexcept
+        {
+            integral_out = tue::detail_::trunc_m(m);
+            return m - integral_out;
+        }
+
         /*!
          * \brief     Computes `tue::math::min()` for each corresponding pair of
          *            components from `m1` and `m2`.
@@ -2129,6 +2417,328 @@ namespace tue
             return tue::detail_::transpose_m(m);
         }
 
+        namespace fast
+        {
+            /*!
+             * \brief     Computes `tue::math::fast::sin()` for each component
+             *            of `m`.
+             *
+             * \tparam T  The component type of `m`.
+             * \tparam C  The column count of `m`.
+             * \tparam R  The row count of `m`.
+             *
+             * \param m   A `mat`.
+             *
+             * \return    `tue::math::fast::sin()` for each component of `m`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> sin(const mat<T, C, R>& m) noexcept
+            {
+                return tue::detail_::fast_sin_m(m);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::cos()` for each component
+             *            of `m`.
+             *
+             * \tparam T  The component type of `m`.
+             * \tparam C  The column count of `m`.
+             * \tparam R  The row count of `m`.
+             *
+             * \param m   A `mat`.
+             *
+             * \return    `tue::math::fast::cos()` for each component of `m`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> cos(const mat<T, C, R>& m) noexcept
+            {
+                return tue::detail_::fast_cos_m(m);
+            }
+
+            /*!
+             * \brief          Computes `tue::math::fast::sincos()` for each
+             *                 component of `m`.
+             *
+             * \tparam T       The component type of `m`.
+             * \tparam C       The column count of `m`.
+             * \tparam R       The row count of `m`.
+             *
+             * \param m        A `mat`.
+             * \param sin_out  A reference to the `mat` to store the `sin()`
+             *                 results in.
+             * \param cos_out  A reference to the `mat` to store the `cos()`
+             *                 results in.
+             */
+            template<typename T, int C, int R>
+            inline void sincos(
+                const mat<T, C, R>& m,
+                mat<T, C, R>& sin_out,
+                mat<T, C, R>& cos_out) noexcept
+            {
+                tue::detail_::fast_sincos_m(m, sin_out, cos_out);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::exp()` for each component
+             *            of `m`.
+             *
+             * \tparam T  The component type of `m`.
+             * \tparam C  The column count of `m`.
+             * \tparam R  The row count of `m`.
+             *
+             * \param m   A `mat`.
+             *
+             * \return    `tue::math::fast::exp()` for each component of `m`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> exp(const mat<T, C, R>& m) noexcept
+            {
+                return tue::detail_::fast_exp_m(m);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::log()` for each component
+             *            of `m`.
+             *
+             * \tparam T  The component type of `m`.
+             * \tparam C  The column count of `m`.
+             * \tparam R  The row count of `m`.
+             *
+             * \param m   A `mat`.
+             *
+             * \return    `tue::math::fast::log()` for each component of `m`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> log(const mat<T, C, R>& m) noexcept
+            {
+                return tue::detail_::fast_log_m(m);
+            }
+
+            /*!
+             * \brief            Computes `tue::math::fast::pow()` for each
+             *                   component of `bases` and each corresponding
+             *                   component of `exponents`.
+             *
+             * \tparam T         The component type of both `bases` and
+             *                   `exponents`.
+             * \tparam C         The column count of both `bases` and
+             *                   `exponents`.
+             * \tparam R         The row count of both `bases` and `exponents`.
+             *
+             * \param bases      The bases.
+             * \param exponents  The exponents.
+             *
+             * \return           `tue::math::fast::pow()` for each component of
+             *                   `bases` and each corresponding component of
+             *                   `exponents`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> pow(
+                const mat<T, C, R>& bases,
+                const mat<T, C, R>& exponents) noexcept
+            {
+                return tue::detail_::fast_pow_mm(bases, exponents);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::recip()` for each component
+             *            of `m`.
+             *
+             * \tparam T  The component type of `m`.
+             * \tparam C  The column count of `m`.
+             * \tparam R  The row count of `m`.
+             *
+             * \param m   A `mat`.
+             *
+             * \return    `tue::math::fast::recip()` for each component of `m`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> recip(const mat<T, C, R>& m) noexcept
+            {
+                return tue::detail_::fast_recip_m(m);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::rsqrt()` for each component
+             *            of `m`.
+             *
+             * \tparam T  The component type of `m`.
+             * \tparam C  The column count of `m`.
+             * \tparam R  The row count of `m`.
+             *
+             * \param m   A `mat`.
+             *
+             * \return    `tue::math::fast::rsqrt()` for each component of `m`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> rsqrt(const mat<T, C, R>& m) noexcept
+            {
+                return tue::detail_::fast_rsqrt_m(m);
+            }
+        }
+
+        namespace precise
+        {
+            /*!
+             * \brief     Computes `tue::math::precise::sin()` for each
+             *            component of `m`.
+             *
+             * \tparam T  The component type of `m`.
+             * \tparam C  The column count of `m`.
+             * \tparam R  The row count of `m`.
+             *
+             * \param m   A `mat`.
+             *
+             * \return    `tue::math::precise::sin()` for each component of `m`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> sin(const mat<T, C, R>& m) noexcept
+            {
+                return tue::detail_::precise_sin_m(m);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::cos()` for each
+             *            component of `m`.
+             *
+             * \tparam T  The component type of `m`.
+             * \tparam C  The column count of `m`.
+             * \tparam R  The row count of `m`.
+             *
+             * \param m   A `mat`.
+             *
+             * \return    `tue::math::precise::cos()` for each component of `m`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> cos(const mat<T, C, R>& m) noexcept
+            {
+                return tue::detail_::precise_cos_m(m);
+            }
+
+            /*!
+             * \brief          Computes `tue::math::precise::sincos()` for each
+             *                 component of `m`.
+             *
+             * \tparam T       The component type of `m`.
+             * \tparam C       The column count of `m`.
+             * \tparam R       The row count of `m`.
+             *
+             * \param m        A `mat`.
+             * \param sin_out  A reference to the `mat` to store the `sin()`
+             *                 results in.
+             * \param cos_out  A reference to the `mat` to store the `cos()`
+             *                 results in.
+             */
+            template<typename T, int C, int R>
+            inline void sincos(
+                const mat<T, C, R>& m,
+                mat<T, C, R>& sin_out,
+                mat<T, C, R>& cos_out) noexcept
+            {
+                tue::detail_::precise_sincos_m(m, sin_out, cos_out);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::exp()` for each
+             *            component of `m`.
+             *
+             * \tparam T  The component type of `m`.
+             * \tparam C  The column count of `m`.
+             * \tparam R  The row count of `m`.
+             *
+             * \param m   A `mat`.
+             *
+             * \return    `tue::math::precise::exp()` for each component of `m`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> exp(const mat<T, C, R>& m) noexcept
+            {
+                return tue::detail_::precise_exp_m(m);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::log()` for each
+             *            component of `m`.
+             *
+             * \tparam T  The component type of `m`.
+             * \tparam C  The column count of `m`.
+             * \tparam R  The row count of `m`.
+             *
+             * \param m   A `mat`.
+             *
+             * \return    `tue::math::precise::log()` for each component of `m`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> log(const mat<T, C, R>& m) noexcept
+            {
+                return tue::detail_::precise_log_m(m);
+            }
+
+            /*!
+             * \brief            Computes `tue::math::precise::pow()` for each
+             *                   component of `bases` and each corresponding
+             *                   component of `exponents`.
+             *
+             * \tparam T         The component type of both `bases` and
+             *                   `exponents`.
+             * \tparam C         The column count of both `bases` and
+             *                   `exponents`.
+             * \tparam R         The row count of both `bases` and `exponents`.
+             *
+             * \param bases      The bases.
+             * \param exponents  The exponents.
+             *
+             * \return           `tue::math::precise::pow()` for each component
+             *                   of `bases` and each corresponding component of
+             *                   `exponents`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> pow(
+                const mat<T, C, R>& bases,
+                const mat<T, C, R>& exponents) noexcept
+            {
+                return tue::detail_::precise_pow_mm(bases, exponents);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::recip()` for each
+             *            component of `m`.
+             *
+             * \tparam T  The component type of `m`.
+             * \tparam C  The column count of `m`.
+             * \tparam R  The row count of `m`.
+             *
+             * \param m   A `mat`.
+             *
+             * \return    `tue::math::precise::recip()` for each component of
+             *            `m`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> recip(const mat<T, C, R>& m) noexcept
+            {
+                return tue::detail_::precise_recip_m(m);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::rsqrt()` for each
+             *            component of `m`.
+             *
+             * \tparam T  The component type of `m`.
+             * \tparam C  The column count of `m`.
+             * \tparam R  The row count of `m`.
+             *
+             * \param m   A `mat`.
+             *
+             * \return    `tue::math::precise::rsqrt()` for each component of
+             *            `m`.
+             */
+            template<typename T, int C, int R>
+            inline mat<T, C, R> rsqrt(const mat<T, C, R>& m) noexcept
+            {
+                return tue::detail_::precise_rsqrt_m(m);
+            }
+        }
+
         /*!@}*/
     }
 }
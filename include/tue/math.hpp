@@ -10,11 +10,15 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <limits>
 #include <type_traits>
+#include <utility>
 
 #include "detail_/is_arithmetic_simd_component.hpp"
 #include "detail_/is_floating_point_simd_component.hpp"
+#include "detail_/is_integral_simd_component.hpp"
 #include "detail_/is_simd_component.hpp"
 #include "sized_bool.hpp"
 
@@ -43,6 +47,18 @@ namespace tue
         {
             return x;
         }
+
+        // Computes x * y + z. Dot products, matrix multiplication and the
+        // like are written in terms of this so the overload for
+        // floating-point `simd` can fuse them when TUE_FMA is defined.
+        // Scalars keep the plain expression so they stay constexpr.
+        template<typename T, typename U, typename V>
+        inline constexpr decltype(
+            std::declval<T>() * std::declval<U>() + std::declval<V>())
+        madd(const T& x, const U& y, const V& z) noexcept
+        {
+            return x * y + z;
+        }
     }
 
     namespace math
@@ -104,6 +120,90 @@ namespace tue
             cos_out = std::cos(x);
         }
 
+        /*!
+         * \brief     Computes the tangent of `x` (measured in radians).
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The tangent of `x` (measured in radians).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        tan(T x) noexcept
+        {
+            return std::tan(x);
+        }
+
+        /*!
+         * \brief     Computes the arc sine of `x`.
+         * \details   If `x` is outside [-1, 1], behavior is undefined.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The arc sine of `x` (measured in radians).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        asin(T x) noexcept
+        {
+            return std::asin(x);
+        }
+
+        /*!
+         * \brief     Computes the arc cosine of `x`.
+         * \details   If `x` is outside [-1, 1], behavior is undefined.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The arc cosine of `x` (measured in radians).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        acos(T x) noexcept
+        {
+            return std::acos(x);
+        }
+
+        /*!
+         * \brief     Computes the arc tangent of `x`.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The arc tangent of `x` (measured in radians).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        atan(T x) noexcept
+        {
+            return std::atan(x);
+        }
+
+        /*!
+         * \brief     Computes the arc tangent of `y / x` using the signs of
+         *            both to determine the quadrant.
+         *
+         * \tparam T  The type of parameters `y` and `x`.
+         *
+         * \param y   A floating-point number.
+         * \param x   Another floating-point number.
+         *
+         * \return    The arc tangent of `y / x` (measured in radians).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        atan2(T y, T x) noexcept
+        {
+            return std::atan2(y, x);
+        }
+
         /*!
          * \brief     Computes the base-e exponential of `x`.
          *
@@ -120,6 +220,22 @@ namespace tue
             return std::exp(x);
         }
 
+        /*!
+         * \brief     Computes the base-2 exponential of `x`.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The base-2 exponential of `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        exp2(T x) noexcept
+        {
+            return std::exp2(x);
+        }
+
         /*!
          * \brief     Computes the base-e (natural) logarithm of `x`.
          * \details   If `x` is negative, behavior is undefined.
@@ -137,6 +253,40 @@ namespace tue
             return std::log(x);
         }
 
+        /*!
+         * \brief     Computes the base-2 logarithm of `x`.
+         * \details   If `x` is negative, behavior is undefined.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The base-2 logarithm of `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        log2(T x) noexcept
+        {
+            return std::log2(x);
+        }
+
+        /*!
+         * \brief     Computes the base-10 logarithm of `x`.
+         * \details   If `x` is negative, behavior is undefined.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The base-10 logarithm of `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        log10(T x) noexcept
+        {
+            return std::log10(x);
+        }
+
         /*!
          * \brief     Computes the absolute value of `x`.
          *
@@ -205,6 +355,22 @@ namespace tue
             return std::sqrt(x);
         }
 
+        /*!
+         * \brief     Computes the cube root of `x`.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The cube root of `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        cbrt(T x) noexcept
+        {
+            return std::cbrt(x);
+        }
+
         /*!
          * \brief     Computes the reciprocal of the nonnegative square root of
          *            `x`.
@@ -224,6 +390,130 @@ namespace tue
             return 1 / std::sqrt(x);
         }
 
+        /*!
+         * \brief     Computes `x * y + z` with a single rounding.
+         *
+         * \tparam T  The type of parameters `x`, `y`, and `z`.
+         *
+         * \param x   A floating-point number.
+         * \param y   Another floating-point number.
+         * \param z   Another floating-point number.
+         *
+         * \return    `x * y + z` computed as if to infinite precision and
+         *            rounded once.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        fma(T x, T y, T z) noexcept
+        {
+            return std::fma(x, y, z);
+        }
+
+        /*!
+         * \brief     Computes the largest integer value not greater than `x`.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The largest integer value not greater than `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        floor(T x) noexcept
+        {
+            return std::floor(x);
+        }
+
+        /*!
+         * \brief     Computes the smallest integer value not less than `x`.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The smallest integer value not less than `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        ceil(T x) noexcept
+        {
+            return std::ceil(x);
+        }
+
+        /*!
+         * \brief     Computes the nearest integer value to `x`.
+         * \details   Halfway cases are rounded away from zero.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The nearest integer value to `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        round(T x) noexcept
+        {
+            return std::round(x);
+        }
+
+        /*!
+         * \brief     Computes the nearest integer value not greater in
+         *            magnitude than `x`.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    The nearest integer value not greater in magnitude
+         *            than `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        trunc(T x) noexcept
+        {
+            return std::trunc(x);
+        }
+
+        /*!
+         * \brief     Computes the fractional part of `x` relative to
+         *            `tue::math::floor()`.
+         * \details   The result is `x - floor(x)`, so it's nonnegative even
+         *            when `x` is negative. Like GLSL's `fract()`, very small
+         *            negative values can round up to `1`.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A floating-point number.
+         *
+         * \return    `x - floor(x)`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        fract(T x) noexcept
+        {
+            return x - std::floor(x);
+        }
+
+        /*!
+         * \brief               Splits `x` into integral and fractional parts.
+         *
+         * \tparam T            The type of parameter `x`.
+         *
+         * \param x             A floating-point number.
+         * \param integral_out  Where to store `tue::math::trunc()` of `x`.
+         *
+         * \return              The fractional part of `x`, which has the same
+         *                      sign as `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_floating_point_simd_component<T>::value, T>
+        modf(T x, T& integral_out) noexcept
+        {
+            return std::modf(x, &integral_out);
+        }
+
         /*!
          * \brief     Determines the minimum numeric value of the arguments.
          *
@@ -258,6 +548,121 @@ namespace tue
             return std::max(x, y);
         }
 
+        /*!
+         * \brief     Computes the sum of the arguments, clamped to the range
+         *            of `T` instead of wrapping around.
+         *
+         * \tparam T  The type of parameters `x` and `y`.
+         *
+         * \param x   An integer.
+         * \param y   Another integer.
+         *
+         * \return    `x + y` clamped to the range of `T`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_integral_simd_component<T>::value, T>
+        adds(T x, T y) noexcept
+        {
+            constexpr T lowest = std::numeric_limits<T>::lowest();
+            constexpr T highest = std::numeric_limits<T>::max();
+            if (y > 0 && x > highest - y) return highest;
+            if (y < 0 && x < lowest - y) return lowest;
+            return static_cast<T>(x + y);
+        }
+
+        /*!
+         * \brief     Computes the difference of the arguments, clamped to the
+         *            range of `T` instead of wrapping around.
+         *
+         * \tparam T  The type of parameters `x` and `y`.
+         *
+         * \param x   An integer.
+         * \param y   Another integer.
+         *
+         * \return    `x - y` clamped to the range of `T`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_integral_simd_component<T>::value, T>
+        subs(T x, T y) noexcept
+        {
+            constexpr T lowest = std::numeric_limits<T>::lowest();
+            constexpr T highest = std::numeric_limits<T>::max();
+            if (y > 0 && x < lowest + y) return lowest;
+            if (y < 0 && x > highest + y) return highest;
+            return static_cast<T>(x - y);
+        }
+
+        /*!
+         * \brief     Computes the average of the arguments, rounding halves
+         *            up, without overflowing.
+         *
+         * \tparam T  The type of parameters `x` and `y`.
+         *
+         * \param x   An integer.
+         * \param y   Another integer.
+         *
+         * \return    `(x + y + 1) / 2` rounded down, computed as if `T` had
+         *            unlimited range.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_integral_simd_component<T>::value, T>
+        avg(T x, T y) noexcept
+        {
+            return static_cast<T>((x | y) - ((x ^ y) >> 1));
+        }
+
+        /*!
+         * \brief     Computes the sum of the components of `x`.
+         * \details   For a scalar, this is just `x`. It exists so generic code
+         *            can reduce both scalars and `simd` types.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A number.
+         *
+         * \return    `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_arithmetic_simd_component<T>::value, T>
+        reduce_add(T x) noexcept
+        {
+            return x;
+        }
+
+        /*!
+         * \brief     Computes the minimum of the components of `x`.
+         * \details   For a scalar, this is just `x`.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A number.
+         *
+         * \return    `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_arithmetic_simd_component<T>::value, T>
+        reduce_min(T x) noexcept
+        {
+            return x;
+        }
+
+        /*!
+         * \brief     Computes the maximum of the components of `x`.
+         * \details   For a scalar, this is just `x`.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A number.
+         *
+         * \return    `x`.
+         */
+        template<typename T>
+        inline std::enable_if_t<is_arithmetic_simd_component<T>::value, T>
+        reduce_max(T x) noexcept
+        {
+            return x;
+        }
+
         /*!
          * \brief            Computes the bitwise AND of `condition` and
          *                   `value`.
@@ -440,6 +845,391 @@ namespace tue
             return lhs != rhs ? U(~0LL) : U(0LL);
         }
 
+        /*!
+         * \brief     Packs the truth value of each component of `x` into the
+         *            bits of an integer.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A sized boolean.
+         *
+         * \return    `1` if `x` is `trueX` and `0` otherwise (where `X` is the
+         *            number of bits in `T`).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_sized_bool<T>::value, std::uint64_t>
+        movemask(T x) noexcept
+        {
+            return x ? 1u : 0u;
+        }
+
+        /*!
+         * \brief     Determines whether or not any component of `x` is true.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A sized boolean.
+         *
+         * \return    Whether or not `x` is `trueX` (where `X` is the number of
+         *            bits in `T`).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_sized_bool<T>::value, bool>
+        any(T x) noexcept
+        {
+            return x != 0;
+        }
+
+        /*!
+         * \brief     Determines whether or not every component of `x` is true.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A sized boolean.
+         *
+         * \return    Whether or not `x` is `trueX` (where `X` is the number of
+         *            bits in `T`).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_sized_bool<T>::value, bool>
+        all(T x) noexcept
+        {
+            return x != 0;
+        }
+
+        /*!
+         * \brief     Determines whether or not no component of `x` is true.
+         *
+         * \tparam T  The type of parameter `x`.
+         *
+         * \param x   A sized boolean.
+         *
+         * \return    Whether or not `x` is `falseX` (where `X` is the number of
+         *            bits in `T`).
+         */
+        template<typename T>
+        inline std::enable_if_t<is_sized_bool<T>::value, bool>
+        none(T x) noexcept
+        {
+            return x == 0;
+        }
+
+        /*!
+         * \brief    Faster, less accurate versions of `sin()`, `cos()`,
+         *           `sincos()`, `exp()`, `log()`, `pow()`, `recip()` and
+         *           `rsqrt()`.
+         * \details  For `float` `simd` types, `recip()` and `rsqrt()` return
+         *           the 12-bit hardware estimate and the transcendentals use
+         *           short polynomials: `sin()`, `cos()` and `exp()` are within
+         *           about 100 ulp, `log()` about 250 and `pow()` about 600.
+         *           For `double` `simd` types the transcendentals are
+         *           accurate to about 1e-8 and `recip()` and `rsqrt()` match
+         *           the default tier, since there's no double precision
+         *           estimate to start from. Scalars always use the default
+         *           tier. `tests/accuracy.tests.cpp` measures the maximum
+         *           error of each tier.
+         */
+        namespace fast
+        {
+            /*!
+             * \brief     Computes `tue::math::sin()` of `x`.
+             *
+             * \tparam T  The type of parameter `x`.
+             *
+             * \param x   A floating-point number.
+             *
+             * \return    `tue::math::sin()` of `x`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            sin(T x) noexcept
+            {
+                return tue::math::sin(x);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::cos()` of `x`.
+             *
+             * \tparam T  The type of parameter `x`.
+             *
+             * \param x   A floating-point number.
+             *
+             * \return    `tue::math::cos()` of `x`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            cos(T x) noexcept
+            {
+                return tue::math::cos(x);
+            }
+
+            /*!
+             * \brief          Computes `tue::math::sincos()` of `x`.
+             *
+             * \tparam T       The type of parameter `x`.
+             *
+             * \param x        A floating-point number.
+             * \param sin_out  A reference to the value where the sine of `x`
+             *                 (measured in radians) will be stored.
+             * \param cos_out  A reference to the value where the cosine of `x`
+             *                 (measured in radians) will be stored.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value>
+            sincos(T x, T& sin_out, T& cos_out) noexcept
+            {
+                tue::math::sincos(x, sin_out, cos_out);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::exp()` of `x`.
+             *
+             * \tparam T  The type of parameter `x`.
+             *
+             * \param x   A floating-point number.
+             *
+             * \return    `tue::math::exp()` of `x`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            exp(T x) noexcept
+            {
+                return tue::math::exp(x);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::log()` of `x`.
+             *
+             * \tparam T  The type of parameter `x`.
+             *
+             * \param x   A floating-point number.
+             *
+             * \return    `tue::math::log()` of `x`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            log(T x) noexcept
+            {
+                return tue::math::log(x);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::pow()` of `x` and `y`.
+             *
+             * \tparam T  The type of parameters `x` and `y`.
+             *
+             * \param x   The base.
+             * \param y   The exponent.
+             *
+             * \return    `tue::math::pow()` of `x` and `y`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            pow(T x, T y) noexcept
+            {
+                return tue::math::pow(x, y);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::recip()` of `x`.
+             *
+             * \tparam T  The type of parameter `x`.
+             *
+             * \param x   A floating-point number.
+             *
+             * \return    `tue::math::recip()` of `x`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            recip(T x) noexcept
+            {
+                return tue::math::recip(x);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::rsqrt()` of `x`.
+             *
+             * \tparam T  The type of parameter `x`.
+             *
+             * \param x   A floating-point number.
+             *
+             * \return    `tue::math::rsqrt()` of `x`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            rsqrt(T x) noexcept
+            {
+                return tue::math::rsqrt(x);
+            }
+        }
+
+        /*!
+         * \brief    More accurate versions of `sin()`, `cos()`, `sincos()`,
+         *           `exp()`, `log()`, `pow()`, `recip()` and `rsqrt()`.
+         * \details  For `float` `simd` types, `recip()` divides, `rsqrt()`
+         *           divides by the square root (within 1.5 ulp) and the
+         *           transcendentals are computed in double precision, so
+         *           they're within 1 ulp. For `double` `simd` types they match
+         *           the default tier, except for `pow()`, which calls the C
+         *           library to stay within 1 ulp. Scalars always use the
+         *           default tier.
+         *
+         *           The default tier sits between the two: for `float` `simd`
+         *           types, `recip()` and `rsqrt()` refine the hardware
+         *           estimate with one Newton-Raphson step (within 3 ulp),
+         *           `pow()` is within about 50 ulp and the other
+         *           transcendentals are within 2 ulp.
+         */
+        namespace precise
+        {
+            /*!
+             * \brief     Computes `tue::math::sin()` of `x`.
+             *
+             * \tparam T  The type of parameter `x`.
+             *
+             * \param x   A floating-point number.
+             *
+             * \return    `tue::math::sin()` of `x`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            sin(T x) noexcept
+            {
+                return tue::math::sin(x);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::cos()` of `x`.
+             *
+             * \tparam T  The type of parameter `x`.
+             *
+             * \param x   A floating-point number.
+             *
+             * \return    `tue::math::cos()` of `x`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            cos(T x) noexcept
+            {
+                return tue::math::cos(x);
+            }
+
+            /*!
+             * \brief          Computes `tue::math::sincos()` of `x`.
+             *
+             * \tparam T       The type of parameter `x`.
+             *
+             * \param x        A floating-point number.
+             * \param sin_out  A reference to the value where the sine of `x`
+             *                 (measured in radians) will be stored.
+             * \param cos_out  A reference to the value where the cosine of `x`
+             *                 (measured in radians) will be stored.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value>
+            sincos(T x, T& sin_out, T& cos_out) noexcept
+            {
+                tue::math::sincos(x, sin_out, cos_out);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::exp()` of `x`.
+             *
+             * \tparam T  The type of parameter `x`.
+             *
+             * \param x   A floating-point number.
+             *
+             * \return    `tue::math::exp()` of `x`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            exp(T x) noexcept
+            {
+                return tue::math::exp(x);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::log()` of `x`.
+             *
+             * \tparam T  The type of parameter `x`.
+             *
+             * \param x   A floating-point number.
+             *
+             * \return    `tue::math::log()` of `x`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            log(T x) noexcept
+            {
+                return tue::math::log(x);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::pow()` of `x` and `y`.
+             *
+             * \tparam T  The type of parameters `x` and `y`.
+             *
+             * \param x   The base.
+             * \param y   The exponent.
+             *
+             * \return    `tue::math::pow()` of `x` and `y`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            pow(T x, T y) noexcept
+            {
+                return tue::math::pow(x, y);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::recip()` of `x`.
+             *
+             * \tparam T  The type of parameter `x`.
+             *
+             * \param x   A floating-point number.
+             *
+             * \return    `tue::math::recip()` of `x`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            recip(T x) noexcept
+            {
+                return tue::math::recip(x);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::rsqrt()` of `x`.
+             *
+             * \tparam T  The type of parameter `x`.
+             *
+             * \param x   A floating-point number.
+             *
+             * \return    `tue::math::rsqrt()` of `x`.
+             */
+            template<typename T>
+            inline std::enable_if_t<
+                is_floating_point_simd_component<T>::value, T>
+            rsqrt(T x) noexcept
+            {
+                return tue::math::rsqrt(x);
+            }
+        }
+
         /*/!@}*/
     }
 }
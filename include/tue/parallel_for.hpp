@@ -0,0 +1,431 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace tue
+{
+    /*!
+     * \defgroup  parallel_for_hpp <tue/parallel_for.hpp>
+     *
+     * \brief     A work-stealing `thread_pool` and `parallel_for()`, which
+     *            splits a range of indices into chunks across its threads.
+     * \details   Every thread has its own queue of subranges. A thread
+     *            working on a range bigger than the grain size splits it in
+     *            two, queues one half, and carries on with the other. Idle
+     *            threads steal the oldest, and so the biggest, subranges from
+     *            the front of other threads' queues. The thread calling
+     *            `parallel_for()` works through the range too.
+     *
+     * @{
+     */
+
+    class thread_pool;
+
+    /*!@}*/
+
+    /**/
+    namespace detail_
+    {
+        // One `parallel_for()` call. It lives on the calling thread's stack
+        // until `remaining` drops to zero, which happens after the last
+        // chunk's kernel returns and nothing touches the job any more.
+        struct parallel_job
+        {
+            void (*invoke)(
+                const void* kernel, std::size_t begin, std::size_t end);
+            const void* kernel;
+            std::size_t grain;
+            std::atomic<std::size_t> remaining;
+        };
+
+        struct parallel_task
+        {
+            parallel_job* job;
+            std::size_t begin;
+            std::size_t end;
+        };
+
+        // Padded to its own cache lines so that threads locking their own
+        // queues don't slow each other down.
+        struct parallel_queue
+        {
+            std::mutex mutex;
+            std::deque<parallel_task> tasks;
+            char padding[64];
+        };
+
+        // The pool and queue of the worker thread running on this thread,
+        // if any, so that nested calls queue their halves locally.
+        struct parallel_worker
+        {
+            const thread_pool* pool;
+            std::size_t queue;
+        };
+
+        inline parallel_worker& current_parallel_worker() noexcept
+        {
+            static thread_local parallel_worker worker = { nullptr, 0 };
+            return worker;
+        }
+
+        template<typename F>
+        inline void invoke_parallel_kernel(
+            const void* kernel, std::size_t begin, std::size_t end)
+        {
+            (*static_cast<const F*>(kernel))(begin, end);
+        }
+    }
+
+    /*!
+     * \addtogroup  parallel_for_hpp
+     * @{
+     */
+
+    /*!
+     * \brief    A fixed set of threads that run `parallel_for()` chunks.
+     * \details  A `thread_pool` with a concurrency of `n` starts `n - 1`
+     *           threads, since the thread calling `parallel_for()` also
+     *           works through the range. Several threads may call
+     *           `parallel_for()` on the same `thread_pool` at once, and
+     *           kernels may call it again.
+     */
+    class thread_pool
+    {
+        std::size_t concurrency_;
+
+        // One queue per worker thread, then one shared by every other
+        // thread that calls `parallel_for()`.
+        std::unique_ptr<tue::detail_::parallel_queue[]> queues_;
+
+        std::vector<std::thread> threads_;
+
+        std::atomic<std::size_t> queued_{ 0 };
+        std::atomic<std::size_t> sleeping_{ 0 };
+        std::mutex sleep_mutex_;
+        std::condition_variable wake_;
+        bool stopping_ = false;
+
+        std::size_t external_queue() const noexcept
+        {
+            return this->concurrency_ - 1;
+        }
+
+        void push(std::size_t queue, const tue::detail_::parallel_task& task)
+        {
+            {
+                auto& q = this->queues_[queue];
+                std::lock_guard<std::mutex> lock(q.mutex);
+                q.tasks.push_back(task);
+            }
+
+            // Sleeping workers recheck `queued_` under `sleep_mutex_`
+            // after announcing themselves in `sleeping_`, so either they
+            // see the new task or this sees them and wakes one.
+            this->queued_.fetch_add(1);
+            if (this->sleeping_.load() > 0)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(this->sleep_mutex_);
+                }
+                this->wake_.notify_one();
+            }
+        }
+
+        // Takes the newest task from `queue`, or failing that the oldest
+        // task from any other queue.
+        bool pop(std::size_t queue, tue::detail_::parallel_task& task)
+        {
+            if (this->queued_.load() == 0)
+            {
+                return false;
+            }
+
+            {
+                auto& q = this->queues_[queue];
+                std::lock_guard<std::mutex> lock(q.mutex);
+                if (!q.tasks.empty())
+                {
+                    task = q.tasks.back();
+                    q.tasks.pop_back();
+                    this->queued_.fetch_sub(1);
+                    return true;
+                }
+            }
+
+            for (std::size_t i = 1; i < this->concurrency_; ++i)
+            {
+                auto& q = this->queues_[(queue + i) % this->concurrency_];
+                std::lock_guard<std::mutex> lock(q.mutex);
+                if (!q.tasks.empty())
+                {
+                    task = q.tasks.front();
+                    q.tasks.pop_front();
+                    this->queued_.fetch_sub(1);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // Splits `task` down to the grain size, queueing the upper halves,
+        // and runs what's left.
+        void run(std::size_t queue, tue::detail_::parallel_task task)
+        {
+            const auto job = task.job;
+            const auto grain = job->grain;
+            while (task.end - task.begin > grain)
+            {
+                // Split at a multiple of the grain size so that chunks
+                // start on the same boundaries however they're divided.
+                auto middle = (task.begin + (task.end - task.begin) / 2)
+                    / grain * grain;
+                if (middle <= task.begin)
+                {
+                    middle = task.begin / grain * grain + grain;
+                }
+                this->push(queue, { job, middle, task.end });
+                task.end = middle;
+            }
+
+            job->invoke(job->kernel, task.begin, task.end);
+            job->remaining.fetch_sub(task.end - task.begin);
+        }
+
+        void work(std::size_t queue)
+        {
+            tue::detail_::current_parallel_worker() = { this, queue };
+            tue::detail_::parallel_task task;
+            for (;;)
+            {
+                if (this->pop(queue, task))
+                {
+                    this->run(queue, task);
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(this->sleep_mutex_);
+                this->sleeping_.fetch_add(1);
+                this->wake_.wait(lock, [this]
+                {
+                    return this->stopping_ || this->queued_.load() > 0;
+                });
+                this->sleeping_.fetch_sub(1);
+                if (this->stopping_)
+                {
+                    return;
+                }
+            }
+        }
+
+    public:
+        /*!
+         * \brief              Starts `concurrency - 1` worker threads.
+         *
+         * \param concurrency  The number of threads, including the caller,
+         *                     that work through each `parallel_for()`.
+         *                     Values less than `1` are treated as `1`.
+         */
+        explicit thread_pool(int concurrency)
+        :
+            concurrency_(concurrency > 1 ? std::size_t(concurrency) : 1),
+            queues_(new tue::detail_::parallel_queue[concurrency_])
+        {
+            this->threads_.reserve(this->concurrency_ - 1);
+            for (std::size_t i = 0; i + 1 < this->concurrency_; ++i)
+            {
+                this->threads_.emplace_back([this, i] { this->work(i); });
+            }
+        }
+
+        /*!
+         * \brief  Starts one worker thread per hardware thread, minus one
+         *         for the caller.
+         */
+        thread_pool()
+        :
+            thread_pool(int(std::thread::hardware_concurrency()))
+        {
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        /*!
+         * \brief    Stops and joins the worker threads.
+         * \details  No `parallel_for()` may still be running on this
+         *           `thread_pool`.
+         */
+        ~thread_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->sleep_mutex_);
+                this->stopping_ = true;
+            }
+            this->wake_.notify_all();
+            for (auto& t : this->threads_)
+            {
+                t.join();
+            }
+        }
+
+        /*!
+         * \brief   Returns the number of threads, including the caller,
+         *          that work through each `parallel_for()`.
+         *
+         * \return  The number of threads, including the caller, that work
+         *          through each `parallel_for()`.
+         */
+        std::size_t concurrency() const noexcept
+        {
+            return this->concurrency_;
+        }
+
+        /*!
+         * \brief         Calls `kernel(b, e)` for disjoint subranges
+         *                `[b, e)` that together cover `[begin, end)`, spread
+         *                across this `thread_pool`'s threads.
+         * \details       Returns once every call has returned. Every `b`
+         *                and `e` other than `begin` and `end` is a multiple
+         *                of `grain`, so a `grain` that's a multiple of the
+         *                `simd` width and of the number of elements per
+         *                cache line keeps chunks from sharing either. No
+         *                chunk is bigger than `grain`, except that
+         *                `[begin, end)` is run as one chunk if it's no
+         *                bigger than `grain` or the concurrency is `1`.
+         *                `kernel` must not throw.
+         *
+         * \tparam F      The kernel type.
+         *
+         * \param begin   The first index.
+         * \param end     One past the last index.
+         * \param grain   The chunk size. Values less than `1` are treated
+         *                as `1`.
+         * \param kernel  The function to call for each chunk.
+         */
+        template<typename F>
+        void parallel_for(
+            std::size_t begin,
+            std::size_t end,
+            std::size_t grain,
+            const F& kernel)
+        {
+            if (begin >= end)
+            {
+                return;
+            }
+
+            if (grain < 1)
+            {
+                grain = 1;
+            }
+
+            if (this->concurrency_ == 1 || end - begin <= grain)
+            {
+                kernel(begin, end);
+                return;
+            }
+
+            tue::detail_::parallel_job job;
+            job.invoke = &tue::detail_::invoke_parallel_kernel<F>;
+            job.kernel = &kernel;
+            job.grain = grain;
+            job.remaining.store(end - begin);
+
+            const auto& worker = tue::detail_::current_parallel_worker();
+            const auto queue = worker.pool == this
+                ? worker.queue
+                : this->external_queue();
+
+            // Help out, with this job or any other, until every chunk of
+            // this one has been run.
+            this->run(queue, { &job, begin, end });
+            tue::detail_::parallel_task task;
+            while (job.remaining.load() > 0)
+            {
+                if (this->pop(queue, task))
+                {
+                    this->run(queue, task);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    };
+
+    /*!
+     * \brief   Returns a `thread_pool` with one thread per hardware thread,
+     *          created the first time this is called.
+     *
+     * \return  The default `thread_pool`.
+     */
+    inline thread_pool& default_thread_pool()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+    /*!
+     * \brief         Calls `pool.parallel_for(begin, end, grain, kernel)`.
+     *
+     * \tparam F      The kernel type.
+     *
+     * \param pool    The `thread_pool` to run on.
+     * \param begin   The first index.
+     * \param end     One past the last index.
+     * \param grain   The chunk size.
+     * \param kernel  The function to call for each chunk.
+     */
+    template<typename F>
+    inline void parallel_for(
+        thread_pool& pool,
+        std::size_t begin,
+        std::size_t end,
+        std::size_t grain,
+        const F& kernel)
+    {
+        pool.parallel_for(begin, end, grain, kernel);
+    }
+
+    /*!
+     * \brief         Calls `kernel(b, e)` for disjoint subranges `[b, e)`
+     *                that together cover `[begin, end)` on the
+     *                `default_thread_pool()`.
+     *
+     * \tparam F      The kernel type.
+     *
+     * \param begin   The first index.
+     * \param end     One past the last index.
+     * \param grain   The chunk size.
+     * \param kernel  The function to call for each chunk.
+     */
+    template<typename F>
+    inline void parallel_for(
+        std::size_t begin,
+        std::size_t end,
+        std::size_t grain,
+        const F& kernel)
+    {
+        tue::default_thread_pool().parallel_for(begin, end, grain, kernel);
+    }
+
+    /*!@}*/
+}
@@ -494,11 +494,13 @@ namespace tue
     inline constexpr quat<decltype(std::declval<T>() * std::declval<U>())>
     operator*(const quat<T>& lhs, const quat<U>& rhs) noexcept
     {
+        const auto c = tue::math::cross(rhs.v(), lhs.v());
         return {
-            rhs.s()*lhs.v() + lhs.s()*rhs.v()
-                + tue::math::cross(rhs.v(), lhs.v()),
-            rhs.s()*lhs.s()
-                - tue::math::dot(rhs.v(), lhs.v()),
+            tue::detail_::madd(lhs[3], rhs[0], rhs[3]*lhs[0]) + c[0],
+            tue::detail_::madd(lhs[3], rhs[1], rhs[3]*lhs[1]) + c[1],
+            tue::detail_::madd(lhs[3], rhs[2], rhs[3]*lhs[2]) + c[2],
+            tue::detail_::madd(
+                rhs[3], lhs[3], -tue::math::dot(rhs.v(), lhs.v())),
         };
     }
 
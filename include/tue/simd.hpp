@@ -11,10 +11,14 @@
 static_assert(sizeof(float) == 4, "float is not 32-bits wide");
 static_assert(sizeof(double) == 8, "double is not 64-bits wide");
 
+#include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <type_traits>
+#include <utility>
 
 #include "sized_bool.hpp"
+#include "unused.hpp"
 
 namespace tue
 {
@@ -156,6 +160,28 @@ namespace tue
      *            `float32x4` | `__m128`
      *            `float64x2` | `__m128d`
      *
+     *            <b>AVX</b>
+     *            `simd` Type | SIMD Intrinsic
+     *            ----------- | --------------
+     *            `bool32x8`  | `__m256i` and `__m256`
+     *            `bool64x4`  | `__m256i` and `__m256d`
+     *            `float32x8` | `__m256`
+     *            `float64x4` | `__m256d`
+     *
+     *            <b>AVX2</b>
+     *            `simd` Type | SIMD Intrinsic
+     *            ----------- | --------------
+     *            `bool8x32`  | `__m256i`
+     *            `bool16x16` | `__m256i`
+     *            `int8x32`   | `__m256i`
+     *            `int16x16`  | `__m256i`
+     *            `int32x8`   | `__m256i`
+     *            `int64x4`   | `__m256i`
+     *            `uint8x32`  | `__m256i`
+     *            `uint16x16` | `__m256i`
+     *            `uint32x8`  | `__m256i`
+     *            `uint64x4`  | `__m256i`
+     *
      * \tparam T  The component type. `is_simd_component<T>::value` must be
      *            `true`.
      * \tparam N  The component count. Must be `2`, `4`, `8`, `16`, `32`, or
@@ -529,6 +555,301 @@ namespace tue
             return (sizeof(T) * N);
 #endif
         }
+
+        // The integral type with the given size and signedness.
+        template<std::size_t Size, bool Signed>
+        struct sized_integral;
+
+        template<>
+        struct sized_integral<1, true> { using type = std::int8_t; };
+
+        template<>
+        struct sized_integral<1, false> { using type = std::uint8_t; };
+
+        template<>
+        struct sized_integral<2, true> { using type = std::int16_t; };
+
+        template<>
+        struct sized_integral<2, false> { using type = std::uint16_t; };
+
+        template<>
+        struct sized_integral<4, true> { using type = std::int32_t; };
+
+        template<>
+        struct sized_integral<4, false> { using type = std::uint32_t; };
+
+        template<>
+        struct sized_integral<8, true> { using type = std::int64_t; };
+
+        template<>
+        struct sized_integral<8, false> { using type = std::uint64_t; };
+
+        template<std::size_t Size, bool Signed>
+        using sized_integral_t = typename sized_integral<Size, Signed>::type;
+
+        // The integral type twice as wide as `T` with the same signedness.
+        template<typename T>
+        using widened_t =
+            sized_integral_t<sizeof(T)*2, std::is_signed<T>::value>;
+
+        // Converts `x` to the narrower integral type `U`, clamping it to the
+        // range of `U` instead of truncating it.
+        template<typename U, typename T>
+        inline U saturate_cast(T x) noexcept
+        {
+            constexpr U lowest = std::numeric_limits<U>::lowest();
+            constexpr U highest = std::numeric_limits<U>::max();
+            if (std::is_signed<T>::value && x < static_cast<T>(lowest))
+            {
+                return lowest;
+            }
+            if (x > static_cast<T>(highest))
+            {
+                return highest;
+            }
+            return static_cast<U>(x);
+        }
+
+        // Whether `size` bytes starting at `data` lie within a single 4 KiB
+        // page. If they do, a full vector load can't fault as long as at
+        // least one of its components is part of the source array.
+        inline bool within_page(const void* data, std::size_t size) noexcept
+        {
+            return (reinterpret_cast<std::uintptr_t>(data) & 4095)
+                <= 4096 - size;
+        }
+
+        // Loads one component at a time through an aligned array, for the
+        // types that don't have a masked load instruction.
+        template<typename S, typename C>
+        inline S maskload_components(
+            const typename S::component_type* data,
+            const C& conditions) noexcept
+        {
+            using T = typename S::component_type;
+            using V = typename C::component_type;
+            constexpr int N = S::component_count;
+            alignas(C) V cdata[N];
+            conditions.store(cdata);
+            alignas(S) T sdata[N];
+            for (int i = 0; i < N; ++i)
+            {
+                sdata[i] = cdata[i] ? data[i] : static_cast<T>(0);
+            }
+            return S::load(sdata);
+        }
+
+        template<typename S, typename C>
+        inline void maskstore_components(
+            const S& s,
+            typename S::component_type* data,
+            const C& conditions) noexcept
+        {
+            using T = typename S::component_type;
+            using V = typename C::component_type;
+            constexpr int N = S::component_count;
+            alignas(C) V cdata[N];
+            conditions.store(cdata);
+            alignas(S) T sdata[N];
+            s.store(sdata);
+            for (int i = 0; i < N; ++i)
+            {
+                if (cdata[i])
+                {
+                    data[i] = sdata[i];
+                }
+            }
+        }
+
+        // Gathers one component at a time through aligned arrays, for the
+        // types that don't have a gather instruction.
+        template<typename S, typename I>
+        inline S gather_components(
+            const typename S::component_type* base, const I& indices) noexcept
+        {
+            using T = typename S::component_type;
+            using U = typename I::component_type;
+            constexpr int N = S::component_count;
+            alignas(I) U idata[N];
+            indices.store(idata);
+            alignas(S) T sdata[N];
+            for (int i = 0; i < N; ++i)
+            {
+                sdata[i] = base[idata[i]];
+            }
+            return S::load(sdata);
+        }
+
+        template<typename S, typename I, typename C>
+        inline S gather_components(
+            const typename S::component_type* base,
+            const I& indices,
+            const C& conditions) noexcept
+        {
+            using T = typename S::component_type;
+            using U = typename I::component_type;
+            using V = typename C::component_type;
+            constexpr int N = S::component_count;
+            alignas(I) U idata[N];
+            indices.store(idata);
+            alignas(C) V cdata[N];
+            conditions.store(cdata);
+            alignas(S) T sdata[N];
+            for (int i = 0; i < N; ++i)
+            {
+                sdata[i] = cdata[i] ? base[idata[i]] : static_cast<T>(0);
+            }
+            return S::load(sdata);
+        }
+
+        template<typename S, typename I>
+        inline void scatter_components(
+            const S& s,
+            typename S::component_type* base,
+            const I& indices) noexcept
+        {
+            using T = typename S::component_type;
+            using U = typename I::component_type;
+            constexpr int N = S::component_count;
+            alignas(I) U idata[N];
+            indices.store(idata);
+            alignas(S) T sdata[N];
+            s.store(sdata);
+            for (int i = 0; i < N; ++i)
+            {
+                base[idata[i]] = sdata[i];
+            }
+        }
+
+        template<typename S, typename I, typename C>
+        inline void scatter_components(
+            const S& s,
+            typename S::component_type* base,
+            const I& indices,
+            const C& conditions) noexcept
+        {
+            using T = typename S::component_type;
+            using U = typename I::component_type;
+            using V = typename C::component_type;
+            constexpr int N = S::component_count;
+            alignas(I) U idata[N];
+            indices.store(idata);
+            alignas(C) V cdata[N];
+            conditions.store(cdata);
+            alignas(S) T sdata[N];
+            s.store(sdata);
+            for (int i = 0; i < N; ++i)
+            {
+                if (cdata[i])
+                {
+                    base[idata[i]] = sdata[i];
+                }
+            }
+        }
+
+        template<int M>
+        inline constexpr bool are_lane_indices() noexcept
+        {
+            return true;
+        }
+
+        template<int M, int I, int... Is>
+        inline constexpr bool are_lane_indices() noexcept
+        {
+            return I >= 0 && I < M && are_lane_indices<M, Is...>();
+        }
+
+        template<int L, int... I>
+        inline constexpr std::integer_sequence<int, (I * 0 + L)...>
+        broadcast_indices(std::integer_sequence<int, I...>) noexcept
+        {
+            return {};
+        }
+
+        template<int K, int... I>
+        inline constexpr std::integer_sequence<int,
+            ((I + K % int(sizeof...(I)) + int(sizeof...(I)))
+                % int(sizeof...(I)))...>
+        rotate_indices(std::integer_sequence<int, I...>) noexcept
+        {
+            return {};
+        }
+
+        // The bitmask of the shuffle indices `I` that read a component from
+        // a different group of `W` components than the one they write to,
+        // e.g. across the two 128-bit halves of a 256-bit register.
+        template<int W, int... I>
+        inline constexpr int crossing_lanes() noexcept
+        {
+            const int indices[] = { I... };
+            int result = 0;
+            for (int j = 0; j < int(sizeof...(I)); ++j)
+            {
+                result |= int(indices[j] / W != j / W) << j;
+            }
+            return result;
+        }
+
+        // The bitmask of the two-source shuffle indices `I` that read from
+        // the second source.
+        template<int N, int... I>
+        inline constexpr int second_source_lanes() noexcept
+        {
+            const int indices[] = { I... };
+            int result = 0;
+            for (int j = 0; j < int(sizeof...(I)); ++j)
+            {
+                result |= int(indices[j] >= N) << j;
+            }
+            return result;
+        }
+
+        // Whether `simd<T, W>` is narrower than `N` components and has a
+        // specialization. `simd<T, W>` is only instantiated if it's narrower.
+        template<typename T, int W, int N, bool = (W < N)>
+        struct is_accelerated_chunk : std::false_type
+        {
+        };
+
+        template<typename T, int W, int N>
+        struct is_accelerated_chunk<T, W, N, true>
+        :
+            std::integral_constant<bool, simd<T, W>::is_accelerated>
+        {
+        };
+
+        // The component count of the pieces a `simd<T, N>` without its own
+        // specialization is made of: the widest specialized `simd<T, W>`
+        // that's narrower, or `2` if there is none. Wide composites hold
+        // `N/W` of them side by side rather than nesting halves, so every
+        // operation on them is a single level of calls into the
+        // specializations.
+        template<typename T, int N>
+        inline constexpr int simd_chunk_width() noexcept
+        {
+            return is_accelerated_chunk<T, 32/sizeof(T), N>::value
+                ? int(32/sizeof(T))
+                : is_accelerated_chunk<T, 16/sizeof(T), N>::value
+                    ? int(16/sizeof(T))
+                    : 2;
+        }
+
+        template<typename F, int... I>
+        inline void unroll_indices(
+            F& f, std::integer_sequence<int, I...>) noexcept
+        {
+            const int expand[] = { (f(I), 0)... };
+            tue::unused(expand);
+        }
+
+        // Calls `f(0)`, `f(1)`, ..., `f(Count-1)` in order without a loop,
+        // so that each call sees its index as a constant once inlined.
+        template<int Count, typename F>
+        inline void unroll(F&& f) noexcept
+        {
+            tue::detail_::unroll_indices(
+                f, std::make_integer_sequence<int, Count>());
+        }
     }
 }
 
@@ -543,10 +864,12 @@ namespace tue
     template<typename T, int N>
     class alignas(tue::detail_::alignof_simd<T, N>()) simd
     {
+        static constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+
         std::enable_if_t<
             is_simd_component<T>::value
                 && (N == 4 || N == 8 || N == 16 || N == 32 || N == 64),
-            simd<T, N/2>[2]>
+            simd<T, W>[N/W]>
         impl_;
 
     public:
@@ -581,9 +904,11 @@ namespace tue
          */
         explicit simd(T x) noexcept
         {
-            const auto y = simd<T, N/2>(x);
-            this->impl_[0] = y;
-            this->impl_[1] = y;
+            const auto y = simd<T, W>(x);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                this->impl_[i] = y;
+            });
         }
 
         /*!
@@ -597,8 +922,8 @@ namespace tue
         template<int M = N, typename = std::enable_if_t<M == 2>>
         simd(T x, T y) noexcept
         {
-            this->impl_[0] = simd<T, 1>(x);
-            this->impl_[1] = simd<T, 1>(y);
+            const T components[] = { x, y };
+            *this = simd<T, N>::loadu(components);
         }
 
         /*!
@@ -614,8 +939,8 @@ namespace tue
         template<int M = N, typename = std::enable_if_t<M == 4>>
         simd(T x, T y, T z, T w) noexcept
         {
-            this->impl_[0] = simd<T, 2>(x, y);
-            this->impl_[1] = simd<T, 2>(z, w);
+            const T components[] = { x, y, z, w };
+            *this = simd<T, N>::loadu(components);
         }
 
         /*!
@@ -635,8 +960,8 @@ namespace tue
         template<int M = N, typename = std::enable_if_t<M == 8>>
         simd(T s0, T s1, T s2, T s3, T s4, T s5, T s6, T s7) noexcept
         {
-            this->impl_[0] = simd<T, 4>(s0, s1, s2, s3);
-            this->impl_[1] = simd<T, 4>(s4, s5, s6, s7);
+            const T components[] = { s0, s1, s2, s3, s4, s5, s6, s7 };
+            *this = simd<T, N>::loadu(components);
         }
 
         /*!
@@ -666,8 +991,11 @@ namespace tue
             T s0, T s1, T  s2, T  s3, T  s4, T  s5, T  s6, T  s7,
             T s8, T s9, T s10, T s11, T s12, T s13, T s14, T s15) noexcept
         {
-            this->impl_[0] = simd<T, 8>(s0, s1,  s2,  s3,  s4,  s5,  s6,  s7);
-            this->impl_[1] = simd<T, 8>(s8, s9, s10, s11, s12, s13, s14, s15);
+            const T components[] = {
+                s0, s1,  s2,  s3,  s4,  s5,  s6,  s7,
+                s8, s9, s10, s11, s12, s13, s14, s15,
+            };
+            *this = simd<T, N>::loadu(components);
         }
 
         /*!
@@ -680,9 +1008,11 @@ namespace tue
         template<typename U>
         explicit simd(const simd<U, N>& s) noexcept
         {
-            const auto simpl = reinterpret_cast<const simd<U, N/2>*>(&s);
-            this->impl_[0] = simd<T, N/2>(simpl[0]);
-            this->impl_[1] = simd<T, N/2>(simpl[1]);
+            const auto simpl = reinterpret_cast<const simd<U, W>*>(&s);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                this->impl_[i] = simd<T, W>(simpl[i]);
+            });
         }
 
         /*!
@@ -693,8 +1023,10 @@ namespace tue
         static simd<T, N> zero() noexcept
         {
             simd<T, N> s;
-            s.impl_[0] = simd<T, N/2>::zero();
-            s.impl_[1] = simd<T, N/2>::zero();
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                s.impl_[i] = simd<T, W>::zero();
+            });
             return s;
         }
 
@@ -713,8 +1045,10 @@ namespace tue
         static simd<T, N> load(const T* data) noexcept
         {
             simd<T, N> s;
-            s.impl_[0] = simd<T, N/2>::load(data);
-            s.impl_[1] = simd<T, N/2>::load(data + N/2);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                s.impl_[i] = simd<T, W>::load(data + i*W);
+            });
             return s;
         }
 
@@ -731,8 +1065,139 @@ namespace tue
         static simd<T, N> loadu(const T* data) noexcept
         {
             simd<T, N> s;
-            s.impl_[0] = simd<T, N/2>::loadu(data);
-            s.impl_[1] = simd<T, N/2>::loadu(data + N/2);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                s.impl_[i] = simd<T, W>::loadu(data + i*W);
+            });
+            return s;
+        }
+
+        /*!
+         * \brief          Loads the components of `base` at the given indices
+         *                 into a new `simd`.
+         * \details        Component `i` of the new `simd` is
+         *                 `base[indices[i]]`. If the source array is null or
+         *                 any index is out of its range, behavior is
+         *                 undefined.
+         *
+         * \tparam I       The component type of `indices`. Must be
+         *                 `std::int32_t`.
+         *
+         * \param base     The source component array.
+         * \param indices  The index into `base` of each component.
+         *
+         * \return         The new `simd`.
+         */
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        static simd<T, N> gather(
+            const T* base, const simd<I, N>& indices) noexcept
+        {
+            const auto iimpl = reinterpret_cast<const simd<I, W>*>(&indices);
+            simd<T, N> s;
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                s.impl_[i] = simd<T, W>::gather(base, iimpl[i]);
+            });
+            return s;
+        }
+
+        /*!
+         * \brief             Loads the components of `base` at the given
+         *                    indices into a new `simd` wherever `conditions`
+         *                    is `true`.
+         * \details           Component `i` of the new `simd` is
+         *                    `base[indices[i]]` if `conditions[i]` is `true`
+         *                    and `0` otherwise. Only the components whose
+         *                    condition is `true` are read. If the source array
+         *                    is null or any of those indices is out of its
+         *                    range, behavior is undefined.
+         *
+         * \tparam I          The component type of `indices`. Must be
+         *                    `std::int32_t`.
+         *
+         * \param base        The source component array.
+         * \param indices     The index into `base` of each component.
+         * \param conditions  Which components to load.
+         *
+         * \return            The new `simd`.
+         */
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        static simd<T, N> gather(
+            const T* base,
+            const simd<I, N>& indices,
+            const simd<sized_bool_t<sizeof(T)>, N>& conditions) noexcept
+        {
+            using U = sized_bool_t<sizeof(T)>;
+            const auto iimpl = reinterpret_cast<const simd<I, W>*>(&indices);
+            const auto cimpl =
+                reinterpret_cast<const simd<U, W>*>(&conditions);
+            simd<T, N> s;
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                s.impl_[i] = simd<T, W>::gather(base, iimpl[i], cimpl[i]);
+            });
+            return s;
+        }
+
+        /*!
+         * \brief        Loads the first `count` components of the given
+         *               unaligned component array into a new `simd`.
+         * \details      The remaining components of the new `simd` are `0`
+         *               and nothing past the first `count` components of the
+         *               source array is read, so the last few components of
+         *               an array can be loaded without padding it. If
+         *               `count` is positive and the source array is null or
+         *               doesn't contain that many components, behavior is
+         *               undefined.
+         *
+         * \param data   The source component array.
+         * \param count  The number of components to load, from `0` to `N`.
+         *
+         * \return       The new `simd`.
+         */
+        static simd<T, N> load_partial(const T* data, int count) noexcept
+        {
+            simd<T, N> s;
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                s.impl_[i] = count > i*W
+                    ? simd<T, W>::load_partial(data + i*W, count - i*W)
+                    : simd<T, W>::zero();
+            });
+            return s;
+        }
+
+        /*!
+         * \brief             Loads the components of the given unaligned
+         *                    component array into a new `simd` wherever
+         *                    `conditions` is `true`.
+         * \details           Component `i` of the new `simd` is `data[i]` if
+         *                    `conditions[i]` is `true` and `0` otherwise. The
+         *                    components whose condition is `false` are never
+         *                    faulted on, so they may lie past the end of the
+         *                    source array.
+         *
+         * \param data        The source component array.
+         * \param conditions  Which components to load.
+         *
+         * \return            The new `simd`.
+         */
+        static simd<T, N> maskload(
+            const T* data,
+            const simd<sized_bool_t<sizeof(T)>, N>& conditions) noexcept
+        {
+            using U = sized_bool_t<sizeof(T)>;
+            const auto cimpl =
+                reinterpret_cast<const simd<U, W>*>(&conditions);
+            simd<T, N> s;
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                s.impl_[i] = simd<T, W>::maskload(data + i*W, cimpl[i]);
+            });
             return s;
         }
 
@@ -749,8 +1214,10 @@ namespace tue
          */
         void store(T* data) const noexcept
         {
-            this->impl_[0].store(data);
-            this->impl_[1].store(data + N/2);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                this->impl_[i].store(data + i*W);
+            });
         }
 
         /*!
@@ -763,8 +1230,143 @@ namespace tue
          */
         void storeu(T* data) const noexcept
         {
-            this->impl_[0].storeu(data);
-            this->impl_[1].storeu(data + N/2);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                this->impl_[i].storeu(data + i*W);
+            });
+        }
+
+        /*!
+         * \brief       Stores this `simd`'s underlying component array in
+         *              the given aligned component array without pulling the
+         *              destination into the cache.
+         * \details     Meant for large outputs that won't be read again
+         *              soon, so that writing them doesn't evict data that
+         *              will. The stores are weakly ordered; call
+         *              `tue::stream_fence()` before other threads read the
+         *              destination. The destination array must have the same
+         *              alignment as this `simd` type. If the destination
+         *              array is null, unaligned, or doesn't contain room for
+         *              all `N` components, behavior is undefined.
+         *
+         * \param data  The destination component array.
+         */
+        void stream(T* data) const noexcept
+        {
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                this->impl_[i].stream(data + i*W);
+            });
+        }
+
+        /*!
+         * \brief          Stores this `simd`'s components in `base` at the
+         *                 given indices.
+         * \details        Component `i` is stored in `base[indices[i]]`. If
+         *                 two indices are the same, the component with the
+         *                 higher index wins. If the destination array is null
+         *                 or any index is out of its range, behavior is
+         *                 undefined.
+         *
+         * \tparam I       The component type of `indices`. Must be
+         *                 `std::int32_t`.
+         *
+         * \param base     The destination component array.
+         * \param indices  The index into `base` of each component.
+         */
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        void scatter(T* base, const simd<I, N>& indices) const noexcept
+        {
+            const auto iimpl = reinterpret_cast<const simd<I, W>*>(&indices);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                this->impl_[i].scatter(base, iimpl[i]);
+            });
+        }
+
+        /*!
+         * \brief             Stores this `simd`'s components in `base` at the
+         *                    given indices wherever `conditions` is `true`.
+         * \details           Component `i` is stored in `base[indices[i]]` if
+         *                    `conditions[i]` is `true`. If two of those indices
+         *                    are the same, the component with the higher index
+         *                    wins. If the destination array is null or any of
+         *                    those indices is out of its range, behavior is
+         *                    undefined.
+         *
+         * \tparam I          The component type of `indices`. Must be
+         *                    `std::int32_t`.
+         *
+         * \param base        The destination component array.
+         * \param indices     The index into `base` of each component.
+         * \param conditions  Which components to store.
+         */
+        template<
+            typename I,
+            typename = std::enable_if_t<std::is_same<I, std::int32_t>::value>>
+        void scatter(
+            T* base,
+            const simd<I, N>& indices,
+            const simd<sized_bool_t<sizeof(T)>, N>& conditions) const noexcept
+        {
+            using U = sized_bool_t<sizeof(T)>;
+            const auto iimpl = reinterpret_cast<const simd<I, W>*>(&indices);
+            const auto cimpl =
+                reinterpret_cast<const simd<U, W>*>(&conditions);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                this->impl_[i].scatter(base, iimpl[i], cimpl[i]);
+            });
+        }
+
+        /*!
+         * \brief        Stores the first `count` of this `simd`'s components
+         *               in the given unaligned component array.
+         * \details      Nothing past the first `count` components of the
+         *               destination array is written. If `count` is positive
+         *               and the destination array is null or doesn't contain
+         *               room for that many components, behavior is
+         *               undefined.
+         *
+         * \param data   The destination component array.
+         * \param count  The number of components to store, from `0` to `N`.
+         */
+        void store_partial(T* data, int count) const noexcept
+        {
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                if (count > i*W)
+                {
+                    this->impl_[i].store_partial(data + i*W, count - i*W);
+                }
+            });
+        }
+
+        /*!
+         * \brief             Stores this `simd`'s components in the given
+         *                    unaligned component array wherever `conditions`
+         *                    is `true`.
+         * \details           Component `i` is stored in `data[i]` if
+         *                    `conditions[i]` is `true`. The components whose
+         *                    condition is `false` are left untouched, so they
+         *                    may lie past the end of the destination array.
+         *
+         * \param data        The destination component array.
+         * \param conditions  Which components to store.
+         */
+        void maskstore(
+            T* data,
+            const simd<sized_bool_t<sizeof(T)>, N>& conditions) const noexcept
+        {
+            using U = sized_bool_t<sizeof(T)>;
+            const auto cimpl =
+                reinterpret_cast<const simd<U, W>*>(&conditions);
+            tue::detail_::unroll<N/W>([&](int i)
+            {
+                this->impl_[i].maskstore(data + i*W, cimpl[i]);
+            });
         }
 
         /*!
@@ -793,9 +1395,12 @@ namespace tue
     /*!@}*/
 }
 
-#include "detail_/simdN.hpp"
 #include "detail_/simd_support.hpp"
+#ifdef TUE_VECTOR_EXT
+#include "detail_/simd_vector_ext.hpp"
+#endif
 #include "detail_/simd_specializations.hpp"
+#include "detail_/simdN.hpp"
 
 namespace tue
 {
@@ -1116,6 +1721,46 @@ namespace tue
         return tue::detail_::bitwise_shift_right_operator_si(lhs, rhs);
     }
 
+    /*!
+     * \brief      Computes the bitwise shifts left of each component of `lhs`
+     *             by each corresponding component of `rhs`.
+     *
+     * \tparam T   The component type of both `lhs` and `rhs`.
+     * \tparam N   The component count of both `lhs` and `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     The bitwise shifts left of each component of `lhs` by each
+     *             corresponding component of `rhs`.
+     */
+    template<typename T, int N>
+    inline simd<T, N> operator<<(
+        const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+    {
+        return tue::detail_::bitwise_shift_left_operator_ss(lhs, rhs);
+    }
+
+    /*!
+     * \brief      Computes the bitwise shifts right of each component of `lhs`
+     *             by each corresponding component of `rhs`.
+     *
+     * \tparam T   The component type of both `lhs` and `rhs`.
+     * \tparam N   The component count of both `lhs` and `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     The bitwise shifts right of each component of `lhs` by each
+     *             corresponding component of `rhs`.
+     */
+    template<typename T, int N>
+    inline simd<T, N> operator>>(
+        const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+    {
+        return tue::detail_::bitwise_shift_right_operator_ss(lhs, rhs);
+    }
+
     /*!
      * \brief      Adds each component of `rhs` to each corresponding component
      *             of `lhs`.
@@ -1306,6 +1951,46 @@ namespace tue
             lhs, rhs);
     }
 
+    /*!
+     * \brief      Bitwise shifts left each component of `lhs` by each
+     *             corresponding component of `rhs`.
+     *
+     * \tparam T   The component type of both `lhs` and `rhs`.
+     * \tparam N   The component count of both `lhs` and `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     A reference to `lhs`.
+     */
+    template<typename T, int N>
+    inline simd<T, N>& operator<<=(
+        simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+    {
+        return tue::detail_::bitwise_shift_left_assignment_operator_ss(
+            lhs, rhs);
+    }
+
+    /*!
+     * \brief      Bitwise shifts right each component of `lhs` by each
+     *             corresponding component of `rhs`.
+     *
+     * \tparam T   The component type of both `lhs` and `rhs`.
+     * \tparam N   The component count of both `lhs` and `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     A reference to `lhs`.
+     */
+    template<typename T, int N>
+    inline simd<T, N>& operator>>=(
+        simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+    {
+        return tue::detail_::bitwise_shift_right_assignment_operator_ss(
+            lhs, rhs);
+    }
+
     /*!
      * \brief      Determines whether or not two `simd`'s compare equal.
      *
@@ -1344,42 +2029,412 @@ namespace tue
         return tue::detail_::inequality_operator_ss(lhs, rhs);
     }
 
-    /*!@}*/
-    namespace math
+    /*!
+     * \brief     Rearranges the components of `s`.
+     * \details   Component `i` of the result is component `I[i]` of `s`.
+     *            The indices are checked at compile time.
+     *
+     * \tparam I  The index of the component of `s` to place in each
+     *            component of the result. There must be exactly `N`.
+     * \tparam T  The component type of `s`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   An `simd`.
+     *
+     * \return    The components of `s` in the order given by `I`.
+     */
+    template<int... I, typename T, int N>
+    inline simd<T, N> shuffle(const simd<T, N>& s) noexcept
     {
-        /*!
-         * \addtogroup  simd_hpp
-         * @{
-         */
+        static_assert(sizeof...(I) == N,
+            "shuffle needs exactly one index per component");
+        static_assert(tue::detail_::are_lane_indices<N, I...>(),
+            "shuffle index out of range");
+        return tue::detail_::shuffle_s(
+            s, std::integer_sequence<int, I...>());
+    }
 
-        /*!
-         * \brief     Computes `tue::math::sin()` for each component of `s`.
-         * \details   The results may not match `tue::math::sin()` exactly, but
-         *            will at least approximate the same values.
-         *
-         * \tparam T  The component type of `s`.
-         * \tparam N  The component count of `s`.
-         *
-         * \param s   An `simd`.
-         *
-         * \return    `tue::math::sin()` for each component of `s`.
-         */
-        template<typename T, int N>
-        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
-        sin(const simd<T, N>& s) noexcept
-        {
-            return tue::detail_::sin_s(s);
-        }
+    /*!
+     * \brief      Picks components from two `simd`'s.
+     * \details    Indices `0` through `N-1` pick components of `lhs` and
+     *             indices `N` through `2N-1` pick components of `rhs`.
+     *
+     * \tparam I   The index of the component to place in each component of
+     *             the result. There must be exactly `N`.
+     * \tparam T   The component type of both `lhs` and `rhs`.
+     * \tparam N   The component count of both `lhs` and `rhs`.
+     *
+     * \param lhs  The first source.
+     * \param rhs  The second source.
+     *
+     * \return     The components of `lhs` and `rhs` picked by `I`.
+     */
+    template<int... I, typename T, int N>
+    inline simd<T, N> shuffle(
+        const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+    {
+        static_assert(sizeof...(I) == N,
+            "shuffle needs exactly one index per component");
+        static_assert(tue::detail_::are_lane_indices<2*N, I...>(),
+            "shuffle index out of range");
+        return tue::detail_::shuffle_ss(
+            lhs, rhs, std::integer_sequence<int, I...>());
+    }
 
-        /*!
-         * \brief     Computes `tue::math::cos()` for each component of `s`.
-         * \details   The results may not match `tue::math::cos()` exactly, but
-         *            will at least approximate the same values.
-         *
-         * \tparam T  The component type of `s`.
-         * \tparam N  The component count of `s`.
-         *
-         * \param s   An `simd`.
+    /*!
+     * \brief     Copies one component of `s` into every component.
+     *
+     * \tparam L  The index of the component to copy.
+     * \tparam T  The component type of `s`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   An `simd`.
+     *
+     * \return    An `simd` with every component set to component `L` of
+     *            `s`.
+     */
+    template<int L, typename T, int N>
+    inline simd<T, N> broadcast(const simd<T, N>& s) noexcept
+    {
+        static_assert(L >= 0 && L < N, "broadcast index out of range");
+        return tue::detail_::shuffle_s(
+            s, tue::detail_::broadcast_indices<L>(
+                std::make_integer_sequence<int, N>()));
+    }
+
+    /*!
+     * \brief     Rotates the components of `s`.
+     * \details   Component `i` of the result is component `(i + K) mod N` of
+     *            `s`, so positive `K` moves components toward index `0`.
+     *
+     * \tparam K  The number of components to rotate by. May be negative.
+     * \tparam T  The component type of `s`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   An `simd`.
+     *
+     * \return    The components of `s` rotated by `K`.
+     */
+    template<int K, typename T, int N>
+    inline simd<T, N> rotate(const simd<T, N>& s) noexcept
+    {
+        return tue::detail_::shuffle_s(
+            s, tue::detail_::rotate_indices<K>(
+                std::make_integer_sequence<int, N>()));
+    }
+
+    /*!
+     * \brief     Gets one component of `s`.
+     *
+     * \tparam I  The index of the component.
+     * \tparam T  The component type of `s`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   An `simd`.
+     *
+     * \return    Component `I` of `s`.
+     */
+    template<int I, typename T, int N>
+    inline T extract(const simd<T, N>& s) noexcept
+    {
+        static_assert(I >= 0 && I < N, "extract index out of range");
+        return tue::detail_::extract_s(s, std::integral_constant<int, I>());
+    }
+
+    /*!
+     * \brief     Replaces one component of `s`.
+     *
+     * \tparam I  The index of the component.
+     * \tparam T  The component type of `s`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   An `simd`.
+     * \param x   The new value of component `I`.
+     *
+     * \return    A copy of `s` with component `I` set to `x`.
+     */
+    template<int I, typename T, int N>
+    inline simd<T, N> insert(
+        const simd<T, N>& s,
+        typename simd<T, N>::component_type x) noexcept
+    {
+        static_assert(I >= 0 && I < N, "insert index out of range");
+        return tue::detail_::insert_s(
+            s, x, std::integral_constant<int, I>());
+    }
+
+    /*!
+     * \brief      Interleaves the lower halves of two `simd`'s.
+     *
+     * \tparam T   The component type of both `lhs` and `rhs`.
+     * \tparam N   The component count of both `lhs` and `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `{ lhs[0], rhs[0], lhs[1], rhs[1], ..., lhs[N/2-1],
+     *             rhs[N/2-1] }`.
+     */
+    template<typename T, int N>
+    inline simd<T, N> interleave_lo(
+        const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+    {
+        return tue::detail_::interleave_lo_ss(lhs, rhs);
+    }
+
+    /*!
+     * \brief      Interleaves the upper halves of two `simd`'s.
+     *
+     * \tparam T   The component type of both `lhs` and `rhs`.
+     * \tparam N   The component count of both `lhs` and `rhs`.
+     *
+     * \param lhs  The left-hand side operand.
+     * \param rhs  The right-hand side operand.
+     *
+     * \return     `{ lhs[N/2], rhs[N/2], lhs[N/2+1], rhs[N/2+1], ...,
+     *             lhs[N-1], rhs[N-1] }`.
+     */
+    template<typename T, int N>
+    inline simd<T, N> interleave_hi(
+        const simd<T, N>& lhs, const simd<T, N>& rhs) noexcept
+    {
+        return tue::detail_::interleave_hi_ss(lhs, rhs);
+    }
+
+    /*!
+     * \brief     Converts each component of `s` to the nearest
+     *            `std::int32_t`.
+     * \details   Halfway cases are rounded to even. If a component isn't
+     *            representable as an `std::int32_t`, or is NaN, the result
+     *            is `std::numeric_limits<std::int32_t>::min()`.
+     *
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   An `simd`.
+     *
+     * \return    Each component of `s` rounded to the nearest integer.
+     */
+    template<int N>
+    inline simd<std::int32_t, N> round_to_int32(
+        const simd<float, N>& s) noexcept
+    {
+        return tue::detail_::round_to_int32_s(s);
+    }
+
+    /*!
+     * \brief     Converts each component of `s` to an `std::int32_t`,
+     *            rounding toward zero.
+     * \details   If a component isn't representable as an `std::int32_t`,
+     *            or is NaN, the result is
+     *            `std::numeric_limits<std::int32_t>::min()`.
+     *
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   An `simd`.
+     *
+     * \return    Each component of `s` with its fractional part discarded.
+     */
+    template<int N>
+    inline simd<std::int32_t, N> trunc_to_int32(
+        const simd<float, N>& s) noexcept
+    {
+        return tue::detail_::trunc_to_int32_s(s);
+    }
+
+    /*!
+     * \brief      Narrows the components of two `simd`'s to the signed
+     *             integral type half as wide, saturating values that don't
+     *             fit.
+     * \details    Packing to `std::uint8_t` from `std::int32_t` can be done
+     *             in two steps, through `std::int16_t`, since saturating
+     *             twice gives the same result as saturating once.
+     *
+     * \tparam T   The component type of both `lo` and `hi`.
+     * \tparam N   The component count of both `lo` and `hi`.
+     *
+     * \param lo   The components of the lower half of the result.
+     * \param hi   The components of the upper half of the result.
+     *
+     * \return     `{ lo[0], ..., lo[N-1], hi[0], ..., hi[N-1] }`, each
+     *             clamped to the range of the narrower type.
+     */
+    template<typename T, int N>
+    inline std::enable_if_t<
+        std::is_integral<T>::value && (sizeof(T) > 1),
+        simd<tue::detail_::sized_integral_t<sizeof(T)/2, true>, N*2>>
+    packs(const simd<T, N>& lo, const simd<T, N>& hi) noexcept
+    {
+        return tue::detail_::packs_ss(lo, hi);
+    }
+
+    /*!
+     * \brief      Narrows the components of two `simd`'s to the unsigned
+     *             integral type half as wide, saturating values that don't
+     *             fit.
+     *
+     * \tparam T   The component type of both `lo` and `hi`.
+     * \tparam N   The component count of both `lo` and `hi`.
+     *
+     * \param lo   The components of the lower half of the result.
+     * \param hi   The components of the upper half of the result.
+     *
+     * \return     `{ lo[0], ..., lo[N-1], hi[0], ..., hi[N-1] }`, each
+     *             clamped to the range of the narrower type.
+     */
+    template<typename T, int N>
+    inline std::enable_if_t<
+        std::is_integral<T>::value && (sizeof(T) > 1),
+        simd<tue::detail_::sized_integral_t<sizeof(T)/2, false>, N*2>>
+    packus(const simd<T, N>& lo, const simd<T, N>& hi) noexcept
+    {
+        return tue::detail_::packus_ss(lo, hi);
+    }
+
+    /*!
+     * \brief     Widens the lower half of the components of `s` to the
+     *            integral type twice as wide.
+     * \details   Signed components are sign-extended and unsigned components
+     *            are zero-extended, so every value is preserved. Widening
+     *            `std::uint8_t` to `std::int32_t` can be done by widening
+     *            twice and casting, since zero-extended values fit.
+     *
+     * \tparam T  The component type of `s`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   An `simd`.
+     *
+     * \return    `{ s[0], ..., s[N/2-1] }` in the wider type.
+     */
+    template<typename T, int N>
+    inline std::enable_if_t<
+        std::is_integral<T>::value && (sizeof(T) < 8) && (N >= 4),
+        simd<tue::detail_::widened_t<T>, N/2>>
+    widen_lo(const simd<T, N>& s) noexcept
+    {
+        return tue::detail_::widen_lo_s(s);
+    }
+
+    /*!
+     * \brief     Widens the upper half of the components of `s` to the
+     *            integral type twice as wide.
+     * \details   Signed components are sign-extended and unsigned components
+     *            are zero-extended, so every value is preserved.
+     *
+     * \tparam T  The component type of `s`.
+     * \tparam N  The component count of `s`.
+     *
+     * \param s   An `simd`.
+     *
+     * \return    `{ s[N/2], ..., s[N-1] }` in the wider type.
+     */
+    template<typename T, int N>
+    inline std::enable_if_t<
+        std::is_integral<T>::value && (sizeof(T) < 8) && (N >= 4),
+        simd<tue::detail_::widened_t<T>, N/2>>
+    widen_hi(const simd<T, N>& s) noexcept
+    {
+        return tue::detail_::widen_hi_s(s);
+    }
+
+    /*!
+     * \brief    Orders all preceding `simd::stream()` stores before any
+     *           following stores.
+     * \details  Call this after streaming an output and before handing it
+     *           to another thread.
+     */
+    inline void stream_fence() noexcept
+    {
+#ifdef TUE_SSE
+        _mm_sfence();
+#endif
+    }
+
+    /*!
+     * \brief  The cache locality hints for `tue::prefetch()`.
+     */
+    enum class prefetch_hint
+    {
+        /*! Prefetch into all levels of the cache. */
+        t0,
+
+        /*! Prefetch into the second level of the cache and above. */
+        t1,
+
+        /*! Prefetch into the third level of the cache and above. */
+        t2,
+
+        /*! Prefetch close to the processor while minimizing pollution. */
+        nta,
+    };
+
+    /*!
+     * \brief          Hints to the processor that the cache line containing
+     *                 `address` will be read soon.
+     * \details        This never faults, even if `address` is invalid.
+     *
+     * \tparam H       The cache locality hint.
+     *
+     * \param address  The address to prefetch.
+     */
+    template<prefetch_hint H = prefetch_hint::t0>
+    inline void prefetch(const void* address) noexcept
+    {
+#ifdef TUE_SSE
+        _mm_prefetch(
+            static_cast<const char*>(address),
+            H == prefetch_hint::t0 ? _MM_HINT_T0
+                : H == prefetch_hint::t1 ? _MM_HINT_T1
+                : H == prefetch_hint::t2 ? _MM_HINT_T2
+                : _MM_HINT_NTA);
+#else
+#ifdef __GNUC__
+        __builtin_prefetch(address, 0,
+            H == prefetch_hint::t0 ? 3
+                : H == prefetch_hint::t1 ? 2
+                : H == prefetch_hint::t2 ? 1
+                : 0);
+#else
+        tue::unused(address);
+#endif
+#endif
+    }
+
+    /*!@}*/
+    namespace math
+    {
+        /*!
+         * \addtogroup  simd_hpp
+         * @{
+         */
+
+        /*!
+         * \brief     Computes `tue::math::sin()` for each component of `s`.
+         * \details   The results may not match `tue::math::sin()` exactly, but
+         *            will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::sin()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        sin(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::sin_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::cos()` for each component of `s`.
+         * \details   The results may not match `tue::math::cos()` exactly, but
+         *            will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
          *
          * \return    `tue::math::cos()` for each component of `s`.
          */
@@ -1413,12 +2468,168 @@ namespace tue
             simd<T, N>& sin_out,
             simd<T, N>& cos_out) noexcept
         {
-            tue::detail_::sincos_s(s, sin_out, cos_out);
+            tue::detail_::sincos_s(s, sin_out, cos_out);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::tan()` for each component of `s`.
+         * \details   The results may not match `tue::math::tan()` exactly, but
+         *            will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::tan()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        tan(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::tan_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::asin()` for each component of `s`.
+         * \details   The results may not match `tue::math::asin()` exactly, but
+         *            will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::asin()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        asin(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::asin_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::acos()` for each component of `s`.
+         * \details   The results may not match `tue::math::acos()` exactly, but
+         *            will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::acos()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        acos(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::acos_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::atan()` for each component of `s`.
+         * \details   The results may not match `tue::math::atan()` exactly, but
+         *            will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::atan()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        atan(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::atan_s(s);
+        }
+
+        /*!
+         * \brief            Computes `tue::math::atan2()` for each component of
+         *                   `y` and each corresponding component of `x`.
+         * \details          The results may not match `tue::math::atan2()`
+         *                   exactly, but will at least approximate the same
+         *                   values.
+         *
+         * \tparam T         The component type of both `y` and `x`.
+         * \tparam N         The component count of both `y` and `x`.
+         *
+         * \param y          The y-coordinates.
+         * \param x          The x-coordinates.
+         *
+         * \return           `tue::math::atan2()` for each component of `y`
+         *                   and each corresponding component of `x`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        atan2(const simd<T, N>& y, const simd<T, N>& x) noexcept
+        {
+            return tue::detail_::atan2_ss(y, x);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::exp()` for each component of `s`.
+         * \details   The results may not match `tue::math::exp()` exactly, but
+         *            will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::exp()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        exp(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::exp_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::exp2()` for each component of `s`.
+         * \details   The results may not match `tue::math::exp2()` exactly, but
+         *            will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::exp2()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        exp2(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::exp2_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::log()` for each component of `s`.
+         * \details   The results may not match `tue::math::log()` exactly, but
+         *            will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::log()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        log(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::log_s(s);
         }
 
         /*!
-         * \brief     Computes `tue::math::exp()` for each component of `s`.
-         * \details   The results may not match `tue::math::exp()` exactly, but
+         * \brief     Computes `tue::math::log2()` for each component of `s`.
+         * \details   The results may not match `tue::math::log2()` exactly, but
          *            will at least approximate the same values.
          *
          * \tparam T  The component type of `s`.
@@ -1426,32 +2637,32 @@ namespace tue
          *
          * \param s   An `simd`.
          *
-         * \return    `tue::math::exp()` for each component of `s`.
+         * \return    `tue::math::log2()` for each component of `s`.
          */
         template<typename T, int N>
         inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
-        exp(const simd<T, N>& s) noexcept
+        log2(const simd<T, N>& s) noexcept
         {
-            return tue::detail_::exp_s(s);
+            return tue::detail_::log2_s(s);
         }
 
         /*!
-         * \brief     Computes `tue::math::log()` for each component of `s`.
-         * \details   The results may not match `tue::math::log()` exactly, but
-         *            will at least approximate the same values.
+         * \brief     Computes `tue::math::log10()` for each component of `s`.
+         * \details   The results may not match `tue::math::log10()` exactly,
+         *            but will at least approximate the same values.
          *
          * \tparam T  The component type of `s`.
          * \tparam N  The component count of `s`.
          *
          * \param s   An `simd`.
          *
-         * \return    `tue::math::log()` for each component of `s`.
+         * \return    `tue::math::log10()` for each component of `s`.
          */
         template<typename T, int N>
         inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
-        log(const simd<T, N>& s) noexcept
+        log10(const simd<T, N>& s) noexcept
         {
-            return tue::detail_::log_s(s);
+            return tue::detail_::log10_s(s);
         }
 
         /*!
@@ -1534,6 +2745,25 @@ namespace tue
             return tue::detail_::sqrt_s(s);
         }
 
+        /*!
+         * \brief     Computes `tue::math::cbrt()` for each component of `s`.
+         * \details   The results may not match `tue::math::cbrt()` exactly, but
+         *            will at least approximate the same values.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::cbrt()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        cbrt(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::cbrt_s(s);
+        }
+
         /*!
          * \brief     Computes `tue::math::rsqrt()` for each component of `s`.
          * \details   The results may not match `tue::math::rsqrt()` exactly,
@@ -1553,6 +2783,140 @@ namespace tue
             return tue::detail_::rsqrt_s(s);
         }
 
+        /*!
+         * \brief     Computes `s1 * s2 + s3` for each corresponding trio of
+         *            components from `s1`, `s2`, and `s3`.
+         * \details   This is a single fused multiply-add instruction when
+         *            `TUE_FMA` is defined. Otherwise it falls back to a
+         *            separate multiply and add, so unlike `std::fma()` the
+         *            product is rounded before the sum.
+         *
+         * \tparam T  The component type of all three parameters.
+         * \tparam N  The component count of all three parameters.
+         *
+         * \param s1  An `simd`.
+         * \param s2  Another `simd`.
+         * \param s3  Another `simd`.
+         *
+         * \return    `s1 * s2 + s3` for each corresponding trio of
+         *            components from `s1`, `s2`, and `s3`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        fma(const simd<T, N>& s1,
+            const simd<T, N>& s2,
+            const simd<T, N>& s3) noexcept
+        {
+            return tue::detail_::fma_sss(s1, s2, s3);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::floor()` for each component of `s`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::floor()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        floor(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::floor_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::ceil()` for each component of `s`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::ceil()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        ceil(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::ceil_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::round()` for each component of `s`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::round()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        round(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::round_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::trunc()` for each component of `s`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::trunc()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        trunc(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::trunc_s(s);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::fract()` for each component of `s`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    `tue::math::fract()` for each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        fract(const simd<T, N>& s) noexcept
+        {
+            return s - tue::detail_::floor_s(s);
+        }
+
+        /*!
+         * \brief               Computes `tue::math::modf()` for each
+         *                      component of `s`.
+         * \details             Unlike `std::modf()`, the fractional part of
+         *                      an infinite component is NaN rather than zero.
+         *
+         * \tparam T            The component type of `s`.
+         * \tparam N            The component count of `s`.
+         *
+         * \param s             An `simd`.
+         * \param integral_out  Where to store `tue::math::trunc()` of `s`.
+         *
+         * \return              The fractional part of each component of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        modf(const simd<T, N>& s, simd<T, N>& integral_out) noexcept
+        {
+            integral_out = tue::detail_::trunc_s(s);
+            return s - integral_out;
+        }
+
         /*!
          * \brief     Computes `tue::math::min()` for each corresponding pair of
          *            components from `s1` and `s2`.
@@ -1593,6 +2957,120 @@ namespace tue
             return tue::detail_::max_ss(s1, s2);
         }
 
+        /*!
+         * \brief     Computes `tue::math::adds()` for each corresponding pair
+         *            of components from `s1` and `s2`.
+         *
+         * \tparam T  The component type of both `s1` and `s2`.
+         * \tparam N  The component count of both `s1` and `s2`.
+         *
+         * \param s1  An `simd`.
+         * \param s2  Another `simd`.
+         *
+         * \return    `tue::math::adds()` for each corresponding pair of
+         *            components from `s1` and `s2`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_integral<T>::value, simd<T, N>>
+        adds(const simd<T, N>& s1, const simd<T, N>& s2) noexcept
+        {
+            return tue::detail_::adds_ss(s1, s2);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::subs()` for each corresponding pair
+         *            of components from `s1` and `s2`.
+         *
+         * \tparam T  The component type of both `s1` and `s2`.
+         * \tparam N  The component count of both `s1` and `s2`.
+         *
+         * \param s1  An `simd`.
+         * \param s2  Another `simd`.
+         *
+         * \return    `tue::math::subs()` for each corresponding pair of
+         *            components from `s1` and `s2`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_integral<T>::value, simd<T, N>>
+        subs(const simd<T, N>& s1, const simd<T, N>& s2) noexcept
+        {
+            return tue::detail_::subs_ss(s1, s2);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::avg()` for each corresponding pair of
+         *            components from `s1` and `s2`.
+         *
+         * \tparam T  The component type of both `s1` and `s2`.
+         * \tparam N  The component count of both `s1` and `s2`.
+         *
+         * \param s1  An `simd`.
+         * \param s2  Another `simd`.
+         *
+         * \return    `tue::math::avg()` for each corresponding pair of
+         *            components from `s1` and `s2`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_integral<T>::value, simd<T, N>>
+        avg(const simd<T, N>& s1, const simd<T, N>& s2) noexcept
+        {
+            return tue::detail_::avg_ss(s1, s2);
+        }
+
+        /*!
+         * \brief     Computes the sum of the components of `s`.
+         * \details   The order of the additions is unspecified, so floating-
+         *            point results may differ slightly between platforms.
+         *            Integer sums wrap around like the `+` operator.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    The sum of the components of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, T>
+        reduce_add(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::reduce_add_s(s);
+        }
+
+        /*!
+         * \brief     Computes the minimum of the components of `s`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    The minimum of the components of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, T>
+        reduce_min(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::reduce_min_s(s);
+        }
+
+        /*!
+         * \brief     Computes the maximum of the components of `s`.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd`.
+         *
+         * \return    The maximum of the components of `s`.
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_arithmetic<T>::value, T>
+        reduce_max(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::reduce_max_s(s);
+        }
+
         /*!
          * \brief             Computes `tue::math::mask()` for each
          *                    corresponding pair of components from `conditions`
@@ -1767,6 +3245,472 @@ namespace tue
             return tue::detail_::not_equal_ss(lhs, rhs);
         }
 
+        /*!
+         * \brief     Packs the truth value of each component of `s` into the
+         *            bits of an integer.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd` of sized booleans.
+         *
+         * \return    An integer with bit `i` set if and only if component `i`
+         *            of `s` is `trueX` (where `X` is the number of bits in
+         *            `T`).
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<is_sized_bool<T>::value, std::uint64_t>
+        movemask(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::movemask_s(s);
+        }
+
+        /*!
+         * \brief     Determines whether or not any component of `s` is true.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd` of sized booleans.
+         *
+         * \return    Whether or not any component of `s` is `trueX` (where
+         *            `X` is the number of bits in `T`).
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<is_sized_bool<T>::value, bool>
+        any(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::any_s(s);
+        }
+
+        /*!
+         * \brief     Determines whether or not every component of `s` is true.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd` of sized booleans.
+         *
+         * \return    Whether or not every component of `s` is `trueX` (where
+         *            `X` is the number of bits in `T`).
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<is_sized_bool<T>::value, bool>
+        all(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::all_s(s);
+        }
+
+        /*!
+         * \brief     Determines whether or not no component of `s` is true.
+         *
+         * \tparam T  The component type of `s`.
+         * \tparam N  The component count of `s`.
+         *
+         * \param s   An `simd` of sized booleans.
+         *
+         * \return    Whether or not every component of `s` is `falseX` (where
+         *            `X` is the number of bits in `T`).
+         */
+        template<typename T, int N>
+        inline std::enable_if_t<is_sized_bool<T>::value, bool>
+        none(const simd<T, N>& s) noexcept
+        {
+            return tue::detail_::none_s(s);
+        }
+
+        namespace fast
+        {
+            /*!
+             * \brief     Computes `tue::math::fast::sin()` for each component
+             *            of `s`.
+             * \details   The results may not match `tue::math::fast::sin()`
+             *            exactly, but will at least approximate the same
+             *            values.
+             *
+             * \tparam T  The component type of `s`.
+             * \tparam N  The component count of `s`.
+             *
+             * \param s   An `simd`.
+             *
+             * \return    `tue::math::fast::sin()` for each component of `s`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            sin(const simd<T, N>& s) noexcept
+            {
+                return tue::detail_::fast_sin_s(s);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::cos()` for each component
+             *            of `s`.
+             * \details   The results may not match `tue::math::fast::cos()`
+             *            exactly, but will at least approximate the same
+             *            values.
+             *
+             * \tparam T  The component type of `s`.
+             * \tparam N  The component count of `s`.
+             *
+             * \param s   An `simd`.
+             *
+             * \return    `tue::math::fast::cos()` for each component of `s`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            cos(const simd<T, N>& s) noexcept
+            {
+                return tue::detail_::fast_cos_s(s);
+            }
+
+            /*!
+             * \brief          Computes `tue::math::fast::sincos()` for each
+             *                 component of `s`.
+             * \details        The results may not match
+             *                 `tue::math::fast::sincos()` exactly, but will at
+             *                 least approximate the same values.
+             *
+             * \tparam T       The component type of `s`.
+             * \tparam N       The component count of `s`.
+             *
+             * \param s        An `simd`.
+             * \param sin_out  A reference to the `simd` to store the `sin()`
+             *                 results in.
+             * \param cos_out  A reference to the `simd` to store the `cos()`
+             *                 results in.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<std::is_floating_point<T>::value>
+            sincos(
+                const simd<T, N>& s,
+                simd<T, N>& sin_out,
+                simd<T, N>& cos_out) noexcept
+            {
+                tue::detail_::fast_sincos_s(s, sin_out, cos_out);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::exp()` for each component
+             *            of `s`.
+             * \details   The results may not match `tue::math::fast::exp()`
+             *            exactly, but will at least approximate the same
+             *            values.
+             *
+             * \tparam T  The component type of `s`.
+             * \tparam N  The component count of `s`.
+             *
+             * \param s   An `simd`.
+             *
+             * \return    `tue::math::fast::exp()` for each component of `s`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            exp(const simd<T, N>& s) noexcept
+            {
+                return tue::detail_::fast_exp_s(s);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::log()` for each component
+             *            of `s`.
+             * \details   The results may not match `tue::math::fast::log()`
+             *            exactly, but will at least approximate the same
+             *            values.
+             *
+             * \tparam T  The component type of `s`.
+             * \tparam N  The component count of `s`.
+             *
+             * \param s   An `simd`.
+             *
+             * \return    `tue::math::fast::log()` for each component of `s`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            log(const simd<T, N>& s) noexcept
+            {
+                return tue::detail_::fast_log_s(s);
+            }
+
+            /*!
+             * \brief            Computes `tue::math::fast::pow()` for each
+             *                   component of `bases` and each corresponding
+             *                   component of `exponents`.
+             * \details          The results may not match
+             *                   `tue::math::fast::pow()` exactly, but will at
+             *                   least approximate the same values.
+             *
+             * \tparam T         The component type of both `bases` and
+             *                   `exponents`.
+             * \tparam N         The component count of both `bases` and
+             *                   `exponents`.
+             *
+             * \param bases      The bases.
+             * \param exponents  The exponents.
+             *
+             * \return           `tue::math::fast::pow()` for each component of
+             *                   `bases` and each corresponding component of
+             *                   `exponents`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            pow(const simd<T, N>& bases, const simd<T, N>& exponents) noexcept
+            {
+                return tue::detail_::fast_pow_ss(bases, exponents);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::recip()` for each component
+             *            of `s`.
+             * \details   The results may not match `tue::math::fast::recip()`
+             *            exactly, but will at least approximate the same
+             *            values.
+             *
+             * \tparam T  The component type of `s`.
+             * \tparam N  The component count of `s`.
+             *
+             * \param s   An `simd`.
+             *
+             * \return    `tue::math::fast::recip()` for each component of `s`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            recip(const simd<T, N>& s) noexcept
+            {
+                return tue::detail_::fast_recip_s(s);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::rsqrt()` for each component
+             *            of `s`.
+             * \details   The results may not match `tue::math::fast::rsqrt()`
+             *            exactly, but will at least approximate the same
+             *            values.
+             *
+             * \tparam T  The component type of `s`.
+             * \tparam N  The component count of `s`.
+             *
+             * \param s   An `simd`.
+             *
+             * \return    `tue::math::fast::rsqrt()` for each component of `s`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            rsqrt(const simd<T, N>& s) noexcept
+            {
+                return tue::detail_::fast_rsqrt_s(s);
+            }
+        }
+
+        namespace precise
+        {
+            /*!
+             * \brief     Computes `tue::math::precise::sin()` for each
+             *            component of `s`.
+             * \details   The results may not match `tue::math::precise::sin()`
+             *            exactly, but will at least approximate the same
+             *            values.
+             *
+             * \tparam T  The component type of `s`.
+             * \tparam N  The component count of `s`.
+             *
+             * \param s   An `simd`.
+             *
+             * \return    `tue::math::precise::sin()` for each component of `s`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            sin(const simd<T, N>& s) noexcept
+            {
+                return tue::detail_::precise_sin_s(s);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::cos()` for each
+             *            component of `s`.
+             * \details   The results may not match `tue::math::precise::cos()`
+             *            exactly, but will at least approximate the same
+             *            values.
+             *
+             * \tparam T  The component type of `s`.
+             * \tparam N  The component count of `s`.
+             *
+             * \param s   An `simd`.
+             *
+             * \return    `tue::math::precise::cos()` for each component of `s`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            cos(const simd<T, N>& s) noexcept
+            {
+                return tue::detail_::precise_cos_s(s);
+            }
+
+            /*!
+             * \brief          Computes `tue::math::precise::sincos()` for each
+             *                 component of `s`.
+             * \details        The results may not match
+             *                 `tue::math::precise::sincos()` exactly, but will
+             *                 at least approximate the same values.
+             *
+             * \tparam T       The component type of `s`.
+             * \tparam N       The component count of `s`.
+             *
+             * \param s        An `simd`.
+             * \param sin_out  A reference to the `simd` to store the `sin()`
+             *                 results in.
+             * \param cos_out  A reference to the `simd` to store the `cos()`
+             *                 results in.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<std::is_floating_point<T>::value>
+            sincos(
+                const simd<T, N>& s,
+                simd<T, N>& sin_out,
+                simd<T, N>& cos_out) noexcept
+            {
+                tue::detail_::precise_sincos_s(s, sin_out, cos_out);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::exp()` for each
+             *            component of `s`.
+             * \details   The results may not match `tue::math::precise::exp()`
+             *            exactly, but will at least approximate the same
+             *            values.
+             *
+             * \tparam T  The component type of `s`.
+             * \tparam N  The component count of `s`.
+             *
+             * \param s   An `simd`.
+             *
+             * \return    `tue::math::precise::exp()` for each component of `s`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            exp(const simd<T, N>& s) noexcept
+            {
+                return tue::detail_::precise_exp_s(s);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::log()` for each
+             *            component of `s`.
+             * \details   The results may not match `tue::math::precise::log()`
+             *            exactly, but will at least approximate the same
+             *            values.
+             *
+             * \tparam T  The component type of `s`.
+             * \tparam N  The component count of `s`.
+             *
+             * \param s   An `simd`.
+             *
+             * \return    `tue::math::precise::log()` for each component of `s`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            log(const simd<T, N>& s) noexcept
+            {
+                return tue::detail_::precise_log_s(s);
+            }
+
+            /*!
+             * \brief            Computes `tue::math::precise::pow()` for each
+             *                   component of `bases` and each corresponding
+             *                   component of `exponents`.
+             * \details          The results may not match
+             *                   `tue::math::precise::pow()` exactly, but will
+             *                   at least approximate the same values.
+             *
+             * \tparam T         The component type of both `bases` and
+             *                   `exponents`.
+             * \tparam N         The component count of both `bases` and
+             *                   `exponents`.
+             *
+             * \param bases      The bases.
+             * \param exponents  The exponents.
+             *
+             * \return           `tue::math::precise::pow()` for each component
+             *                   of `bases` and each corresponding component of
+             *                   `exponents`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            pow(const simd<T, N>& bases, const simd<T, N>& exponents) noexcept
+            {
+                return tue::detail_::precise_pow_ss(bases, exponents);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::recip()` for each
+             *            component of `s`.
+             * \details   The results may not match
+             *            `tue::math::precise::recip()` exactly, but will at
+             *            least approximate the same values.
+             *
+             * \tparam T  The component type of `s`.
+             * \tparam N  The component count of `s`.
+             *
+             * \param s   An `simd`.
+             *
+             * \return    `tue::math::precise::recip()` for each component of
+             *            `s`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            recip(const simd<T, N>& s) noexcept
+            {
+                return tue::detail_::precise_recip_s(s);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::rsqrt()` for each
+             *            component of `s`.
+             * \details   The results may not match
+             *            `tue::math::precise::rsqrt()` exactly, but will at
+             *            least approximate the same values.
+             *
+             * \tparam T  The component type of `s`.
+             * \tparam N  The component count of `s`.
+             *
+             * \param s   An `simd`.
+             *
+             * \return    `tue::math::precise::rsqrt()` for each component of
+             *            `s`.
+             */
+            template<typename T, int N>
+            inline std::enable_if_t<
+                std::is_floating_point<T>::value, simd<T, N>>
+            rsqrt(const simd<T, N>& s) noexcept
+            {
+                return tue::detail_::precise_rsqrt_s(s);
+            }
+        }
+
         /*!@}*/
     }
+
+    namespace detail_
+    {
+        template<typename T, int N>
+        inline std::enable_if_t<std::is_floating_point<T>::value, simd<T, N>>
+        madd(const simd<T, N>& x,
+             const simd<T, N>& y,
+             const simd<T, N>& z) noexcept
+        {
+            return tue::detail_::fma_sss(x, y, z);
+        }
+    }
 }
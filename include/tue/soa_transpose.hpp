@@ -0,0 +1,597 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+// Included ahead of vec.hpp and the rest so that their functions see the
+// `simd` overloads when called on the results.
+#include "simd.hpp"
+
+#include "mat.hpp"
+#include "quat.hpp"
+#include "vec.hpp"
+
+namespace tue
+{
+    /**/
+    namespace detail_
+    {
+        // Whether `simd<T, N>` is made of narrower specialized `simd`'s,
+        // in which case the conversions below convert one of those at a
+        // time.
+        template<typename T, int N>
+        using has_accelerated_chunks = is_accelerated_chunk<
+            T, tue::detail_::simd_chunk_width<T, N>(), N>;
+
+        template<typename T, int N>
+        inline void load_soa2(
+            const T* aos, simd<T, N>& x, simd<T, N>& y) noexcept;
+
+        template<typename T, int N>
+        inline void load_soa3(
+            const T* aos,
+            simd<T, N>& x, simd<T, N>& y, simd<T, N>& z) noexcept;
+
+        template<typename T, int N>
+        inline void load_soa4(
+            const T* aos,
+            std::size_t stride,
+            simd<T, N>& x,
+            simd<T, N>& y,
+            simd<T, N>& z,
+            simd<T, N>& w) noexcept;
+
+        template<typename T, int N>
+        inline void store_aos2(
+            T* aos, const simd<T, N>& x, const simd<T, N>& y) noexcept;
+
+        template<typename T, int N>
+        inline void store_aos3(
+            T* aos,
+            const simd<T, N>& x,
+            const simd<T, N>& y,
+            const simd<T, N>& z) noexcept;
+
+        template<typename T, int N>
+        inline void store_aos4(
+            T* aos,
+            std::size_t stride,
+            const simd<T, N>& x,
+            const simd<T, N>& y,
+            const simd<T, N>& z,
+            const simd<T, N>& w) noexcept;
+
+        template<typename T, int N>
+        inline void load_soa2(
+            const T* aos,
+            simd<T, N>& x,
+            simd<T, N>& y,
+            std::false_type) noexcept
+        {
+            for (int i = 0; i < N; ++i)
+            {
+                x.data()[i] = aos[i * 2];
+                y.data()[i] = aos[i * 2 + 1];
+            }
+        }
+
+        template<typename T, int N>
+        inline void load_soa2(
+            const T* aos,
+            simd<T, N>& x,
+            simd<T, N>& y,
+            std::true_type) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto xc = reinterpret_cast<simd<T, W>*>(&x);
+            const auto yc = reinterpret_cast<simd<T, W>*>(&y);
+            for (int c = 0; c < N/W; ++c)
+            {
+                tue::detail_::load_soa2(aos + c * W * 2, xc[c], yc[c]);
+            }
+        }
+
+        template<typename T, int N>
+        inline void load_soa2(
+            const T* aos, simd<T, N>& x, simd<T, N>& y) noexcept
+        {
+            tue::detail_::load_soa2(
+                aos, x, y, has_accelerated_chunks<T, N>());
+        }
+
+        template<typename T, int N>
+        inline void load_soa3(
+            const T* aos,
+            simd<T, N>& x,
+            simd<T, N>& y,
+            simd<T, N>& z,
+            std::false_type) noexcept
+        {
+            for (int i = 0; i < N; ++i)
+            {
+                x.data()[i] = aos[i * 3];
+                y.data()[i] = aos[i * 3 + 1];
+                z.data()[i] = aos[i * 3 + 2];
+            }
+        }
+
+        template<typename T, int N>
+        inline void load_soa3(
+            const T* aos,
+            simd<T, N>& x,
+            simd<T, N>& y,
+            simd<T, N>& z,
+            std::true_type) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto xc = reinterpret_cast<simd<T, W>*>(&x);
+            const auto yc = reinterpret_cast<simd<T, W>*>(&y);
+            const auto zc = reinterpret_cast<simd<T, W>*>(&z);
+            for (int c = 0; c < N/W; ++c)
+            {
+                tue::detail_::load_soa3(
+                    aos + c * W * 3, xc[c], yc[c], zc[c]);
+            }
+        }
+
+        template<typename T, int N>
+        inline void load_soa3(
+            const T* aos,
+            simd<T, N>& x, simd<T, N>& y, simd<T, N>& z) noexcept
+        {
+            tue::detail_::load_soa3(
+                aos, x, y, z, has_accelerated_chunks<T, N>());
+        }
+
+        template<typename T, int N>
+        inline void load_soa4(
+            const T* aos,
+            std::size_t stride,
+            simd<T, N>& x,
+            simd<T, N>& y,
+            simd<T, N>& z,
+            simd<T, N>& w,
+            std::false_type) noexcept
+        {
+            for (int i = 0; i < N; ++i)
+            {
+                const T* row = aos + stride * i;
+                x.data()[i] = row[0];
+                y.data()[i] = row[1];
+                z.data()[i] = row[2];
+                w.data()[i] = row[3];
+            }
+        }
+
+        template<typename T, int N>
+        inline void load_soa4(
+            const T* aos,
+            std::size_t stride,
+            simd<T, N>& x,
+            simd<T, N>& y,
+            simd<T, N>& z,
+            simd<T, N>& w,
+            std::true_type) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto xc = reinterpret_cast<simd<T, W>*>(&x);
+            const auto yc = reinterpret_cast<simd<T, W>*>(&y);
+            const auto zc = reinterpret_cast<simd<T, W>*>(&z);
+            const auto wc = reinterpret_cast<simd<T, W>*>(&w);
+            for (int c = 0; c < N/W; ++c)
+            {
+                tue::detail_::load_soa4(
+                    aos + stride * W * c, stride,
+                    xc[c], yc[c], zc[c], wc[c]);
+            }
+        }
+
+        template<typename T, int N>
+        inline void load_soa4(
+            const T* aos,
+            std::size_t stride,
+            simd<T, N>& x,
+            simd<T, N>& y,
+            simd<T, N>& z,
+            simd<T, N>& w) noexcept
+        {
+            tue::detail_::load_soa4(
+                aos, stride, x, y, z, w, has_accelerated_chunks<T, N>());
+        }
+
+        template<typename T, int N>
+        inline void store_aos2(
+            T* aos,
+            const simd<T, N>& x,
+            const simd<T, N>& y,
+            std::false_type) noexcept
+        {
+            for (int i = 0; i < N; ++i)
+            {
+                aos[i * 2] = x.data()[i];
+                aos[i * 2 + 1] = y.data()[i];
+            }
+        }
+
+        template<typename T, int N>
+        inline void store_aos2(
+            T* aos,
+            const simd<T, N>& x,
+            const simd<T, N>& y,
+            std::true_type) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto xc = reinterpret_cast<const simd<T, W>*>(&x);
+            const auto yc = reinterpret_cast<const simd<T, W>*>(&y);
+            for (int c = 0; c < N/W; ++c)
+            {
+                tue::detail_::store_aos2(aos + c * W * 2, xc[c], yc[c]);
+            }
+        }
+
+        template<typename T, int N>
+        inline void store_aos2(
+            T* aos, const simd<T, N>& x, const simd<T, N>& y) noexcept
+        {
+            tue::detail_::store_aos2(
+                aos, x, y, has_accelerated_chunks<T, N>());
+        }
+
+        template<typename T, int N>
+        inline void store_aos3(
+            T* aos,
+            const simd<T, N>& x,
+            const simd<T, N>& y,
+            const simd<T, N>& z,
+            std::false_type) noexcept
+        {
+            for (int i = 0; i < N; ++i)
+            {
+                aos[i * 3] = x.data()[i];
+                aos[i * 3 + 1] = y.data()[i];
+                aos[i * 3 + 2] = z.data()[i];
+            }
+        }
+
+        template<typename T, int N>
+        inline void store_aos3(
+            T* aos,
+            const simd<T, N>& x,
+            const simd<T, N>& y,
+            const simd<T, N>& z,
+            std::true_type) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto xc = reinterpret_cast<const simd<T, W>*>(&x);
+            const auto yc = reinterpret_cast<const simd<T, W>*>(&y);
+            const auto zc = reinterpret_cast<const simd<T, W>*>(&z);
+            for (int c = 0; c < N/W; ++c)
+            {
+                tue::detail_::store_aos3(
+                    aos + c * W * 3, xc[c], yc[c], zc[c]);
+            }
+        }
+
+        template<typename T, int N>
+        inline void store_aos3(
+            T* aos,
+            const simd<T, N>& x,
+            const simd<T, N>& y,
+            const simd<T, N>& z) noexcept
+        {
+            tue::detail_::store_aos3(
+                aos, x, y, z, has_accelerated_chunks<T, N>());
+        }
+
+        template<typename T, int N>
+        inline void store_aos4(
+            T* aos,
+            std::size_t stride,
+            const simd<T, N>& x,
+            const simd<T, N>& y,
+            const simd<T, N>& z,
+            const simd<T, N>& w,
+            std::false_type) noexcept
+        {
+            for (int i = 0; i < N; ++i)
+            {
+                T* row = aos + stride * i;
+                row[0] = x.data()[i];
+                row[1] = y.data()[i];
+                row[2] = z.data()[i];
+                row[3] = w.data()[i];
+            }
+        }
+
+        template<typename T, int N>
+        inline void store_aos4(
+            T* aos,
+            std::size_t stride,
+            const simd<T, N>& x,
+            const simd<T, N>& y,
+            const simd<T, N>& z,
+            const simd<T, N>& w,
+            std::true_type) noexcept
+        {
+            constexpr int W = tue::detail_::simd_chunk_width<T, N>();
+            const auto xc = reinterpret_cast<const simd<T, W>*>(&x);
+            const auto yc = reinterpret_cast<const simd<T, W>*>(&y);
+            const auto zc = reinterpret_cast<const simd<T, W>*>(&z);
+            const auto wc = reinterpret_cast<const simd<T, W>*>(&w);
+            for (int c = 0; c < N/W; ++c)
+            {
+                tue::detail_::store_aos4(
+                    aos + stride * W * c, stride,
+                    xc[c], yc[c], zc[c], wc[c]);
+            }
+        }
+
+        template<typename T, int N>
+        inline void store_aos4(
+            T* aos,
+            std::size_t stride,
+            const simd<T, N>& x,
+            const simd<T, N>& y,
+            const simd<T, N>& z,
+            const simd<T, N>& w) noexcept
+        {
+            tue::detail_::store_aos4(
+                aos, stride, x, y, z, w, has_accelerated_chunks<T, N>());
+        }
+
+        // The functions below treat arrays of `vec`'s, `quat`'s, and `mat`'s
+        // as arrays of their components.
+        template<typename V, typename T, int N>
+        inline constexpr bool is_packed() noexcept
+        {
+            return sizeof(V) == sizeof(T) * N;
+        }
+    }
+
+    /*!
+     * \defgroup  soa_transpose_hpp <tue/soa_transpose.hpp>
+     *
+     * \brief     Conversions between arrays of `vec`'s, `quat`'s, or `mat`'s
+     *            and `vec`'s, `quat`'s, or `mat`'s of `simd`'s.
+     * \details   `load_soa<W>()` reads `W` consecutive elements of an array
+     *            of structures (AoS) into a single structure of arrays (SoA)
+     *            with one `simd<T, W>` per component, and `store_aos()`
+     *            does the reverse. `float` with `W` of `4` (SSE) or `8`
+     *            (AVX) use shuffle networks in the style of
+     *            `_MM_TRANSPOSE4_PS` instead of moving each component on
+     *            its own.
+     * @{
+     */
+
+    /*!
+     * \brief      Loads `W` consecutive `vec2`'s into a `vec2` of `simd`'s.
+     *
+     * \tparam W   The number of elements to load.
+     * \tparam T   The component type of the elements.
+     *
+     * \param aos  A pointer to the first element. Doesn't need to be
+     *             aligned.
+     *
+     * \return     A `vec2` whose `x` holds every element's `x` component
+     *             and whose `y` holds every element's `y` component.
+     */
+    template<int W, typename T>
+    inline vec2<simd<T, W>> load_soa(const vec2<T>* aos) noexcept
+    {
+        static_assert(tue::detail_::is_packed<vec2<T>, T, 2>(),
+            "vec2 must not have padding");
+        vec2<simd<T, W>> soa;
+        tue::detail_::load_soa2(aos->data(), soa[0], soa[1]);
+        return soa;
+    }
+
+    /*!
+     * \brief      Loads `W` consecutive `vec3`'s into a `vec3` of `simd`'s.
+     *
+     * \tparam W   The number of elements to load.
+     * \tparam T   The component type of the elements.
+     *
+     * \param aos  A pointer to the first element. Doesn't need to be
+     *             aligned.
+     *
+     * \return     A `vec3` whose `x`, `y`, and `z` each hold the
+     *             corresponding component of every element.
+     */
+    template<int W, typename T>
+    inline vec3<simd<T, W>> load_soa(const vec3<T>* aos) noexcept
+    {
+        static_assert(tue::detail_::is_packed<vec3<T>, T, 3>(),
+            "vec3 must not have padding");
+        vec3<simd<T, W>> soa;
+        tue::detail_::load_soa3(aos->data(), soa[0], soa[1], soa[2]);
+        return soa;
+    }
+
+    /*!
+     * \brief      Loads `W` consecutive `vec4`'s into a `vec4` of `simd`'s.
+     *
+     * \tparam W   The number of elements to load.
+     * \tparam T   The component type of the elements.
+     *
+     * \param aos  A pointer to the first element. Doesn't need to be
+     *             aligned.
+     *
+     * \return     A `vec4` whose `x`, `y`, `z`, and `w` each hold the
+     *             corresponding component of every element.
+     */
+    template<int W, typename T>
+    inline vec4<simd<T, W>> load_soa(const vec4<T>* aos) noexcept
+    {
+        static_assert(tue::detail_::is_packed<vec4<T>, T, 4>(),
+            "vec4 must not have padding");
+        vec4<simd<T, W>> soa;
+        tue::detail_::load_soa4(
+            aos->data(), 4, soa[0], soa[1], soa[2], soa[3]);
+        return soa;
+    }
+
+    /*!
+     * \brief      Loads `W` consecutive `quat`'s into a `quat` of `simd`'s.
+     *
+     * \tparam W   The number of elements to load.
+     * \tparam T   The component type of the elements.
+     *
+     * \param aos  A pointer to the first element. Doesn't need to be
+     *             aligned.
+     *
+     * \return     A `quat` whose components each hold the corresponding
+     *             component of every element.
+     */
+    template<int W, typename T>
+    inline quat<simd<T, W>> load_soa(const quat<T>* aos) noexcept
+    {
+        static_assert(tue::detail_::is_packed<quat<T>, T, 4>(),
+            "quat must not have padding");
+        quat<simd<T, W>> soa;
+        tue::detail_::load_soa4(
+            aos->data(), 4, soa[0], soa[1], soa[2], soa[3]);
+        return soa;
+    }
+
+    /*!
+     * \brief      Loads `W` consecutive `mat4x4`'s into a `mat4x4` of
+     *             `simd`'s.
+     *
+     * \tparam W   The number of elements to load.
+     * \tparam T   The component type of the elements.
+     *
+     * \param aos  A pointer to the first element. Doesn't need to be
+     *             aligned.
+     *
+     * \return     A `mat4x4` whose components each hold the corresponding
+     *             component of every element.
+     */
+    template<int W, typename T>
+    inline mat4x4<simd<T, W>> load_soa(const mat4x4<T>* aos) noexcept
+    {
+        static_assert(tue::detail_::is_packed<mat4x4<T>, T, 16>(),
+            "mat4x4 must not have padding");
+        mat4x4<simd<T, W>> soa;
+        for (int c = 0; c < 4; ++c)
+        {
+            tue::detail_::load_soa4(
+                aos->data() + c * 4, 16,
+                soa[c][0], soa[c][1], soa[c][2], soa[c][3]);
+        }
+        return soa;
+    }
+
+    /*!
+     * \brief      Stores a `vec2` of `simd`'s into `W` consecutive `vec2`'s.
+     *
+     * \tparam T   The component type of the elements.
+     * \tparam W   The number of elements to store.
+     *
+     * \param soa  A `vec2` whose `x` and `y` each hold the corresponding
+     *             component of every element.
+     * \param aos  A pointer to the first element. Doesn't need to be
+     *             aligned.
+     */
+    template<typename T, int W>
+    inline void store_aos(const vec2<simd<T, W>>& soa, vec2<T>* aos) noexcept
+    {
+        static_assert(tue::detail_::is_packed<vec2<T>, T, 2>(),
+            "vec2 must not have padding");
+        tue::detail_::store_aos2(aos->data(), soa[0], soa[1]);
+    }
+
+    /*!
+     * \brief      Stores a `vec3` of `simd`'s into `W` consecutive `vec3`'s.
+     *
+     * \tparam T   The component type of the elements.
+     * \tparam W   The number of elements to store.
+     *
+     * \param soa  A `vec3` whose `x`, `y`, and `z` each hold the
+     *             corresponding component of every element.
+     * \param aos  A pointer to the first element. Doesn't need to be
+     *             aligned.
+     */
+    template<typename T, int W>
+    inline void store_aos(const vec3<simd<T, W>>& soa, vec3<T>* aos) noexcept
+    {
+        static_assert(tue::detail_::is_packed<vec3<T>, T, 3>(),
+            "vec3 must not have padding");
+        tue::detail_::store_aos3(aos->data(), soa[0], soa[1], soa[2]);
+    }
+
+    /*!
+     * \brief      Stores a `vec4` of `simd`'s into `W` consecutive `vec4`'s.
+     *
+     * \tparam T   The component type of the elements.
+     * \tparam W   The number of elements to store.
+     *
+     * \param soa  A `vec4` whose `x`, `y`, `z`, and `w` each hold the
+     *             corresponding component of every element.
+     * \param aos  A pointer to the first element. Doesn't need to be
+     *             aligned.
+     */
+    template<typename T, int W>
+    inline void store_aos(const vec4<simd<T, W>>& soa, vec4<T>* aos) noexcept
+    {
+        static_assert(tue::detail_::is_packed<vec4<T>, T, 4>(),
+            "vec4 must not have padding");
+        tue::detail_::store_aos4(
+            aos->data(), 4, soa[0], soa[1], soa[2], soa[3]);
+    }
+
+    /*!
+     * \brief      Stores a `quat` of `simd`'s into `W` consecutive `quat`'s.
+     *
+     * \tparam T   The component type of the elements.
+     * \tparam W   The number of elements to store.
+     *
+     * \param soa  A `quat` whose components each hold the corresponding
+     *             component of every element.
+     * \param aos  A pointer to the first element. Doesn't need to be
+     *             aligned.
+     */
+    template<typename T, int W>
+    inline void store_aos(const quat<simd<T, W>>& soa, quat<T>* aos) noexcept
+    {
+        static_assert(tue::detail_::is_packed<quat<T>, T, 4>(),
+            "quat must not have padding");
+        tue::detail_::store_aos4(
+            aos->data(), 4, soa[0], soa[1], soa[2], soa[3]);
+    }
+
+    /*!
+     * \brief      Stores a `mat4x4` of `simd`'s into `W` consecutive
+     *             `mat4x4`'s.
+     *
+     * \tparam T   The component type of the elements.
+     * \tparam W   The number of elements to store.
+     *
+     * \param soa  A `mat4x4` whose components each hold the corresponding
+     *             component of every element.
+     * \param aos  A pointer to the first element. Doesn't need to be
+     *             aligned.
+     */
+    template<typename T, int W>
+    inline void store_aos(
+        const mat4x4<simd<T, W>>& soa, mat4x4<T>* aos) noexcept
+    {
+        static_assert(tue::detail_::is_packed<mat4x4<T>, T, 16>(),
+            "mat4x4 must not have padding");
+        for (int c = 0; c < 4; ++c)
+        {
+            tue::detail_::store_aos4(
+                aos->data() + c * 4, 16,
+                soa[c][0], soa[c][1], soa[c][2], soa[c][3]);
+        }
+    }
+
+    /*!@}*/
+}
@@ -0,0 +1,724 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// simd.hpp comes first so that the `vec`, `quat`, and `mat` functions see
+// its overloads of `rsqrt()`, `sqrt()`, etc. when used on packets.
+#include "simd.hpp"
+
+#include "mat.hpp"
+#include "quat.hpp"
+#include "sized_bool.hpp"
+#include "vec.hpp"
+
+namespace tue
+{
+    /*!
+     * \defgroup  soa_vector_hpp <tue/soa_vector.hpp>
+     *
+     * \brief     The `soa_vector` class template and its `soa_packet`
+     *            proxies.
+     * \details   A `soa_vector<vec3<float>>` stores its elements' first,
+     *            second, and third components in three separate arrays
+     *            instead of one array of `vec3<float>`'s. `for_each_packet()`
+     *            then hands out `W` consecutive elements at a time as a
+     *            single `vec3<simd<float, W>>` that can be operated on with
+     *            the usual `vec` functions.
+     *
+     * @{
+     */
+
+    template<typename V>
+    class soa_vector;
+
+    template<typename S, int W>
+    class soa_packet;
+
+    /*!@}*/
+
+    namespace detail_
+    {
+        // How each element type of a `soa_vector` splits into streams of
+        // components and which type holds `W` elements' worth of them.
+        template<typename V>
+        struct soa_traits;
+
+        template<typename T, int N>
+        struct soa_traits<vec<T, N>>
+        {
+            using component_type = T;
+
+            static constexpr int stream_count = N;
+
+            template<int W>
+            using packet_type = vec<simd<T, W>, N>;
+        };
+
+        template<typename T>
+        struct soa_traits<quat<T>>
+        {
+            using component_type = T;
+
+            static constexpr int stream_count = 4;
+
+            template<int W>
+            using packet_type = quat<simd<T, W>>;
+        };
+
+        template<typename T, int C, int R>
+        struct soa_traits<mat<T, C, R>>
+        {
+            using component_type = T;
+
+            static constexpr int stream_count = C * R;
+
+            template<int W>
+            using packet_type = mat<simd<T, W>, C, R>;
+        };
+    }
+
+    /*!
+     * \addtogroup  soa_vector_hpp
+     * @{
+     */
+
+    /*!
+     * \brief     A dynamically-sized array of `vec`'s, `quat`'s, or `mat`'s
+     *            stored as one aligned array per component (i.e., a
+     *            structure of arrays).
+     * \details   Since the components of an element aren't adjacent in
+     *            memory, elements are read and written by value with `get()`
+     *            and `set()` rather than by reference. Each component array
+     *            is aligned for and padded to a multiple of the widest `simd`
+     *            type, so packets of up to 64 elements can always be loaded
+     *            and stored whole, even at the end of the array. The padding
+     *            past `size()` is never observable through any other member
+     *            function.
+     *
+     * \tparam V  The element type. Must be a `vec`, `quat`, or `mat` type
+     *            whose component type is an arithmetic `simd` component
+     *            type.
+     */
+    template<typename V>
+    class soa_vector
+    {
+        using traits = tue::detail_::soa_traits<V>;
+
+        using T = typename traits::component_type;
+
+        static_assert(
+            is_arithmetic_simd_component<T>::value,
+            "soa_vector requires an arithmetic simd component type");
+
+        // Every component array starts on this boundary, which is the
+        // largest alignment of any `simd` type.
+        static constexpr std::size_t stream_alignment = 128;
+
+        // Capacities are multiples of this so that every component array
+        // stays aligned and packets of up to 64 elements never run past
+        // the end of one.
+        static constexpr std::size_t capacity_granularity =
+            sizeof(T) < 2 ? 128 : 64;
+
+        void* allocation_ = nullptr;
+        T* streams_ = nullptr;
+        std::size_t size_ = 0;
+        std::size_t capacity_ = 0;
+
+        void reallocate(std::size_t capacity)
+        {
+            const std::size_t bytes = capacity * stream_count * sizeof(T);
+            void* allocation = ::operator new(bytes + stream_alignment - 1);
+            const auto address =
+                (reinterpret_cast<std::uintptr_t>(allocation)
+                    + stream_alignment - 1)
+                & ~std::uintptr_t(stream_alignment - 1);
+            const auto streams = reinterpret_cast<T*>(address);
+
+            std::memset(streams, 0, bytes);
+            for (int k = 0; k < stream_count; ++k)
+            {
+                if (this->size_ > 0)
+                {
+                    std::memcpy(
+                        streams + k * capacity,
+                        this->streams_ + k * this->capacity_,
+                        this->size_ * sizeof(T));
+                }
+            }
+
+            ::operator delete(this->allocation_);
+            this->allocation_ = allocation;
+            this->streams_ = streams;
+            this->capacity_ = capacity;
+        }
+
+    public:
+        /*!
+         * \brief  This `soa_vector` type's element type.
+         */
+        using value_type = V;
+
+        /*!
+         * \brief  The component type of this `soa_vector` type's elements.
+         */
+        using component_type = T;
+
+        /*!
+         * \brief  The type of sizes and indices.
+         */
+        using size_type = std::size_t;
+
+        /*!
+         * \brief     The type that holds `W` consecutive elements, e.g.,
+         *            `vec3<simd<float, W>>` for `soa_vector<vec3<float>>`.
+         *
+         * \tparam W  The number of elements.
+         */
+        template<int W>
+        using packet_type = typename traits::template packet_type<W>;
+
+        /*!
+         * \brief  The number of separate component arrays.
+         */
+        static constexpr int stream_count = traits::stream_count;
+
+        /*!
+         * \name Constructors, Assignment, and Destructor
+         * @{
+         */
+        /*!
+         * \brief  Constructs an empty `soa_vector`.
+         */
+        soa_vector() noexcept = default;
+
+        /*!
+         * \brief        Constructs a `soa_vector` with `count` elements whose
+         *               components are all `0`.
+         *
+         * \param count  The number of elements.
+         */
+        explicit soa_vector(size_type count)
+        {
+            this->resize(count);
+        }
+
+        /*!
+         * \brief        Constructs a `soa_vector` with `count` copies of
+         *               `value`.
+         *
+         * \param count  The number of elements.
+         * \param value  The value to copy into each element.
+         */
+        soa_vector(size_type count, const V& value)
+        {
+            this->resize(count, value);
+        }
+
+        /*!
+         * \brief        Copies another `soa_vector`'s elements.
+         *
+         * \param other  The `soa_vector` to copy.
+         */
+        soa_vector(const soa_vector& other)
+        {
+            this->reserve(other.size_);
+            for (int k = 0; k < stream_count; ++k)
+            {
+                if (other.size_ > 0)
+                {
+                    std::memcpy(
+                        this->stream(k),
+                        other.stream(k),
+                        other.size_ * sizeof(T));
+                }
+            }
+            this->size_ = other.size_;
+        }
+
+        /*!
+         * \brief        Takes ownership of another `soa_vector`'s elements,
+         *               leaving it empty.
+         *
+         * \param other  The `soa_vector` to move from.
+         */
+        soa_vector(soa_vector&& other) noexcept
+        {
+            this->swap(other);
+        }
+
+        /*!
+         * \brief        Replaces this `soa_vector`'s elements with copies of
+         *               another's.
+         *
+         * \param other  The `soa_vector` to copy.
+         *
+         * \return       A reference to this `soa_vector`.
+         */
+        soa_vector& operator=(const soa_vector& other)
+        {
+            soa_vector copy(other);
+            this->swap(copy);
+            return *this;
+        }
+
+        /*!
+         * \brief        Replaces this `soa_vector`'s elements with
+         *               another's, leaving it empty.
+         *
+         * \param other  The `soa_vector` to move from.
+         *
+         * \return       A reference to this `soa_vector`.
+         */
+        soa_vector& operator=(soa_vector&& other) noexcept
+        {
+            soa_vector moved(std::move(other));
+            this->swap(moved);
+            return *this;
+        }
+
+        /*!
+         * \brief  Frees this `soa_vector`'s component arrays.
+         */
+        ~soa_vector()
+        {
+            ::operator delete(this->allocation_);
+        }
+
+        /*!@}*/
+        /*!
+         * \name Capacity
+         * @{
+         */
+        /*!
+         * \brief   Returns the number of elements.
+         *
+         * \return  The number of elements.
+         */
+        size_type size() const noexcept
+        {
+            return this->size_;
+        }
+
+        /*!
+         * \brief   Returns the number of elements that fit without
+         *          reallocating.
+         *
+         * \return  The number of elements that fit without reallocating.
+         */
+        size_type capacity() const noexcept
+        {
+            return this->capacity_;
+        }
+
+        /*!
+         * \brief   Determines whether or not there are no elements.
+         *
+         * \return  `true` if there are no elements and `false` otherwise.
+         */
+        bool empty() const noexcept
+        {
+            return this->size_ == 0;
+        }
+
+        /*!
+         * \brief           Makes room for at least `capacity` elements.
+         * \details         Component pointers and packet proxies are
+         *                  invalidated if this reallocates.
+         *
+         * \param capacity  The minimum number of elements to make room for.
+         */
+        void reserve(size_type capacity)
+        {
+            if (capacity > this->capacity_)
+            {
+                if (capacity < this->capacity_ * 2)
+                {
+                    capacity = this->capacity_ * 2;
+                }
+                this->reallocate(
+                    (capacity + capacity_granularity - 1)
+                    / capacity_granularity * capacity_granularity);
+            }
+        }
+
+        /*!
+         * \brief        Changes the number of elements. New elements have all
+         *               of their components set to `0`.
+         *
+         * \param count  The new number of elements.
+         */
+        void resize(size_type count)
+        {
+            this->reserve(count);
+            for (int k = 0; k < stream_count; ++k)
+            {
+                const auto s = this->stream(k);
+                for (size_type i = this->size_; i < count; ++i)
+                {
+                    s[i] = static_cast<T>(0);
+                }
+            }
+            this->size_ = count;
+        }
+
+        /*!
+         * \brief        Changes the number of elements. New elements are
+         *               copies of `value`.
+         *
+         * \param count  The new number of elements.
+         * \param value  The value to copy into each new element.
+         */
+        void resize(size_type count, const V& value)
+        {
+            this->reserve(count);
+            for (int k = 0; k < stream_count; ++k)
+            {
+                const auto s = this->stream(k);
+                const auto x = value.data()[k];
+                for (size_type i = this->size_; i < count; ++i)
+                {
+                    s[i] = x;
+                }
+            }
+            this->size_ = count;
+        }
+
+        /*!
+         * \brief  Removes every element without freeing any memory.
+         */
+        void clear() noexcept
+        {
+            this->size_ = 0;
+        }
+
+        /*!@}*/
+        /*!
+         * \name Element Access
+         * @{
+         */
+        /*!
+         * \brief        Appends a copy of `value`.
+         *
+         * \param value  The value to append.
+         */
+        void push_back(const V& value)
+        {
+            if (this->size_ == this->capacity_)
+            {
+                this->reserve(this->size_ + 1);
+            }
+            this->set(this->size_++, value);
+        }
+
+        /*!
+         * \brief    Removes the last element.
+         * \details  If there are no elements, behavior is undefined.
+         */
+        void pop_back() noexcept
+        {
+            --this->size_;
+        }
+
+        /*!
+         * \brief    Returns a copy of the element at index `i`.
+         * \details  If `i` is out of range, behavior is undefined.
+         *
+         * \param i  The index of the element.
+         *
+         * \return   A copy of the element at index `i`.
+         */
+        V get(size_type i) const noexcept
+        {
+            V value;
+            for (int k = 0; k < stream_count; ++k)
+            {
+                value.data()[k] = this->stream(k)[i];
+            }
+            return value;
+        }
+
+        /*!
+         * \brief        Replaces the element at index `i` with `value`.
+         * \details      If `i` is out of range, behavior is undefined.
+         *
+         * \param i      The index of the element.
+         * \param value  The new value of the element.
+         */
+        void set(size_type i, const V& value) noexcept
+        {
+            for (int k = 0; k < stream_count; ++k)
+            {
+                this->stream(k)[i] = value.data()[k];
+            }
+        }
+
+        /*!
+         * \brief    Returns a pointer to the array holding component `k` of
+         *           every element.
+         * \details  Component `k` is the one at `V::data()[k]`. The array is
+         *           aligned to 128 bytes and holds `capacity()` components.
+         *           If `capacity()` is `0`, the pointer is null.
+         *
+         * \param k  The component index, from `0` to `stream_count - 1`.
+         *
+         * \return   A pointer to the array holding component `k`.
+         */
+        const T* stream(int k) const noexcept
+        {
+            return this->streams_ + k * this->capacity_;
+        }
+
+        /*!
+         * \brief    Returns a pointer to the array holding component `k` of
+         *           every element.
+         * \details  Component `k` is the one at `V::data()[k]`. The array is
+         *           aligned to 128 bytes and holds `capacity()` components.
+         *           If `capacity()` is `0`, the pointer is null.
+         *
+         * \param k  The component index, from `0` to `stream_count - 1`.
+         *
+         * \return   A pointer to the array holding component `k`.
+         */
+        T* stream(int k) noexcept
+        {
+            return this->streams_ + k * this->capacity_;
+        }
+
+        /*!
+         * \brief     Loads the `W` elements starting at index `i`.
+         * \details   `i` must be a multiple of `W` less than `size()`.
+         *            Elements past `size()` are padding with unspecified
+         *            values.
+         *
+         * \tparam W  The number of elements.
+         *
+         * \param i   The index of the first element.
+         *
+         * \return    The `W` elements starting at index `i`.
+         */
+        template<int W>
+        packet_type<W> load_packet(size_type i) const noexcept
+        {
+            packet_type<W> packet;
+            for (int k = 0; k < stream_count; ++k)
+            {
+                packet.data()[k] =
+                    simd<T, W>::load(this->stream(k) + i);
+            }
+            return packet;
+        }
+
+        /*!
+         * \brief         Stores `W` elements starting at index `i`.
+         * \details       `i` must be a multiple of `W` less than `size()`.
+         *                Elements past `size()` are padding and are written
+         *                too, but remain unobservable.
+         *
+         * \tparam W      The number of elements.
+         *
+         * \param i       The index of the first element.
+         * \param packet  The elements to store.
+         */
+        template<int W>
+        void store_packet(
+            size_type i, const packet_type<W>& packet) noexcept
+        {
+            for (int k = 0; k < stream_count; ++k)
+            {
+                packet.data()[k].store(this->stream(k) + i);
+            }
+        }
+
+        /*!
+         * \brief     Calls `f` with a `soa_packet` for each group of `W`
+         *            consecutive elements, in order.
+         * \details   The last packet holds fewer than `W` elements if
+         *            `size()` isn't a multiple of `W`; see
+         *            `soa_packet::count()` and `soa_packet::mask()`.
+         *
+         * \tparam W  The number of elements per packet.
+         * \tparam F  The type of `f`.
+         *
+         * \param f   The function to call with each packet.
+         */
+        template<int W, typename F>
+        void for_each_packet(F&& f)
+        {
+            for (size_type i = 0; i < this->size_; i += W)
+            {
+                const auto remaining = this->size_ - i;
+                f(soa_packet<soa_vector<V>, W>(
+                    *this, i, remaining < W ? int(remaining) : W));
+            }
+        }
+
+        /*!
+         * \brief     Calls `f` with a read-only `soa_packet` for each group
+         *            of `W` consecutive elements, in order.
+         * \details   The last packet holds fewer than `W` elements if
+         *            `size()` isn't a multiple of `W`; see
+         *            `soa_packet::count()` and `soa_packet::mask()`.
+         *
+         * \tparam W  The number of elements per packet.
+         * \tparam F  The type of `f`.
+         *
+         * \param f   The function to call with each packet.
+         */
+        template<int W, typename F>
+        void for_each_packet(F&& f) const
+        {
+            for (size_type i = 0; i < this->size_; i += W)
+            {
+                const auto remaining = this->size_ - i;
+                f(soa_packet<const soa_vector<V>, W>(
+                    *this, i, remaining < W ? int(remaining) : W));
+            }
+        }
+
+        /*!@}*/
+        /*!
+         * \brief        Exchanges the elements of this `soa_vector` with
+         *               another's.
+         *
+         * \param other  The `soa_vector` to swap with.
+         */
+        void swap(soa_vector& other) noexcept
+        {
+            std::swap(this->allocation_, other.allocation_);
+            std::swap(this->streams_, other.streams_);
+            std::swap(this->size_, other.size_);
+            std::swap(this->capacity_, other.capacity_);
+        }
+    };
+
+    /*!
+     * \brief     A proxy for `W` consecutive elements of a `soa_vector` or
+     *            `aosoa`, as passed to their `for_each_packet()`.
+     *
+     * \tparam S  The `soa_vector` or `aosoa` type, `const`-qualified for
+     *            read-only packets.
+     * \tparam W  The number of elements.
+     */
+    template<typename S, int W>
+    class soa_packet
+    {
+        S* vector_;
+        std::size_t index_;
+        int count_;
+
+    public:
+        /*!
+         * \brief  The type that holds the elements, e.g.,
+         *         `vec3<simd<float, W>>`.
+         */
+        using packet_type =
+            typename std::remove_const_t<S>::template packet_type<W>;
+
+        /*!
+         * \brief  The component type of the elements.
+         */
+        using component_type =
+            typename std::remove_const_t<S>::component_type;
+
+        /*!
+         * \brief         Constructs a proxy for `count` elements starting at
+         *                `index`.
+         *
+         * \param vector  The container holding the elements.
+         * \param index   The index of the first element. Must be a multiple
+         *                of `W`.
+         * \param count   The number of elements, from `1` to `W`.
+         */
+        soa_packet(S& vector, std::size_t index, int count) noexcept
+        :
+            vector_(&vector),
+            index_(index),
+            count_(count)
+        {
+        }
+
+        /*!
+         * \brief   Returns the index of the first element.
+         *
+         * \return  The index of the first element.
+         */
+        std::size_t index() const noexcept
+        {
+            return this->index_;
+        }
+
+        /*!
+         * \brief   Returns the number of elements, which is less than `W`
+         *          only for the last packet of a container.
+         *
+         * \return  The number of elements.
+         */
+        int count() const noexcept
+        {
+            return this->count_;
+        }
+
+        /*!
+         * \brief   Determines which lanes of `packet_type` hold elements
+         *          rather than padding.
+         * \details Use this to leave the padding lanes of the last packet
+         *          out of reductions.
+         *
+         * \return  `true` for the first `count()` lanes and `false` for the
+         *          rest.
+         */
+        simd<sized_bool_t<sizeof(component_type)>, W> mask() const noexcept
+        {
+            using T = component_type;
+            alignas(simd<T, W>) T lanes[W];
+            for (int i = 0; i < W; ++i)
+            {
+                lanes[i] = static_cast<T>(i);
+            }
+            return math::less(
+                simd<T, W>::load(lanes),
+                simd<T, W>(static_cast<T>(this->count_)));
+        }
+
+        /*!
+         * \brief   Loads the elements.
+         * \details The lanes past `count()` hold padding with unspecified
+         *          values.
+         *
+         * \return  The elements.
+         */
+        packet_type load() const noexcept
+        {
+            return this->vector_->template load_packet<W>(this->index_);
+        }
+
+        /*!
+         * \brief         Stores `packet` over the elements.
+         * \details       Only available for non-`const` containers. The
+         *                lanes past `count()` are written to padding and
+         *                remain unobservable.
+         *
+         * \param packet  The new values of the elements.
+         */
+        void store(const packet_type& packet) const noexcept
+        {
+            this->vector_->template store_packet<W>(this->index_, packet);
+        }
+    };
+
+    /*!@}*/
+}
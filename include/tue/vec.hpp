@@ -1947,6 +1947,90 @@ namespace tue
             tue::detail_::sincos_v(v, sin_out, cos_out);
         }
 
+        /*!
+         * \brief     Computes `tue::math::tan()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::tan()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> tan(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::tan_v(v);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::asin()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::asin()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> asin(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::asin_v(v);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::acos()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::acos()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> acos(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::acos_v(v);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::atan()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::atan()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> atan(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::atan_v(v);
+        }
+
+        /*!
+         * \brief            Computes `tue::math::atan2()` for each component of
+         *                   `y` and each corresponding component of `x`.
+         *
+         * \tparam T         The component type of both `y` and `x`.
+         * \tparam N         The component count of both `y` and `x`.
+         *
+         * \param y          The y-coordinates.
+         * \param x          The x-coordinates.
+         *
+         * \return           `tue::math::atan2()` for each component of `y`
+         *                   and each corresponding component of `x`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> atan2(
+            const vec<T, N>& y, const vec<T, N>& x) noexcept
+        {
+            return tue::detail_::atan2_vv(y, x);
+        }
+
         /*!
          * \brief     Computes `tue::math::exp()` for each component of `v`.
          *
@@ -1963,6 +2047,22 @@ namespace tue
             return tue::detail_::exp_v(v);
         }
 
+        /*!
+         * \brief     Computes `tue::math::exp2()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::exp2()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> exp2(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::exp2_v(v);
+        }
+
         /*!
          * \brief     Computes `tue::math::log()` for each component of `v`.
          *
@@ -1979,6 +2079,38 @@ namespace tue
             return tue::detail_::log_v(v);
         }
 
+        /*!
+         * \brief     Computes `tue::math::log2()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::log2()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> log2(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::log2_v(v);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::log10()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::log10()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> log10(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::log10_v(v);
+        }
+
         /*!
          * \brief     Computes `tue::math::abs()` for each component of `v`.
          *
@@ -2049,6 +2181,22 @@ namespace tue
             return tue::detail_::sqrt_v(v);
         }
 
+        /*!
+         * \brief     Computes `tue::math::cbrt()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::cbrt()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> cbrt(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::cbrt_v(v);
+        }
+
         /*!
          * \brief     Computes `tue::math::rsqrt()` for each component of `v`.
          *
@@ -2065,6 +2213,130 @@ namespace tue
             return tue::detail_::rsqrt_v(v);
         }
 
+        /*!
+         * \brief     Computes `tue::math::fma()` for each corresponding trio
+         *            of components from `v1`, `v2`, and `v3`.
+         *
+         * \tparam T  The component type of all three parameters.
+         * \tparam N  The component count of all three parameters.
+         *
+         * \param v1  A `vec`.
+         * \param v2  Another `vec`.
+         * \param v3  Another `vec`.
+         *
+         * \return    `tue::math::fma()` for each corresponding trio of
+         *            components from `v1`, `v2`, and `v3`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> fma(
+            const vec<T, N>& v1,
+            const vec<T, N>& v2,
+            const vec<T, N>& v3) noexcept
+        {
+            return tue::detail_::fma_vvv(v1, v2, v3);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::floor()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::floor()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> floor(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::floor_v(v);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::ceil()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::ceil()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> ceil(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::ceil_v(v);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::round()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::round()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> round(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::round_v(v);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::trunc()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::trunc()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> trunc(const vec<T, N>& v) noexcept
+        {
+            return tue::detail_::trunc_v(v);
+        }
+
+        /*!
+         * \brief     Computes `tue::math::fract()` for each component of `v`.
+         *
+         * \tparam T  The component type of `v`.
+         * \tparam N  The component count of `v`.
+         *
+         * \param v   A `vec`.
+         *
+         * \return    `tue::math::fract()` for each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> fract(const vec<T, N>& v) noexcept
+        {
+            return v - tue::detail_::floor_v(v);
+        }
+
+        /*!
+         * \brief               Computes `tue::math::modf()` for each
+         *                      component of `v`.
+         *
+         * \tparam T            The component type of `v`.
+         * \tparam N            The component count of `v`.
+         *
+         * \param v             A `vec`.
+         * \param integral_out  Where to store `tue::math::trunc()` of `v`.
+         *
+         * \return              The fractional part of each component of `v`.
+         */
+        template<typename T, int N>
+        inline vec<T, N> modf(
+            const vec<T, N>& v,
+            vec<T, N>& integral_out) noexcept
+        {
+            integral_out = tue::detail_::trunc_v(v);
+            return v - integral_out;
+        }
+
         /*!
          * \brief     Computes `tue::math::min()` for each corresponding pair of
          *            components from `v1` and `v2`.
@@ -2329,9 +2601,9 @@ namespace tue
         cross(const vec3<T>& lhs, const vec3<U>& rhs) noexcept
         {
             return {
-                lhs[1]*rhs[2] - lhs[2]*rhs[1],
-                lhs[2]*rhs[0] - lhs[0]*rhs[2],
-                lhs[0]*rhs[1] - lhs[1]*rhs[0],
+                tue::detail_::madd(lhs[1], rhs[2], -(lhs[2]*rhs[1])),
+                tue::detail_::madd(lhs[2], rhs[0], -(lhs[0]*rhs[2])),
+                tue::detail_::madd(lhs[0], rhs[1], -(lhs[1]*rhs[0])),
             };
         }
 
@@ -2403,6 +2675,310 @@ namespace tue
             return v * tue::math::rlength(v);
         }
 
+        namespace fast
+        {
+            /*!
+             * \brief     Computes `tue::math::fast::sin()` for each component
+             *            of `v`.
+             *
+             * \tparam T  The component type of `v`.
+             * \tparam N  The component count of `v`.
+             *
+             * \param v   A `vec`.
+             *
+             * \return    `tue::math::fast::sin()` for each component of `v`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> sin(const vec<T, N>& v) noexcept
+            {
+                return tue::detail_::fast_sin_v(v);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::cos()` for each component
+             *            of `v`.
+             *
+             * \tparam T  The component type of `v`.
+             * \tparam N  The component count of `v`.
+             *
+             * \param v   A `vec`.
+             *
+             * \return    `tue::math::fast::cos()` for each component of `v`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> cos(const vec<T, N>& v) noexcept
+            {
+                return tue::detail_::fast_cos_v(v);
+            }
+
+            /*!
+             * \brief          Computes `tue::math::fast::sincos()` for each
+             *                 component of `v`.
+             *
+             * \tparam T       The component type of `v`.
+             * \tparam N       The component count of `v`.
+             *
+             * \param v        A `vec`.
+             * \param sin_out  A reference to the `vec` to store the `sin()`
+             *                 results in.
+             * \param cos_out  A reference to the `vec` to store the `cos()`
+             *                 results in.
+             */
+            template<typename T, int N>
+            inline void sincos(
+                const vec<T, N>& v,
+                vec<T, N>& sin_out,
+                vec<T, N>& cos_out) noexcept
+            {
+                tue::detail_::fast_sincos_v(v, sin_out, cos_out);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::exp()` for each component
+             *            of `v`.
+             *
+             * \tparam T  The component type of `v`.
+             * \tparam N  The component count of `v`.
+             *
+             * \param v   A `vec`.
+             *
+             * \return    `tue::math::fast::exp()` for each component of `v`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> exp(const vec<T, N>& v) noexcept
+            {
+                return tue::detail_::fast_exp_v(v);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::log()` for each component
+             *            of `v`.
+             *
+             * \tparam T  The component type of `v`.
+             * \tparam N  The component count of `v`.
+             *
+             * \param v   A `vec`.
+             *
+             * \return    `tue::math::fast::log()` for each component of `v`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> log(const vec<T, N>& v) noexcept
+            {
+                return tue::detail_::fast_log_v(v);
+            }
+
+            /*!
+             * \brief            Computes `tue::math::fast::pow()` for each
+             *                   component of `bases` and each corresponding
+             *                   component of `exponents`.
+             *
+             * \tparam T         The component type of both `bases` and
+             *                   `exponents`.
+             * \tparam N         The component count of both `bases` and
+             *                   `exponents`.
+             *
+             * \param bases      The bases.
+             * \param exponents  The exponents.
+             *
+             * \return           `tue::math::fast::pow()` for each component of
+             *                   `bases` and each corresponding component of
+             *                   `exponents`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> pow(
+                const vec<T, N>& bases, const vec<T, N>& exponents) noexcept
+            {
+                return tue::detail_::fast_pow_vv(bases, exponents);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::recip()` for each component
+             *            of `v`.
+             *
+             * \tparam T  The component type of `v`.
+             * \tparam N  The component count of `v`.
+             *
+             * \param v   A `vec`.
+             *
+             * \return    `tue::math::fast::recip()` for each component of `v`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> recip(const vec<T, N>& v) noexcept
+            {
+                return tue::detail_::fast_recip_v(v);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::fast::rsqrt()` for each component
+             *            of `v`.
+             *
+             * \tparam T  The component type of `v`.
+             * \tparam N  The component count of `v`.
+             *
+             * \param v   A `vec`.
+             *
+             * \return    `tue::math::fast::rsqrt()` for each component of `v`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> rsqrt(const vec<T, N>& v) noexcept
+            {
+                return tue::detail_::fast_rsqrt_v(v);
+            }
+        }
+
+        namespace precise
+        {
+            /*!
+             * \brief     Computes `tue::math::precise::sin()` for each
+             *            component of `v`.
+             *
+             * \tparam T  The component type of `v`.
+             * \tparam N  The component count of `v`.
+             *
+             * \param v   A `vec`.
+             *
+             * \return    `tue::math::precise::sin()` for each component of `v`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> sin(const vec<T, N>& v) noexcept
+            {
+                return tue::detail_::precise_sin_v(v);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::cos()` for each
+             *            component of `v`.
+             *
+             * \tparam T  The component type of `v`.
+             * \tparam N  The component count of `v`.
+             *
+             * \param v   A `vec`.
+             *
+             * \return    `tue::math::precise::cos()` for each component of `v`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> cos(const vec<T, N>& v) noexcept
+            {
+                return tue::detail_::precise_cos_v(v);
+            }
+
+            /*!
+             * \brief          Computes `tue::math::precise::sincos()` for each
+             *                 component of `v`.
+             *
+             * \tparam T       The component type of `v`.
+             * \tparam N       The component count of `v`.
+             *
+             * \param v        A `vec`.
+             * \param sin_out  A reference to the `vec` to store the `sin()`
+             *                 results in.
+             * \param cos_out  A reference to the `vec` to store the `cos()`
+             *                 results in.
+             */
+            template<typename T, int N>
+            inline void sincos(
+                const vec<T, N>& v,
+                vec<T, N>& sin_out,
+                vec<T, N>& cos_out) noexcept
+            {
+                tue::detail_::precise_sincos_v(v, sin_out, cos_out);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::exp()` for each
+             *            component of `v`.
+             *
+             * \tparam T  The component type of `v`.
+             * \tparam N  The component count of `v`.
+             *
+             * \param v   A `vec`.
+             *
+             * \return    `tue::math::precise::exp()` for each component of `v`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> exp(const vec<T, N>& v) noexcept
+            {
+                return tue::detail_::precise_exp_v(v);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::log()` for each
+             *            component of `v`.
+             *
+             * \tparam T  The component type of `v`.
+             * \tparam N  The component count of `v`.
+             *
+             * \param v   A `vec`.
+             *
+             * \return    `tue::math::precise::log()` for each component of `v`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> log(const vec<T, N>& v) noexcept
+            {
+                return tue::detail_::precise_log_v(v);
+            }
+
+            /*!
+             * \brief            Computes `tue::math::precise::pow()` for each
+             *                   component of `bases` and each corresponding
+             *                   component of `exponents`.
+             *
+             * \tparam T         The component type of both `bases` and
+             *                   `exponents`.
+             * \tparam N         The component count of both `bases` and
+             *                   `exponents`.
+             *
+             * \param bases      The bases.
+             * \param exponents  The exponents.
+             *
+             * \return           `tue::math::precise::pow()` for each component
+             *                   of `bases` and each corresponding component of
+             *                   `exponents`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> pow(
+                const vec<T, N>& bases, const vec<T, N>& exponents) noexcept
+            {
+                return tue::detail_::precise_pow_vv(bases, exponents);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::recip()` for each
+             *            component of `v`.
+             *
+             * \tparam T  The component type of `v`.
+             * \tparam N  The component count of `v`.
+             *
+             * \param v   A `vec`.
+             *
+             * \return    `tue::math::precise::recip()` for each component of
+             *            `v`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> recip(const vec<T, N>& v) noexcept
+            {
+                return tue::detail_::precise_recip_v(v);
+            }
+
+            /*!
+             * \brief     Computes `tue::math::precise::rsqrt()` for each
+             *            component of `v`.
+             *
+             * \tparam T  The component type of `v`.
+             * \tparam N  The component count of `v`.
+             *
+             * \param v   A `vec`.
+             *
+             * \return    `tue::math::precise::rsqrt()` for each component of
+             *            `v`.
+             */
+            template<typename T, int N>
+            inline vec<T, N> rsqrt(const vec<T, N>& v) noexcept
+            {
+                return tue::detail_::precise_rsqrt_v(v);
+            }
+        }
+
         /*!@}*/
     }
 }
@@ -0,0 +1,338 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/simd.hpp>
+#include "tue.tests.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tue/math.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    /*
+     * Measures the maximum error, in units in the last place (ulp), of each
+     * accuracy tier of each floating-point simd function over a sweep of
+     * inputs. The bounds asserted below are the measured maxima rounded up,
+     * so they double as a table for picking the cheapest tier that's
+     * accurate enough.
+     */
+
+    // The distance from `actual` to `expected`, measured in ulp of `T` at
+    // `expected`.
+    template<typename T>
+    long double ulp_error(T actual, long double expected) noexcept
+    {
+        if (std::isnan(actual) || std::isnan(expected))
+        {
+            return std::isnan(actual) && std::isnan(expected)
+                ? 0.0L : std::numeric_limits<long double>::infinity();
+        }
+
+        const T rounded = static_cast<T>(expected);
+        if (std::isinf(rounded))
+        {
+            return actual == rounded
+                ? 0.0L : std::numeric_limits<long double>::infinity();
+        }
+
+        const int exponent = std::max(
+            rounded == 0 ? std::numeric_limits<T>::min_exponent
+                         : std::ilogb(rounded),
+            std::numeric_limits<T>::min_exponent - 1);
+        const long double ulp = std::ldexp(
+            1.0L, exponent - (std::numeric_limits<T>::digits - 1));
+        return std::abs(static_cast<long double>(actual) - expected) / ulp;
+    }
+
+    // Evenly spaced inputs from `lo` to `hi`.
+    struct linear
+    {
+        long double lo, hi;
+
+        long double operator()(long double t) const noexcept
+        {
+            return lo + (hi - lo) * t;
+        }
+    };
+
+    // Inputs from `lo` to `hi` (both positive) with evenly spaced logarithms.
+    struct geometric
+    {
+        long double lo, hi;
+
+        long double operator()(long double t) const noexcept
+        {
+            return lo * std::pow(hi / lo, t);
+        }
+    };
+
+    constexpr int sample_count = 1 << 14;
+
+    template<typename S, typename F, typename R, typename G>
+    long double max_ulp_error(F f, R reference, G inputs) noexcept
+    {
+        using T = typename S::component_type;
+        constexpr int N = S::component_count;
+
+        long double result = 0.0L;
+        for (int i = 0; i < sample_count; i += N)
+        {
+            alignas(S) T in[N];
+            alignas(S) T out[N];
+            for (int j = 0; j < N; ++j)
+            {
+                in[j] = static_cast<T>(
+                    inputs((i + j) / (sample_count - 1.0L)));
+            }
+
+            f(S::load(in)).store(out);
+            for (int j = 0; j < N; ++j)
+            {
+                result = std::max(result, ulp_error(
+                    out[j], reference(static_cast<long double>(in[j]))));
+            }
+        }
+        return result;
+    }
+
+    // Like the above, but pairs each base with an exponent from a second
+    // sweep that's out of step with the first.
+    template<typename S, typename F, typename R, typename G, typename H>
+    long double max_ulp_error(
+        F f, R reference, G bases, H exponents) noexcept
+    {
+        using T = typename S::component_type;
+        constexpr int N = S::component_count;
+
+        long double result = 0.0L;
+        for (int i = 0; i < sample_count; i += N)
+        {
+            alignas(S) T b[N];
+            alignas(S) T e[N];
+            alignas(S) T out[N];
+            for (int j = 0; j < N; ++j)
+            {
+                const long double t = (i + j) / (sample_count - 1.0L);
+                const long double u = t * 61.803398875L;
+                b[j] = static_cast<T>(bases(t));
+                e[j] = static_cast<T>(exponents(u - std::floor(u)));
+            }
+
+            f(S::load(b), S::load(e)).store(out);
+            for (int j = 0; j < N; ++j)
+            {
+                result = std::max(result, ulp_error(out[j], reference(
+                    static_cast<long double>(b[j]),
+                    static_cast<long double>(e[j]))));
+            }
+        }
+        return result;
+    }
+
+    // The maximum errors of one function for one type, in the order fast,
+    // default, precise.
+    struct bounds
+    {
+        long double fast, normal, precise;
+    };
+
+    bool within(long double error, long double bound) noexcept
+    {
+        return error <= bound;
+    }
+
+    template<typename S, typename G>
+    void test_sin(const bounds& b, G in)
+    {
+        const auto ref = [](long double x) { return std::sin(x); };
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::fast::sin(s); }, ref, in),
+            b.fast));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::sin(s); }, ref, in),
+            b.normal));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::precise::sin(s); }, ref, in),
+            b.precise));
+    }
+
+    template<typename S, typename G>
+    void test_cos(const bounds& b, G in)
+    {
+        const auto ref = [](long double x) { return std::cos(x); };
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::fast::cos(s); }, ref, in),
+            b.fast));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::cos(s); }, ref, in),
+            b.normal));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::precise::cos(s); }, ref, in),
+            b.precise));
+    }
+
+    template<typename S>
+    void test_exp(const bounds& b, long double lo, long double hi)
+    {
+        const auto ref = [](long double x) { return std::exp(x); };
+        const linear in = { lo, hi };
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::fast::exp(s); }, ref, in),
+            b.fast));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::exp(s); }, ref, in),
+            b.normal));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::precise::exp(s); }, ref, in),
+            b.precise));
+    }
+
+    template<typename S>
+    void test_log(const bounds& b, long double lo, long double hi)
+    {
+        const auto ref = [](long double x) { return std::log(x); };
+        const geometric in = { lo, hi };
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::fast::log(s); }, ref, in),
+            b.fast));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::log(s); }, ref, in),
+            b.normal));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::precise::log(s); }, ref, in),
+            b.precise));
+    }
+
+    template<typename S>
+    void test_pow(const bounds& b)
+    {
+        const auto ref = [](long double x, long double y)
+        {
+            return std::pow(x, y);
+        };
+        const geometric bases = { 0.01L, 100.0L };
+        const linear exponents = { -8.0L, 8.0L };
+        test_assert(within(max_ulp_error<S>(
+            [](const S& x, const S& y) { return math::fast::pow(x, y); },
+            ref, bases, exponents), b.fast));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& x, const S& y) { return math::pow(x, y); },
+            ref, bases, exponents), b.normal));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& x, const S& y) { return math::precise::pow(x, y); },
+            ref, bases, exponents), b.precise));
+    }
+
+    template<typename S>
+    void test_recip(const bounds& b)
+    {
+        const auto ref = [](long double x) { return 1.0L / x; };
+        const geometric in = { 1.0e-6L, 1.0e6L };
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::fast::recip(s); }, ref, in),
+            b.fast));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::recip(s); }, ref, in),
+            b.normal));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::precise::recip(s); }, ref, in),
+            b.precise));
+    }
+
+    template<typename S>
+    void test_rsqrt(const bounds& b)
+    {
+        const auto ref = [](long double x) { return 1.0L / std::sqrt(x); };
+        const geometric in = { 1.0e-6L, 1.0e6L };
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::fast::rsqrt(s); }, ref, in),
+            b.fast));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::rsqrt(s); }, ref, in),
+            b.normal));
+        test_assert(within(max_ulp_error<S>(
+            [](const S& s) { return math::precise::rsqrt(s); }, ref, in),
+            b.precise));
+    }
+
+    TEST_CASE(sin)
+    {
+        const linear small = { -10.0L, 10.0L };
+        test_sin<float32x4>({ 32, 2, 1 }, small);
+        test_sin<float32x8>({ 32, 2, 1 }, small);
+        test_sin<float64x2>({ 64.0e6, 2, 2 }, small);
+        test_sin<float64x4>({ 64.0e6, 2, 2 }, small);
+
+        // The double precision kernels hand arguments above 2^30 to the C
+        // library, so sweep well past that too.
+        const geometric large = { 10.0L, 1.0e15L };
+        test_sin<float64x2>({ 64.0e6, 2, 2 }, large);
+        test_sin<float64x4>({ 64.0e6, 2, 2 }, large);
+    }
+
+    TEST_CASE(cos)
+    {
+        const linear small = { -10.0L, 10.0L };
+        test_cos<float32x4>({ 32, 2, 1 }, small);
+        test_cos<float32x8>({ 32, 2, 1 }, small);
+        test_cos<float64x2>({ 64.0e6, 2, 2 }, small);
+        test_cos<float64x4>({ 64.0e6, 2, 2 }, small);
+
+        // The double precision kernels hand arguments above 2^30 to the C
+        // library, so sweep well past that too.
+        const geometric large = { 10.0L, 1.0e15L };
+        test_cos<float64x2>({ 64.0e6, 2, 2 }, large);
+        test_cos<float64x4>({ 64.0e6, 2, 2 }, large);
+    }
+
+    TEST_CASE(exp)
+    {
+        test_exp<float32x4>({ 96, 1, 1 }, -87.0L, 88.0L);
+        test_exp<float32x8>({ 96, 1, 1 }, -87.0L, 88.0L);
+        test_exp<float64x2>({ 32.0e6, 1, 1 }, -708.0L, 709.0L);
+        test_exp<float64x4>({ 32.0e6, 1, 1 }, -708.0L, 709.0L);
+    }
+
+    TEST_CASE(log)
+    {
+        test_log<float32x4>({ 256, 1, 1 }, 1.0e-30L, 1.0e30L);
+        test_log<float32x8>({ 256, 1, 1 }, 1.0e-30L, 1.0e30L);
+        test_log<float64x2>({ 8.0e6, 1, 1 }, 1.0e-300L, 1.0e300L);
+        test_log<float64x4>({ 8.0e6, 1, 1 }, 1.0e-300L, 1.0e300L);
+    }
+
+    TEST_CASE(pow)
+    {
+        test_pow<float32x4>({ 640, 48, 1 });
+        test_pow<float32x8>({ 640, 48, 1 });
+        test_pow<float64x2>({ 48.0e6, 64, 1 });
+        test_pow<float64x4>({ 48.0e6, 64, 1 });
+    }
+
+    // The default float tiers measure about 2.2 (recip) and 2.6 (rsqrt)
+    // ulp without FMA, and about 1.8 and 2.9 ulp with it.
+    TEST_CASE(recip)
+    {
+        test_recip<float32x4>({ 5120, 3, 1 });
+        test_recip<float32x8>({ 5120, 3, 1 });
+        test_recip<float64x2>({ 1, 1, 1 });
+        test_recip<float64x4>({ 1, 1, 1 });
+    }
+
+    TEST_CASE(rsqrt)
+    {
+        test_rsqrt<float32x4>({ 5120, 3, 1.5 });
+        test_rsqrt<float32x8>({ 5120, 3, 1.5 });
+        test_rsqrt<float64x2>({ 1.5, 1.5, 1.5 });
+        test_rsqrt<float64x4>({ 1.5, 1.5, 1.5 });
+    }
+}
@@ -0,0 +1,176 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/aosoa.hpp>
+#include "tue.tests.hpp"
+
+#include <cstdint>
+#include <utility>
+
+#include <tue/mat.hpp>
+#include <tue/quat.hpp>
+#include <tue/simd.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    TEST_CASE(default_width)
+    {
+        constexpr int width = float32x8::is_accelerated ? 8
+            : float32x4::is_accelerated ? 4 : 2;
+        test_assert(aosoa<fvec3>::block_width == width);
+        test_assert((aosoa<fvec3, 8>::block_size == 24));
+    }
+
+    TEST_CASE(constructors)
+    {
+        const aosoa<fvec3, 4> a;
+        test_assert(a.size() == 0);
+        test_assert(a.capacity() == 0);
+        test_assert(a.empty());
+
+        const aosoa<fvec3, 4> b(5);
+        test_assert(b.size() == 5);
+        test_assert(b.capacity() == 8);
+        test_assert(b[4] == fvec3(0.0f));
+
+        const aosoa<fvec3, 4> c(3, fvec3(1.0f, 2.0f, 3.0f));
+        test_assert(c.size() == 3);
+        test_assert(c[2] == fvec3(1.0f, 2.0f, 3.0f));
+    }
+
+    TEST_CASE(block_layout)
+    {
+        aosoa<ivec2, 4> a;
+        for (int i = 0; i < 6; ++i)
+        {
+            a.push_back(ivec2(i, i + 10));
+        }
+
+        const int expected[] = {
+            0, 1, 2, 3, 10, 11, 12, 13,
+            4, 5, 0, 0, 14, 15, 0, 0,
+        };
+        for (int i = 0; i < 16; ++i)
+        {
+            test_assert(a.data()[i] == expected[i]);
+        }
+        test_assert(
+            reinterpret_cast<std::uintptr_t>(a.data())
+                % alignof(simd<int, 4>) == 0);
+    }
+
+    TEST_CASE(element_proxies)
+    {
+        aosoa<fvec3, 4> a(6);
+        a[5] = fvec3(1.0f, 2.0f, 3.0f);
+        a[1] = a[5];
+        a[2][1] = 7.0f;
+
+        const fvec3 v = a[1];
+        test_assert(v == fvec3(1.0f, 2.0f, 3.0f));
+        test_assert(a.get(2) == fvec3(0.0f, 7.0f, 0.0f));
+        test_assert(a[0][2] == 0.0f);
+
+        a.set(0, fvec3(4.0f));
+        test_assert(a.get(0) == fvec3(4.0f));
+        a.pop_back();
+        test_assert(a.size() == 5);
+    }
+
+    TEST_CASE(copy_and_move)
+    {
+        aosoa<dvec3, 2> a;
+        for (int i = 0; i < 9; ++i)
+        {
+            a.push_back(dvec3(double(i)));
+        }
+
+        aosoa<dvec3, 2> copy(a);
+        test_assert(copy.size() == 9);
+        test_assert(copy.data() != a.data());
+        test_assert(copy.get(8) == dvec3(8.0));
+
+        const auto data = a.data();
+        aosoa<dvec3, 2> moved(std::move(a));
+        test_assert(moved.data() == data);
+        test_assert(a.size() == 0);
+
+        copy = moved;
+        test_assert(copy.get(4) == dvec3(4.0));
+        copy = std::move(moved);
+        test_assert(copy.data() == data);
+    }
+
+    TEST_CASE(packets)
+    {
+        using S = simd<float, 4>;
+        aosoa<fvec2, 8> a(11);
+        const auto p = vec2<S>(S(1.0f, 2.0f, 3.0f, 4.0f), S(5.0f));
+        a.store_packet<4>(4, p);
+        test_assert(a.get(3) == fvec2(0.0f));
+        test_assert(a.get(6) == fvec2(3.0f, 5.0f));
+        test_assert(a.load_packet<4>(4) == p);
+        test_assert(a.load_packet(0)[0].data()[5] == 2.0f);
+    }
+
+    TEST_CASE(for_each_packet)
+    {
+        aosoa<fvec3, 8> a;
+        for (int i = 0; i < 21; ++i)
+        {
+            a.push_back(fvec3(float(i), 1.0f, 2.0f));
+        }
+
+        int packets = 0;
+        a.for_each_packet([&](const auto& p)
+        {
+            test_assert(p.index() == std::size_t(packets * 8));
+            test_assert(p.count() == (packets < 2 ? 8 : 5));
+            p.store(p.load() * simd<float, 8>(2.0f));
+            ++packets;
+        });
+        test_assert(packets == 3);
+
+        for (int i = 0; i < 21; ++i)
+        {
+            test_assert(a.get(i) == fvec3(float(i * 2), 2.0f, 4.0f));
+        }
+
+        const auto& ca = a;
+        std::uint8_t last = 0;
+        ca.for_each_packet<4>([&](const auto& p)
+        {
+            last = math::movemask(p.mask());
+        });
+        test_assert(last == 0x1);
+    }
+
+    TEST_CASE(quat_and_mat)
+    {
+        aosoa<fquat, 4> q(5, fquat(1.0f, 2.0f, 3.0f, 4.0f));
+        q.for_each_packet([](const auto& p)
+        {
+            p.store(math::conjugate(p.load()));
+        });
+        test_assert(q.get(4) == fquat(-1.0f, -2.0f, -3.0f, 4.0f));
+
+        const auto m = fmat2x3(
+            fvec3(1.0f, 2.0f, 3.0f), fvec3(4.0f, 5.0f, 6.0f));
+        aosoa<fmat2x3, 4> ms(3, m);
+        test_assert(ms.block_size == 24);
+        test_assert(ms.data()[4 * 4 + 1] == 5.0f);
+        ms.for_each_packet([](const auto& p)
+        {
+            p.store(p.load() * simd<float, 4>(2.0f));
+        });
+        test_assert(ms.get(2) == m * 2.0f);
+    }
+}
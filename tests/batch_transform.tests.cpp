@@ -0,0 +1,355 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/batch_transform.hpp>
+#include "tue.tests.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include <tue/cpu_features.hpp>
+#include <tue/mat.hpp>
+#include <tue/parallel_for.hpp>
+#include <tue/soa_vector.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    // Small integer components and power-of-two scales keep every result
+    // exact whether or not the multiplies and adds are fused.
+    template<typename T>
+    vec3<T> point(std::size_t i)
+    {
+        return {
+            T(int(i % 7) - 3),
+            T(int(i % 5) - 2),
+            T(int(i % 11) - 5),
+        };
+    }
+
+    template<typename T>
+    mat4x4<T> affine()
+    {
+        return {
+            { T(0), T(2), T(0), T(0) },
+            { T(-4), T(0), T(0), T(0) },
+            { T(1), T(0), T(8), T(0) },
+            { T(3), T(-5), T(7), T(1) },
+        };
+    }
+
+    template<typename T>
+    mat4x4<T> projection()
+    {
+        return {
+            { T(2), T(0), T(0), T(1) },
+            { T(0), T(4), T(0), T(0) },
+            { T(0), T(0), T(-1), T(2) },
+            { T(1), T(3), T(-2), T(16) },
+        };
+    }
+
+    template<typename T>
+    vec3<T> expected_point(const mat4x4<T>& m, const vec3<T>& p)
+    {
+        return vec3<T>(m * vec4<T>(p, T(1)));
+    }
+
+    template<typename T>
+    vec3<T> expected_projection(const mat4x4<T>& m, const vec3<T>& p)
+    {
+        const vec4<T> r = m * vec4<T>(p, T(1));
+        return { r[0] / r[3], r[1] / r[3], r[2] / r[3] };
+    }
+
+    // Checks counts around every batch width so that the tails get
+    // covered, both out of place and in place.
+    template<typename T, typename F, typename E>
+    void test_aos(F transform, const mat4x4<T>& m, E expected)
+    {
+        for (std::size_t count = 0; count < 40; ++count)
+        {
+            std::vector<vec3<T>> in(count + 1);
+            for (std::size_t i = 0; i < in.size(); ++i)
+            {
+                in[i] = point<T>(i);
+            }
+
+            std::vector<vec3<T>> out(count + 1, vec3<T>(T(99)));
+            transform(m, in.data() + 1, out.data() + 1, count);
+            test_assert(out[0] == vec3<T>(T(99)));
+            for (std::size_t i = 1; i <= count; ++i)
+            {
+                test_assert(out[i] == expected(m, in[i]));
+            }
+
+            transform(m, in.data(), in.data(), count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                test_assert(in[i] == expected(m, point<T>(i)));
+            }
+        }
+    }
+
+    template<typename T, typename F, typename E>
+    void test_soa(F transform, const mat4x4<T>& m, E expected)
+    {
+        for (std::size_t count = 0; count < 40; ++count)
+        {
+            soa_vector<vec3<T>> in;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                in.push_back(point<T>(i));
+            }
+
+            soa_vector<vec3<T>> out(3);
+            transform(m, in, out);
+            test_assert(out.size() == count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                test_assert(out.get(i) == expected(m, in.get(i)));
+            }
+
+            transform(m, in, in);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                test_assert(in.get(i) == expected(m, point<T>(i)));
+            }
+        }
+    }
+
+    template<typename T>
+    void test_points()
+    {
+        const auto aos = [](
+            const mat4x4<T>& m, const vec3<T>* in, vec3<T>* out,
+            std::size_t count)
+        {
+            transform_points(m, in, out, count);
+        };
+        const auto soa = [](
+            const mat4x4<T>& m,
+            const soa_vector<vec3<T>>& in,
+            soa_vector<vec3<T>>& out)
+        {
+            transform_points(m, in, out);
+        };
+        test_aos<T>(aos, affine<T>(), expected_point<T>);
+        test_soa<T>(soa, affine<T>(), expected_point<T>);
+    }
+
+    template<typename T>
+    void test_vectors()
+    {
+        const auto expected = [](const mat4x4<T>& m, const vec3<T>& v)
+        {
+            return vec3<T>(m * vec4<T>(v, T(0)));
+        };
+        const auto aos = [](
+            const mat4x4<T>& m, const vec3<T>* in, vec3<T>* out,
+            std::size_t count)
+        {
+            transform_vectors(m, in, out, count);
+        };
+        const auto soa = [](
+            const mat4x4<T>& m,
+            const soa_vector<vec3<T>>& in,
+            soa_vector<vec3<T>>& out)
+        {
+            transform_vectors(m, in, out);
+        };
+        test_aos<T>(aos, affine<T>(), expected);
+        test_soa<T>(soa, affine<T>(), expected);
+    }
+
+    template<typename T>
+    void test_normals()
+    {
+        // The inverse-transpose of the upper-left 3x3 of affine().
+        const auto expected = [](const mat4x4<T>&, const vec3<T>& n)
+        {
+            const mat3x3<T> it(
+                { T(0), T(0.5), T(0) },
+                { T(-0.25), T(0), T(0.03125) },
+                { T(0), T(0), T(0.125) });
+            return it * n;
+        };
+        const auto aos = [](
+            const mat4x4<T>& m, const vec3<T>* in, vec3<T>* out,
+            std::size_t count)
+        {
+            transform_normals(m, in, out, count);
+        };
+        const auto soa = [](
+            const mat4x4<T>& m,
+            const soa_vector<vec3<T>>& in,
+            soa_vector<vec3<T>>& out)
+        {
+            transform_normals(m, in, out);
+        };
+        test_aos<T>(aos, affine<T>(), expected);
+        test_soa<T>(soa, affine<T>(), expected);
+    }
+
+    template<typename T>
+    void test_projection()
+    {
+        const auto aos = [](
+            const mat4x4<T>& m, const vec3<T>* in, vec3<T>* out,
+            std::size_t count)
+        {
+            project_points(m, in, out, count);
+        };
+        const auto soa = [](
+            const mat4x4<T>& m,
+            const soa_vector<vec3<T>>& in,
+            soa_vector<vec3<T>>& out)
+        {
+            project_points(m, in, out);
+        };
+        test_aos<T>(aos, projection<T>(), expected_projection<T>);
+        test_soa<T>(soa, projection<T>(), expected_projection<T>);
+    }
+
+    TEST_CASE(transform_points)
+    {
+        test_points<float>();
+        test_points<double>();
+    }
+
+    TEST_CASE(transform_vectors)
+    {
+        test_vectors<float>();
+        test_vectors<double>();
+    }
+
+    TEST_CASE(transform_normals)
+    {
+        test_normals<float>();
+        test_normals<double>();
+    }
+
+    TEST_CASE(project_points)
+    {
+        test_projection<float>();
+        test_projection<double>();
+    }
+
+    // Runs every kernel the CPU supports directly, not just the one the
+    // functions above pick.
+    template<bool Projective>
+    void test_kernels()
+    {
+        using kernels =
+            tue::detail_::transform3_kernels<float, Projective, false>;
+        using soa_kernels =
+            tue::detail_::transform3_kernels<float, Projective, true>;
+        const auto matrix =
+            Projective ? projection<float>() : affine<float>();
+        const auto expected =
+            Projective ? expected_projection<float> : expected_point<float>;
+
+        for (int t = 0; t <= int(simd_target::avx2); ++t)
+        {
+            const auto target = simd_target(t);
+            if (target > best_simd_target())
+            {
+                break;
+            }
+
+            const auto aos = tue::select_kernel(kernels::get(), target);
+            test_aos<float>(
+                [aos](
+                    const fmat4x4& m, const fvec3* in, fvec3* out,
+                    std::size_t count)
+                {
+                    aos(m.data(), in->data(), 0, out->data(), 0, count,
+                        false);
+                },
+                matrix, expected);
+
+            const auto soa = tue::select_kernel(soa_kernels::get(), target);
+            for (const bool stream : { false, true })
+            {
+                test_soa<float>(
+                    [soa, stream](
+                        const fmat4x4& m,
+                        const soa_vector<fvec3>& in,
+                        soa_vector<fvec3>& out)
+                    {
+                        out.resize(in.size());
+                        soa(m.data(),
+                            in.stream(0), in.capacity(),
+                            out.stream(0), out.capacity(),
+                            in.size(), stream);
+                    },
+                    matrix, expected);
+            }
+        }
+    }
+
+    TEST_CASE(kernels)
+    {
+        test_kernels<false>();
+        test_kernels<true>();
+    }
+
+    // Runs `transform` with and without `pool` on enough elements to be
+    // split into several uneven chunks.
+    template<typename F>
+    void test_pool(thread_pool& pool, F transform, const fmat4x4& m)
+    {
+        const std::size_t count = 3 * 4096 + 13;
+
+        std::vector<fvec3> in(count);
+        soa_vector<fvec3> soa_in;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            in[i] = point<float>(i);
+            soa_in.push_back(in[i]);
+        }
+
+        std::vector<fvec3> expected(count);
+        transform(m, in.data(), expected.data(), count);
+
+        std::vector<fvec3> out(count);
+        transform(pool, m, in.data(), out.data(), count);
+        test_assert(out == expected);
+
+        soa_vector<fvec3> soa_out;
+        transform(pool, m, soa_in, soa_out);
+        test_assert(soa_out.size() == count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            test_assert(soa_out.get(i) == expected[i]);
+        }
+    }
+
+    TEST_CASE(thread_pool)
+    {
+        thread_pool pool(3);
+        test_pool(pool, [](auto&&... args)
+        {
+            transform_points(args...);
+        }, affine<float>());
+        test_pool(pool, [](auto&&... args)
+        {
+            transform_vectors(args...);
+        }, affine<float>());
+        test_pool(pool, [](auto&&... args)
+        {
+            transform_normals(args...);
+        }, affine<float>());
+        test_pool(pool, [](auto&&... args)
+        {
+            project_points(args...);
+        }, projection<float>());
+    }
+}
@@ -0,0 +1,73 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/cpu_features.hpp>
+#include "tue.tests.hpp"
+
+namespace
+{
+    using namespace tue;
+
+    int kernel_generic(int x) noexcept
+    {
+        return x + 1;
+    }
+
+    int kernel_sse2(int x) noexcept
+    {
+        return x + 2;
+    }
+
+    TUE_TARGET("avx2,fma")
+    int kernel_avx2(int x) noexcept
+    {
+        return x + 5;
+    }
+
+    TEST_CASE(cpu_features)
+    {
+        const auto& features = tue::cpu_features();
+        test_assert(&features == &tue::cpu_features());
+        test_assert(!features.sse2 || features.sse);
+        test_assert(!features.sse4_1 || features.sse2);
+        test_assert(!features.avx || features.sse4_1);
+        test_assert(!features.avx2 || features.avx);
+        test_assert(!features.fma || features.avx);
+    }
+
+    TEST_CASE(best_simd_target)
+    {
+        // This program couldn't be running if the CPU didn't support what
+        // it was compiled for.
+        test_assert(tue::best_simd_target() >= tue::compiled_simd_target());
+    }
+
+    TEST_CASE(select_kernel)
+    {
+        using F = int(*)(int);
+        const kernel_set<F> kernels = {
+            &kernel_generic, &kernel_sse2, nullptr, nullptr, &kernel_avx2,
+        };
+
+        test_assert(select_kernel(kernels, simd_target::generic)
+            == &kernel_generic);
+        test_assert(select_kernel(kernels, simd_target::sse2)
+            == &kernel_sse2);
+        test_assert(select_kernel(kernels, simd_target::sse4_1)
+            == &kernel_sse2);
+        test_assert(select_kernel(kernels, simd_target::avx)
+            == &kernel_sse2);
+        test_assert(select_kernel(kernels, simd_target::avx2)
+            == &kernel_avx2);
+
+        const auto kernel = select_kernel(kernels);
+        test_assert(kernel
+            == select_kernel(kernels, tue::best_simd_target()));
+        test_assert(kernel(1) > 1);
+    }
+}
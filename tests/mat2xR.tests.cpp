@@ -883,6 +883,43 @@ namespace
         test_assert(c[1] == math::cos(dm22[1]));
     }
 
+    TEST_CASE(tan)
+    {
+        const auto m = math::tan(dm22);
+        test_assert(m[0] == math::tan(dm22[0]));
+        test_assert(m[1] == math::tan(dm22[1]));
+    }
+
+    TEST_CASE(asin)
+    {
+        const auto m1 = dm22 / 8.0;
+        const auto m = math::asin(m1);
+        test_assert(m[0] == math::asin(m1[0]));
+        test_assert(m[1] == math::asin(m1[1]));
+    }
+
+    TEST_CASE(acos)
+    {
+        const auto m1 = dm22 / 8.0;
+        const auto m = math::acos(m1);
+        test_assert(m[0] == math::acos(m1[0]));
+        test_assert(m[1] == math::acos(m1[1]));
+    }
+
+    TEST_CASE(atan)
+    {
+        const auto m = math::atan(dm22);
+        test_assert(m[0] == math::atan(dm22[0]));
+        test_assert(m[1] == math::atan(dm22[1]));
+    }
+
+    TEST_CASE(atan2)
+    {
+        const auto m = math::atan2(dm22, dm222);
+        test_assert(m[0] == math::atan2(dm22[0], dm222[0]));
+        test_assert(m[1] == math::atan2(dm22[1], dm222[1]));
+    }
+
     TEST_CASE(exp)
     {
         const auto m = math::exp(dm22);
@@ -890,6 +927,13 @@ namespace
         test_assert(m[1] == math::exp(dm22[1]));
     }
 
+    TEST_CASE(exp2)
+    {
+        const auto m = math::exp2(dm22);
+        test_assert(m[0] == math::exp2(dm22[0]));
+        test_assert(m[1] == math::exp2(dm22[1]));
+    }
+
     TEST_CASE(log)
     {
         const auto m = math::log(dm22);
@@ -897,6 +941,20 @@ namespace
         test_assert(m[1] == math::log(dm22[1]));
     }
 
+    TEST_CASE(log2)
+    {
+        const auto m = math::log2(dm22);
+        test_assert(m[0] == math::log2(dm22[0]));
+        test_assert(m[1] == math::log2(dm22[1]));
+    }
+
+    TEST_CASE(log10)
+    {
+        const auto m = math::log10(dm22);
+        test_assert(m[0] == math::log10(dm22[0]));
+        test_assert(m[1] == math::log10(dm22[1]));
+    }
+
     TEST_CASE(abs)
     {
         const auto m = math::abs(dm222);
@@ -925,6 +983,13 @@ namespace
         test_assert(m[1] == math::sqrt(dm22[1]));
     }
 
+    TEST_CASE(cbrt)
+    {
+        const auto m = math::cbrt(dm22);
+        test_assert(m[0] == math::cbrt(dm22[0]));
+        test_assert(m[1] == math::cbrt(dm22[1]));
+    }
+
     TEST_CASE(rsqrt)
     {
         const auto m = math::rsqrt(dm22);
@@ -932,6 +997,182 @@ namespace
         test_assert(m[1] == math::rsqrt(dm22[1]));
     }
 
+    TEST_CASE(fma)
+    {
+        const auto m = math::fma(dm22, dm222, dm22);
+        test_assert(m[0] == math::fma(dm22[0], dm222[0], dm22[0]));
+        test_assert(m[1] == math::fma(dm22[1], dm222[1], dm22[1]));
+    }
+
+    TEST_CASE(floor)
+    {
+        const auto m = math::floor(dm22);
+        test_assert(m[0] == math::floor(dm22[0]));
+        test_assert(m[1] == math::floor(dm22[1]));
+    }
+
+    TEST_CASE(ceil)
+    {
+        const auto m = math::ceil(dm22);
+        test_assert(m[0] == math::ceil(dm22[0]));
+        test_assert(m[1] == math::ceil(dm22[1]));
+    }
+
+    TEST_CASE(round)
+    {
+        const auto m = math::round(dm22);
+        test_assert(m[0] == math::round(dm22[0]));
+        test_assert(m[1] == math::round(dm22[1]));
+    }
+
+    TEST_CASE(trunc)
+    {
+        const auto m = math::trunc(dm22);
+        test_assert(m[0] == math::trunc(dm22[0]));
+        test_assert(m[1] == math::trunc(dm22[1]));
+    }
+
+    TEST_CASE(fract)
+    {
+        const auto m = math::fract(dm22);
+        test_assert(m[0] == math::fract(dm22[0]));
+        test_assert(m[1] == math::fract(dm22[1]));
+    }
+
+    TEST_CASE(modf)
+    {
+        auto i = dm22;
+        const auto m = math::modf(dm22, i);
+        auto i0 = dm22[0];
+        test_assert(m[0] == math::modf(dm22[0], i0));
+        test_assert(i[0] == i0);
+        auto i1 = dm22[1];
+        test_assert(m[1] == math::modf(dm22[1], i1));
+        test_assert(i[1] == i1);
+    }
+
+    TEST_CASE(fast_sin)
+    {
+        const auto m = math::fast::sin(dm22);
+        test_assert(m[0] == math::fast::sin(dm22[0]));
+        test_assert(m[1] == math::fast::sin(dm22[1]));
+    }
+
+    TEST_CASE(fast_cos)
+    {
+        const auto m = math::fast::cos(dm22);
+        test_assert(m[0] == math::fast::cos(dm22[0]));
+        test_assert(m[1] == math::fast::cos(dm22[1]));
+    }
+
+    TEST_CASE(fast_sincos)
+    {
+        dmat2x2 s, c;
+        math::fast::sincos(dm22, s, c);
+
+        test_assert(s[0] == math::fast::sin(dm22[0]));
+        test_assert(s[1] == math::fast::sin(dm22[1]));
+
+        test_assert(c[0] == math::fast::cos(dm22[0]));
+        test_assert(c[1] == math::fast::cos(dm22[1]));
+    }
+
+    TEST_CASE(fast_exp)
+    {
+        const auto m = math::fast::exp(dm22);
+        test_assert(m[0] == math::fast::exp(dm22[0]));
+        test_assert(m[1] == math::fast::exp(dm22[1]));
+    }
+
+    TEST_CASE(fast_log)
+    {
+        const auto m = math::fast::log(dm22);
+        test_assert(m[0] == math::fast::log(dm22[0]));
+        test_assert(m[1] == math::fast::log(dm22[1]));
+    }
+
+    TEST_CASE(fast_pow)
+    {
+        const auto m = math::fast::pow(dm22, dm222);
+        test_assert(m[0] == math::fast::pow(dm22[0], dm222[0]));
+        test_assert(m[1] == math::fast::pow(dm22[1], dm222[1]));
+    }
+
+    TEST_CASE(fast_recip)
+    {
+        const auto m = math::fast::recip(dm22);
+        test_assert(m[0] == math::fast::recip(dm22[0]));
+        test_assert(m[1] == math::fast::recip(dm22[1]));
+    }
+
+    TEST_CASE(fast_rsqrt)
+    {
+        const auto m = math::fast::rsqrt(dm22);
+        test_assert(m[0] == math::fast::rsqrt(dm22[0]));
+        test_assert(m[1] == math::fast::rsqrt(dm22[1]));
+    }
+
+    TEST_CASE(precise_sin)
+    {
+        const auto m = math::precise::sin(dm22);
+        test_assert(m[0] == math::precise::sin(dm22[0]));
+        test_assert(m[1] == math::precise::sin(dm22[1]));
+    }
+
+    TEST_CASE(precise_cos)
+    {
+        const auto m = math::precise::cos(dm22);
+        test_assert(m[0] == math::precise::cos(dm22[0]));
+        test_assert(m[1] == math::precise::cos(dm22[1]));
+    }
+
+    TEST_CASE(precise_sincos)
+    {
+        dmat2x2 s, c;
+        math::precise::sincos(dm22, s, c);
+
+        test_assert(s[0] == math::precise::sin(dm22[0]));
+        test_assert(s[1] == math::precise::sin(dm22[1]));
+
+        test_assert(c[0] == math::precise::cos(dm22[0]));
+        test_assert(c[1] == math::precise::cos(dm22[1]));
+    }
+
+    TEST_CASE(precise_exp)
+    {
+        const auto m = math::precise::exp(dm22);
+        test_assert(m[0] == math::precise::exp(dm22[0]));
+        test_assert(m[1] == math::precise::exp(dm22[1]));
+    }
+
+    TEST_CASE(precise_log)
+    {
+        const auto m = math::precise::log(dm22);
+        test_assert(m[0] == math::precise::log(dm22[0]));
+        test_assert(m[1] == math::precise::log(dm22[1]));
+    }
+
+    TEST_CASE(precise_pow)
+    {
+        const auto m = math::precise::pow(dm22, dm222);
+        test_assert(m[0] == math::precise::pow(dm22[0], dm222[0]));
+        test_assert(m[1] == math::precise::pow(dm22[1], dm222[1]));
+    }
+
+    TEST_CASE(precise_recip)
+    {
+        const auto m = math::precise::recip(dm22);
+        test_assert(m[0] == math::precise::recip(dm22[0]));
+        test_assert(m[1] == math::precise::recip(dm22[1]));
+    }
+
+    TEST_CASE(precise_rsqrt)
+    {
+        const auto m = math::precise::rsqrt(dm22);
+        test_assert(m[0] == math::precise::rsqrt(dm22[0]));
+        test_assert(m[1] == math::precise::rsqrt(dm22[1]));
+    }
+
     TEST_CASE(min)
     {
         const auto m = math::min(dm22, dm222);
@@ -1002,6 +1002,48 @@ namespace
         test_assert(c[2] == math::cos(dm32[2]));
     }
 
+    TEST_CASE(tan)
+    {
+        const auto m = math::tan(dm32);
+        test_assert(m[0] == math::tan(dm32[0]));
+        test_assert(m[1] == math::tan(dm32[1]));
+        test_assert(m[2] == math::tan(dm32[2]));
+    }
+
+    TEST_CASE(asin)
+    {
+        const auto m1 = dm32 / 8.0;
+        const auto m = math::asin(m1);
+        test_assert(m[0] == math::asin(m1[0]));
+        test_assert(m[1] == math::asin(m1[1]));
+        test_assert(m[2] == math::asin(m1[2]));
+    }
+
+    TEST_CASE(acos)
+    {
+        const auto m1 = dm32 / 8.0;
+        const auto m = math::acos(m1);
+        test_assert(m[0] == math::acos(m1[0]));
+        test_assert(m[1] == math::acos(m1[1]));
+        test_assert(m[2] == math::acos(m1[2]));
+    }
+
+    TEST_CASE(atan)
+    {
+        const auto m = math::atan(dm32);
+        test_assert(m[0] == math::atan(dm32[0]));
+        test_assert(m[1] == math::atan(dm32[1]));
+        test_assert(m[2] == math::atan(dm32[2]));
+    }
+
+    TEST_CASE(atan2)
+    {
+        const auto m = math::atan2(dm32, dm322);
+        test_assert(m[0] == math::atan2(dm32[0], dm322[0]));
+        test_assert(m[1] == math::atan2(dm32[1], dm322[1]));
+        test_assert(m[2] == math::atan2(dm32[2], dm322[2]));
+    }
+
     TEST_CASE(exp)
     {
         const auto m = math::exp(dm32);
@@ -1010,6 +1052,14 @@ namespace
         test_assert(m[2] == math::exp(dm32[2]));
     }
 
+    TEST_CASE(exp2)
+    {
+        const auto m = math::exp2(dm32);
+        test_assert(m[0] == math::exp2(dm32[0]));
+        test_assert(m[1] == math::exp2(dm32[1]));
+        test_assert(m[2] == math::exp2(dm32[2]));
+    }
+
     TEST_CASE(log)
     {
         const auto m = math::log(dm32);
@@ -1018,6 +1068,22 @@ namespace
         test_assert(m[2] == math::log(dm32[2]));
     }
 
+    TEST_CASE(log2)
+    {
+        const auto m = math::log2(dm32);
+        test_assert(m[0] == math::log2(dm32[0]));
+        test_assert(m[1] == math::log2(dm32[1]));
+        test_assert(m[2] == math::log2(dm32[2]));
+    }
+
+    TEST_CASE(log10)
+    {
+        const auto m = math::log10(dm32);
+        test_assert(m[0] == math::log10(dm32[0]));
+        test_assert(m[1] == math::log10(dm32[1]));
+        test_assert(m[2] == math::log10(dm32[2]));
+    }
+
     TEST_CASE(abs)
     {
         const auto m = math::abs(dm322);
@@ -1050,6 +1116,14 @@ namespace
         test_assert(m[2] == math::sqrt(dm32[2]));
     }
 
+    TEST_CASE(cbrt)
+    {
+        const auto m = math::cbrt(dm32);
+        test_assert(m[0] == math::cbrt(dm32[0]));
+        test_assert(m[1] == math::cbrt(dm32[1]));
+        test_assert(m[2] == math::cbrt(dm32[2]));
+    }
+
     TEST_CASE(rsqrt)
     {
         const auto m = math::rsqrt(dm32);
@@ -1058,6 +1132,209 @@ namespace
         test_assert(m[2] == math::rsqrt(dm32[2]));
     }
 
+    TEST_CASE(fma)
+    {
+        const auto m = math::fma(dm32, dm322, dm32);
+        test_assert(m[0] == math::fma(dm32[0], dm322[0], dm32[0]));
+        test_assert(m[1] == math::fma(dm32[1], dm322[1], dm32[1]));
+        test_assert(m[2] == math::fma(dm32[2], dm322[2], dm32[2]));
+    }
+
+    TEST_CASE(floor)
+    {
+        const auto m = math::floor(dm32);
+        test_assert(m[0] == math::floor(dm32[0]));
+        test_assert(m[1] == math::floor(dm32[1]));
+        test_assert(m[2] == math::floor(dm32[2]));
+    }
+
+    TEST_CASE(ceil)
+    {
+        const auto m = math::ceil(dm32);
+        test_assert(m[0] == math::ceil(dm32[0]));
+        test_assert(m[1] == math::ceil(dm32[1]));
+        test_assert(m[2] == math::ceil(dm32[2]));
+    }
+
+    TEST_CASE(round)
+    {
+        const auto m = math::round(dm32);
+        test_assert(m[0] == math::round(dm32[0]));
+        test_assert(m[1] == math::round(dm32[1]));
+        test_assert(m[2] == math::round(dm32[2]));
+    }
+
+    TEST_CASE(trunc)
+    {
+        const auto m = math::trunc(dm32);
+        test_assert(m[0] == math::trunc(dm32[0]));
+        test_assert(m[1] == math::trunc(dm32[1]));
+        test_assert(m[2] == math::trunc(dm32[2]));
+    }
+
+    TEST_CASE(fract)
+    {
+        const auto m = math::fract(dm32);
+        test_assert(m[0] == math::fract(dm32[0]));
+        test_assert(m[1] == math::fract(dm32[1]));
+        test_assert(m[2] == math::fract(dm32[2]));
+    }
+
+    TEST_CASE(modf)
+    {
+        auto i = dm32;
+        const auto m = math::modf(dm32, i);
+        auto i0 = dm32[0];
+        test_assert(m[0] == math::modf(dm32[0], i0));
+        test_assert(i[0] == i0);
+        auto i1 = dm32[1];
+        test_assert(m[1] == math::modf(dm32[1], i1));
+        test_assert(i[1] == i1);
+        auto i2 = dm32[2];
+        test_assert(m[2] == math::modf(dm32[2], i2));
+        test_assert(i[2] == i2);
+    }
+
+    TEST_CASE(fast_sin)
+    {
+        const auto m = math::fast::sin(dm32);
+        test_assert(m[0] == math::fast::sin(dm32[0]));
+        test_assert(m[1] == math::fast::sin(dm32[1]));
+        test_assert(m[2] == math::fast::sin(dm32[2]));
+    }
+
+    TEST_CASE(fast_cos)
+    {
+        const auto m = math::fast::cos(dm32);
+        test_assert(m[0] == math::fast::cos(dm32[0]));
+        test_assert(m[1] == math::fast::cos(dm32[1]));
+        test_assert(m[2] == math::fast::cos(dm32[2]));
+    }
+
+    TEST_CASE(fast_sincos)
+    {
+        dmat3x2 s, c;
+        math::fast::sincos(dm32, s, c);
+
+        test_assert(s[0] == math::fast::sin(dm32[0]));
+        test_assert(s[1] == math::fast::sin(dm32[1]));
+        test_assert(s[2] == math::fast::sin(dm32[2]));
+
+        test_assert(c[0] == math::fast::cos(dm32[0]));
+        test_assert(c[1] == math::fast::cos(dm32[1]));
+        test_assert(c[2] == math::fast::cos(dm32[2]));
+    }
+
+    TEST_CASE(fast_exp)
+    {
+        const auto m = math::fast::exp(dm32);
+        test_assert(m[0] == math::fast::exp(dm32[0]));
+        test_assert(m[1] == math::fast::exp(dm32[1]));
+        test_assert(m[2] == math::fast::exp(dm32[2]));
+    }
+
+    TEST_CASE(fast_log)
+    {
+        const auto m = math::fast::log(dm32);
+        test_assert(m[0] == math::fast::log(dm32[0]));
+        test_assert(m[1] == math::fast::log(dm32[1]));
+        test_assert(m[2] == math::fast::log(dm32[2]));
+    }
+
+    TEST_CASE(fast_pow)
+    {
+        const auto m = math::fast::pow(dm32, dm322);
+        test_assert(m[0] == math::fast::pow(dm32[0], dm322[0]));
+        test_assert(m[1] == math::fast::pow(dm32[1], dm322[1]));
+        test_assert(m[2] == math::fast::pow(dm32[2], dm322[2]));
+    }
+
+    TEST_CASE(fast_recip)
+    {
+        const auto m = math::fast::recip(dm32);
+        test_assert(m[0] == math::fast::recip(dm32[0]));
+        test_assert(m[1] == math::fast::recip(dm32[1]));
+        test_assert(m[2] == math::fast::recip(dm32[2]));
+    }
+
+    TEST_CASE(fast_rsqrt)
+    {
+        const auto m = math::fast::rsqrt(dm32);
+        test_assert(m[0] == math::fast::rsqrt(dm32[0]));
+        test_assert(m[1] == math::fast::rsqrt(dm32[1]));
+        test_assert(m[2] == math::fast::rsqrt(dm32[2]));
+    }
+
+    TEST_CASE(precise_sin)
+    {
+        const auto m = math::precise::sin(dm32);
+        test_assert(m[0] == math::precise::sin(dm32[0]));
+        test_assert(m[1] == math::precise::sin(dm32[1]));
+        test_assert(m[2] == math::precise::sin(dm32[2]));
+    }
+
+    TEST_CASE(precise_cos)
+    {
+        const auto m = math::precise::cos(dm32);
+        test_assert(m[0] == math::precise::cos(dm32[0]));
+        test_assert(m[1] == math::precise::cos(dm32[1]));
+        test_assert(m[2] == math::precise::cos(dm32[2]));
+    }
+
+    TEST_CASE(precise_sincos)
+    {
+        dmat3x2 s, c;
+        math::precise::sincos(dm32, s, c);
+
+        test_assert(s[0] == math::precise::sin(dm32[0]));
+        test_assert(s[1] == math::precise::sin(dm32[1]));
+        test_assert(s[2] == math::precise::sin(dm32[2]));
+
+        test_assert(c[0] == math::precise::cos(dm32[0]));
+        test_assert(c[1] == math::precise::cos(dm32[1]));
+        test_assert(c[2] == math::precise::cos(dm32[2]));
+    }
+
+    TEST_CASE(precise_exp)
+    {
+        const auto m = math::precise::exp(dm32);
+        test_assert(m[0] == math::precise::exp(dm32[0]));
+        test_assert(m[1] == math::precise::exp(dm32[1]));
+        test_assert(m[2] == math::precise::exp(dm32[2]));
+    }
+
+    TEST_CASE(precise_log)
+    {
+        const auto m = math::precise::log(dm32);
+        test_assert(m[0] == math::precise::log(dm32[0]));
+        test_assert(m[1] == math::precise::log(dm32[1]));
+        test_assert(m[2] == math::precise::log(dm32[2]));
+    }
+
+    TEST_CASE(precise_pow)
+    {
+        const auto m = math::precise::pow(dm32, dm322);
+        test_assert(m[0] == math::precise::pow(dm32[0], dm322[0]));
+        test_assert(m[1] == math::precise::pow(dm32[1], dm322[1]));
+        test_assert(m[2] == math::precise::pow(dm32[2], dm322[2]));
+    }
+
+    TEST_CASE(precise_recip)
+    {
+        const auto m = math::precise::recip(dm32);
+        test_assert(m[0] == math::precise::recip(dm32[0]));
+        test_assert(m[1] == math::precise::recip(dm32[1]));
+        test_assert(m[2] == math::precise::recip(dm32[2]));
+    }
+
+    TEST_CASE(precise_rsqrt)
+    {
+        const auto m = math::precise::rsqrt(dm32);
+        test_assert(m[0] == math::precise::rsqrt(dm32[0]));
+        test_assert(m[1] == math::precise::rsqrt(dm32[1]));
+        test_assert(m[2] == math::precise::rsqrt(dm32[2]));
+    }
+
     TEST_CASE(min)
     {
         const auto m = math::min(dm32, dm322);
@@ -1137,6 +1137,53 @@ namespace
         test_assert(c[3] == math::cos(dm42[3]));
     }
 
+    TEST_CASE(tan)
+    {
+        const auto m = math::tan(dm42);
+        test_assert(m[0] == math::tan(dm42[0]));
+        test_assert(m[1] == math::tan(dm42[1]));
+        test_assert(m[2] == math::tan(dm42[2]));
+        test_assert(m[3] == math::tan(dm42[3]));
+    }
+
+    TEST_CASE(asin)
+    {
+        const auto m1 = dm42 / 8.0;
+        const auto m = math::asin(m1);
+        test_assert(m[0] == math::asin(m1[0]));
+        test_assert(m[1] == math::asin(m1[1]));
+        test_assert(m[2] == math::asin(m1[2]));
+        test_assert(m[3] == math::asin(m1[3]));
+    }
+
+    TEST_CASE(acos)
+    {
+        const auto m1 = dm42 / 8.0;
+        const auto m = math::acos(m1);
+        test_assert(m[0] == math::acos(m1[0]));
+        test_assert(m[1] == math::acos(m1[1]));
+        test_assert(m[2] == math::acos(m1[2]));
+        test_assert(m[3] == math::acos(m1[3]));
+    }
+
+    TEST_CASE(atan)
+    {
+        const auto m = math::atan(dm42);
+        test_assert(m[0] == math::atan(dm42[0]));
+        test_assert(m[1] == math::atan(dm42[1]));
+        test_assert(m[2] == math::atan(dm42[2]));
+        test_assert(m[3] == math::atan(dm42[3]));
+    }
+
+    TEST_CASE(atan2)
+    {
+        const auto m = math::atan2(dm42, dm422);
+        test_assert(m[0] == math::atan2(dm42[0], dm422[0]));
+        test_assert(m[1] == math::atan2(dm42[1], dm422[1]));
+        test_assert(m[2] == math::atan2(dm42[2], dm422[2]));
+        test_assert(m[3] == math::atan2(dm42[3], dm422[3]));
+    }
+
     TEST_CASE(exp)
     {
         const auto m = math::exp(dm42);
@@ -1146,6 +1193,15 @@ namespace
         test_assert(m[3] == math::exp(dm42[3]));
     }
 
+    TEST_CASE(exp2)
+    {
+        const auto m = math::exp2(dm42);
+        test_assert(m[0] == math::exp2(dm42[0]));
+        test_assert(m[1] == math::exp2(dm42[1]));
+        test_assert(m[2] == math::exp2(dm42[2]));
+        test_assert(m[3] == math::exp2(dm42[3]));
+    }
+
     TEST_CASE(log)
     {
         const auto m = math::log(dm42);
@@ -1155,6 +1211,24 @@ namespace
         test_assert(m[3] == math::log(dm42[3]));
     }
 
+    TEST_CASE(log2)
+    {
+        const auto m = math::log2(dm42);
+        test_assert(m[0] == math::log2(dm42[0]));
+        test_assert(m[1] == math::log2(dm42[1]));
+        test_assert(m[2] == math::log2(dm42[2]));
+        test_assert(m[3] == math::log2(dm42[3]));
+    }
+
+    TEST_CASE(log10)
+    {
+        const auto m = math::log10(dm42);
+        test_assert(m[0] == math::log10(dm42[0]));
+        test_assert(m[1] == math::log10(dm42[1]));
+        test_assert(m[2] == math::log10(dm42[2]));
+        test_assert(m[3] == math::log10(dm42[3]));
+    }
+
     TEST_CASE(abs)
     {
         const auto m = math::abs(dm422);
@@ -1191,6 +1265,15 @@ namespace
         test_assert(m[3] == math::sqrt(dm42[3]));
     }
 
+    TEST_CASE(cbrt)
+    {
+        const auto m = math::cbrt(dm42);
+        test_assert(m[0] == math::cbrt(dm42[0]));
+        test_assert(m[1] == math::cbrt(dm42[1]));
+        test_assert(m[2] == math::cbrt(dm42[2]));
+        test_assert(m[3] == math::cbrt(dm42[3]));
+    }
+
     TEST_CASE(rsqrt)
     {
         const auto m = math::rsqrt(dm42);
@@ -1200,6 +1283,236 @@ namespace
         test_assert(m[3] == math::rsqrt(dm42[3]));
     }
 
+    TEST_CASE(fma)
+    {
+        const auto m = math::fma(dm42, dm422, dm42);
+        test_assert(m[0] == math::fma(dm42[0], dm422[0], dm42[0]));
+        test_assert(m[1] == math::fma(dm42[1], dm422[1], dm42[1]));
+        test_assert(m[2] == math::fma(dm42[2], dm422[2], dm42[2]));
+        test_assert(m[3] == math::fma(dm42[3], dm422[3], dm42[3]));
+    }
+
+    TEST_CASE(floor)
+    {
+        const auto m = math::floor(dm42);
+        test_assert(m[0] == math::floor(dm42[0]));
+        test_assert(m[1] == math::floor(dm42[1]));
+        test_assert(m[2] == math::floor(dm42[2]));
+        test_assert(m[3] == math::floor(dm42[3]));
+    }
+
+    TEST_CASE(ceil)
+    {
+        const auto m = math::ceil(dm42);
+        test_assert(m[0] == math::ceil(dm42[0]));
+        test_assert(m[1] == math::ceil(dm42[1]));
+        test_assert(m[2] == math::ceil(dm42[2]));
+        test_assert(m[3] == math::ceil(dm42[3]));
+    }
+
+    TEST_CASE(round)
+    {
+        const auto m = math::round(dm42);
+        test_assert(m[0] == math::round(dm42[0]));
+        test_assert(m[1] == math::round(dm42[1]));
+        test_assert(m[2] == math::round(dm42[2]));
+        test_assert(m[3] == math::round(dm42[3]));
+    }
+
+    TEST_CASE(trunc)
+    {
+        const auto m = math::trunc(dm42);
+        test_assert(m[0] == math::trunc(dm42[0]));
+        test_assert(m[1] == math::trunc(dm42[1]));
+        test_assert(m[2] == math::trunc(dm42[2]));
+        test_assert(m[3] == math::trunc(dm42[3]));
+    }
+
+    TEST_CASE(fract)
+    {
+        const auto m = math::fract(dm42);
+        test_assert(m[0] == math::fract(dm42[0]));
+        test_assert(m[1] == math::fract(dm42[1]));
+        test_assert(m[2] == math::fract(dm42[2]));
+        test_assert(m[3] == math::fract(dm42[3]));
+    }
+
+    TEST_CASE(modf)
+    {
+        auto i = dm42;
+        const auto m = math::modf(dm42, i);
+        auto i0 = dm42[0];
+        test_assert(m[0] == math::modf(dm42[0], i0));
+        test_assert(i[0] == i0);
+        auto i1 = dm42[1];
+        test_assert(m[1] == math::modf(dm42[1], i1));
+        test_assert(i[1] == i1);
+        auto i2 = dm42[2];
+        test_assert(m[2] == math::modf(dm42[2], i2));
+        test_assert(i[2] == i2);
+        auto i3 = dm42[3];
+        test_assert(m[3] == math::modf(dm42[3], i3));
+        test_assert(i[3] == i3);
+    }
+
+    TEST_CASE(fast_sin)
+    {
+        const auto m = math::fast::sin(dm42);
+        test_assert(m[0] == math::fast::sin(dm42[0]));
+        test_assert(m[1] == math::fast::sin(dm42[1]));
+        test_assert(m[2] == math::fast::sin(dm42[2]));
+        test_assert(m[3] == math::fast::sin(dm42[3]));
+    }
+
+    TEST_CASE(fast_cos)
+    {
+        const auto m = math::fast::cos(dm42);
+        test_assert(m[0] == math::fast::cos(dm42[0]));
+        test_assert(m[1] == math::fast::cos(dm42[1]));
+        test_assert(m[2] == math::fast::cos(dm42[2]));
+        test_assert(m[3] == math::fast::cos(dm42[3]));
+    }
+
+    TEST_CASE(fast_sincos)
+    {
+        dmat4x2 s, c;
+        math::fast::sincos(dm42, s, c);
+
+        test_assert(s[0] == math::fast::sin(dm42[0]));
+        test_assert(s[1] == math::fast::sin(dm42[1]));
+        test_assert(s[2] == math::fast::sin(dm42[2]));
+        test_assert(s[3] == math::fast::sin(dm42[3]));
+
+        test_assert(c[0] == math::fast::cos(dm42[0]));
+        test_assert(c[1] == math::fast::cos(dm42[1]));
+        test_assert(c[2] == math::fast::cos(dm42[2]));
+        test_assert(c[3] == math::fast::cos(dm42[3]));
+    }
+
+    TEST_CASE(fast_exp)
+    {
+        const auto m = math::fast::exp(dm42);
+        test_assert(m[0] == math::fast::exp(dm42[0]));
+        test_assert(m[1] == math::fast::exp(dm42[1]));
+        test_assert(m[2] == math::fast::exp(dm42[2]));
+        test_assert(m[3] == math::fast::exp(dm42[3]));
+    }
+
+    TEST_CASE(fast_log)
+    {
+        const auto m = math::fast::log(dm42);
+        test_assert(m[0] == math::fast::log(dm42[0]));
+        test_assert(m[1] == math::fast::log(dm42[1]));
+        test_assert(m[2] == math::fast::log(dm42[2]));
+        test_assert(m[3] == math::fast::log(dm42[3]));
+    }
+
+    TEST_CASE(fast_pow)
+    {
+        const auto m = math::fast::pow(dm42, dm422);
+        test_assert(m[0] == math::fast::pow(dm42[0], dm422[0]));
+        test_assert(m[1] == math::fast::pow(dm42[1], dm422[1]));
+        test_assert(m[2] == math::fast::pow(dm42[2], dm422[2]));
+        test_assert(m[3] == math::fast::pow(dm42[3], dm422[3]));
+    }
+
+    TEST_CASE(fast_recip)
+    {
+        const auto m = math::fast::recip(dm42);
+        test_assert(m[0] == math::fast::recip(dm42[0]));
+        test_assert(m[1] == math::fast::recip(dm42[1]));
+        test_assert(m[2] == math::fast::recip(dm42[2]));
+        test_assert(m[3] == math::fast::recip(dm42[3]));
+    }
+
+    TEST_CASE(fast_rsqrt)
+    {
+        const auto m = math::fast::rsqrt(dm42);
+        test_assert(m[0] == math::fast::rsqrt(dm42[0]));
+        test_assert(m[1] == math::fast::rsqrt(dm42[1]));
+        test_assert(m[2] == math::fast::rsqrt(dm42[2]));
+        test_assert(m[3] == math::fast::rsqrt(dm42[3]));
+    }
+
+    TEST_CASE(precise_sin)
+    {
+        const auto m = math::precise::sin(dm42);
+        test_assert(m[0] == math::precise::sin(dm42[0]));
+        test_assert(m[1] == math::precise::sin(dm42[1]));
+        test_assert(m[2] == math::precise::sin(dm42[2]));
+        test_assert(m[3] == math::precise::sin(dm42[3]));
+    }
+
+    TEST_CASE(precise_cos)
+    {
+        const auto m = math::precise::cos(dm42);
+        test_assert(m[0] == math::precise::cos(dm42[0]));
+        test_assert(m[1] == math::precise::cos(dm42[1]));
+        test_assert(m[2] == math::precise::cos(dm42[2]));
+        test_assert(m[3] == math::precise::cos(dm42[3]));
+    }
+
+    TEST_CASE(precise_sincos)
+    {
+        dmat4x2 s, c;
+        math::precise::sincos(dm42, s, c);
+
+        test_assert(s[0] == math::precise::sin(dm42[0]));
+        test_assert(s[1] == math::precise::sin(dm42[1]));
+        test_assert(s[2] == math::precise::sin(dm42[2]));
+        test_assert(s[3] == math::precise::sin(dm42[3]));
+
+        test_assert(c[0] == math::precise::cos(dm42[0]));
+        test_assert(c[1] == math::precise::cos(dm42[1]));
+        test_assert(c[2] == math::precise::cos(dm42[2]));
+        test_assert(c[3] == math::precise::cos(dm42[3]));
+    }
+
+    TEST_CASE(precise_exp)
+    {
+        const auto m = math::precise::exp(dm42);
+        test_assert(m[0] == math::precise::exp(dm42[0]));
+        test_assert(m[1] == math::precise::exp(dm42[1]));
+        test_assert(m[2] == math::precise::exp(dm42[2]));
+        test_assert(m[3] == math::precise::exp(dm42[3]));
+    }
+
+    TEST_CASE(precise_log)
+    {
+        const auto m = math::precise::log(dm42);
+        test_assert(m[0] == math::precise::log(dm42[0]));
+        test_assert(m[1] == math::precise::log(dm42[1]));
+        test_assert(m[2] == math::precise::log(dm42[2]));
+        test_assert(m[3] == math::precise::log(dm42[3]));
+    }
+
+    TEST_CASE(precise_pow)
+    {
+        const auto m = math::precise::pow(dm42, dm422);
+        test_assert(m[0] == math::precise::pow(dm42[0], dm422[0]));
+        test_assert(m[1] == math::precise::pow(dm42[1], dm422[1]));
+        test_assert(m[2] == math::precise::pow(dm42[2], dm422[2]));
+        test_assert(m[3] == math::precise::pow(dm42[3], dm422[3]));
+    }
+
+    TEST_CASE(precise_recip)
+    {
+        const auto m = math::precise::recip(dm42);
+        test_assert(m[0] == math::precise::recip(dm42[0]));
+        test_assert(m[1] == math::precise::recip(dm42[1]));
+        test_assert(m[2] == math::precise::recip(dm42[2]));
+        test_assert(m[3] == math::precise::recip(dm42[3]));
+    }
+
+    TEST_CASE(precise_rsqrt)
+    {
+        const auto m = math::precise::rsqrt(dm42);
+        test_assert(m[0] == math::precise::rsqrt(dm42[0]));
+        test_assert(m[1] == math::precise::rsqrt(dm42[1]));
+        test_assert(m[2] == math::precise::rsqrt(dm42[2]));
+        test_assert(m[3] == math::precise::rsqrt(dm42[3]));
+    }
+
     TEST_CASE(min)
     {
         const auto m = math::min(dm42, dm422);
@@ -10,6 +10,8 @@
 #include "tue.tests.hpp"
 
 #include <cmath>
+#include <cstdint>
+#include <limits>
 
 namespace
 {
@@ -33,16 +35,57 @@ namespace
         test_assert(nearly_equal(c, std::cos(1.2)));
     }
 
+    TEST_CASE(tan)
+    {
+        test_assert(nearly_equal(math::tan(1.2), std::tan(1.2)));
+    }
+
+    TEST_CASE(asin)
+    {
+        test_assert(nearly_equal(math::asin(0.12), std::asin(0.12)));
+    }
+
+    TEST_CASE(acos)
+    {
+        test_assert(nearly_equal(math::acos(0.12), std::acos(0.12)));
+    }
+
+    TEST_CASE(atan)
+    {
+        test_assert(nearly_equal(math::atan(1.2), std::atan(1.2)));
+    }
+
+    TEST_CASE(atan2)
+    {
+        test_assert(nearly_equal(
+            math::atan2(1.2, 3.4), std::atan2(1.2, 3.4)));
+    }
+
     TEST_CASE(exp)
     {
         test_assert(nearly_equal(math::exp(1.2), std::exp(1.2)));
     }
 
+    TEST_CASE(exp2)
+    {
+        test_assert(nearly_equal(math::exp2(1.2), std::exp2(1.2)));
+    }
+
     TEST_CASE(log)
     {
         test_assert(nearly_equal(math::log(1.2), std::log(1.2)));
     }
 
+    TEST_CASE(log2)
+    {
+        test_assert(nearly_equal(math::log2(1.2), std::log2(1.2)));
+    }
+
+    TEST_CASE(log10)
+    {
+        test_assert(nearly_equal(math::log10(1.2), std::log10(1.2)));
+    }
+
     TEST_CASE(abs)
     {
         test_assert(math::abs(1.2) == 1.2);
@@ -67,11 +110,99 @@ namespace
         test_assert(nearly_equal(math::sqrt(1.2), std::sqrt(1.2)));
     }
 
+    TEST_CASE(cbrt)
+    {
+        test_assert(nearly_equal(math::cbrt(1.2), std::cbrt(1.2)));
+    }
+
     TEST_CASE(rsqrt)
     {
         test_assert(nearly_equal(math::rsqrt(1.2), 1 / std::sqrt(1.2)));
     }
 
+    TEST_CASE(fma)
+    {
+        test_assert(math::fma(1.2, 3.4, 5.6) == std::fma(1.2, 3.4, 5.6));
+    }
+
+    TEST_CASE(fast)
+    {
+        test_assert(nearly_equal(math::fast::sin(1.2), std::sin(1.2)));
+        test_assert(nearly_equal(math::fast::cos(1.2), std::cos(1.2)));
+
+        double s, c;
+        math::fast::sincos(1.2, s, c);
+        test_assert(nearly_equal(s, std::sin(1.2)));
+        test_assert(nearly_equal(c, std::cos(1.2)));
+
+        test_assert(nearly_equal(math::fast::exp(1.2), std::exp(1.2)));
+        test_assert(nearly_equal(math::fast::log(1.2), std::log(1.2)));
+        test_assert(nearly_equal(
+            math::fast::pow(1.2, 3.4), std::pow(1.2, 3.4)));
+        test_assert(nearly_equal(math::fast::recip(1.2), 1 / 1.2));
+        test_assert(nearly_equal(
+            math::fast::rsqrt(1.2), 1 / std::sqrt(1.2)));
+    }
+
+    TEST_CASE(precise)
+    {
+        test_assert(nearly_equal(math::precise::sin(1.2), std::sin(1.2)));
+        test_assert(nearly_equal(math::precise::cos(1.2), std::cos(1.2)));
+
+        double s, c;
+        math::precise::sincos(1.2, s, c);
+        test_assert(nearly_equal(s, std::sin(1.2)));
+        test_assert(nearly_equal(c, std::cos(1.2)));
+
+        test_assert(nearly_equal(math::precise::exp(1.2), std::exp(1.2)));
+        test_assert(nearly_equal(math::precise::log(1.2), std::log(1.2)));
+        test_assert(nearly_equal(
+            math::precise::pow(1.2, 3.4), std::pow(1.2, 3.4)));
+        test_assert(nearly_equal(math::precise::recip(1.2), 1 / 1.2));
+        test_assert(nearly_equal(
+            math::precise::rsqrt(1.2), 1 / std::sqrt(1.2)));
+    }
+
+    TEST_CASE(floor)
+    {
+        test_assert(math::floor(1.5) == 1.0);
+        test_assert(math::floor(-1.5) == -2.0);
+    }
+
+    TEST_CASE(ceil)
+    {
+        test_assert(math::ceil(1.5) == 2.0);
+        test_assert(math::ceil(-1.5) == -1.0);
+    }
+
+    TEST_CASE(round)
+    {
+        test_assert(math::round(1.2) == 1.0);
+        test_assert(math::round(2.5) == 3.0);
+        test_assert(math::round(-2.5) == -3.0);
+    }
+
+    TEST_CASE(trunc)
+    {
+        test_assert(math::trunc(1.5) == 1.0);
+        test_assert(math::trunc(-1.5) == -1.0);
+    }
+
+    TEST_CASE(fract)
+    {
+        test_assert(math::fract(1.25) == 0.25);
+        test_assert(math::fract(-1.25) == 0.75);
+    }
+
+    TEST_CASE(modf)
+    {
+        double i;
+        test_assert(math::modf(1.25, i) == 0.25);
+        test_assert(i == 1.0);
+        test_assert(math::modf(-1.25, i) == -0.25);
+        test_assert(i == -1.0);
+    }
+
     TEST_CASE(min)
     {
         test_assert(math::min(1.2, 3.4) == 1.2);
@@ -90,6 +221,56 @@ namespace
         test_assert(math::max(12, -34) == 12);
     }
 
+    TEST_CASE(adds)
+    {
+        test_assert(math::adds<std::int8_t>(100, 20) == 120);
+        test_assert(math::adds<std::int8_t>(100, 100) == 127);
+        test_assert(math::adds<std::int8_t>(-100, -100) == -128);
+        test_assert(math::adds<std::uint8_t>(200, 100) == 255);
+        test_assert(math::adds<std::int64_t>(
+            std::numeric_limits<std::int64_t>::max(), 1)
+            == std::numeric_limits<std::int64_t>::max());
+    }
+
+    TEST_CASE(subs)
+    {
+        test_assert(math::subs<std::int8_t>(100, 20) == 80);
+        test_assert(math::subs<std::int8_t>(-100, 100) == -128);
+        test_assert(math::subs<std::int8_t>(100, -100) == 127);
+        test_assert(math::subs<std::uint8_t>(100, 200) == 0);
+        test_assert(math::subs<std::int64_t>(
+            std::numeric_limits<std::int64_t>::lowest(), 1)
+            == std::numeric_limits<std::int64_t>::lowest());
+    }
+
+    TEST_CASE(avg)
+    {
+        test_assert(math::avg<std::uint8_t>(255, 254) == 255);
+        test_assert(math::avg<std::uint8_t>(3, 4) == 4);
+        test_assert(math::avg<std::int8_t>(-128, 127) == 0);
+        test_assert(math::avg<std::int8_t>(-3, -4) == -3);
+        test_assert(math::avg<std::uint32_t>(0xFFFFFFFF, 0xFFFFFFFD)
+            == 0xFFFFFFFE);
+    }
+
+    TEST_CASE(reduce_add)
+    {
+        test_assert(math::reduce_add(1.2) == 1.2);
+        test_assert(math::reduce_add(3) == 3);
+    }
+
+    TEST_CASE(reduce_min)
+    {
+        test_assert(math::reduce_min(1.2) == 1.2);
+        test_assert(math::reduce_min(3) == 3);
+    }
+
+    TEST_CASE(reduce_max)
+    {
+        test_assert(math::reduce_max(1.2) == 1.2);
+        test_assert(math::reduce_max(3) == 3);
+    }
+
     TEST_CASE(mask)
     {
         test_assert(math::mask(true64, 1.2) == 1.2);
@@ -173,4 +354,28 @@ namespace
         test_assert(math::not_equal(false32, true32) == true32);
         test_assert(math::not_equal(false32, false32) == false32);
     }
+
+    TEST_CASE(movemask)
+    {
+        test_assert(math::movemask(true32) == 1);
+        test_assert(math::movemask(false32) == 0);
+    }
+
+    TEST_CASE(any)
+    {
+        test_assert(math::any(true8) == true);
+        test_assert(math::any(false8) == false);
+    }
+
+    TEST_CASE(all)
+    {
+        test_assert(math::all(true16) == true);
+        test_assert(math::all(false16) == false);
+    }
+
+    TEST_CASE(none)
+    {
+        test_assert(math::none(true64) == false);
+        test_assert(math::none(false64) == true);
+    }
 }
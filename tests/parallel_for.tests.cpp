@@ -0,0 +1,211 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/parallel_for.hpp>
+#include "tue.tests.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace tue;
+
+    // Counts how many times each index is visited and records every
+    // chunk that breaks the boundary rules, so that the checks themselves
+    // run on the test's thread.
+    struct coverage
+    {
+        std::size_t begin;
+        std::size_t end;
+        std::size_t grain;
+        std::unique_ptr<std::atomic<int>[]> visits;
+        std::atomic<int> chunks{ 0 };
+        std::atomic<int> bad_chunks{ 0 };
+
+        coverage(std::size_t b, std::size_t e, std::size_t g)
+        :
+            begin(b),
+            end(e),
+            grain(g),
+            visits(new std::atomic<int>[e])
+        {
+            for (std::size_t i = 0; i < e; ++i)
+            {
+                visits[i] = 0;
+            }
+        }
+
+        void operator()(std::size_t b, std::size_t e)
+        {
+            ++chunks;
+            if (b >= e
+                || (b != begin && b % grain != 0)
+                || (e != end && e % grain != 0)
+                || (e - b > grain && (b != begin || e != end)))
+            {
+                ++bad_chunks;
+            }
+            for (std::size_t i = b; i < e; ++i)
+            {
+                ++visits[i];
+            }
+        }
+
+        bool covered() const
+        {
+            for (std::size_t i = 0; i < end; ++i)
+            {
+                if (visits[i] != (i >= begin ? 1 : 0))
+                {
+                    return false;
+                }
+            }
+            return bad_chunks == 0;
+        }
+    };
+
+    void test_coverage(
+        thread_pool& pool,
+        std::size_t begin,
+        std::size_t end,
+        std::size_t grain)
+    {
+        coverage c(begin, end, grain > 0 ? grain : 1);
+        pool.parallel_for(begin, end, grain, [&c](std::size_t b, std::size_t e)
+        {
+            c(b, e);
+        });
+        test_assert(c.covered());
+    }
+
+    TEST_CASE(concurrency)
+    {
+        const thread_pool p1(1);
+        test_assert(p1.concurrency() == 1);
+
+        const thread_pool p0(0);
+        test_assert(p0.concurrency() == 1);
+
+        const thread_pool p4(4);
+        test_assert(p4.concurrency() == 4);
+
+        const thread_pool p;
+        test_assert(p.concurrency() >= 1);
+    }
+
+    TEST_CASE(parallel_for)
+    {
+        for (const int concurrency : { 1, 2, 3, 8 })
+        {
+            thread_pool pool(concurrency);
+            test_coverage(pool, 0, 0, 16);
+            test_coverage(pool, 5, 5, 16);
+            test_coverage(pool, 0, 1, 16);
+            test_coverage(pool, 0, 16, 16);
+            test_coverage(pool, 0, 17, 16);
+            test_coverage(pool, 3, 1000, 16);
+            test_coverage(pool, 0, 100000, 64);
+            test_coverage(pool, 77, 12345, 1);
+            test_coverage(pool, 0, 100, 0);
+        }
+    }
+
+    TEST_CASE(parallel_for_single_chunk)
+    {
+        thread_pool pool(4);
+        coverage small(0, 64, 64);
+        pool.parallel_for(0, 64, 64, [&small](std::size_t b, std::size_t e)
+        {
+            small(b, e);
+        });
+        test_assert(small.covered());
+        test_assert(small.chunks == 1);
+
+        thread_pool serial(1);
+        coverage big(0, 1000, 10);
+        serial.parallel_for(0, 1000, 10, [&big](std::size_t b, std::size_t e)
+        {
+            big(b, e);
+        });
+        test_assert(big.covered());
+        test_assert(big.chunks == 1);
+    }
+
+    TEST_CASE(parallel_for_nested)
+    {
+        thread_pool pool(4);
+        std::atomic<int> total{ 0 };
+        pool.parallel_for(0, 64, 4, [&](std::size_t b, std::size_t e)
+        {
+            for (std::size_t i = b; i < e; ++i)
+            {
+                pool.parallel_for(0, 100, 8, [&](std::size_t c, std::size_t d)
+                {
+                    total += int(d - c);
+                });
+            }
+        });
+        test_assert(total == 6400);
+    }
+
+    TEST_CASE(parallel_for_concurrent_callers)
+    {
+        thread_pool pool(4);
+        std::vector<std::unique_ptr<coverage>> coverages;
+        std::vector<std::thread> callers;
+        for (int i = 0; i < 4; ++i)
+        {
+            coverages.emplace_back(new coverage(i, 50000 + i * 1000, 32));
+        }
+        for (int i = 0; i < 4; ++i)
+        {
+            const auto c = coverages[i].get();
+            callers.emplace_back([&pool, c]
+            {
+                pool.parallel_for(c->begin, c->end, c->grain,
+                    [c](std::size_t b, std::size_t e)
+                {
+                    (*c)(b, e);
+                });
+            });
+        }
+        for (auto& t : callers)
+        {
+            t.join();
+        }
+        for (const auto& c : coverages)
+        {
+            test_assert(c->covered());
+        }
+    }
+
+    TEST_CASE(default_thread_pool)
+    {
+        test_assert(&default_thread_pool() == &default_thread_pool());
+
+        coverage c(10, 5000, 100);
+        tue::parallel_for(10, 5000, 100, [&c](std::size_t b, std::size_t e)
+        {
+            c(b, e);
+        });
+        test_assert(c.covered());
+
+        thread_pool pool(2);
+        coverage d(0, 5000, 100);
+        tue::parallel_for(pool, 0, 5000, 100,
+            [&d](std::size_t b, std::size_t e)
+        {
+            d(b, e);
+        });
+        test_assert(d.covered());
+    }
+}
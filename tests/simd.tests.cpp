@@ -11,8 +11,10 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <type_traits>
 #include <type_traits>
+#include <utility>
 #include <tue/math.hpp>
 #include <tue/sized_bool.hpp>
 #include <tue/unused.hpp>
@@ -122,6 +124,32 @@ namespace
             is_integral_simd_component<simd<float, 4>>::value == false));
     }
 
+    TEST_CASE(prefetch)
+    {
+        // Prefetching is only a hint, even for invalid addresses.
+        const float data[16] = {};
+        prefetch(data);
+        prefetch<prefetch_hint::t0>(data);
+        prefetch<prefetch_hint::t1>(data);
+        prefetch<prefetch_hint::t2>(data);
+        prefetch<prefetch_hint::nta>(data);
+        prefetch(nullptr);
+    }
+
+#ifdef TUE_FMA
+    TEST_CASE(fma_is_fused)
+    {
+        // (1 + 2^-12)^2 - (1 + 2^-11) is exactly 2^-24, which only survives
+        // if the product isn't rounded first.
+        const float32x4 x(1.0f + std::ldexp(1.0f, -12));
+        const float32x4 y(-(1.0f + std::ldexp(1.0f, -11)));
+        test_assert(math::fma(x, x, y) == float32x4(std::ldexp(1.0f, -24)));
+        const float64x4 z(1.0 + std::ldexp(1.0, -27));
+        const float64x4 w(-(1.0 + std::ldexp(1.0, -26)));
+        test_assert(math::fma(z, z, w) == float64x4(std::ldexp(1.0, -54)));
+    }
+#endif
+
     /*
      * Common SIMD Tests
      */
@@ -494,6 +522,18 @@ namespace
             }
         }
 
+        static void TEST_CASE_stream()
+        {
+            const auto s = test_simd();
+            alignas(simd<T, N>) T data[N];
+            s.stream(data);
+            stream_fence();
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(data[i] == s.data()[i]);
+            }
+        }
+
         static void TEST_CASE_data()
         {
             const auto cs = test_simd();
@@ -605,6 +645,316 @@ namespace
             }
         }
 
+        template<int... I>
+        static void test_shuffle(std::integer_sequence<int, I...>)
+        {
+            const auto s1 = test_simd();
+            const auto s2 = shuffle<((I*5 + N/2) % N)...>(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == s1.data()[(i*5 + N/2) % N]);
+            }
+        }
+
+        static void TEST_CASE_shuffle()
+        {
+            test_shuffle(std::make_integer_sequence<int, N>());
+        }
+
+        template<int... I>
+        static void test_shuffle2()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = test_simd2();
+            const auto s3 = shuffle<I...>(s1, s2);
+            const int indices[] = { I... };
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s3.data()[i] == (indices[i] < N
+                    ? s1.data()[indices[i]]
+                    : s2.data()[indices[i] - N]));
+            }
+        }
+
+        template<int... I>
+        static void test_shuffle2(std::integer_sequence<int, I...>)
+        {
+            test_shuffle2<(I%2 == 0
+                ? (I*5 + N/2) % N
+                : N + (I*3 + 1) % N)...>();
+            test_shuffle2<(I < N/2 ? N - 1 - I : N + I)...>();
+        }
+
+        static void TEST_CASE_shuffle2()
+        {
+            test_shuffle2(std::make_integer_sequence<int, N>());
+        }
+
+        template<int L>
+        static void test_broadcast()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = broadcast<L>(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == s1.data()[L]);
+            }
+        }
+
+        static void TEST_CASE_broadcast()
+        {
+            test_broadcast<0>();
+            test_broadcast<N/2>();
+            test_broadcast<N-1>();
+        }
+
+        template<int K>
+        static void test_rotate()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = rotate<K>(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == s1.data()[((i + K) % N + N) % N]);
+            }
+        }
+
+        static void TEST_CASE_rotate()
+        {
+            test_rotate<0>();
+            test_rotate<1>();
+            test_rotate<-1>();
+            test_rotate<N/2 + 1>();
+        }
+
+        template<int... I>
+        static void test_extract(std::integer_sequence<int, I...>)
+        {
+            const auto s = test_simd();
+            const T components[] = { extract<I>(s)... };
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(components[i] == s.data()[i]);
+            }
+        }
+
+        static void TEST_CASE_extract()
+        {
+            test_extract(std::make_integer_sequence<int, N>());
+        }
+
+        template<int... I>
+        static void test_insert(std::integer_sequence<int, I...>)
+        {
+            const auto s = test_simd();
+            const auto x = static_cast<T>(N+1);
+            const simd<T, N> results[] = { insert<I>(s, x)... };
+            for (int i = 0; i < N; ++i)
+            {
+                for (int j = 0; j < N; ++j)
+                {
+                    test_assert(results[i].data()[j] ==
+                        (i == j ? x : s.data()[j]));
+                }
+            }
+        }
+
+        static void TEST_CASE_insert()
+        {
+            test_insert(std::make_integer_sequence<int, N>());
+        }
+
+        static void TEST_CASE_interleave_lo()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = test_simd2();
+            const auto s3 = interleave_lo(s1, s2);
+            for (int i = 0; i < N/2; ++i)
+            {
+                test_assert(s3.data()[2*i] == s1.data()[i]);
+                test_assert(s3.data()[2*i + 1] == s2.data()[i]);
+            }
+        }
+
+        static void TEST_CASE_interleave_hi()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = test_simd2();
+            const auto s3 = interleave_hi(s1, s2);
+            for (int i = 0; i < N/2; ++i)
+            {
+                test_assert(s3.data()[2*i] == s1.data()[N/2 + i]);
+                test_assert(s3.data()[2*i + 1] == s2.data()[N/2 + i]);
+            }
+        }
+
+        static const simd<std::int32_t, N>& test_indices() noexcept
+        {
+            static bool initialized = false;
+            static simd<std::int32_t, N> s;
+            if (!initialized)
+            {
+                for (int i = 0; i < N; ++i)
+                {
+                    s.data()[i] = (i*5 + N/2) % N * 2;
+                }
+                initialized = true;
+            }
+            return s;
+        }
+
+        static void TEST_CASE_gather()
+        {
+            T table[N*2];
+            for (int i = 0; i < N*2; ++i)
+            {
+                table[i] = static_cast<T>(i+1);
+            }
+
+            const auto& indices = test_indices();
+            const auto s = simd<T, N>::gather(table, indices);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s.data()[i] == table[indices.data()[i]]);
+            }
+        }
+
+        static void TEST_CASE_gather_masked()
+        {
+            T table[N*2];
+            for (int i = 0; i < N*2; ++i)
+            {
+                table[i] = static_cast<T>(i+1);
+            }
+
+            simd<sized_bool_t<sizeof(T)>, N> c;
+            for (int i = 0; i < N; ++i)
+            {
+                c.data()[i] = static_cast<sized_bool_t<sizeof(T)>>(
+                    i%2==0 ? 0LL : ~0LL);
+            }
+            const auto& conditions = c;
+
+            const auto& indices = test_indices();
+            const auto s = simd<T, N>::gather(table, indices, conditions);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s.data()[i] == (i%2==0
+                    ? static_cast<T>(0) : table[indices.data()[i]]));
+            }
+        }
+
+        static void TEST_CASE_scatter()
+        {
+            T table[N*2] = {};
+            const auto& indices = test_indices();
+            const auto s = test_simd();
+            s.scatter(table, indices);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(table[indices.data()[i]] == s.data()[i]);
+                test_assert(table[indices.data()[i] + 1] == T());
+            }
+        }
+
+        static void TEST_CASE_scatter_masked()
+        {
+            T table[N*2] = {};
+            simd<sized_bool_t<sizeof(T)>, N> c;
+            for (int i = 0; i < N; ++i)
+            {
+                c.data()[i] = static_cast<sized_bool_t<sizeof(T)>>(
+                    i%2==0 ? 0LL : ~0LL);
+            }
+            const auto& conditions = c;
+
+            const auto& indices = test_indices();
+            const auto s = test_simd();
+            s.scatter(table, indices, conditions);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(table[indices.data()[i]]
+                    == (i%2==0 ? T() : s.data()[i]));
+            }
+        }
+
+        static void TEST_CASE_load_partial()
+        {
+            T data[N];
+            for (int i = 0; i < N; ++i)
+            {
+                data[i] = test_simd().data()[i];
+            }
+
+            for (int count = 0; count <= N; ++count)
+            {
+                const auto s = simd<T, N>::load_partial(data, count);
+                for (int i = 0; i < N; ++i)
+                {
+                    test_assert(s.data()[i]
+                        == (i < count ? data[i] : static_cast<T>(0)));
+                }
+            }
+        }
+
+        static void TEST_CASE_maskload()
+        {
+            T data[N];
+            for (int i = 0; i < N; ++i)
+            {
+                data[i] = test_simd().data()[i];
+            }
+
+            simd<sized_bool_t<sizeof(T)>, N> c;
+            for (int i = 0; i < N; ++i)
+            {
+                c.data()[i] = static_cast<sized_bool_t<sizeof(T)>>(
+                    i%2==0 ? 0LL : ~0LL);
+            }
+            const auto& conditions = c;
+
+            const auto s = simd<T, N>::maskload(data, conditions);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s.data()[i]
+                    == (i%2==0 ? static_cast<T>(0) : data[i]));
+            }
+        }
+
+        static void TEST_CASE_store_partial()
+        {
+            const auto s = test_simd();
+            for (int count = 0; count <= N; ++count)
+            {
+                T data[N+1] = {};
+                s.store_partial(data, count);
+                for (int i = 0; i <= N; ++i)
+                {
+                    test_assert(data[i]
+                        == (i < count ? s.data()[i] : T()));
+                }
+            }
+        }
+
+        static void TEST_CASE_maskstore()
+        {
+            simd<sized_bool_t<sizeof(T)>, N> c;
+            for (int i = 0; i < N; ++i)
+            {
+                c.data()[i] = static_cast<sized_bool_t<sizeof(T)>>(
+                    i%2==0 ? 0LL : ~0LL);
+            }
+            const auto& conditions = c;
+
+            T data[N] = {};
+            const auto s = test_simd();
+            s.maskstore(data, conditions);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(data[i] == (i%2==0 ? T() : s.data()[i]));
+            }
+        }
+
         static void run_all()
         {
             TEST_CASE_alias();
@@ -624,6 +974,7 @@ namespace
             TEST_CASE_loadu();
             TEST_CASE_store();
             TEST_CASE_storeu();
+            TEST_CASE_stream();
             TEST_CASE_data();
             TEST_CASE_equality_operator();
             TEST_CASE_inequality_operator();
@@ -631,6 +982,22 @@ namespace
             TEST_CASE_select();
             TEST_CASE_equal();
             TEST_CASE_not_equal();
+            TEST_CASE_shuffle();
+            TEST_CASE_shuffle2();
+            TEST_CASE_broadcast();
+            TEST_CASE_rotate();
+            TEST_CASE_extract();
+            TEST_CASE_insert();
+            TEST_CASE_interleave_lo();
+            TEST_CASE_interleave_hi();
+            TEST_CASE_gather();
+            TEST_CASE_gather_masked();
+            TEST_CASE_scatter();
+            TEST_CASE_scatter_masked();
+            TEST_CASE_load_partial();
+            TEST_CASE_maskload();
+            TEST_CASE_store_partial();
+            TEST_CASE_maskstore();
         }
     };
 
@@ -878,6 +1245,38 @@ namespace
             }
         }
 
+        static void TEST_CASE_reduce_add()
+        {
+            const auto s = test_simd();
+            T expected = T(0);
+            for (int i = 0; i < N; ++i)
+            {
+                expected = static_cast<T>(expected + s.data()[i]);
+            }
+            test_assert(math::reduce_add(s) == expected);
+        }
+
+        static void TEST_CASE_reduce_min()
+        {
+            // Shuffle 1 through N so the extremes land in the middle.
+            simd<T, N> s;
+            for (int i = 0; i < N; ++i)
+            {
+                s.data()[i] = static_cast<T>((i * 5 + N / 2) % N + 1);
+            }
+            test_assert(math::reduce_min(s) == T(1));
+        }
+
+        static void TEST_CASE_reduce_max()
+        {
+            simd<T, N> s;
+            for (int i = 0; i < N; ++i)
+            {
+                s.data()[i] = static_cast<T>((i * 5 + N / 2) % N + 1);
+            }
+            test_assert(math::reduce_max(s) == static_cast<T>(N));
+        }
+
         static void TEST_CASE_less()
         {
             const auto s1 = test_simd();
@@ -950,6 +1349,9 @@ namespace
             TEST_CASE_abs();
             TEST_CASE_min();
             TEST_CASE_max();
+            TEST_CASE_reduce_add();
+            TEST_CASE_reduce_min();
+            TEST_CASE_reduce_max();
             TEST_CASE_less();
             TEST_CASE_less_equal();
             TEST_CASE_greater();
@@ -967,6 +1369,21 @@ namespace
         using arithmetic_simd_tests<Alias, T, N>::test_simd2;
         using arithmetic_simd_tests<Alias, T, N>::test_simd_abs;
 
+        static const simd<T, N>& test_simd_fractions() noexcept
+        {
+            static bool initialized = false;
+            static simd<T, N> s;
+            if (!initialized)
+            {
+                for (int i = 0; i < N; ++i)
+                {
+                    s.data()[i] = T(i) * T(0.75) - T(N) * T(0.5);
+                }
+                initialized = true;
+            }
+            return s;
+        }
+
         static void TEST_CASE_sin()
         {
             const auto s1 = test_simd();
@@ -1003,21 +1420,151 @@ namespace
             }
         }
 
-        static void TEST_CASE_exp()
+        // Arguments past the range reduction's limit of 2^30 must still be
+        // reduced exactly rather than overflowing the octant.
+        template<typename U = T>
+        static std::enable_if_t<std::is_same<U, double>::value>
+        TEST_CASE_sincos_large()
         {
-            const auto s1 = test_simd();
-            const auto s2 = math::exp(s1);
+            const T values[] = {
+                T(1e9), T(1073741824.0), T(-1.5e9), T(2e9),
+                T(-1e10), T(1e15), T(1e300), std::numeric_limits<T>::max(),
+            };
+            simd<T, N> s;
             for (int i = 0; i < N; ++i)
             {
-                test_assert(nearly_equal(
-                    s2.data()[i], math::exp(s1.data()[i])));
+                s.data()[i] = values[i % 8];
             }
-        }
 
-        static void TEST_CASE_log()
-        {
-            const auto s1 = test_simd_abs();
-            const auto s2 = math::log(s1);
+            simd<T, N> sin_out, cos_out;
+            math::sincos(s, sin_out, cos_out);
+            const auto s2 = math::tan(s);
+            for (int i = 0; i < N; ++i)
+            {
+                const auto sin = math::sin(s.data()[i]);
+                const auto cos = math::cos(s.data()[i]);
+                test_assert(math::abs(sin_out.data()[i] - sin) < T(1e-14));
+                test_assert(math::abs(cos_out.data()[i] - cos) < T(1e-14));
+                test_assert(nearly_equal(s2.data()[i], sin / cos));
+            }
+        }
+
+        template<typename U = T>
+        static std::enable_if_t<!std::is_same<U, double>::value>
+        TEST_CASE_sincos_large()
+        {
+        }
+
+        static void TEST_CASE_tan()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = math::tan(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::tan(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_asin()
+        {
+            simd<T, N> s1;
+            for (int i = 0; i < N; ++i)
+            {
+                s1.data()[i] = T(i + 1) / T(N + 1) * 2 - 1;
+            }
+            const auto s2 = math::asin(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::asin(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_acos()
+        {
+            simd<T, N> s1;
+            for (int i = 0; i < N; ++i)
+            {
+                s1.data()[i] = T(i + 1) / T(N + 1) * 2 - 1;
+            }
+            const auto s2 = math::acos(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::acos(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_atan()
+        {
+            const auto s1 = test_simd_fractions();
+            const auto s2 = math::atan(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::atan(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_atan2()
+        {
+            const auto s1 = test_simd_fractions();
+            simd<T, N> s2;
+            for (int i = 0; i < N; ++i)
+            {
+                s2.data()[i] = T(N) * T(0.5) - T(i);
+            }
+            const auto s3 = math::atan2(s1, s2);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s3.data()[i], math::atan2(s1.data()[i], s2.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_exp()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = math::exp(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::exp(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_exp_range()
+        {
+            const T max_log = math::log(std::numeric_limits<T>::max());
+            simd<T, N> s1;
+            for (int i = 0; i < N; ++i)
+            {
+                s1.data()[i] = max_log * (T(i + 1) / T(N + 1) - T(0.5)) * 2;
+            }
+            const auto s2 = math::exp(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::exp(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_exp2()
+        {
+            const auto s1 = test_simd_fractions();
+            const auto s2 = math::exp2(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::exp2(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_log()
+        {
+            const auto s1 = test_simd_abs();
+            const auto s2 = math::log(s1);
             for (int i = 0; i < N; ++i)
             {
                 test_assert(nearly_equal(
@@ -1025,6 +1572,45 @@ namespace
             }
         }
 
+        static void TEST_CASE_log_range()
+        {
+            simd<T, N> s1;
+            for (int i = 0; i < N; ++i)
+            {
+                s1.data()[i] = i % 2 == 0
+                    ? std::numeric_limits<T>::min() * T(i + 1)
+                    : std::numeric_limits<T>::max() / T(i + 1);
+            }
+            const auto s2 = math::log(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::log(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_log2()
+        {
+            const auto s1 = test_simd_abs();
+            const auto s2 = math::log2(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::log2(s1.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_log10()
+        {
+            const auto s1 = test_simd_abs();
+            const auto s2 = math::log10(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::log10(s1.data()[i])));
+            }
+        }
+
         static void TEST_CASE_pow()
         {
             const auto s1 = test_simd_abs();
@@ -1037,6 +1623,28 @@ namespace
             }
         }
 
+        static void TEST_CASE_pow_special()
+        {
+            const T inf = std::numeric_limits<T>::infinity();
+            const T nan = std::numeric_limits<T>::quiet_NaN();
+            const T bases[] = { T(0), T(0), T(1), T(1), nan, inf, T(-2), T(1) };
+            const T exponents[] = {
+                T(0), T(-0.0), inf, nan, T(0), T(0), T(0), T(-3.5),
+            };
+            simd<T, N> s1;
+            simd<T, N> s2;
+            for (int i = 0; i < N; ++i)
+            {
+                s1.data()[i] = bases[i % 8];
+                s2.data()[i] = exponents[i % 8];
+            }
+            const auto s3 = math::pow(s1, s2);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s3.data()[i] == T(1));
+            }
+        }
+
         static void TEST_CASE_recip()
         {
             const auto s1 = test_simd();
@@ -1059,6 +1667,17 @@ namespace
             }
         }
 
+        static void TEST_CASE_cbrt()
+        {
+            const auto s1 = test_simd_fractions();
+            const auto s2 = math::cbrt(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(
+                    s2.data()[i], math::cbrt(s1.data()[i])));
+            }
+        }
+
         static void TEST_CASE_rsqrt()
         {
             const auto s1 = test_simd_abs();
@@ -1070,18 +1689,193 @@ namespace
             }
         }
 
+        static void TEST_CASE_fma()
+        {
+            const auto s1 = test_simd();
+            const auto s2 = test_simd2();
+            const auto s3 = test_simd_abs();
+            const auto s4 = math::fma(s1, s2, s3);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(nearly_equal(s4.data()[i], math::fma(
+                    s1.data()[i], s2.data()[i], s3.data()[i])));
+            }
+        }
+
+        static void TEST_CASE_floor()
+        {
+            const auto s1 = test_simd_fractions();
+            const auto s2 = math::floor(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == math::floor(s1.data()[i]));
+            }
+        }
+
+        static void TEST_CASE_ceil()
+        {
+            const auto s1 = test_simd_fractions();
+            const auto s2 = math::ceil(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == math::ceil(s1.data()[i]));
+            }
+        }
+
+        static void TEST_CASE_round()
+        {
+            const auto s1 = test_simd_fractions();
+            const auto s2 = math::round(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == math::round(s1.data()[i]));
+            }
+        }
+
+        static void TEST_CASE_trunc()
+        {
+            const auto s1 = test_simd_fractions();
+            const auto s2 = math::trunc(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == math::trunc(s1.data()[i]));
+            }
+        }
+
+        static void TEST_CASE_fract()
+        {
+            const auto s1 = test_simd_fractions();
+            const auto s2 = math::fract(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == math::fract(s1.data()[i]));
+            }
+        }
+
+        static void TEST_CASE_modf()
+        {
+            const auto s1 = test_simd_fractions();
+            simd<T, N> s2;
+            const auto s3 = math::modf(s1, s2);
+            for (int i = 0; i < N; ++i)
+            {
+                T integral;
+                const T fraction = math::modf(s1.data()[i], integral);
+                test_assert(s3.data()[i] == fraction);
+                test_assert(s2.data()[i] == integral);
+            }
+        }
+
+        template<typename U = T>
+        static std::enable_if_t<std::is_same<U, float>::value>
+        TEST_CASE_round_to_int32()
+        {
+            const auto s1 = test_simd() + simd<T, N>(static_cast<T>(0.5));
+            const auto s2 = round_to_int32(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == static_cast<std::int32_t>(
+                    std::nearbyint(s1.data()[i])));
+            }
+        }
+
+        template<typename U = T>
+        static std::enable_if_t<!std::is_same<U, float>::value>
+        TEST_CASE_round_to_int32()
+        {
+        }
+
+        template<typename U = T>
+        static std::enable_if_t<std::is_same<U, float>::value>
+        TEST_CASE_trunc_to_int32()
+        {
+            const auto s1 = test_simd() * simd<T, N>(static_cast<T>(1.75));
+            const auto s2 = trunc_to_int32(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i]
+                    == static_cast<std::int32_t>(s1.data()[i]));
+            }
+        }
+
+        template<typename U = T>
+        static std::enable_if_t<!std::is_same<U, float>::value>
+        TEST_CASE_trunc_to_int32()
+        {
+        }
+
+        // Every width gives the same result as the SSE2 and AVX2
+        // conversions for values that don't fit.
+        template<typename U = T>
+        static std::enable_if_t<std::is_same<U, float>::value>
+        TEST_CASE_to_int32_out_of_range()
+        {
+            // GCC folds the conversion intrinsics on constant operands
+            // without the hardware's out of range result, so the values are
+            // only known at run time.
+            const auto min = std::numeric_limits<std::int32_t>::min();
+            const volatile T values[] = {
+                T(3.0e9), T(-3.0e9), T(2147483648.0), T(-2147483904.0),
+                std::numeric_limits<T>::infinity(),
+                -std::numeric_limits<T>::infinity(),
+                std::numeric_limits<T>::quiet_NaN(),
+                T(-2147483648.0),
+            };
+            simd<T, N> s1;
+            for (int i = 0; i < N; ++i)
+            {
+                s1.data()[i] = values[i % 8];
+            }
+            const auto s2 = round_to_int32(s1);
+            const auto s3 = trunc_to_int32(s1);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == min);
+                test_assert(s3.data()[i] == min);
+            }
+        }
+
+        template<typename U = T>
+        static std::enable_if_t<!std::is_same<U, float>::value>
+        TEST_CASE_to_int32_out_of_range()
+        {
+        }
+
         static void run_all()
         {
             arithmetic_simd_tests<Alias, T, N>::run_all();
             TEST_CASE_sin();
             TEST_CASE_cos();
             TEST_CASE_sincos();
+            TEST_CASE_sincos_large();
+            TEST_CASE_tan();
+            TEST_CASE_asin();
+            TEST_CASE_acos();
+            TEST_CASE_atan();
+            TEST_CASE_atan2();
             TEST_CASE_exp();
+            TEST_CASE_exp_range();
+            TEST_CASE_exp2();
             TEST_CASE_log();
+            TEST_CASE_log_range();
+            TEST_CASE_log2();
+            TEST_CASE_log10();
             TEST_CASE_pow();
+            TEST_CASE_pow_special();
             TEST_CASE_recip();
             TEST_CASE_sqrt();
+            TEST_CASE_cbrt();
             TEST_CASE_rsqrt();
+            TEST_CASE_fma();
+            TEST_CASE_floor();
+            TEST_CASE_ceil();
+            TEST_CASE_round();
+            TEST_CASE_trunc();
+            TEST_CASE_fract();
+            TEST_CASE_modf();
+            TEST_CASE_round_to_int32();
+            TEST_CASE_trunc_to_int32();
+            TEST_CASE_to_int32_out_of_range();
         }
     };
 
@@ -1095,6 +1889,38 @@ namespace
         using arithmetic_simd_tests<Alias, T, N>::test_simd2;
         using arithmetic_simd_tests<Alias, T, N>::test_simd_abs;
 
+        static const simd<T, N>& test_simd_shifts() noexcept
+        {
+            static bool initialized = false;
+            static simd<T, N> s;
+            if (!initialized)
+            {
+                for (int i = 0; i < N; ++i)
+                {
+                    s.data()[i] = static_cast<T>(i % 4);
+                }
+                initialized = true;
+            }
+            return s;
+        }
+
+        static const simd<T, N>& test_simd_extremes() noexcept
+        {
+            static bool initialized = false;
+            static simd<T, N> s;
+            if (!initialized)
+            {
+                for (int i = 0; i < N; ++i)
+                {
+                    s.data()[i] = i%2 == 0
+                        ? static_cast<T>(std::numeric_limits<T>::max() - i)
+                        : static_cast<T>(std::numeric_limits<T>::lowest() + i);
+                }
+                initialized = true;
+            }
+            return s;
+        }
+
         static void TEST_CASE_bitwise_not_operator()
         {
             const auto s1 = test_simd();
@@ -1117,6 +1943,69 @@ namespace
             }
         }
 
+        static void TEST_CASE_inexact_division_operator()
+        {
+            const auto s1 = test_simd2() * simd<T, N>(3) + test_simd();
+            const auto s2 = test_simd2();
+            const auto s3 = s1 / s2;
+            const auto s4 = s1 % s2;
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s3.data()[i] ==
+                    static_cast<T>(s1.data()[i] / s2.data()[i]));
+                test_assert(s4.data()[i] ==
+                    static_cast<T>(s1.data()[i] % s2.data()[i]));
+            }
+        }
+
+        // Division truncates toward zero, and the remainder takes the sign
+        // of the dividend, for every combination of signs. The lowest value
+        // divided by -1 overflows, so it isn't checked.
+        template<typename U = T>
+        static std::enable_if_t<std::is_signed<U>::value>
+        TEST_CASE_signed_division_operator()
+        {
+            const T lowest = std::numeric_limits<T>::lowest();
+            const T max = std::numeric_limits<T>::max();
+            const T dividends[] = {
+                T(-7), T(7), T(-7), T(-8), T(-1), T(-100), T(100), T(0),
+                lowest, lowest, lowest, lowest, lowest + 1, max, max, T(-1),
+            };
+            const T divisors[] = {
+                T(2), T(-2), T(-2), T(3), T(2), T(7), T(-7), T(-3),
+                T(1), T(2), T(-2), max, T(-1), T(-1), lowest, lowest,
+            };
+            simd<T, N> s1;
+            simd<T, N> s2;
+            for (int i = 0; i < N; ++i)
+            {
+                s1.data()[i] = dividends[i % 16];
+                s2.data()[i] = divisors[i % 16];
+            }
+
+            const auto s3 = s1 / s2;
+            const auto s4 = s1 % s2;
+            auto s5 = s1;
+            auto s6 = s1;
+            s5 /= s2;
+            s6 %= s2;
+            for (int i = 0; i < N; ++i)
+            {
+                const auto q = static_cast<T>(s1.data()[i] / s2.data()[i]);
+                const auto r = static_cast<T>(s1.data()[i] % s2.data()[i]);
+                test_assert(s3.data()[i] == q);
+                test_assert(s4.data()[i] == r);
+                test_assert(s5.data()[i] == q);
+                test_assert(s6.data()[i] == r);
+            }
+        }
+
+        template<typename U = T>
+        static std::enable_if_t<!std::is_signed<U>::value>
+        TEST_CASE_signed_division_operator()
+        {
+        }
+
         static void TEST_CASE_bitwise_and_operator()
         {
             const auto s1 = test_simd();
@@ -1162,6 +2051,14 @@ namespace
                 test_assert(s2.data()[i] ==
                     static_cast<T>(s1.data()[i] << 2));
             }
+
+            const auto s3 = test_simd_shifts();
+            const auto s4 = s1 << s3;
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s4.data()[i] ==
+                    static_cast<T>(s1.data()[i] << s3.data()[i]));
+            }
         }
 
         static void TEST_CASE_bitwise_shift_right_operator()
@@ -1173,6 +2070,106 @@ namespace
                 test_assert(s2.data()[i] ==
                     static_cast<T>(s1.data()[i] >> 2));
             }
+
+            const auto s3 = test_simd_shifts();
+            const auto s4 = s1 >> s3;
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s4.data()[i] ==
+                    static_cast<T>(s1.data()[i] >> s3.data()[i]));
+            }
+        }
+
+        // Signed right shifts are arithmetic whichever backend implements
+        // them, so negative lanes shift in copies of their sign bit.
+        template<typename U = T>
+        static std::enable_if_t<std::is_signed<U>::value>
+        TEST_CASE_bitwise_shift_right_negative()
+        {
+            const simd<T, N> s1s[] = { test_simd(), test_simd_extremes() };
+            const int counts[] = { 0, 1, 3, int(sizeof(T) * 8 - 1) };
+            for (const auto& s1 : s1s)
+            {
+                for (const int count : counts)
+                {
+                    const auto s2 = s1 >> count;
+                    auto s3 = s1;
+                    test_assert(&(s3 >>= count) == &s3);
+                    for (int i = 0; i < N; ++i)
+                    {
+                        const auto expected =
+                            static_cast<T>(s1.data()[i] >> count);
+                        test_assert(s2.data()[i] == expected);
+                        test_assert(s3.data()[i] == expected);
+                    }
+                }
+
+                const auto s4 = test_simd_shifts();
+                const auto s5 = s1 >> s4;
+                auto s6 = s1;
+                test_assert(&(s6 >>= s4) == &s6);
+                for (int i = 0; i < N; ++i)
+                {
+                    const auto expected =
+                        static_cast<T>(s1.data()[i] >> s4.data()[i]);
+                    test_assert(s5.data()[i] == expected);
+                    test_assert(s6.data()[i] == expected);
+                }
+            }
+        }
+
+        template<typename U = T>
+        static std::enable_if_t<!std::is_signed<U>::value>
+        TEST_CASE_bitwise_shift_right_negative()
+        {
+        }
+
+        // 8- and 16-bit components are promoted to int before shifting, so
+        // shifts by their width or more are well-defined.
+        template<typename U = T>
+        static std::enable_if_t<(sizeof(U) < sizeof(int))>
+        TEST_CASE_bitwise_shift_narrow()
+        {
+            constexpr int width = int(sizeof(T) * 8);
+            const int left_counts[] = { 0, 1, width - 1, width };
+            const int right_counts[] = { 0, width - 1, width, 31 };
+            const auto s1 = test_simd_abs();
+            const auto s2 = test_simd_extremes();
+            for (int c = 0; c < 4; ++c)
+            {
+                const auto s3 = s1 << left_counts[c];
+                const auto s4 = s2 >> right_counts[c];
+                for (int i = 0; i < N; ++i)
+                {
+                    test_assert(s3.data()[i] ==
+                        static_cast<T>(s1.data()[i] << left_counts[c]));
+                    test_assert(s4.data()[i] ==
+                        static_cast<T>(s2.data()[i] >> right_counts[c]));
+                }
+            }
+
+            simd<T, N> left;
+            simd<T, N> right;
+            for (int i = 0; i < N; ++i)
+            {
+                left.data()[i] = static_cast<T>(left_counts[i % 4]);
+                right.data()[i] = static_cast<T>(right_counts[i % 4]);
+            }
+            const auto s5 = s1 << left;
+            const auto s6 = s2 >> right;
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s5.data()[i] ==
+                    static_cast<T>(s1.data()[i] << left_counts[i % 4]));
+                test_assert(s6.data()[i] ==
+                    static_cast<T>(s2.data()[i] >> right_counts[i % 4]));
+            }
+        }
+
+        template<typename U = T>
+        static std::enable_if_t<(sizeof(U) >= sizeof(int))>
+        TEST_CASE_bitwise_shift_narrow()
+        {
         }
 
         static void TEST_CASE_modulo_assignment_operator()
@@ -1232,6 +2229,15 @@ namespace
                 test_assert(s1.data()[i] ==
                     static_cast<T>(test_simd().data()[i] << 2));
             }
+
+            auto s2 = test_simd();
+            const auto s3 = test_simd_shifts();
+            test_assert(&(s2 <<= s3) == &s2);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == static_cast<T>(
+                    test_simd().data()[i] << s3.data()[i]));
+            }
         }
 
         static void TEST_CASE_bitwise_shift_right_assignment_operator()
@@ -1243,6 +2249,114 @@ namespace
                 test_assert(s1.data()[i] ==
                     static_cast<T>(test_simd_abs().data()[i] >> 2));
             }
+
+            auto s2 = test_simd_abs();
+            const auto s3 = test_simd_shifts();
+            test_assert(&(s2 >>= s3) == &s2);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s2.data()[i] == static_cast<T>(
+                    test_simd_abs().data()[i] >> s3.data()[i]));
+            }
+        }
+
+        static void TEST_CASE_adds()
+        {
+            const simd<T, N> s1s[] = { test_simd(), test_simd_extremes() };
+            const simd<T, N> s2s[] = { test_simd2(), test_simd_extremes() };
+            for (const auto& s1 : s1s)
+            {
+                for (const auto& s2 : s2s)
+                {
+                    const auto s3 = math::adds(s1, s2);
+                    for (int i = 0; i < N; ++i)
+                    {
+                        test_assert(s3.data()[i] ==
+                            math::adds(s1.data()[i], s2.data()[i]));
+                    }
+                }
+            }
+        }
+
+        static void TEST_CASE_subs()
+        {
+            const simd<T, N> s1s[] = { test_simd(), test_simd_extremes() };
+            const simd<T, N> s2s[] = { test_simd2(), test_simd_extremes() };
+            for (const auto& s1 : s1s)
+            {
+                for (const auto& s2 : s2s)
+                {
+                    const auto s3 = math::subs(s1, s2);
+                    for (int i = 0; i < N; ++i)
+                    {
+                        test_assert(s3.data()[i] ==
+                            math::subs(s1.data()[i], s2.data()[i]));
+                    }
+                }
+            }
+        }
+
+        static void TEST_CASE_avg()
+        {
+            const simd<T, N> s1s[] = { test_simd(), test_simd_extremes() };
+            const simd<T, N> s2s[] = { test_simd2(), test_simd_extremes() };
+            for (const auto& s1 : s1s)
+            {
+                for (const auto& s2 : s2s)
+                {
+                    const auto s3 = math::avg(s1, s2);
+                    for (int i = 0; i < N; ++i)
+                    {
+                        test_assert(s3.data()[i] ==
+                            math::avg(s1.data()[i], s2.data()[i]));
+                    }
+                }
+            }
+        }
+
+        template<typename U = T>
+        static std::enable_if_t<(sizeof(U) > 1)> TEST_CASE_packs()
+        {
+            const auto s1 = test_simd_extremes();
+            const auto s2 = test_simd();
+            const auto s3 = packs(s1, s2);
+            const auto s4 = packus(s1, s2);
+            using S = typename decltype(s3)::component_type;
+            using V = typename decltype(s4)::component_type;
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(s3.data()[i] == tue::detail_::saturate_cast<S>(
+                    s1.data()[i]));
+                test_assert(s3.data()[N + i] == tue::detail_::saturate_cast<S>(
+                    s2.data()[i]));
+                test_assert(s4.data()[i] == tue::detail_::saturate_cast<V>(
+                    s1.data()[i]));
+                test_assert(s4.data()[N + i] == tue::detail_::saturate_cast<V>(
+                    s2.data()[i]));
+            }
+        }
+
+        template<typename U = T>
+        static std::enable_if_t<(sizeof(U) == 1)> TEST_CASE_packs()
+        {
+        }
+
+        template<typename U = T>
+        static std::enable_if_t<(sizeof(U) < 8 && N >= 4)> TEST_CASE_widen()
+        {
+            const auto s = test_simd_extremes();
+            const auto lo = widen_lo(s);
+            const auto hi = widen_hi(s);
+            for (int i = 0; i < N/2; ++i)
+            {
+                test_assert(lo.data()[i] == s.data()[i]);
+                test_assert(hi.data()[i] == s.data()[N/2 + i]);
+            }
+        }
+
+        template<typename U = T>
+        static std::enable_if_t<!(sizeof(U) < 8 && N >= 4)> TEST_CASE_widen()
+        {
         }
 
         static void run_all()
@@ -1250,17 +2364,91 @@ namespace
             arithmetic_simd_tests<Alias, T, N>::run_all();
             TEST_CASE_bitwise_not_operator();
             TEST_CASE_modulo_operator();
+            TEST_CASE_inexact_division_operator();
+            TEST_CASE_signed_division_operator();
             TEST_CASE_bitwise_and_operator();
             TEST_CASE_bitwise_or_operator();
             TEST_CASE_bitwise_xor_operator();
             TEST_CASE_bitwise_shift_left_operator();
             TEST_CASE_bitwise_shift_right_operator();
+            TEST_CASE_bitwise_shift_right_negative();
+            TEST_CASE_bitwise_shift_narrow();
             TEST_CASE_modulo_assignment_operator();
             TEST_CASE_bitwise_and_assignment_operator();
             TEST_CASE_bitwise_or_assignment_operator();
             TEST_CASE_bitwise_xor_assignment_operator();
             TEST_CASE_bitwise_shift_left_assignment_operator();
             TEST_CASE_bitwise_shift_right_assignment_operator();
+            TEST_CASE_adds();
+            TEST_CASE_subs();
+            TEST_CASE_avg();
+            TEST_CASE_packs();
+            TEST_CASE_widen();
+        }
+    };
+
+    /*
+     * Boolean SIMD Tests
+     */
+    template<typename Alias, typename T, int N>
+    struct bool_simd_tests : public common_simd_tests<Alias, T, N>
+    {
+        static const simd<T, N>& test_simd_mask() noexcept
+        {
+            static bool initialized = false;
+            static simd<T, N> s;
+            if (!initialized)
+            {
+                for (int i = 0; i < N; ++i)
+                {
+                    s.data()[i] = static_cast<T>(i % 3 == 1 ? ~0LL : 0LL);
+                }
+                initialized = true;
+            }
+            return s;
+        }
+
+        static void TEST_CASE_movemask()
+        {
+            const auto s = test_simd_mask();
+            const std::uint64_t mask = math::movemask(s);
+            for (int i = 0; i < N; ++i)
+            {
+                test_assert(((mask >> i) & 1) == (i % 3 == 1 ? 1u : 0u));
+            }
+            test_assert(N == 64 || (mask >> (N % 64)) == 0);
+
+            test_assert(math::movemask(simd<T, N>::zero()) == 0);
+        }
+
+        static void TEST_CASE_any()
+        {
+            test_assert(math::any(test_simd_mask()) == true);
+            test_assert(math::any(simd<T, N>::zero()) == false);
+            test_assert(math::any(simd<T, N>(static_cast<T>(~0LL))) == true);
+        }
+
+        static void TEST_CASE_all()
+        {
+            test_assert(math::all(test_simd_mask()) == false);
+            test_assert(math::all(simd<T, N>::zero()) == false);
+            test_assert(math::all(simd<T, N>(static_cast<T>(~0LL))) == true);
+        }
+
+        static void TEST_CASE_none()
+        {
+            test_assert(math::none(test_simd_mask()) == false);
+            test_assert(math::none(simd<T, N>::zero()) == true);
+            test_assert(math::none(simd<T, N>(static_cast<T>(~0LL))) == false);
+        }
+
+        static void run_all()
+        {
+            common_simd_tests<Alias, T, N>::run_all();
+            TEST_CASE_movemask();
+            TEST_CASE_any();
+            TEST_CASE_all();
+            TEST_CASE_none();
         }
     };
 
@@ -1279,7 +2467,7 @@ namespace
 #define BOOL_SIMD_TEST_CASES(Alias, T, N) \
     TEST_CASE(Alias) \
     { \
-        common_simd_tests<Alias, T, N>::run_all(); \
+        bool_simd_tests<Alias, T, N>::run_all(); \
     }
 
     FLOAT_SIMD_TEST_CASES(float32x2, float, 2)
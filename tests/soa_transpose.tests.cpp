@@ -0,0 +1,126 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/soa_transpose.hpp>
+#include "tue.tests.hpp"
+
+#include <tue/mat.hpp>
+#include <tue/quat.hpp>
+#include <tue/simd.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    // Fills `count` elements of `V` with distinct components, starting one
+    // element in so that the loads and stores are unaligned.
+    template<typename V, typename T, int C>
+    void fill(V* aos, int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            for (int k = 0; k < C; ++k)
+            {
+                aos[i].data()[k] = static_cast<T>(i * 100 + k);
+            }
+        }
+    }
+
+    template<int W, typename V, typename T, int C>
+    void test_round_trip()
+    {
+        V aos[W + 1];
+        fill<V, T, C>(aos, W + 1);
+
+        const auto soa = load_soa<W>(aos + 1);
+        for (int i = 0; i < W; ++i)
+        {
+            for (int k = 0; k < C; ++k)
+            {
+                const auto& s = soa.data()[k];
+                test_assert(s.data()[i] == static_cast<T>((i + 1) * 100 + k));
+            }
+        }
+
+        V result[W + 2];
+        fill<V, T, C>(result, W + 2);
+        auto doubled = soa;
+        for (int k = 0; k < C; ++k)
+        {
+            doubled.data()[k] += doubled.data()[k];
+        }
+        store_aos(doubled, result + 1);
+        for (int k = 0; k < C; ++k)
+        {
+            test_assert(result[0].data()[k] == static_cast<T>(k));
+            test_assert(
+                result[W + 1].data()[k] == static_cast<T>((W + 1) * 100 + k));
+        }
+        for (int i = 0; i < W; ++i)
+        {
+            for (int k = 0; k < C; ++k)
+            {
+                test_assert(
+                    result[i + 1].data()[k]
+                    == static_cast<T>(((i + 1) * 100 + k) * 2));
+            }
+        }
+    }
+
+    template<int W>
+    void test_all_float()
+    {
+        test_round_trip<W, fvec2, float, 2>();
+        test_round_trip<W, fvec3, float, 3>();
+        test_round_trip<W, fvec4, float, 4>();
+        test_round_trip<W, fquat, float, 4>();
+        test_round_trip<W, fmat4x4, float, 16>();
+    }
+
+    TEST_CASE(float32x4_round_trip)
+    {
+        test_all_float<4>();
+    }
+
+    TEST_CASE(float32x8_round_trip)
+    {
+        test_all_float<8>();
+    }
+
+    TEST_CASE(float32x16_round_trip)
+    {
+        test_all_float<16>();
+    }
+
+    TEST_CASE(float64_round_trip)
+    {
+        test_round_trip<2, dvec3, double, 3>();
+        test_round_trip<4, dvec4, double, 4>();
+        test_round_trip<4, dmat4x4, double, 16>();
+    }
+
+    TEST_CASE(int32_round_trip)
+    {
+        test_round_trip<4, ivec2, int, 2>();
+        test_round_trip<8, ivec3, int, 3>();
+        test_round_trip<4, ivec4, int, 4>();
+    }
+
+    TEST_CASE(mat4x4_layout)
+    {
+        fmat4x4 aos[4];
+        for (int i = 0; i < 4; ++i)
+        {
+            aos[i] = fmat4x4::identity() * float(i + 1);
+        }
+        const auto soa = load_soa<4>(aos);
+        test_assert(soa[1][1] == float32x4(1.0f, 2.0f, 3.0f, 4.0f));
+        test_assert(soa[2][1] == float32x4(0.0f));
+    }
+}
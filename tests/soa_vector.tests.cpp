@@ -0,0 +1,241 @@
+//                Copyright Jo Bates 2015.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+//     Please report any bugs, typos, or suggestions to
+//         https://github.com/Cincinesh/tue/issues
+
+#include <tue/soa_vector.hpp>
+#include "tue.tests.hpp"
+
+#include <cstdint>
+#include <utility>
+
+#include <tue/mat.hpp>
+#include <tue/quat.hpp>
+#include <tue/simd.hpp>
+#include <tue/sized_bool.hpp>
+#include <tue/vec.hpp>
+
+namespace
+{
+    using namespace tue;
+
+    TEST_CASE(default_constructor)
+    {
+        const soa_vector<fvec3> v;
+        test_assert(v.size() == 0);
+        test_assert(v.capacity() == 0);
+        test_assert(v.empty());
+    }
+
+    TEST_CASE(count_constructor)
+    {
+        const soa_vector<fvec3> v(5);
+        test_assert(v.size() == 5);
+        test_assert(v.capacity() >= 5);
+        for (std::size_t i = 0; i < v.size(); ++i)
+        {
+            test_assert(v.get(i) == fvec3(0.0f));
+        }
+
+        const soa_vector<fvec3> w(3, fvec3(1.0f, 2.0f, 3.0f));
+        test_assert(w.size() == 3);
+        for (std::size_t i = 0; i < w.size(); ++i)
+        {
+            test_assert(w.get(i) == fvec3(1.0f, 2.0f, 3.0f));
+        }
+    }
+
+    TEST_CASE(push_back)
+    {
+        soa_vector<fvec3> v;
+        for (int i = 0; i < 100; ++i)
+        {
+            v.push_back(fvec3(float(i), float(i * 2), float(i * 3)));
+        }
+        test_assert(v.size() == 100);
+        for (int i = 0; i < 100; ++i)
+        {
+            test_assert(
+                v.get(i) == fvec3(float(i), float(i * 2), float(i * 3)));
+            test_assert(v.stream(0)[i] == float(i));
+            test_assert(v.stream(1)[i] == float(i * 2));
+            test_assert(v.stream(2)[i] == float(i * 3));
+        }
+
+        v.pop_back();
+        test_assert(v.size() == 99);
+        v.clear();
+        test_assert(v.empty());
+        test_assert(v.capacity() >= 100);
+    }
+
+    TEST_CASE(set)
+    {
+        soa_vector<ivec2> v(4);
+        v.set(2, ivec2(7, 8));
+        test_assert(v.get(1) == ivec2(0, 0));
+        test_assert(v.get(2) == ivec2(7, 8));
+    }
+
+    TEST_CASE(resize)
+    {
+        soa_vector<dvec2> v(2, dvec2(1.0, 2.0));
+        v.resize(5, dvec2(3.0, 4.0));
+        test_assert(v.size() == 5);
+        test_assert(v.get(1) == dvec2(1.0, 2.0));
+        test_assert(v.get(2) == dvec2(3.0, 4.0));
+        test_assert(v.get(4) == dvec2(3.0, 4.0));
+
+        v.resize(1);
+        v.resize(3);
+        test_assert(v.get(0) == dvec2(1.0, 2.0));
+        test_assert(v.get(1) == dvec2(0.0, 0.0));
+        test_assert(v.get(2) == dvec2(0.0, 0.0));
+    }
+
+    TEST_CASE(stream_alignment)
+    {
+        soa_vector<vec4<std::uint8_t>> v(3);
+        for (int k = 0; k < v.stream_count; ++k)
+        {
+            test_assert(
+                reinterpret_cast<std::uintptr_t>(v.stream(k)) % 128 == 0);
+        }
+
+        soa_vector<dvec3> w(200);
+        for (int k = 0; k < w.stream_count; ++k)
+        {
+            test_assert(
+                reinterpret_cast<std::uintptr_t>(w.stream(k)) % 128 == 0);
+            test_assert(w.capacity() % 64 == 0);
+        }
+    }
+
+    TEST_CASE(copy_and_move)
+    {
+        soa_vector<fvec3> v;
+        for (int i = 0; i < 10; ++i)
+        {
+            v.push_back(fvec3(float(i)));
+        }
+
+        soa_vector<fvec3> copy(v);
+        test_assert(copy.size() == 10);
+        test_assert(copy.stream(0) != v.stream(0));
+        test_assert(copy.get(9) == fvec3(9.0f));
+
+        soa_vector<fvec3> assigned;
+        assigned = copy;
+        test_assert(assigned.get(3) == fvec3(3.0f));
+
+        const auto streams = v.stream(0);
+        soa_vector<fvec3> moved(std::move(v));
+        test_assert(moved.stream(0) == streams);
+        test_assert(moved.size() == 10);
+        test_assert(v.size() == 0);
+
+        assigned = std::move(moved);
+        test_assert(assigned.stream(0) == streams);
+        test_assert(assigned.get(9) == fvec3(9.0f));
+    }
+
+    TEST_CASE(for_each_packet)
+    {
+        soa_vector<fvec3> v;
+        for (int i = 0; i < 37; ++i)
+        {
+            v.push_back(fvec3(float(i), 1.0f, 2.0f));
+        }
+
+        int packets = 0;
+        v.for_each_packet<8>([&](const soa_packet<soa_vector<fvec3>, 8>& p)
+        {
+            test_assert(p.index() == std::size_t(packets * 8));
+            test_assert(p.count() == (packets < 4 ? 8 : 5));
+            auto x = p.load();
+            test_assert(x[0].data()[0] == float(packets * 8));
+            x *= simd<float, 8>(2.0f);
+            p.store(x);
+            ++packets;
+        });
+        test_assert(packets == 5);
+
+        for (int i = 0; i < 37; ++i)
+        {
+            test_assert(v.get(i) == fvec3(float(i * 2), 2.0f, 4.0f));
+        }
+
+        const auto& cv = v;
+        float sum = 0.0f;
+        cv.for_each_packet<4>([&](const auto& p)
+        {
+            const auto x = p.load();
+            for (int j = 0; j < p.count(); ++j)
+            {
+                sum += x[0].data()[j];
+            }
+        });
+        test_assert(sum == 36.0f * 37.0f);
+    }
+
+    TEST_CASE(packet_mask)
+    {
+        soa_vector<dvec2> v(6);
+        std::uint8_t last = 0;
+        v.for_each_packet<4>([&](const auto& p)
+        {
+            last = math::movemask(p.mask());
+        });
+        test_assert(last == 0x3);
+
+        soa_vector<vec3<std::int8_t>> w(64 + 17);
+        std::uint64_t mask = 0;
+        w.for_each_packet<32>([&](const auto& p)
+        {
+            mask = math::movemask(p.mask());
+        });
+        test_assert(mask == 0x1FFFF);
+    }
+
+    TEST_CASE(load_and_store_packet)
+    {
+        using S = simd<std::int32_t, 4>;
+        soa_vector<ivec4> v(8);
+        const auto p = vec4<S>(
+            S(1, 2, 3, 4), S(5, 6, 7, 8), S(9, 10, 11, 12), S(13, 14, 15, 16));
+        v.store_packet<4>(4, p);
+        test_assert(v.get(3) == ivec4(0));
+        test_assert(v.get(5) == ivec4(2, 6, 10, 14));
+        test_assert(v.load_packet<4>(4) == p);
+    }
+
+    TEST_CASE(quat_and_mat)
+    {
+        soa_vector<fquat> q;
+        q.push_back(fquat(1.0f, 2.0f, 3.0f, 4.0f));
+        q.push_back(fquat::identity());
+        test_assert(q.stream_count == 4);
+        test_assert(q.get(0) == fquat(1.0f, 2.0f, 3.0f, 4.0f));
+        test_assert(q.get(1) == fquat::identity());
+        q.for_each_packet<4>([](const auto& p)
+        {
+            p.store(math::conjugate(p.load()));
+        });
+        test_assert(q.get(0) == fquat(-1.0f, -2.0f, -3.0f, 4.0f));
+
+        const auto m = fmat3x2(
+            fvec2(1.0f, 2.0f), fvec2(3.0f, 4.0f), fvec2(5.0f, 6.0f));
+        soa_vector<fmat3x2> ms(3, m);
+        test_assert(ms.stream_count == 6);
+        test_assert(ms.stream(3)[2] == 4.0f);
+        test_assert(ms.get(2) == m);
+        ms.for_each_packet<8>([](const auto& p)
+        {
+            p.store(p.load() * simd<float, 8>(2.0f));
+        });
+        test_assert(ms.get(1) == m * 2.0f);
+    }
+}
@@ -643,6 +643,41 @@ namespace
         test_assert(nearly_equal(c[1], math::cos(3.4)));
     }
 
+    TEST_CASE(tan)
+    {
+        const auto v = math::tan(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::tan(1.2)));
+        test_assert(nearly_equal(v[1], math::tan(3.4)));
+    }
+
+    TEST_CASE(asin)
+    {
+        const auto v = math::asin(dvec2(0.12, 0.34));
+        test_assert(nearly_equal(v[0], math::asin(0.12)));
+        test_assert(nearly_equal(v[1], math::asin(0.34)));
+    }
+
+    TEST_CASE(acos)
+    {
+        const auto v = math::acos(dvec2(0.12, 0.34));
+        test_assert(nearly_equal(v[0], math::acos(0.12)));
+        test_assert(nearly_equal(v[1], math::acos(0.34)));
+    }
+
+    TEST_CASE(atan)
+    {
+        const auto v = math::atan(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::atan(1.2)));
+        test_assert(nearly_equal(v[1], math::atan(3.4)));
+    }
+
+    TEST_CASE(atan2)
+    {
+        const auto v = math::atan2(dvec2(1.2, 3.4), dvec2(5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::atan2(1.2, 5.6)));
+        test_assert(nearly_equal(v[1], math::atan2(3.4, 7.8)));
+    }
+
     TEST_CASE(exp)
     {
         const auto v = math::exp(dvec2(1.2, 3.4));
@@ -650,6 +685,13 @@ namespace
         test_assert(nearly_equal(v[1], math::exp(3.4)));
     }
 
+    TEST_CASE(exp2)
+    {
+        const auto v = math::exp2(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::exp2(1.2)));
+        test_assert(nearly_equal(v[1], math::exp2(3.4)));
+    }
+
     TEST_CASE(log)
     {
         const auto v = math::log(dvec2(1.2, 3.4));
@@ -657,6 +699,20 @@ namespace
         test_assert(nearly_equal(v[1], math::log(3.4)));
     }
 
+    TEST_CASE(log2)
+    {
+        const auto v = math::log2(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::log2(1.2)));
+        test_assert(nearly_equal(v[1], math::log2(3.4)));
+    }
+
+    TEST_CASE(log10)
+    {
+        const auto v = math::log10(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::log10(1.2)));
+        test_assert(nearly_equal(v[1], math::log10(3.4)));
+    }
+
     TEST_CASE(abs)
     {
         const auto v = math::abs(dvec2(1.2, -3.4));
@@ -685,6 +741,13 @@ namespace
         test_assert(nearly_equal(v[1], math::sqrt(3.4)));
     }
 
+    TEST_CASE(cbrt)
+    {
+        const auto v = math::cbrt(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::cbrt(1.2)));
+        test_assert(nearly_equal(v[1], math::cbrt(3.4)));
+    }
+
     TEST_CASE(rsqrt)
     {
         const auto v = math::rsqrt(dvec2(1.2, 3.4));
@@ -692,6 +755,182 @@ namespace
         test_assert(nearly_equal(v[1], math::rsqrt(3.4)));
     }
 
+    TEST_CASE(fma)
+    {
+        const auto v = math::fma(
+            dvec2(1.2, 3.4), dvec2(5.6, 7.8), dvec2(9.10, 11.12));
+        test_assert(v[0] == math::fma(1.2, 5.6, 9.10));
+        test_assert(v[1] == math::fma(3.4, 7.8, 11.12));
+    }
+
+    TEST_CASE(floor)
+    {
+        const auto v = math::floor(dvec2(1.2, 3.4));
+        test_assert(v[0] == math::floor(1.2));
+        test_assert(v[1] == math::floor(3.4));
+    }
+
+    TEST_CASE(ceil)
+    {
+        const auto v = math::ceil(dvec2(1.2, 3.4));
+        test_assert(v[0] == math::ceil(1.2));
+        test_assert(v[1] == math::ceil(3.4));
+    }
+
+    TEST_CASE(round)
+    {
+        const auto v = math::round(dvec2(1.2, 3.4));
+        test_assert(v[0] == math::round(1.2));
+        test_assert(v[1] == math::round(3.4));
+    }
+
+    TEST_CASE(trunc)
+    {
+        const auto v = math::trunc(dvec2(1.2, 3.4));
+        test_assert(v[0] == math::trunc(1.2));
+        test_assert(v[1] == math::trunc(3.4));
+    }
+
+    TEST_CASE(fract)
+    {
+        const auto v = math::fract(dvec2(1.2, 3.4));
+        test_assert(v[0] == math::fract(1.2));
+        test_assert(v[1] == math::fract(3.4));
+    }
+
+    TEST_CASE(modf)
+    {
+        dvec2 i;
+        double i0, i1;
+        const auto v = math::modf(dvec2(1.2, 3.4), i);
+        test_assert(v[0] == math::modf(1.2, i0));
+        test_assert(i[0] == i0);
+        test_assert(v[1] == math::modf(3.4, i1));
+        test_assert(i[1] == i1);
+    }
+
+    TEST_CASE(fast_sin)
+    {
+        const auto v = math::fast::sin(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::sin(1.2)));
+        test_assert(nearly_equal(v[1], math::sin(3.4)));
+    }
+
+    TEST_CASE(fast_cos)
+    {
+        const auto v = math::fast::cos(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::cos(1.2)));
+        test_assert(nearly_equal(v[1], math::cos(3.4)));
+    }
+
+    TEST_CASE(fast_sincos)
+    {
+        dvec2 s, c;
+        math::fast::sincos(dvec2(1.2, 3.4), s, c);
+
+        test_assert(nearly_equal(s[0], math::sin(1.2)));
+        test_assert(nearly_equal(s[1], math::sin(3.4)));
+
+        test_assert(nearly_equal(c[0], math::cos(1.2)));
+        test_assert(nearly_equal(c[1], math::cos(3.4)));
+    }
+
+    TEST_CASE(fast_exp)
+    {
+        const auto v = math::fast::exp(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::exp(1.2)));
+        test_assert(nearly_equal(v[1], math::exp(3.4)));
+    }
+
+    TEST_CASE(fast_log)
+    {
+        const auto v = math::fast::log(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::log(1.2)));
+        test_assert(nearly_equal(v[1], math::log(3.4)));
+    }
+
+    TEST_CASE(fast_pow)
+    {
+        const auto v = math::fast::pow(dvec2(1.2, 3.4), dvec2(5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::pow(1.2, 5.6)));
+        test_assert(nearly_equal(v[1], math::pow(3.4, 7.8)));
+    }
+
+    TEST_CASE(fast_recip)
+    {
+        const auto v = math::fast::recip(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::recip(1.2)));
+        test_assert(nearly_equal(v[1], math::recip(3.4)));
+    }
+
+    TEST_CASE(fast_rsqrt)
+    {
+        const auto v = math::fast::rsqrt(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::rsqrt(1.2)));
+        test_assert(nearly_equal(v[1], math::rsqrt(3.4)));
+    }
+
+    TEST_CASE(precise_sin)
+    {
+        const auto v = math::precise::sin(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::sin(1.2)));
+        test_assert(nearly_equal(v[1], math::sin(3.4)));
+    }
+
+    TEST_CASE(precise_cos)
+    {
+        const auto v = math::precise::cos(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::cos(1.2)));
+        test_assert(nearly_equal(v[1], math::cos(3.4)));
+    }
+
+    TEST_CASE(precise_sincos)
+    {
+        dvec2 s, c;
+        math::precise::sincos(dvec2(1.2, 3.4), s, c);
+
+        test_assert(nearly_equal(s[0], math::sin(1.2)));
+        test_assert(nearly_equal(s[1], math::sin(3.4)));
+
+        test_assert(nearly_equal(c[0], math::cos(1.2)));
+        test_assert(nearly_equal(c[1], math::cos(3.4)));
+    }
+
+    TEST_CASE(precise_exp)
+    {
+        const auto v = math::precise::exp(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::exp(1.2)));
+        test_assert(nearly_equal(v[1], math::exp(3.4)));
+    }
+
+    TEST_CASE(precise_log)
+    {
+        const auto v = math::precise::log(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::log(1.2)));
+        test_assert(nearly_equal(v[1], math::log(3.4)));
+    }
+
+    TEST_CASE(precise_pow)
+    {
+        const auto v = math::precise::pow(dvec2(1.2, 3.4), dvec2(5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::pow(1.2, 5.6)));
+        test_assert(nearly_equal(v[1], math::pow(3.4, 7.8)));
+    }
+
+    TEST_CASE(precise_recip)
+    {
+        const auto v = math::precise::recip(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::recip(1.2)));
+        test_assert(nearly_equal(v[1], math::recip(3.4)));
+    }
+
+    TEST_CASE(precise_rsqrt)
+    {
+        const auto v = math::precise::rsqrt(dvec2(1.2, 3.4));
+        test_assert(nearly_equal(v[0], math::rsqrt(1.2)));
+        test_assert(nearly_equal(v[1], math::rsqrt(3.4)));
+    }
+
     TEST_CASE(min)
     {
         const auto v = math::min(dvec2(1.2, 3.4), dvec2(5.6, -7.8));
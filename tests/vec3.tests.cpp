@@ -813,6 +813,47 @@ namespace
         test_assert(nearly_equal(c[2], math::cos(5.6)));
     }
 
+    TEST_CASE(tan)
+    {
+        const auto v = math::tan(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::tan(1.2)));
+        test_assert(nearly_equal(v[1], math::tan(3.4)));
+        test_assert(nearly_equal(v[2], math::tan(5.6)));
+    }
+
+    TEST_CASE(asin)
+    {
+        const auto v = math::asin(dvec3(0.12, 0.34, 0.56));
+        test_assert(nearly_equal(v[0], math::asin(0.12)));
+        test_assert(nearly_equal(v[1], math::asin(0.34)));
+        test_assert(nearly_equal(v[2], math::asin(0.56)));
+    }
+
+    TEST_CASE(acos)
+    {
+        const auto v = math::acos(dvec3(0.12, 0.34, 0.56));
+        test_assert(nearly_equal(v[0], math::acos(0.12)));
+        test_assert(nearly_equal(v[1], math::acos(0.34)));
+        test_assert(nearly_equal(v[2], math::acos(0.56)));
+    }
+
+    TEST_CASE(atan)
+    {
+        const auto v = math::atan(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::atan(1.2)));
+        test_assert(nearly_equal(v[1], math::atan(3.4)));
+        test_assert(nearly_equal(v[2], math::atan(5.6)));
+    }
+
+    TEST_CASE(atan2)
+    {
+        const auto v = math::atan2(
+            dvec3(1.2, 3.4, 5.6), dvec3(7.8, 9.10, 11.12));
+        test_assert(nearly_equal(v[0], math::atan2(1.2, 7.8)));
+        test_assert(nearly_equal(v[1], math::atan2(3.4, 9.10)));
+        test_assert(nearly_equal(v[2], math::atan2(5.6, 11.12)));
+    }
+
     TEST_CASE(exp)
     {
         const auto v = math::exp(dvec3(1.2, 3.4, 5.6));
@@ -821,6 +862,14 @@ namespace
         test_assert(nearly_equal(v[2], math::exp(5.6)));
     }
 
+    TEST_CASE(exp2)
+    {
+        const auto v = math::exp2(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::exp2(1.2)));
+        test_assert(nearly_equal(v[1], math::exp2(3.4)));
+        test_assert(nearly_equal(v[2], math::exp2(5.6)));
+    }
+
     TEST_CASE(log)
     {
         const auto v = math::log(dvec3(1.2, 3.4, 5.6));
@@ -829,6 +878,22 @@ namespace
         test_assert(nearly_equal(v[2], math::log(5.6)));
     }
 
+    TEST_CASE(log2)
+    {
+        const auto v = math::log2(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::log2(1.2)));
+        test_assert(nearly_equal(v[1], math::log2(3.4)));
+        test_assert(nearly_equal(v[2], math::log2(5.6)));
+    }
+
+    TEST_CASE(log10)
+    {
+        const auto v = math::log10(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::log10(1.2)));
+        test_assert(nearly_equal(v[1], math::log10(3.4)));
+        test_assert(nearly_equal(v[2], math::log10(5.6)));
+    }
+
     TEST_CASE(abs)
     {
         const auto v = math::abs(dvec3(1.2, -3.4, 5.6));
@@ -862,6 +927,14 @@ namespace
         test_assert(nearly_equal(v[2], math::sqrt(5.6)));
     }
 
+    TEST_CASE(cbrt)
+    {
+        const auto v = math::cbrt(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::cbrt(1.2)));
+        test_assert(nearly_equal(v[1], math::cbrt(3.4)));
+        test_assert(nearly_equal(v[2], math::cbrt(5.6)));
+    }
+
     TEST_CASE(rsqrt)
     {
         const auto v = math::rsqrt(dvec3(1.2, 3.4, 5.6));
@@ -870,6 +943,212 @@ namespace
         test_assert(nearly_equal(v[2], math::rsqrt(5.6)));
     }
 
+    TEST_CASE(fma)
+    {
+        const auto v = math::fma(
+            dvec3(1.2, 3.4, 5.6),
+            dvec3(7.8, 9.10, 11.12),
+            dvec3(13.14, 15.16, 17.18));
+        test_assert(v[0] == math::fma(1.2, 7.8, 13.14));
+        test_assert(v[1] == math::fma(3.4, 9.10, 15.16));
+        test_assert(v[2] == math::fma(5.6, 11.12, 17.18));
+    }
+
+    TEST_CASE(floor)
+    {
+        const auto v = math::floor(dvec3(1.2, 3.4, 5.6));
+        test_assert(v[0] == math::floor(1.2));
+        test_assert(v[1] == math::floor(3.4));
+        test_assert(v[2] == math::floor(5.6));
+    }
+
+    TEST_CASE(ceil)
+    {
+        const auto v = math::ceil(dvec3(1.2, 3.4, 5.6));
+        test_assert(v[0] == math::ceil(1.2));
+        test_assert(v[1] == math::ceil(3.4));
+        test_assert(v[2] == math::ceil(5.6));
+    }
+
+    TEST_CASE(round)
+    {
+        const auto v = math::round(dvec3(1.2, 3.4, 5.6));
+        test_assert(v[0] == math::round(1.2));
+        test_assert(v[1] == math::round(3.4));
+        test_assert(v[2] == math::round(5.6));
+    }
+
+    TEST_CASE(trunc)
+    {
+        const auto v = math::trunc(dvec3(1.2, 3.4, 5.6));
+        test_assert(v[0] == math::trunc(1.2));
+        test_assert(v[1] == math::trunc(3.4));
+        test_assert(v[2] == math::trunc(5.6));
+    }
+
+    TEST_CASE(fract)
+    {
+        const auto v = math::fract(dvec3(1.2, 3.4, 5.6));
+        test_assert(v[0] == math::fract(1.2));
+        test_assert(v[1] == math::fract(3.4));
+        test_assert(v[2] == math::fract(5.6));
+    }
+
+    TEST_CASE(modf)
+    {
+        dvec3 i;
+        double i0, i1, i2;
+        const auto v = math::modf(dvec3(1.2, 3.4, 5.6), i);
+        test_assert(v[0] == math::modf(1.2, i0));
+        test_assert(i[0] == i0);
+        test_assert(v[1] == math::modf(3.4, i1));
+        test_assert(i[1] == i1);
+        test_assert(v[2] == math::modf(5.6, i2));
+        test_assert(i[2] == i2);
+    }
+
+    TEST_CASE(fast_sin)
+    {
+        const auto v = math::fast::sin(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::sin(1.2)));
+        test_assert(nearly_equal(v[1], math::sin(3.4)));
+        test_assert(nearly_equal(v[2], math::sin(5.6)));
+    }
+
+    TEST_CASE(fast_cos)
+    {
+        const auto v = math::fast::cos(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::cos(1.2)));
+        test_assert(nearly_equal(v[1], math::cos(3.4)));
+        test_assert(nearly_equal(v[2], math::cos(5.6)));
+    }
+
+    TEST_CASE(fast_sincos)
+    {
+        dvec3 s, c;
+        math::fast::sincos(dvec3(1.2, 3.4, 5.6), s, c);
+
+        test_assert(nearly_equal(s[0], math::sin(1.2)));
+        test_assert(nearly_equal(s[1], math::sin(3.4)));
+        test_assert(nearly_equal(s[2], math::sin(5.6)));
+
+        test_assert(nearly_equal(c[0], math::cos(1.2)));
+        test_assert(nearly_equal(c[1], math::cos(3.4)));
+        test_assert(nearly_equal(c[2], math::cos(5.6)));
+    }
+
+    TEST_CASE(fast_exp)
+    {
+        const auto v = math::fast::exp(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::exp(1.2)));
+        test_assert(nearly_equal(v[1], math::exp(3.4)));
+        test_assert(nearly_equal(v[2], math::exp(5.6)));
+    }
+
+    TEST_CASE(fast_log)
+    {
+        const auto v = math::fast::log(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::log(1.2)));
+        test_assert(nearly_equal(v[1], math::log(3.4)));
+        test_assert(nearly_equal(v[2], math::log(5.6)));
+    }
+
+    TEST_CASE(fast_pow)
+    {
+        const auto v = math::fast::pow(
+            dvec3(1.2, 3.4, 5.6), dvec3(7.8, 9.10, 11.12));
+        test_assert(nearly_equal(v[0], math::pow(1.2, 7.8)));
+        test_assert(nearly_equal(v[1], math::pow(3.4, 9.10)));
+        test_assert(nearly_equal(v[2], math::pow(5.6, 11.12)));
+    }
+
+    TEST_CASE(fast_recip)
+    {
+        const auto v = math::fast::recip(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::recip(1.2)));
+        test_assert(nearly_equal(v[1], math::recip(3.4)));
+        test_assert(nearly_equal(v[2], math::recip(5.6)));
+    }
+
+    TEST_CASE(fast_rsqrt)
+    {
+        const auto v = math::fast::rsqrt(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::rsqrt(1.2)));
+        test_assert(nearly_equal(v[1], math::rsqrt(3.4)));
+        test_assert(nearly_equal(v[2], math::rsqrt(5.6)));
+    }
+
+    TEST_CASE(precise_sin)
+    {
+        const auto v = math::precise::sin(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::sin(1.2)));
+        test_assert(nearly_equal(v[1], math::sin(3.4)));
+        test_assert(nearly_equal(v[2], math::sin(5.6)));
+    }
+
+    TEST_CASE(precise_cos)
+    {
+        const auto v = math::precise::cos(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::cos(1.2)));
+        test_assert(nearly_equal(v[1], math::cos(3.4)));
+        test_assert(nearly_equal(v[2], math::cos(5.6)));
+    }
+
+    TEST_CASE(precise_sincos)
+    {
+        dvec3 s, c;
+        math::precise::sincos(dvec3(1.2, 3.4, 5.6), s, c);
+
+        test_assert(nearly_equal(s[0], math::sin(1.2)));
+        test_assert(nearly_equal(s[1], math::sin(3.4)));
+        test_assert(nearly_equal(s[2], math::sin(5.6)));
+
+        test_assert(nearly_equal(c[0], math::cos(1.2)));
+        test_assert(nearly_equal(c[1], math::cos(3.4)));
+        test_assert(nearly_equal(c[2], math::cos(5.6)));
+    }
+
+    TEST_CASE(precise_exp)
+    {
+        const auto v = math::precise::exp(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::exp(1.2)));
+        test_assert(nearly_equal(v[1], math::exp(3.4)));
+        test_assert(nearly_equal(v[2], math::exp(5.6)));
+    }
+
+    TEST_CASE(precise_log)
+    {
+        const auto v = math::precise::log(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::log(1.2)));
+        test_assert(nearly_equal(v[1], math::log(3.4)));
+        test_assert(nearly_equal(v[2], math::log(5.6)));
+    }
+
+    TEST_CASE(precise_pow)
+    {
+        const auto v = math::precise::pow(
+            dvec3(1.2, 3.4, 5.6), dvec3(7.8, 9.10, 11.12));
+        test_assert(nearly_equal(v[0], math::pow(1.2, 7.8)));
+        test_assert(nearly_equal(v[1], math::pow(3.4, 9.10)));
+        test_assert(nearly_equal(v[2], math::pow(5.6, 11.12)));
+    }
+
+    TEST_CASE(precise_recip)
+    {
+        const auto v = math::precise::recip(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::recip(1.2)));
+        test_assert(nearly_equal(v[1], math::recip(3.4)));
+        test_assert(nearly_equal(v[2], math::recip(5.6)));
+    }
+
+    TEST_CASE(precise_rsqrt)
+    {
+        const auto v = math::precise::rsqrt(dvec3(1.2, 3.4, 5.6));
+        test_assert(nearly_equal(v[0], math::rsqrt(1.2)));
+        test_assert(nearly_equal(v[1], math::rsqrt(3.4)));
+        test_assert(nearly_equal(v[2], math::rsqrt(5.6)));
+    }
+
     TEST_CASE(min)
     {
         const auto v = math::min(
@@ -993,6 +993,52 @@ namespace
         test_assert(nearly_equal(c[3], math::cos(7.8)));
     }
 
+    TEST_CASE(tan)
+    {
+        const auto v = math::tan(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::tan(1.2)));
+        test_assert(nearly_equal(v[1], math::tan(3.4)));
+        test_assert(nearly_equal(v[2], math::tan(5.6)));
+        test_assert(nearly_equal(v[3], math::tan(7.8)));
+    }
+
+    TEST_CASE(asin)
+    {
+        const auto v = math::asin(dvec4(0.12, 0.34, 0.56, 0.78));
+        test_assert(nearly_equal(v[0], math::asin(0.12)));
+        test_assert(nearly_equal(v[1], math::asin(0.34)));
+        test_assert(nearly_equal(v[2], math::asin(0.56)));
+        test_assert(nearly_equal(v[3], math::asin(0.78)));
+    }
+
+    TEST_CASE(acos)
+    {
+        const auto v = math::acos(dvec4(0.12, 0.34, 0.56, 0.78));
+        test_assert(nearly_equal(v[0], math::acos(0.12)));
+        test_assert(nearly_equal(v[1], math::acos(0.34)));
+        test_assert(nearly_equal(v[2], math::acos(0.56)));
+        test_assert(nearly_equal(v[3], math::acos(0.78)));
+    }
+
+    TEST_CASE(atan)
+    {
+        const auto v = math::atan(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::atan(1.2)));
+        test_assert(nearly_equal(v[1], math::atan(3.4)));
+        test_assert(nearly_equal(v[2], math::atan(5.6)));
+        test_assert(nearly_equal(v[3], math::atan(7.8)));
+    }
+
+    TEST_CASE(atan2)
+    {
+        const auto v = math::atan2(
+            dvec4(1.2, 3.4, 5.6, 7.8), dvec4(9.10, 11.12, 13.14, 15.16));
+        test_assert(nearly_equal(v[0], math::atan2(1.2, 9.10)));
+        test_assert(nearly_equal(v[1], math::atan2(3.4, 11.12)));
+        test_assert(nearly_equal(v[2], math::atan2(5.6, 13.14)));
+        test_assert(nearly_equal(v[3], math::atan2(7.8, 15.16)));
+    }
+
     TEST_CASE(exp)
     {
         const auto v = math::exp(dvec4(1.2, 3.4, 5.6, 7.8));
@@ -1002,6 +1048,15 @@ namespace
         test_assert(nearly_equal(v[3], math::exp(7.8)));
     }
 
+    TEST_CASE(exp2)
+    {
+        const auto v = math::exp2(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::exp2(1.2)));
+        test_assert(nearly_equal(v[1], math::exp2(3.4)));
+        test_assert(nearly_equal(v[2], math::exp2(5.6)));
+        test_assert(nearly_equal(v[3], math::exp2(7.8)));
+    }
+
     TEST_CASE(log)
     {
         const auto v = math::log(dvec4(1.2, 3.4, 5.6, 7.8));
@@ -1011,6 +1066,24 @@ namespace
         test_assert(nearly_equal(v[3], math::log(7.8)));
     }
 
+    TEST_CASE(log2)
+    {
+        const auto v = math::log2(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::log2(1.2)));
+        test_assert(nearly_equal(v[1], math::log2(3.4)));
+        test_assert(nearly_equal(v[2], math::log2(5.6)));
+        test_assert(nearly_equal(v[3], math::log2(7.8)));
+    }
+
+    TEST_CASE(log10)
+    {
+        const auto v = math::log10(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::log10(1.2)));
+        test_assert(nearly_equal(v[1], math::log10(3.4)));
+        test_assert(nearly_equal(v[2], math::log10(5.6)));
+        test_assert(nearly_equal(v[3], math::log10(7.8)));
+    }
+
     TEST_CASE(abs)
     {
         const auto v = math::abs(dvec4(1.2, -3.4, 5.6, -7.8));
@@ -1048,6 +1121,15 @@ namespace
         test_assert(nearly_equal(v[3], math::sqrt(7.8)));
     }
 
+    TEST_CASE(cbrt)
+    {
+        const auto v = math::cbrt(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::cbrt(1.2)));
+        test_assert(nearly_equal(v[1], math::cbrt(3.4)));
+        test_assert(nearly_equal(v[2], math::cbrt(5.6)));
+        test_assert(nearly_equal(v[3], math::cbrt(7.8)));
+    }
+
     TEST_CASE(rsqrt)
     {
         const auto v = math::rsqrt(dvec4(1.2, 3.4, 5.6, 7.8));
@@ -1057,6 +1139,238 @@ namespace
         test_assert(nearly_equal(v[3], math::rsqrt(7.8)));
     }
 
+    TEST_CASE(fma)
+    {
+        const auto v = math::fma(
+            dvec4(1.2, 3.4, 5.6, 7.8),
+            dvec4(9.10, 11.12, 13.14, 15.16),
+            dvec4(17.18, 19.20, 21.22, 23.24));
+        test_assert(v[0] == math::fma(1.2, 9.10, 17.18));
+        test_assert(v[1] == math::fma(3.4, 11.12, 19.20));
+        test_assert(v[2] == math::fma(5.6, 13.14, 21.22));
+        test_assert(v[3] == math::fma(7.8, 15.16, 23.24));
+    }
+
+    TEST_CASE(floor)
+    {
+        const auto v = math::floor(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(v[0] == math::floor(1.2));
+        test_assert(v[1] == math::floor(3.4));
+        test_assert(v[2] == math::floor(5.6));
+        test_assert(v[3] == math::floor(7.8));
+    }
+
+    TEST_CASE(ceil)
+    {
+        const auto v = math::ceil(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(v[0] == math::ceil(1.2));
+        test_assert(v[1] == math::ceil(3.4));
+        test_assert(v[2] == math::ceil(5.6));
+        test_assert(v[3] == math::ceil(7.8));
+    }
+
+    TEST_CASE(round)
+    {
+        const auto v = math::round(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(v[0] == math::round(1.2));
+        test_assert(v[1] == math::round(3.4));
+        test_assert(v[2] == math::round(5.6));
+        test_assert(v[3] == math::round(7.8));
+    }
+
+    TEST_CASE(trunc)
+    {
+        const auto v = math::trunc(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(v[0] == math::trunc(1.2));
+        test_assert(v[1] == math::trunc(3.4));
+        test_assert(v[2] == math::trunc(5.6));
+        test_assert(v[3] == math::trunc(7.8));
+    }
+
+    TEST_CASE(fract)
+    {
+        const auto v = math::fract(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(v[0] == math::fract(1.2));
+        test_assert(v[1] == math::fract(3.4));
+        test_assert(v[2] == math::fract(5.6));
+        test_assert(v[3] == math::fract(7.8));
+    }
+
+    TEST_CASE(modf)
+    {
+        dvec4 i;
+        double i0, i1, i2, i3;
+        const auto v = math::modf(dvec4(1.2, 3.4, 5.6, 7.8), i);
+        test_assert(v[0] == math::modf(1.2, i0));
+        test_assert(i[0] == i0);
+        test_assert(v[1] == math::modf(3.4, i1));
+        test_assert(i[1] == i1);
+        test_assert(v[2] == math::modf(5.6, i2));
+        test_assert(i[2] == i2);
+        test_assert(v[3] == math::modf(7.8, i3));
+        test_assert(i[3] == i3);
+    }
+
+    TEST_CASE(fast_sin)
+    {
+        const auto v = math::fast::sin(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::sin(1.2)));
+        test_assert(nearly_equal(v[1], math::sin(3.4)));
+        test_assert(nearly_equal(v[2], math::sin(5.6)));
+        test_assert(nearly_equal(v[3], math::sin(7.8)));
+    }
+
+    TEST_CASE(fast_cos)
+    {
+        const auto v = math::fast::cos(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::cos(1.2)));
+        test_assert(nearly_equal(v[1], math::cos(3.4)));
+        test_assert(nearly_equal(v[2], math::cos(5.6)));
+        test_assert(nearly_equal(v[3], math::cos(7.8)));
+    }
+
+    TEST_CASE(fast_sincos)
+    {
+        dvec4 s, c;
+        math::fast::sincos(dvec4(1.2, 3.4, 5.6, 7.8), s, c);
+
+        test_assert(nearly_equal(s[0], math::sin(1.2)));
+        test_assert(nearly_equal(s[1], math::sin(3.4)));
+        test_assert(nearly_equal(s[2], math::sin(5.6)));
+        test_assert(nearly_equal(s[3], math::sin(7.8)));
+
+        test_assert(nearly_equal(c[0], math::cos(1.2)));
+        test_assert(nearly_equal(c[1], math::cos(3.4)));
+        test_assert(nearly_equal(c[2], math::cos(5.6)));
+        test_assert(nearly_equal(c[3], math::cos(7.8)));
+    }
+
+    TEST_CASE(fast_exp)
+    {
+        const auto v = math::fast::exp(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::exp(1.2)));
+        test_assert(nearly_equal(v[1], math::exp(3.4)));
+        test_assert(nearly_equal(v[2], math::exp(5.6)));
+        test_assert(nearly_equal(v[3], math::exp(7.8)));
+    }
+
+    TEST_CASE(fast_log)
+    {
+        const auto v = math::fast::log(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::log(1.2)));
+        test_assert(nearly_equal(v[1], math::log(3.4)));
+        test_assert(nearly_equal(v[2], math::log(5.6)));
+        test_assert(nearly_equal(v[3], math::log(7.8)));
+    }
+
+    TEST_CASE(fast_pow)
+    {
+        const auto v = math::fast::pow(
+            dvec4(1.2, 3.4, 5.6, 7.8), dvec4(9.10, 11.12, 13.14, 15.16));
+        test_assert(nearly_equal(v[0], math::pow(1.2, 9.10)));
+        test_assert(nearly_equal(v[1], math::pow(3.4, 11.12)));
+        test_assert(nearly_equal(v[2], math::pow(5.6, 13.14)));
+        test_assert(nearly_equal(v[3], math::pow(7.8, 15.16)));
+    }
+
+    TEST_CASE(fast_recip)
+    {
+        const auto v = math::fast::recip(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::recip(1.2)));
+        test_assert(nearly_equal(v[1], math::recip(3.4)));
+        test_assert(nearly_equal(v[2], math::recip(5.6)));
+        test_assert(nearly_equal(v[3], math::recip(7.8)));
+    }
+
+    TEST_CASE(fast_rsqrt)
+    {
+        const auto v = math::fast::rsqrt(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::rsqrt(1.2)));
+        test_assert(nearly_equal(v[1], math::rsqrt(3.4)));
+        test_assert(nearly_equal(v[2], math::rsqrt(5.6)));
+        test_assert(nearly_equal(v[3], math::rsqrt(7.8)));
+    }
+
+    TEST_CASE(precise_sin)
+    {
+        const auto v = math::precise::sin(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::sin(1.2)));
+        test_assert(nearly_equal(v[1], math::sin(3.4)));
+        test_assert(nearly_equal(v[2], math::sin(5.6)));
+        test_assert(nearly_equal(v[3], math::sin(7.8)));
+    }
+
+    TEST_CASE(precise_cos)
+    {
+        const auto v = math::precise::cos(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::cos(1.2)));
+        test_assert(nearly_equal(v[1], math::cos(3.4)));
+        test_assert(nearly_equal(v[2], math::cos(5.6)));
+        test_assert(nearly_equal(v[3], math::cos(7.8)));
+    }
+
+    TEST_CASE(precise_sincos)
+    {
+        dvec4 s, c;
+        math::precise::sincos(dvec4(1.2, 3.4, 5.6, 7.8), s, c);
+
+        test_assert(nearly_equal(s[0], math::sin(1.2)));
+        test_assert(nearly_equal(s[1], math::sin(3.4)));
+        test_assert(nearly_equal(s[2], math::sin(5.6)));
+        test_assert(nearly_equal(s[3], math::sin(7.8)));
+
+        test_assert(nearly_equal(c[0], math::cos(1.2)));
+        test_assert(nearly_equal(c[1], math::cos(3.4)));
+        test_assert(nearly_equal(c[2], math::cos(5.6)));
+        test_assert(nearly_equal(c[3], math::cos(7.8)));
+    }
+
+    TEST_CASE(precise_exp)
+    {
+        const auto v = math::precise::exp(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::exp(1.2)));
+        test_assert(nearly_equal(v[1], math::exp(3.4)));
+        test_assert(nearly_equal(v[2], math::exp(5.6)));
+        test_assert(nearly_equal(v[3], math::exp(7.8)));
+    }
+
+    TEST_CASE(precise_log)
+    {
+        const auto v = math::precise::log(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::log(1.2)));
+        test_assert(nearly_equal(v[1], math::log(3.4)));
+        test_assert(nearly_equal(v[2], math::log(5.6)));
+        test_assert(nearly_equal(v[3], math::log(7.8)));
+    }
+
+    TEST_CASE(precise_pow)
+    {
+        const auto v = math::precise::pow(
+            dvec4(1.2, 3.4, 5.6, 7.8), dvec4(9.10, 11.12, 13.14, 15.16));
+        test_assert(nearly_equal(v[0], math::pow(1.2, 9.10)));
+        test_assert(nearly_equal(v[1], math::pow(3.4, 11.12)));
+        test_assert(nearly_equal(v[2], math::pow(5.6, 13.14)));
+        test_assert(nearly_equal(v[3], math::pow(7.8, 15.16)));
+    }
+
+    TEST_CASE(precise_recip)
+    {
+        const auto v = math::precise::recip(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::recip(1.2)));
+        test_assert(nearly_equal(v[1], math::recip(3.4)));
+        test_assert(nearly_equal(v[2], math::recip(5.6)));
+        test_assert(nearly_equal(v[3], math::recip(7.8)));
+    }
+
+    TEST_CASE(precise_rsqrt)
+    {
+        const auto v = math::precise::rsqrt(dvec4(1.2, 3.4, 5.6, 7.8));
+        test_assert(nearly_equal(v[0], math::rsqrt(1.2)));
+        test_assert(nearly_equal(v[1], math::rsqrt(3.4)));
+        test_assert(nearly_equal(v[2], math::rsqrt(5.6)));
+        test_assert(nearly_equal(v[3], math::rsqrt(7.8)));
+    }
+
     TEST_CASE(min)
     {
         const auto v = math::min(